@@ -25,6 +25,7 @@ map<QString, vector<QColor>> BaseObjectView::color_config;
 unsigned BaseObjectView::global_sel_order=1;
 bool BaseObjectView::use_placeholder=true;
 bool BaseObjectView::compact_view=false;
+bool BaseObjectView::objs_style_loaded=false;
 
 BaseObjectView::BaseObjectView(BaseObject *object)
 {
@@ -268,6 +269,8 @@ void BaseObjectView::loadObjectsStyle(void)
 			}
 			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
+
+		objs_style_loaded=true;
 	}
 	catch(Exception &e)
 	{
@@ -275,6 +278,11 @@ void BaseObjectView::loadObjectsStyle(void)
 	}
 }
 
+bool BaseObjectView::isObjectsStyleLoaded(void)
+{
+	return(objs_style_loaded);
+}
+
 void BaseObjectView::setFontStyle(const QString &id, QTextCharFormat font_fmt)
 {
 	QFont font;
@@ -658,3 +666,17 @@ double BaseObjectView::getScreenDpiFactor(void)
 
 	return(factor * pixel_ratio);
 }
+
+void BaseObjectView::setItemCacheable(QGraphicsItem *item)
+{
+	if(!item)
+		return;
+
+	item->setData(CACHEABLE_ITEM_KEY, true);
+	item->setCacheMode(QGraphicsItem::DeviceCoordinateCache);
+}
+
+bool BaseObjectView::isItemCacheable(QGraphicsItem *item)
+{
+	return(item && item->data(CACHEABLE_ITEM_KEY).toBool());
+}
@@ -35,6 +35,9 @@ class BaseObjectView: public QObject, public QGraphicsItemGroup {
 	private:
 		Q_OBJECT
 
+		//! \brief Key of the item's data used to mark the children items that can be cached (see setItemCacheable())
+		static constexpr int CACHEABLE_ITEM_KEY=1;
+
 	protected:
 		/*! \brief Indicates if the placeholder object must be used when moving objects.
 		Place holder objects when enabled causes a significant performance gain mainly when
@@ -91,6 +94,9 @@ class BaseObjectView: public QObject, public QGraphicsItemGroup {
 		//! \brief Stores the object colors configuration
 		static map<QString, vector<QColor>> color_config;
 
+		//! \brief Indicates that the font / color styles were loaded at least once (see loadObjectsStyle())
+		static bool objs_style_loaded;
+
 		//! \brief Resizes to the specified dimension the passed polygon
 		void resizePolygon(QPolygonF &pol, double width, double height);
 
@@ -138,6 +144,9 @@ class BaseObjectView: public QObject, public QGraphicsItemGroup {
 		//! \brief Loads the font / color styels for the objects from a XML configuration file
 		static void loadObjectsStyle(void);
 
+		//! \brief Returns if the objects style was already loaded from the configuration file
+		static bool isObjectsStyleLoaded(void);
+
 		//! \brief Returns the objects bounding rect in local coordination
 		QRectF boundingRect(void) const;
 
@@ -192,6 +201,15 @@ class BaseObjectView: public QObject, public QGraphicsItemGroup {
 		//! \brief Returns the current factor between the default font size and the current defined one
 		static double getFontFactor(void);
 
+		/*! \brief Enables the device coordinate caching on the provided item marking it as cacheable.
+		 * This is used on the static children items (texts, bodies) whose drawing is expensive so the
+		 * scene repaint is faster when panning the view. Note that the cache applies only to the item's own painting
+		 * so it must be used on the leaf items and not on the groups (see ObjectsScene::setItemsCacheEnabled) */
+		static void setItemCacheable(QGraphicsItem *item);
+
+		//! \brief Returns if the provided item was marked as cacheable via setItemCacheable()
+		static bool isItemCacheable(QGraphicsItem *item);
+
 	protected slots:
 		//! \brief Make the basic object operations
 		void __configureObject(void);
@@ -28,11 +28,13 @@ BaseTableView::BaseTableView(BaseTable *base_tab) : BaseObjectView(base_tab)
 
 	body=new RoundedRectItem;
 	body->setRoundedCorners(RoundedRectItem::BOTTOMLEFT_CORNER | RoundedRectItem::BOTTOMRIGHT_CORNER);
+	setItemCacheable(body);
 
 	title=new TableTitleView;
 
 	ext_attribs_body=new RoundedRectItem;
 	ext_attribs_body->setRoundedCorners(RoundedRectItem::NO_CORNERS);
+	setItemCacheable(ext_attribs_body);
 
 	ext_attribs_toggler=new RoundedRectItem;
 	ext_attribs_toggler->setRoundedCorners(RoundedRectItem::BOTTOMLEFT_CORNER | RoundedRectItem::BOTTOMRIGHT_CORNER);
@@ -53,6 +55,12 @@ BaseTableView::BaseTableView(BaseTable *base_tab) : BaseObjectView(base_tab)
 	tag_body=new QGraphicsPolygonItem;
 	tag_body->setZValue(2);
 
+	cols_count_txt=new QGraphicsSimpleTextItem;
+	cols_count_txt->setZValue(1);
+	cols_count_txt->setVisible(false);
+	simplified_view=false;
+	ext_attribs_visible=true;
+
 	obj_shadow=new RoundedRectItem;
 	obj_shadow->setZValue(-1);
 
@@ -71,6 +79,7 @@ BaseTableView::BaseTableView(BaseTable *base_tab) : BaseObjectView(base_tab)
 	this->addToGroup(ext_attribs_body);
 	this->addToGroup(ext_attribs_toggler);
 	this->addToGroup(ext_attribs_tog_arrow);
+	this->addToGroup(cols_count_txt);
 
 	this->setAcceptHoverEvents(true);
 	sel_child_obj=nullptr;
@@ -88,6 +97,7 @@ BaseTableView::~BaseTableView(void)
 	this->removeFromGroup(columns);
 	this->removeFromGroup(tag_name);
 	this->removeFromGroup(tag_body);
+	this->removeFromGroup(cols_count_txt);
 	delete(ext_attribs_tog_arrow);
 	delete(ext_attribs_toggler);
 	delete(ext_attribs_body);
@@ -97,6 +107,7 @@ BaseTableView::~BaseTableView(void)
 	delete(columns);
 	delete(tag_name);
 	delete(tag_body);
+	delete(cols_count_txt);
 }
 
 void BaseTableView::setHideExtAttributes(bool value)
@@ -438,6 +449,8 @@ void BaseTableView::__configureObject(float width)
 		body->setRoundedCorners(RoundedRectItem::NO_CORNERS);
 	}
 
+	ext_attribs_visible=ext_attribs->isVisible();
+
 	this->table_tooltip=this->getSourceObject()->getName(true) +
 						QString(" (") + this->getSourceObject()->getTypeName() + QString(") \n") +
 						QString("Id: %1\n").arg(this->getSourceObject()->getObjectId()) +
@@ -446,6 +459,7 @@ void BaseTableView::__configureObject(float width)
 						TableObjectView::CONSTR_DELIM_END;
 
 	this->setToolTip(this->table_tooltip);
+	configureSimplifiedView();
 }
 
 float BaseTableView::calculateWidth(void)
@@ -482,3 +496,48 @@ void BaseTableView::togglePlaceholder(bool value)
 	BaseObjectView::togglePlaceholder(!connected_rels.empty() && value);
 }
 
+void BaseTableView::setSimplifiedView(bool value)
+{
+	if(simplified_view==value)
+		return;
+
+	simplified_view=value;
+	configureSimplifiedView();
+}
+
+bool BaseTableView::isSimplifiedView(void)
+{
+	return(simplified_view);
+}
+
+void BaseTableView::configureSimplifiedView(void)
+{
+	/* The hidden items (and their children) are neither painted nor hit-tested by the scene. The extended attributes
+	 * are restored to the visibility determined by the last configuration since it also defines the table's geometry */
+	columns->setVisible(!simplified_view);
+	ext_attribs->setVisible(!simplified_view && ext_attribs_visible);
+	obj_shadow->setVisible(!simplified_view);
+	cols_count_txt->setVisible(simplified_view);
+
+	if(simplified_view)
+	{
+		QFont fnt=BaseObjectView::getFontStyle(ParsersAttributes::GLOBAL).font();
+		QRectF rect=QRectF(body->pos(), body->boundingRect().size());
+		double scale=1;
+
+		fnt.setBold(true);
+		cols_count_txt->setFont(fnt);
+		cols_count_txt->setBrush(BaseObjectView::getFontStyle(ParsersAttributes::COLUMN).foreground());
+		cols_count_txt->setText(QString::number(columns->childItems().size()));
+		cols_count_txt->setScale(1);
+
+		//Scaling the text so it fills the most part of the body and remains legible in low zoom factors
+		if(cols_count_txt->boundingRect().width() > 0 && cols_count_txt->boundingRect().height() > 0)
+			scale=qMin((rect.width() * 0.50f) / cols_count_txt->boundingRect().width(),
+								 (rect.height() * 0.80f) / cols_count_txt->boundingRect().height());
+
+		cols_count_txt->setScale(scale);
+		cols_count_txt->setPos(rect.left() + ((rect.width() - (cols_count_txt->boundingRect().width() * scale)) / 2),
+													 rect.top() + ((rect.height() - (cols_count_txt->boundingRect().height() * scale)) / 2));
+	}
+}
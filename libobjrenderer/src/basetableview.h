@@ -58,7 +58,18 @@ class BaseTableView: public BaseObjectView {
 
 		QGraphicsPolygonItem *tag_body, *ext_attribs_tog_arrow;
 
-		QGraphicsSimpleTextItem *tag_name;
+		QGraphicsSimpleTextItem *tag_name,
+
+		//! \brief Text that shows the amount of columns in the body when the simplified view is used
+		*cols_count_txt;
+
+		/*! \brief Indicates that the table is drawn in a simplified form (title and columns count only).
+		 * This is used as a level of detail when the scene is zoomed out (see ObjectsScene::setSimplifiedView) */
+		bool simplified_view,
+
+		/*! \brief Stores the visibility of the extended attributes determined by the last configuration of the table,
+		 * restored when the simplified view is turned off (in simplified view the extended attributes are always hidden) */
+		ext_attribs_visible;
 
 		//! \brief Stores the reference to the child object currently selected on table
 		TableObject *sel_child_obj;
@@ -87,6 +98,9 @@ class BaseTableView: public BaseObjectView {
 		//! \brief Determines the table width based upon its subsection (title, body and extended attribs)
 		float calculateWidth(void);
 
+		//! \brief Configures the children objects according to the current simplified view state
+		void configureSimplifiedView(void);
+
 	public:
 		static const unsigned LEFT_CONN_POINT=0,
 		RIGHT_CONN_POINT=1;
@@ -121,6 +135,12 @@ class BaseTableView: public BaseObjectView {
 
 		unsigned getConnectedRelsCount(BaseTable *src_tab, BaseTable *dst_tab);
 
+		//! \brief Toggles the simplified view of the table (see ObjectsScene::setSimplifiedView)
+		void setSimplifiedView(bool value);
+
+		//! \brief Returns if the table is being drawn in the simplified form
+		bool isSimplifiedView(void);
+
 	signals:
 		//! \brief Signal emitted when a table is moved over the scene
 		void s_objectMoved(void);
@@ -0,0 +1,822 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+#include "layoutengine.h"
+#include <QThread>
+#include <thread>
+#include <algorithm>
+#include <cmath>
+
+//! \brief Maximum depth of the quadtree. Bodies that reach this depth (coincident centers) are aggregated in the same leaf
+static const unsigned MAX_QUADTREE_DEPTH=24;
+
+//! \brief Maximum amount of passes done by the overlaps removal
+static const unsigned MAX_OVERLAP_PASSES=100;
+
+LayoutEngine::LayoutEngine(QObject *parent) : QObject(parent)
+{
+	algorithm=LAYERED_LAYOUT;
+	spacing=DEFAULT_SPACING;
+	thread_count=0;
+	last_progress=-1;
+	canceled=false;
+}
+
+void LayoutEngine::setGraph(const vector<QRectF> &nodes, const vector<pair<unsigned, unsigned>> &edges)
+{
+	for(auto &edge : edges)
+	{
+		if(edge.first >= nodes.size() || edge.second >= nodes.size())
+			throw Exception(ERR_REF_ELEM_INV_INDEX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	this->nodes=nodes;
+	this->edges=edges;
+	positions.clear();
+	canceled=false;
+}
+
+void LayoutEngine::setAlgorithm(unsigned algorithm)
+{
+	if(algorithm > FORCE_DIRECTED_LAYOUT)
+		throw Exception(ERR_REF_ELEM_INV_INDEX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	this->algorithm=algorithm;
+}
+
+void LayoutEngine::setSpacing(double spacing)
+{
+	this->spacing=(spacing < 0 ? 0 : spacing);
+}
+
+void LayoutEngine::setThreadCount(unsigned count)
+{
+	thread_count=count;
+}
+
+vector<QPointF> LayoutEngine::getPositions(void)
+{
+	return(positions);
+}
+
+bool LayoutEngine::isLayoutCanceled(void)
+{
+	return(canceled);
+}
+
+void LayoutEngine::cancelLayout(void)
+{
+	canceled=true;
+}
+
+void LayoutEngine::updateProgress(int progress, const QString &msg)
+{
+	if(progress!=last_progress)
+	{
+		last_progress=progress;
+		emit s_progressUpdated(progress, msg);
+	}
+}
+
+void LayoutEngine::computeLayout(void)
+{
+	last_progress=-1;
+	positions.clear();
+
+	for(auto &rect : nodes)
+		positions.push_back(rect.topLeft());
+
+	if(!nodes.empty())
+	{
+		if(algorithm==FORCE_DIRECTED_LAYOUT)
+			computeForceDirectedLayout();
+		else
+			computeLayeredLayout();
+	}
+
+	if(canceled)
+		emit s_layoutCanceled();
+	else
+	{
+		updateProgress(100, trUtf8("Layout computed successfully."));
+		emit s_layoutFinished();
+	}
+}
+
+vector<vector<unsigned>> LayoutEngine::getAdjacencyLists(bool directed)
+{
+	vector<vector<unsigned>> adj(nodes.size());
+
+	for(auto &edge : edges)
+	{
+		if(edge.first==edge.second)
+			continue;
+
+		adj[edge.first].push_back(edge.second);
+
+		if(!directed)
+			adj[edge.second].push_back(edge.first);
+	}
+
+	//Several relationships between the same tables are handled as a single edge
+	for(auto &list : adj)
+	{
+		std::sort(list.begin(), list.end());
+		list.erase(std::unique(list.begin(), list.end()), list.end());
+	}
+
+	return(adj);
+}
+
+QRectF LayoutEngine::getBoundingRect(const vector<unsigned> &node_ids)
+{
+	QRectF rect;
+
+	for(auto id : node_ids)
+		rect=rect.united(QRectF(positions[id], nodes[id].size()));
+
+	return(rect);
+}
+
+void LayoutEngine::placeIsolatedNodes(const vector<unsigned> &isolated, QPointF origin, double max_width)
+{
+	double px=origin.x(), py=origin.y(), max_h=0;
+
+	for(auto id : isolated)
+	{
+		//Starting a new row when the current one is full
+		if(px > origin.x() && (px + nodes[id].width()) > (origin.x() + max_width))
+		{
+			px=origin.x();
+			py+=max_h + spacing;
+			max_h=0;
+		}
+
+		positions[id]=QPointF(px, py);
+		px+=nodes[id].width() + spacing;
+		max_h=std::max(max_h, nodes[id].height());
+	}
+}
+
+void LayoutEngine::computeLayeredLayout(void)
+{
+	unsigned node_cnt=nodes.size(), vnode_cnt=node_cnt, max_layer=0, u=0, v=0, idx=0;
+	vector<vector<unsigned>> succs=getAdjacencyLists(true), dag(node_cnt), layers, up, down;
+	vector<unsigned> degree(node_cnt, 0), isolated, connected, state(node_cnt, 0),
+			stack_nodes, stack_pos, layer_of(node_cnt, 0), in_degree(node_cnt, 0), queue;
+	vector<double> order_pos, bary, xpos, widths;
+	QString msg=trUtf8("Computing the layered layout...");
+
+	for(u=0; u < node_cnt; u++)
+	{
+		degree[u]+=succs[u].size();
+
+		for(auto s : succs[u])
+			degree[s]++;
+	}
+
+	for(u=0; u < node_cnt; u++)
+	{
+		if(degree[u]==0)
+			isolated.push_back(u);
+		else
+			connected.push_back(u);
+	}
+
+	/* Cycle removal: the edges that close a cycle (back edges found in a depth-first search)
+	are reversed so the layering can be done over a directed acyclic graph */
+	for(auto root : connected)
+	{
+		if(state[root]!=0)
+			continue;
+
+		state[root]=1;
+		stack_nodes.push_back(root);
+		stack_pos.push_back(0);
+
+		while(!stack_nodes.empty())
+		{
+			u=stack_nodes.back();
+			idx=stack_pos.back();
+
+			if(idx < succs[u].size())
+			{
+				stack_pos.back()++;
+				v=succs[u][idx];
+
+				if(state[v]==1)
+					dag[v].push_back(u);
+				else
+				{
+					dag[u].push_back(v);
+
+					if(state[v]==0)
+					{
+						state[v]=1;
+						stack_nodes.push_back(v);
+						stack_pos.push_back(0);
+					}
+				}
+			}
+			else
+			{
+				state[u]=2;
+				stack_nodes.pop_back();
+				stack_pos.pop_back();
+			}
+		}
+	}
+
+	//Layer assignment: each node is placed one layer below the deepest of its predecessors (longest path)
+	for(auto &list : dag)
+	{
+		std::sort(list.begin(), list.end());
+		list.erase(std::unique(list.begin(), list.end()), list.end());
+
+		for(auto s : list)
+			in_degree[s]++;
+	}
+
+	for(auto id : connected)
+	{
+		if(in_degree[id]==0)
+			queue.push_back(id);
+	}
+
+	for(idx=0; idx < queue.size(); idx++)
+	{
+		u=queue[idx];
+		max_layer=std::max(max_layer, layer_of[u]);
+
+		for(auto s : dag[u])
+		{
+			layer_of[s]=std::max(layer_of[s], layer_of[u] + 1);
+
+			if(--in_degree[s]==0)
+				queue.push_back(s);
+		}
+	}
+
+	updateProgress(10, msg);
+
+	if(canceled)
+		return;
+
+	/* Edges spanning more than one layer are split by dummy nodes (indexes greater than the amount of nodes)
+	so the crossings can be reduced considering the whole path of the edges */
+	up.resize(node_cnt);
+	down.resize(node_cnt);
+
+	for(auto id : connected)
+	{
+		for(auto s : dag[id])
+		{
+			unsigned prev=id;
+
+			for(unsigned l=layer_of[id] + 1; l < layer_of[s]; l++)
+			{
+				up.push_back({ prev });
+				down.push_back({});
+				layer_of.push_back(l);
+				down[prev].push_back(vnode_cnt);
+				prev=vnode_cnt++;
+			}
+
+			down[prev].push_back(s);
+			up[s].push_back(prev);
+		}
+	}
+
+	//The initial order of each layer follows the current horizontal position of the nodes
+	layers.resize(max_layer + 1);
+	order_pos.resize(vnode_cnt);
+	bary.resize(vnode_cnt);
+
+	for(auto id : connected)
+		bary[id]=nodes[id].center().x();
+
+	for(v=node_cnt; v < vnode_cnt; v++)
+		bary[v]=bary[up[v].front()];
+
+	for(auto id : connected)
+		layers[layer_of[id]].push_back(id);
+
+	for(v=node_cnt; v < vnode_cnt; v++)
+		layers[layer_of[v]].push_back(v);
+
+	auto sort_layer=[&](vector<unsigned> &layer)
+	{
+		std::stable_sort(layer.begin(), layer.end(), [&](unsigned id1, unsigned id2){
+			return(bary[id1] < bary[id2]);
+		});
+
+		for(idx=0; idx < layer.size(); idx++)
+			order_pos[layer[idx]]=idx;
+	};
+
+	auto barycenter=[&](unsigned id, const vector<unsigned> &neighbors, const vector<double> &coords) -> double
+	{
+		double sum=0;
+
+		if(neighbors.empty())
+			return(coords[id]);
+
+		for(auto n : neighbors)
+			sum+=coords[n];
+
+		return(sum/neighbors.size());
+	};
+
+	for(auto &layer : layers)
+		sort_layer(layer);
+
+	//Crossing reduction: the nodes of each layer are sorted by the barycenter of their neighbors in the adjacent layer
+	for(unsigned sweep=0; sweep < CROSSING_SWEEPS && !canceled; sweep++)
+	{
+		for(unsigned l=1; l < layers.size(); l++)
+		{
+			for(auto id : layers[l])
+				bary[id]=barycenter(id, up[id], order_pos);
+
+			sort_layer(layers[l]);
+		}
+
+		for(int l=static_cast<int>(layers.size()) - 2; l >= 0; l--)
+		{
+			for(auto id : layers[l])
+				bary[id]=barycenter(id, down[id], order_pos);
+
+			sort_layer(layers[l]);
+		}
+
+		updateProgress(10 + (60 * (sweep + 1))/CROSSING_SWEEPS, msg);
+	}
+
+	if(canceled)
+		return;
+
+	/* Coordinate assignment: the nodes are packed from left to right and then moved towards the
+	barycenter of their neighbors keeping the order and the minimum spacing between them */
+	xpos.resize(vnode_cnt);
+	widths.resize(vnode_cnt, 0);
+
+	for(auto id : connected)
+		widths[id]=nodes[id].width();
+
+	for(auto &layer : layers)
+	{
+		double px=0;
+
+		for(auto id : layer)
+		{
+			xpos[id]=px + widths[id]/2;
+			px+=widths[id] + spacing;
+		}
+	}
+
+	auto place_layer=[&](vector<unsigned> &layer, const vector<vector<unsigned>> &neighbors)
+	{
+		unsigned cnt=layer.size();
+		vector<double> left(cnt), right(cnt);
+		double sep=0;
+
+		for(idx=0; idx < cnt; idx++)
+			left[idx]=right[idx]=barycenter(layer[idx], neighbors[layer[idx]], xpos);
+
+		//The positions respecting the spacing to the left and to the right are averaged (the spacing is kept in both)
+		for(idx=1; idx < cnt; idx++)
+		{
+			sep=(widths[layer[idx-1]] + widths[layer[idx]])/2 + spacing;
+			left[idx]=std::max(left[idx], left[idx-1] + sep);
+		}
+
+		for(int i=static_cast<int>(cnt) - 2; i >= 0; i--)
+		{
+			sep=(widths[layer[i]] + widths[layer[i+1]])/2 + spacing;
+			right[i]=std::min(right[i], right[i+1] - sep);
+		}
+
+		for(idx=0; idx < cnt; idx++)
+			xpos[layer[idx]]=(left[idx] + right[idx])/2;
+	};
+
+	for(unsigned pass=0; pass < 4 && !canceled; pass++)
+	{
+		for(unsigned l=1; l < layers.size(); l++)
+			place_layer(layers[l], up);
+
+		for(int l=static_cast<int>(layers.size()) - 2; l >= 0; l--)
+			place_layer(layers[l], down);
+
+		updateProgress(70 + (25 * (pass + 1))/4, msg);
+	}
+
+	if(canceled)
+		return;
+
+	double min_x=0, py=DEFAULT_SPACING, layer_h=0;
+
+	if(!connected.empty())
+	{
+		min_x=xpos[connected.front()] - widths[connected.front()]/2;
+
+		for(auto id : connected)
+			min_x=std::min(min_x, xpos[id] - widths[id]/2);
+	}
+
+	for(auto &layer : layers)
+	{
+		layer_h=0;
+
+		for(auto id : layer)
+		{
+			if(id >= node_cnt)
+				continue;
+
+			positions[id]=QPointF(xpos[id] - widths[id]/2 - min_x + DEFAULT_SPACING, py);
+			layer_h=std::max(layer_h, nodes[id].height());
+		}
+
+		//Layers are more spaced than the nodes in the same layer to give room to the relationship lines
+		py+=layer_h + (spacing * 2);
+	}
+
+	QRectF rect=getBoundingRect(connected);
+	placeIsolatedNodes(isolated, QPointF(DEFAULT_SPACING, connected.empty() ? DEFAULT_SPACING : rect.bottom() + (spacing * 2)),
+										 std::max(rect.width(), 2000.0));
+}
+
+void LayoutEngine::buildQuadTree(const vector<QPointF> &centers, vector<QuadNode> &tree)
+{
+	double min_x=0, min_y=0, max_x=0, max_y=0;
+	int idx=0, child=0, old_body=0;
+	unsigned depth=0;
+
+	auto new_node=[&](double cx, double cy, double half)
+	{
+		QuadNode node;
+
+		node.cx=cx;
+		node.cy=cy;
+		node.half=half;
+		node.mass=node.mx=node.my=0;
+		node.body=-1;
+		node.children[0]=node.children[1]=node.children[2]=node.children[3]=-1;
+		tree.push_back(node);
+	};
+
+	auto child_for=[&](int node_idx, const QPointF &pnt)
+	{
+		return(tree[node_idx].children[(pnt.x() >= tree[node_idx].cx ? 1 : 0) + (pnt.y() >= tree[node_idx].cy ? 2 : 0)]);
+	};
+
+	auto add_mass=[&](int node_idx, const QPointF &pnt)
+	{
+		QuadNode &node=tree[node_idx];
+
+		node.mx=((node.mx * node.mass) + pnt.x())/(node.mass + 1);
+		node.my=((node.my * node.mass) + pnt.y())/(node.mass + 1);
+		node.mass++;
+	};
+
+	tree.clear();
+
+	if(centers.empty())
+		return;
+
+	min_x=max_x=centers.front().x();
+	min_y=max_y=centers.front().y();
+
+	for(auto &pnt : centers)
+	{
+		min_x=std::min(min_x, pnt.x());
+		min_y=std::min(min_y, pnt.y());
+		max_x=std::max(max_x, pnt.x());
+		max_y=std::max(max_y, pnt.y());
+	}
+
+	tree.reserve(centers.size() * 4);
+	new_node((min_x + max_x)/2, (min_y + max_y)/2, (std::max(max_x - min_x, max_y - min_y)/2) + 1);
+
+	for(int body=0; body < static_cast<int>(centers.size()); body++)
+	{
+		idx=0;
+		depth=0;
+
+		while(true)
+		{
+			add_mass(idx, centers[body]);
+
+			if(tree[idx].children[0] < 0)
+			{
+				//Empty leaf (the mass was zero before adding the body)
+				if(tree[idx].mass==1)
+				{
+					tree[idx].body=body;
+					break;
+				}
+
+				//Coincident bodies are kept aggregated in the leaf
+				if(depth >= MAX_QUADTREE_DEPTH)
+					break;
+
+				//Splitting the leaf and moving the body stored in it to the proper child
+				old_body=tree[idx].body;
+				tree[idx].body=-1;
+
+				for(unsigned quad=0; quad < 4; quad++)
+				{
+					double half=tree[idx].half/2;
+
+					tree[idx].children[quad]=tree.size();
+					new_node(tree[idx].cx + (quad & 1 ? half : -half),
+									 tree[idx].cy + (quad & 2 ? half : -half), half);
+				}
+
+				child=child_for(idx, centers[old_body]);
+				add_mass(child, centers[old_body]);
+				tree[child].body=old_body;
+			}
+
+			idx=child_for(idx, centers[body]);
+			depth++;
+		}
+	}
+}
+
+QPointF LayoutEngine::computeRepulsion(const vector<QuadNode> &tree, const vector<QPointF> &centers, unsigned body, double k2)
+{
+	int stack[(MAX_QUADTREE_DEPTH + 1) * 4], top=0;
+	double dx=0, dy=0, dist2=0, dist=0, mass=0, force=0,
+			theta2=BARNES_HUT_THETA * BARNES_HUT_THETA, fx=0, fy=0;
+	const QPointF &pnt=centers[body];
+	bool is_leaf=false;
+
+	if(tree.empty())
+		return(QPointF());
+
+	stack[top++]=0;
+
+	while(top > 0)
+	{
+		const QuadNode &node=tree[stack[--top]];
+
+		if(node.mass==0)
+			continue;
+
+		is_leaf=node.children[0] < 0;
+
+		if(is_leaf && node.body==static_cast<int>(body) && node.mass==1)
+			continue;
+
+		dx=pnt.x() - node.mx;
+		dy=pnt.y() - node.my;
+		dist2=(dx * dx) + (dy * dy);
+
+		//Distant nodes are handled as a single body placed at their center of mass
+		if(is_leaf || (4 * node.half * node.half) < (theta2 * dist2))
+		{
+			mass=node.mass;
+
+			//Coincident bodies are pushed apart in a direction that depends on the body index (golden angle)
+			if(dist2 < 0.01)
+			{
+				dx=cos(body * 2.399963);
+				dy=sin(body * 2.399963);
+				dist2=1;
+
+				if(node.body==static_cast<int>(body))
+					mass--;
+			}
+
+			dist=sqrt(dist2);
+			force=(k2 * mass)/dist;
+			fx+=(dx/dist) * force;
+			fy+=(dy/dist) * force;
+		}
+		else
+		{
+			for(unsigned quad=0; quad < 4; quad++)
+				stack[top++]=node.children[quad];
+		}
+	}
+
+	return(QPointF(fx, fy));
+}
+
+void LayoutEngine::computeForceDirectedLayout(void)
+{
+	vector<vector<unsigned>> adj=getAdjacencyLists(false);
+	vector<unsigned> isolated, connected, local_id(nodes.size(), 0);
+	vector<pair<unsigned, unsigned>> local_edges;
+	vector<QPointF> centers, disp;
+	vector<QuadNode> tree;
+	vector<QRectF> rects;
+	vector<std::thread> workers;
+	unsigned worker_cnt=thread_count, cnt=0, i=0;
+	double ideal_len=0, k2=0, temperature=0, len=0, min_x=0, min_y=0;
+	QRectF bounds;
+	QPointF centroid, delta;
+	QString msg=trUtf8("Computing the force-directed layout...");
+
+	for(i=0; i < nodes.size(); i++)
+	{
+		if(adj[i].empty())
+			isolated.push_back(i);
+		else
+		{
+			local_id[i]=connected.size();
+			connected.push_back(i);
+		}
+	}
+
+	cnt=connected.size();
+
+	for(auto id : connected)
+	{
+		for(auto n : adj[id])
+		{
+			if(id < n)
+				local_edges.push_back({ local_id[id], local_id[n] });
+		}
+
+		centers.push_back(nodes[id].center());
+		bounds=bounds.united(nodes[id]);
+		ideal_len+=std::max(nodes[id].width(), nodes[id].height());
+	}
+
+	if(cnt > 0)
+	{
+		ideal_len=(ideal_len/cnt) + spacing;
+		k2=ideal_len * ideal_len;
+
+		//When all nodes are stacked (e.g. freshly imported models) the simulation starts from a grid
+		if(bounds.width() < ideal_len && bounds.height() < ideal_len)
+		{
+			unsigned cols=ceil(sqrt(cnt));
+
+			for(i=0; i < cnt; i++)
+				centers[i]=QPointF((i % cols) * ideal_len, (i / cols) * ideal_len);
+		}
+
+		if(worker_cnt==0)
+			worker_cnt=std::max(QThread::idealThreadCount(), 1);
+
+		if(cnt < MIN_PARALLEL_NODES)
+			worker_cnt=1;
+
+		disp.resize(cnt);
+		temperature=ideal_len * std::max(sqrt(cnt), 1.0);
+
+		//Each worker evaluates the repulsion of a subset of the nodes writing only in their positions of the displacements vector
+		auto eval_repulsion=[&](unsigned first_idx)
+		{
+			for(unsigned idx=first_idx; idx < cnt; idx+=worker_cnt)
+				disp[idx]=computeRepulsion(tree, centers, idx, k2);
+		};
+
+		for(unsigned iter=0; iter < FORCE_ITERATIONS && !canceled; iter++)
+		{
+			buildQuadTree(centers, tree);
+
+			workers.clear();
+
+			for(i=1; i < worker_cnt; i++)
+				workers.push_back(std::thread(eval_repulsion, i));
+
+			eval_repulsion(0);
+
+			for(auto &worker : workers)
+				worker.join();
+
+			//Attraction between connected nodes
+			for(auto &edge : local_edges)
+			{
+				delta=centers[edge.second] - centers[edge.first];
+				len=sqrt(QPointF::dotProduct(delta, delta));
+
+				if(len > 0)
+				{
+					delta*=len/ideal_len;
+					disp[edge.first]+=delta;
+					disp[edge.second]-=delta;
+				}
+			}
+
+			//The gravity towards the centroid keeps the disconnected groups close and the whole drawing compact
+			centroid=QPointF(tree.front().mx, tree.front().my);
+
+			for(i=0; i < cnt; i++)
+			{
+				disp[i]+=(centroid - centers[i]) * FORCE_GRAVITY;
+				len=sqrt(QPointF::dotProduct(disp[i], disp[i]));
+
+				if(len > 0)
+					centers[i]+=(disp[i]/len) * std::min(len, temperature);
+			}
+
+			//The maximum displacement decreases linearly so the layout converges
+			temperature=std::max(temperature * (1.0 - (1.0/(FORCE_ITERATIONS - iter))), ideal_len * 0.01);
+			updateProgress((85 * (iter + 1))/FORCE_ITERATIONS, msg);
+		}
+
+		if(canceled)
+			return;
+
+		for(i=0; i < cnt; i++)
+		{
+			QSizeF size=nodes[connected[i]].size();
+			rects.push_back(QRectF(centers[i] - QPointF(size.width()/2, size.height()/2), size));
+		}
+
+		updateProgress(90, trUtf8("Removing overlaps between objects..."));
+		removeOverlaps(rects);
+
+		if(canceled)
+			return;
+
+		min_x=rects.front().left();
+		min_y=rects.front().top();
+
+		for(auto &rect : rects)
+		{
+			min_x=std::min(min_x, rect.left());
+			min_y=std::min(min_y, rect.top());
+		}
+
+		for(i=0; i < cnt; i++)
+			positions[connected[i]]=rects[i].topLeft() - QPointF(min_x, min_y) + QPointF(DEFAULT_SPACING, DEFAULT_SPACING);
+	}
+
+	bounds=getBoundingRect(connected);
+	placeIsolatedNodes(isolated, QPointF(DEFAULT_SPACING, connected.empty() ? DEFAULT_SPACING : bounds.bottom() + (spacing * 2)),
+										 std::max(bounds.width(), 2000.0));
+}
+
+void LayoutEngine::removeOverlaps(vector<QRectF> &rects)
+{
+	vector<unsigned> order(rects.size());
+	double gap=spacing/2, over_x=0, over_y=0, shift=0;
+	bool moved=true;
+
+	for(unsigned i=0; i < order.size(); i++)
+		order[i]=i;
+
+	for(unsigned pass=0; pass < MAX_OVERLAP_PASSES && moved && !canceled; pass++)
+	{
+		moved=false;
+
+		std::sort(order.begin(), order.end(), [&](unsigned id1, unsigned id2){
+			return(rects[id1].left() < rects[id2].left());
+		});
+
+		//Sweeping the rectangles from left to right comparing each one only with the ones starting before its right side
+		for(unsigned i=0; i < order.size(); i++)
+		{
+			QRectF &rect1=rects[order[i]];
+
+			for(unsigned j=i + 1; j < order.size() && rects[order[j]].left() < rect1.right() + gap; j++)
+			{
+				QRectF &rect2=rects[order[j]];
+
+				over_x=std::min(rect1.right(), rect2.right()) + gap - std::max(rect1.left(), rect2.left());
+				over_y=std::min(rect1.bottom(), rect2.bottom()) + gap - std::max(rect1.top(), rect2.top());
+
+				if(over_x <= 0 || over_y <= 0)
+					continue;
+
+				//The rectangles are moved apart in the axis that demands the smallest displacement
+				if(over_x < over_y)
+				{
+					shift=(rect1.center().x() <= rect2.center().x() ? over_x/2 : -over_x/2);
+					rect1.translate(-shift, 0);
+					rect2.translate(shift, 0);
+				}
+				else
+				{
+					shift=(rect1.center().y() <= rect2.center().y() ? over_y/2 : -over_y/2);
+					rect1.translate(0, -shift);
+					rect2.translate(0, shift);
+				}
+
+				moved=true;
+			}
+		}
+	}
+}
@@ -0,0 +1,157 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+
+/**
+\ingroup libobjrenderer
+\class LayoutEngine
+\brief Computes new positions for a set of rectangles (the table/view boxes) connected by edges (the relationships)
+using a layered (Sugiyama) or a force-directed algorithm. The engine works only over geometry so it can run in a
+separated thread (see ModelWidget::rearrangeTables()) while the caller keeps the scene untouched until the layout is finished.
+\note The force-directed algorithm approximates the repulsion between nodes using a Barnes-Hut quadtree and splits the
+force evaluation among several threads, so large models (thousands of tables) are laid out in a few seconds.
+*/
+
+#ifndef LAYOUT_ENGINE_H
+#define LAYOUT_ENGINE_H
+
+#include <QObject>
+#include <QRectF>
+#include "exception.h"
+#include <vector>
+#include <atomic>
+
+using namespace std;
+
+class LayoutEngine: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Node of the quadtree used to approximate the repulsive forces (Barnes-Hut)
+		struct QuadNode {
+			//! \brief Center and half of the side of the square covered by the node
+			double cx, cy, half,
+
+			//! \brief Amount of bodies inside the node and their center of mass
+			mass, mx, my;
+
+			//! \brief Indexes of the children nodes (-1 in leaves)
+			int children[4],
+
+			//! \brief Body stored in the leaf (-1 when empty)
+			body;
+		};
+
+		//! \brief Algorithm used by computeLayout()
+		unsigned algorithm;
+
+		//! \brief Rectangles and edges to be laid out
+		vector<QRectF> nodes;
+		vector<pair<unsigned, unsigned>> edges;
+
+		//! \brief Computed positions (top-left corner of each rectangle)
+		vector<QPointF> positions;
+
+		//! \brief Horizontal/vertical spacing between the rectangles
+		double spacing;
+
+		//! \brief Amount of threads used by the force-directed algorithm
+		unsigned thread_count;
+
+		atomic<bool> canceled;
+
+		//! \brief Emits the progress signal only when the percentage changes to avoid flooding the receiver
+		int last_progress;
+		void updateProgress(int progress, const QString &msg);
+
+		//! \brief Returns the adjacency lists of the nodes ignoring self edges and duplicated edges
+		vector<vector<unsigned>> getAdjacencyLists(bool directed);
+
+		/*! \brief Places the nodes without edges in rows starting at the provided origin.
+		The row width is limited to the width of the already laid out nodes (min. 2000) */
+		void placeIsolatedNodes(const vector<unsigned> &isolated, QPointF origin, double max_width);
+
+		void computeLayeredLayout(void);
+		void computeForceDirectedLayout(void);
+
+		//! \brief Builds the Barnes-Hut quadtree for the provided node centers
+		static void buildQuadTree(const vector<QPointF> &centers, vector<QuadNode> &tree);
+
+		//! \brief Computes the repulsive force on the body using the quadtree
+		static QPointF computeRepulsion(const vector<QuadNode> &tree, const vector<QPointF> &centers, unsigned body, double k2);
+
+		//! \brief Moves the rectangles apart until they don't overlap (or the passes limit is reached)
+		void removeOverlaps(vector<QRectF> &rects);
+
+		//! \brief Returns the bounding rect of the computed positions of the specified nodes
+		QRectF getBoundingRect(const vector<unsigned> &node_ids);
+
+	public:
+		enum Algorithm: unsigned {
+			LAYERED_LAYOUT,
+			FORCE_DIRECTED_LAYOUT
+		};
+
+		//! \brief Default spacing between rectangles
+		static constexpr double DEFAULT_SPACING=50.0,
+
+		//! \brief Barnes-Hut approximation threshold (size of the node / distance to the body)
+		BARNES_HUT_THETA=0.8,
+
+		//! \brief Factor of the force that pulls the nodes towards the centroid of the drawing
+		FORCE_GRAVITY=1.0;
+
+		//! \brief Amount of iterations of the force-directed algorithm
+		static constexpr unsigned FORCE_ITERATIONS=300,
+
+		//! \brief Amount of down/up sweeps used in the crossing reduction of the layered algorithm
+		CROSSING_SWEEPS=8,
+
+		//! \brief Minimum amount of nodes to evaluate the forces in parallel
+		MIN_PARALLEL_NODES=256;
+
+		LayoutEngine(QObject *parent=nullptr);
+
+		//! \brief Configures the graph to be laid out. Edges referencing invalid nodes raise an error
+		void setGraph(const vector<QRectF> &nodes, const vector<pair<unsigned, unsigned>> &edges);
+
+		void setAlgorithm(unsigned algorithm);
+		void setSpacing(double spacing);
+
+		//! \brief Defines the amount of threads used by the force-directed algorithm (0 means QThread::idealThreadCount())
+		void setThreadCount(unsigned count);
+
+		//! \brief Returns the computed positions (top-left corner of each rectangle in the same order of setGraph())
+		vector<QPointF> getPositions(void);
+
+		bool isLayoutCanceled(void);
+
+	public slots:
+		//! \brief Computes the layout emitting s_layoutFinished() or s_layoutCanceled() at the end
+		void computeLayout(void);
+
+		//! \brief Requests the cancellation of the layout. This method can be called from any thread
+		void cancelLayout(void);
+
+	signals:
+		void s_progressUpdated(int progress, QString msg);
+		void s_layoutFinished(void);
+		void s_layoutCanceled(void);
+};
+
+#endif
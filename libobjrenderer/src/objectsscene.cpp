@@ -17,6 +17,7 @@
 */
 
 #include "objectsscene.h"
+#include <cfloat>
 
 bool ObjectsScene::align_objs_grid=false;
 bool ObjectsScene::show_grid=true;
@@ -29,10 +30,15 @@ QSizeF ObjectsScene::custom_paper_size=QSizeF(0,0);
 QBrush ObjectsScene::grid;
 bool ObjectsScene::corner_move=true;
 bool ObjectsScene::invert_rangesel_trigger=false;
+double ObjectsScene::simplified_view_zoom=0.40;
 
 ObjectsScene::ObjectsScene(void)
 {
-	moving_objs=move_scene=false;
+	//The objects style is loaded only when the first scene is created since no object is drawn before that
+	if(!BaseObjectView::isObjectsStyleLoaded())
+		BaseObjectView::loadObjectsStyle();
+
+	moving_objs=move_scene=simplified_view=false;
 	enable_range_sel=true;
 	this->setBackgroundBrush(grid);
 
@@ -55,6 +61,7 @@ ObjectsScene::ObjectsScene(void)
 
 	connect(&scene_move_timer, SIGNAL(timeout()), this, SLOT(moveObjectScene()));
 	connect(&corner_hover_timer, SIGNAL(timeout()), this, SLOT(enableSceneMove()));
+	connect(&rels_update_timer, SIGNAL(timeout()), this, SLOT(updatePendingRelationships()));
 
 	connect(&object_move_timer, &QTimer::timeout, [&](){
 		//If the timer reaches its timeout we execute the procedures to finish the objects movement
@@ -65,15 +72,15 @@ ObjectsScene::ObjectsScene(void)
 	scene_move_timer.setInterval(SCENE_MOVE_TIMEOUT);
 	corner_hover_timer.setInterval(SCENE_MOVE_TIMEOUT * 10);
 	object_move_timer.setInterval(SCENE_MOVE_TIMEOUT * 10);
+
+	rels_update_timer.setInterval(0);
+	rels_update_timer.setSingleShot(true);
 }
 
 ObjectsScene::~ObjectsScene(void)
 {
-	QGraphicsItemGroup *item=nullptr;
-	QList<QGraphicsItem *> items;
 	ObjectType obj_types[]={ OBJ_RELATIONSHIP, OBJ_TEXTBOX,
 							 OBJ_VIEW, OBJ_TABLE, OBJ_SCHEMA };
-	unsigned i, count=sizeof(obj_types)/sizeof(ObjectType);
 
 	this->removeItem(selection_rect);
 	this->removeItem(rel_line);
@@ -82,32 +89,11 @@ ObjectsScene::~ObjectsScene(void)
 	delete(rel_line);
 
 	//Destroy the objects in the order defined on obj_types vector
-	for(i=0; i < count; i++)
+	for(auto &obj_type : obj_types)
 	{
-		items=this->items();
-
-		while(!items.isEmpty())
-		{
-			/* Try to convert the item to QGraphicsItemGroup because all the objects
-			used to represent database object are derived from this class */
-			item=dynamic_cast<QGraphicsItemGroup *>(items.front());
-
-			/* Case the object is converted to a item group and can be converted to database
-			objects, indicates that the object can be removed from the scene */
-			if(item && !item->parentItem() &&
-					((dynamic_cast<RelationshipView *>(item) && obj_types[i]==OBJ_RELATIONSHIP) ||
-					 (dynamic_cast<TextboxView *>(item) && obj_types[i]==OBJ_TEXTBOX) ||
-					 (dynamic_cast<StyledTextboxView *>(item) && obj_types[i]==OBJ_TEXTBOX) ||
-					 (dynamic_cast<GraphicalView *>(item) && obj_types[i]==OBJ_VIEW) ||
-					 (dynamic_cast<TableView *>(item) && obj_types[i]==OBJ_TABLE) ||
-					 (dynamic_cast<SchemaView *>(item) && obj_types[i]==OBJ_SCHEMA)))
-
-			{
-				this->removeItem(item);
-			}
-
-			items.pop_front();
-		}
+		//Iterating over a copy of the registry since removeItem() changes it
+		for(auto &obj_view : getObjectViews(obj_type))
+			this->removeItem(obj_view);
 	}
 
 	//The graphical representation of db objects must be destroyed in a sorted way
@@ -134,6 +120,16 @@ bool ObjectsScene::isCornerMoveEnabled(void)
 	return(ObjectsScene::corner_move);
 }
 
+void ObjectsScene::setSimplifiedViewZoom(double zoom)
+{
+	ObjectsScene::simplified_view_zoom=(zoom < 0 ? 0 : zoom);
+}
+
+double ObjectsScene::getSimplifiedViewZoom(void)
+{
+	return(ObjectsScene::simplified_view_zoom);
+}
+
 QPointF ObjectsScene::alignPointToGrid(const QPointF &pnt)
 {
 	QPointF p(roundf(pnt.x()/grid_size) * grid_size,
@@ -156,57 +152,55 @@ QRectF ObjectsScene::itemsBoundingRect(bool seek_only_db_objs, bool selected_onl
 		return(QGraphicsScene::itemsBoundingRect());
 	else
 	{
-		QRectF rect=QGraphicsScene::itemsBoundingRect();
-		QList<QGraphicsItem *> items= (selected_only ? this->selectedItems() : this->items());
-		double x=rect.width(), y=rect.height(), x2 = -10000, y2 = -10000;
-		BaseObjectView *obj_view=nullptr;
-		QPointF pnt;
+		QList<BaseObjectView *> obj_views;
+		double x=DBL_MAX, y=DBL_MAX, x2=-DBL_MAX, y2=-DBL_MAX;
+		RelationshipView *rel_view=nullptr;
+		QRectF rect;
 		BaseGraphicObject *graph_obj=nullptr;
 
-		for(auto &item : items)
+		if(selected_only)
 		{
-			obj_view=dynamic_cast<BaseObjectView *>(item);
+			BaseObjectView *obj_view=nullptr;
 
-			if(obj_view && obj_view->isVisible())
+			for(auto &item : this->selectedItems())
 			{
-				graph_obj=dynamic_cast<BaseGraphicObject *>(obj_view->getSourceObject());
+				obj_view=dynamic_cast<BaseObjectView *>(item);
 
-				if(graph_obj)
-				{
-					if(graph_obj->getObjectType()!=OBJ_RELATIONSHIP &&
-							graph_obj->getObjectType()!=BASE_RELATIONSHIP)
-						pnt=graph_obj->getPosition();
-					else
-						pnt=dynamic_cast<RelationshipView *>(obj_view)->__boundingRect().topLeft();
+				if(obj_view)
+					obj_views.push_back(obj_view);
+			}
+		}
+		else
+			obj_views=getObjectViews();
 
-					if(pnt.x() < x)
-						x=pnt.x();
+		for(auto &obj_view : obj_views)
+		{
+			if(!obj_view->isVisible())
+				continue;
 
-					if(pnt.y() < y)
-						y=pnt.y();
+			graph_obj=dynamic_cast<BaseGraphicObject *>(obj_view->getSourceObject());
 
-					if(selected_only)
-					{
-						if(graph_obj->getObjectType()!=OBJ_RELATIONSHIP &&
-							 graph_obj->getObjectType()!=BASE_RELATIONSHIP)
-							pnt = pnt + dynamic_cast<BaseObjectView *>(obj_view)->boundingRect().bottomRight();
-						else
-							pnt = pnt +  dynamic_cast<RelationshipView *>(obj_view)->__boundingRect().bottomRight();
+			if(graph_obj)
+			{
+				rel_view=dynamic_cast<RelationshipView *>(obj_view);
 
-						if(pnt.x() > x2)
-							x2 = pnt.x();
+				if(!rel_view)
+					rect=QRectF(graph_obj->getPosition(), obj_view->boundingRect().size());
+				else
+					rect=rel_view->__boundingRect();
 
-						if(pnt.y() > y2)
-							y2 = pnt.y();
-					}
-				}
+				if(rect.left() < x) x=rect.left();
+				if(rect.top() < y) y=rect.top();
+				if(rect.right() > x2) x2=rect.right();
+				if(rect.bottom() > y2) y2=rect.bottom();
 			}
 		}
 
-		if(selected_only)
-			return(QRectF(QPointF(x, y), QPointF(x2, y2)));
-		else
-			return(QRectF(QPointF(x, y), rect.bottomRight()));
+		//No database object found, returning the default items bounding rect
+		if(x2 < x || y2 < y)
+			return(QGraphicsScene::itemsBoundingRect());
+
+		return(QRectF(QPointF(x, y), QPointF(x2, y2)));
 	}
 }
 
@@ -268,9 +262,7 @@ void ObjectsScene::setGridSize(unsigned size)
 
 void ObjectsScene::showRelationshipLine(bool value, const QPointF &p_start)
 {
-	QList<QGraphicsItem *> items=this->items();
 	QGraphicsItem::GraphicsItemFlags flags;
-	BaseObjectView *object=nullptr;
 	BaseGraphicObject *base_obj=nullptr;
 
 	if(!std::isnan(p_start.x()) && !std::isnan(p_start.y()))
@@ -278,15 +270,13 @@ void ObjectsScene::showRelationshipLine(bool value, const QPointF &p_start)
 
 	rel_line->setVisible(value);
 
-	while(!items.isEmpty())
+	for(auto &object : getObjectViews())
 	{
 		//When showing the relationship line all the objects cannot be moved
 		flags=QGraphicsItem::ItemIsSelectable |
 			  QGraphicsItem::ItemSendsGeometryChanges;
 
-		object=dynamic_cast<BaseObjectView *>(items.front());
-
-		if(object && object->getSourceObject())
+		if(object->getSourceObject())
 		{
 			base_obj=dynamic_cast<BaseGraphicObject *>(object->getSourceObject());
 
@@ -302,8 +292,7 @@ void ObjectsScene::showRelationshipLine(bool value, const QPointF &p_start)
 					  QGraphicsItem::ItemSendsGeometryChanges;
 		}
 
-		items.front()->setFlags(flags);
-		items.pop_front();
+		object->setFlags(flags);
 	}
 }
 
@@ -431,6 +420,7 @@ void ObjectsScene::addItem(QGraphicsItem *item)
 		RelationshipView *rel=dynamic_cast<RelationshipView *>(item);
 		BaseTableView *tab=dynamic_cast<BaseTableView *>(item);
 		BaseObjectView *obj=dynamic_cast<BaseObjectView *>(item);
+		ObjectType obj_type=getObjectViewType(item);
 
 		if(rel)
 			connect(rel, SIGNAL(s_relationshipModified(BaseGraphicObject*)),
@@ -441,6 +431,8 @@ void ObjectsScene::addItem(QGraphicsItem *item)
 							this, SLOT(emitChildObjectSelection(TableObject*)));
 			connect(tab, SIGNAL(s_extAttributesToggled()),
 							this, SLOT(emitExtAttributesToggled()));
+
+			tab->setSimplifiedView(simplified_view);
 		}
 
 		if(obj)
@@ -449,6 +441,9 @@ void ObjectsScene::addItem(QGraphicsItem *item)
 					this, SLOT(emitObjectSelection(BaseGraphicObject*,bool)));
 		}
 
+		if(obj_type!=BASE_OBJECT)
+			obj_views[obj_type].insert(obj);
+
 		QGraphicsScene::addItem(item);
 	}
 }
@@ -461,7 +456,13 @@ void ObjectsScene::removeItem(QGraphicsItem *item)
 		RelationshipView *rel=dynamic_cast<RelationshipView *>(item);
 
 		if(rel)
+		{
 			rel->disconnectTables();
+			pending_rels.remove(rel);
+		}
+
+		if(object && obj_views.count(getObjectViewType(item)))
+			obj_views[getObjectViewType(item)].remove(object);
 
 		item->setVisible(false);
 		item->setActive(false);
@@ -479,14 +480,8 @@ void ObjectsScene::removeItem(QGraphicsItem *item)
 
 void ObjectsScene::blockItemsSignals(bool block)
 {
-	BaseObjectView *obj_view = nullptr;
-
-	for(auto &item : this->items())
-	{
-		obj_view = dynamic_cast<BaseObjectView *>(item);
-		if(obj_view)
-			obj_view->blockSignals(block);
-	}
+	for(auto &obj_view : getObjectViews())
+		obj_view->blockSignals(block);
 }
 
 void ObjectsScene::mouseDoubleClickEvent(QGraphicsSceneMouseEvent *event)
@@ -887,6 +882,9 @@ void ObjectsScene::finishObjectsMove(const QPointF &pnt_end)
 	BaseTableView *tab_view=nullptr;
 	QSet<BaseObjectView *> tables;
 
+	//Applying the pending relationships updates so their bounding rects can be used in the scene size calculation
+	updatePendingRelationships();
+
 	//Gathering the relationships inside the selected schemsa in order to move their points too
 	for(auto &item : items)
 	{
@@ -1001,7 +999,7 @@ void ObjectsScene::finishObjectsMove(const QPointF &pnt_end)
 	//If the new rect is greater than the scene bounding rect, this latter is resized
 	if(rect!=this->sceneRect())
 	{
-		rect=this->itemsBoundingRect();
+		rect=this->itemsBoundingRect(true);
 		rect.setTopLeft(QPointF(0,0));
 		rect.setWidth(rect.width() * 1.05f);
 		rect.setHeight(rect.height() * 1.05f);
@@ -1035,54 +1033,47 @@ void ObjectsScene::finishObjectsMove(const QPointF &pnt_end)
 
 void ObjectsScene::alignObjectsToGrid(void)
 {
-	QList<QGraphicsItem *> items=this->items();
 	RelationshipView *rel=nullptr;
-	BaseTableView *tab=nullptr;
 	TextboxView *lab=nullptr;
 	vector<QPointF> points;
 	vector<Schema *> schemas;
-	unsigned i, count, i1, count1;
+	unsigned i1, count1;
 
-	count=items.size();
-	for(i=0; i < count; i++)
+	for(auto &obj_type : { OBJ_TABLE, OBJ_VIEW, OBJ_TEXTBOX })
 	{
-		if(dynamic_cast<QGraphicsItemGroup *>(items[i]) && !items[i]->parentItem())
-		{
-			tab=dynamic_cast<BaseTableView *>(items[i]);
-			rel=dynamic_cast<RelationshipView *>(items[i]);
+		for(auto &obj_view : obj_views[obj_type])
+			obj_view->setPos(this->alignPointToGrid(obj_view->pos()));
+	}
 
-			if(tab)
-				tab->setPos(this->alignPointToGrid(tab->pos()));
-			else if(rel)
-			{
-				//Align the relationship points
-				points=rel->getSourceObject()->getPoints();
-				count1=points.size();
-				for(i1=0; i1 < count1; i1++)
-					points[i1]=this->alignPointToGrid(points[i1]);
+	for(auto &obj_view : obj_views[OBJ_RELATIONSHIP])
+	{
+		rel=dynamic_cast<RelationshipView *>(obj_view);
 
-				if(count1 > 0)
-				{
-					rel->getSourceObject()->setPoints(points);
-					rel->configureLine();
-				}
+		//Align the relationship points
+		points=rel->getSourceObject()->getPoints();
+		count1=points.size();
+		for(i1=0; i1 < count1; i1++)
+			points[i1]=this->alignPointToGrid(points[i1]);
 
-				//Align the labels
-				for(i1=BaseRelationship::SRC_CARD_LABEL;
-					i1<=BaseRelationship::REL_NAME_LABEL; i1++)
-				{
-					lab=rel->getLabel(i1);
-					if(lab)
-						lab->setPos(this->alignPointToGrid(lab->pos()));
-				}
-			}
-			else if(!dynamic_cast<SchemaView *>(items[i]))
-				items[i]->setPos(this->alignPointToGrid(items[i]->pos()));
-			else
-				schemas.push_back(dynamic_cast<Schema *>(dynamic_cast<BaseObjectView *>(items[i])->getSourceObject()));
+		if(count1 > 0)
+		{
+			rel->getSourceObject()->setPoints(points);
+			rel->configureLine();
+		}
+
+		//Align the labels
+		for(i1=BaseRelationship::SRC_CARD_LABEL;
+			i1<=BaseRelationship::REL_NAME_LABEL; i1++)
+		{
+			lab=rel->getLabel(i1);
+			if(lab)
+				lab->setPos(this->alignPointToGrid(lab->pos()));
 		}
 	}
 
+	for(auto &obj_view : obj_views[OBJ_SCHEMA])
+		schemas.push_back(dynamic_cast<Schema *>(obj_view->getSourceObject()));
+
 	//Updating schemas dimensions
 	while(!schemas.empty())
 	{
@@ -1170,3 +1161,123 @@ bool ObjectsScene::isMovingObjects(void)
 {
 	return(moving_objs);
 }
+
+void ObjectsScene::requestRelationshipUpdate(RelationshipView *rel)
+{
+	if(!rel)
+		return;
+
+	pending_rels.insert(rel);
+
+	if(!rels_update_timer.isActive())
+		rels_update_timer.start();
+}
+
+void ObjectsScene::cancelRelationshipUpdate(RelationshipView *rel)
+{
+	pending_rels.remove(rel);
+}
+
+void ObjectsScene::updatePendingRelationships(void)
+{
+	QSet<RelationshipView *> rels;
+
+	rels_update_timer.stop();
+
+	/* Swapping the pending list to a local one since the line configuration
+	can trigger new update requests that will be handled in the next batch */
+	rels.swap(pending_rels);
+
+	for(auto &rel : rels)
+		rel->configureLine();
+}
+
+void ObjectsScene::setSimplifiedView(bool value, const QRectF &area)
+{
+	BaseTableView *tab_view=nullptr;
+
+	if(area.isValid())
+	{
+		for(auto &item : this->items(area))
+		{
+			//Only the top-level tables/views are considered, the children items returned in the query are ignored
+			tab_view=dynamic_cast<BaseTableView *>(item);
+
+			if(tab_view && !tab_view->parentItem())
+				tab_view->setSimplifiedView(value);
+		}
+	}
+	else if(simplified_view!=value)
+	{
+		simplified_view=value;
+
+		for(auto &obj_type : { OBJ_TABLE, OBJ_VIEW })
+		{
+			for(auto &obj_view : obj_views[obj_type])
+				dynamic_cast<BaseTableView *>(obj_view)->setSimplifiedView(value);
+		}
+	}
+}
+
+bool ObjectsScene::isSimplifiedView(void)
+{
+	return(simplified_view);
+}
+
+void ObjectsScene::setItemsCacheEnabled(bool value)
+{
+	for(auto &item : this->items())
+	{
+		if(BaseObjectView::isItemCacheable(item))
+			item->setCacheMode(value ? QGraphicsItem::DeviceCoordinateCache : QGraphicsItem::NoCache);
+	}
+}
+
+ObjectType ObjectsScene::getObjectViewType(QGraphicsItem *item)
+{
+	if(!item || item->parentItem())
+		return(BASE_OBJECT);
+
+	if(dynamic_cast<RelationshipView *>(item))
+		return(OBJ_RELATIONSHIP);
+	else if(dynamic_cast<TableView *>(item))
+		return(OBJ_TABLE);
+	else if(dynamic_cast<GraphicalView *>(item))
+		return(OBJ_VIEW);
+	else if(dynamic_cast<SchemaView *>(item))
+		return(OBJ_SCHEMA);
+	else if(dynamic_cast<TextboxView *>(item))
+		return(OBJ_TEXTBOX);
+
+	return(BASE_OBJECT);
+}
+
+QList<BaseObjectView *> ObjectsScene::getObjectViews(ObjectType obj_type)
+{
+	QList<BaseObjectView *> list;
+
+	if(obj_type==BASE_OBJECT)
+	{
+		for(auto &itr : obj_views)
+			list.append(itr.second.toList());
+	}
+	else if(obj_views.count(obj_type))
+		list=obj_views[obj_type].toList();
+
+	return(list);
+}
+
+unsigned ObjectsScene::getObjectViewsCount(ObjectType obj_type)
+{
+	unsigned count=0;
+
+	if(obj_type==BASE_OBJECT)
+	{
+		for(auto &itr : obj_views)
+			count+=itr.second.size();
+	}
+	else if(obj_views.count(obj_type))
+		count=obj_views[obj_type].size();
+
+	return(count);
+}
@@ -39,6 +39,14 @@ class ObjectsScene: public QGraphicsScene {
 
 		vector<BaseObjectView *> removed_objs;
 
+		/*! \brief Stores the top-level object views added to the scene per kind (tables, views, schemas, relationships and textboxes).
+		This registry is maintained by addItem()/removeItem() and is used by the bulk operations (alignment, bounding rect calculation,
+		signals blocking, etc) so they don't need to iterate over all the graphical primitives (columns, lines, texts) of the scene */
+		map<ObjectType, QSet<BaseObjectView *>> obj_views;
+
+		//! \brief Returns the type used as key in the object views registry for the provided view (BASE_OBJECT for unregistered ones)
+		static ObjectType getObjectViewType(QGraphicsItem *item);
+
 		//! \brief Indicates if the corner move is enabled for the scene
 		static bool corner_move,
 
@@ -47,7 +55,13 @@ class ObjectsScene: public QGraphicsScene {
 		invert_rangesel_trigger;
 
 		//! \brief Indicates if the scene need to be moved
-		bool move_scene;
+		bool move_scene,
+
+		//! \brief Indicates that the tables are currently drawn in their simplified form (see setSimplifiedView())
+		simplified_view;
+
+		//! \brief Zoom factor below which the tables must be drawn in their simplified form
+		static double simplified_view_zoom;
 
 		static const int SCENE_MOVE_STEP=20,
 		SCENE_MOVE_TIMEOUT=50,
@@ -67,7 +81,15 @@ class ObjectsScene: public QGraphicsScene {
 		the timer is still running the same will be restarted, until its timeout is reached. This trick avoids 'spamming' the
 		operation list in ModelWidget creating registries only when the user starts and ends the objects movement. Intermediate
 		key presses/releases aren't not registered in the operation history */
-		object_move_timer;
+		object_move_timer,
+
+		/*! \brief Timer responsible to reconfigure, in a single batch, the lines of relationships marked as pending.
+		This is a zero interval, single shot timer, so all the update requests done by the tables during an event
+		loop iteration (e.g. several tables being moved at once) cause only one line reconfiguration per relationship */
+		rels_update_timer;
+
+		//! \brief Relationships which lines must be reconfigured in the next batch update
+		QSet<RelationshipView *> pending_rels;
 
 		//! \brief Attributes used to control the direction of scene movement when user puts cursor at corners
 		int scene_move_dx, scene_move_dy;
@@ -146,6 +168,11 @@ class ObjectsScene: public QGraphicsScene {
 		static void setInvertRangeSelectionTrigger(bool invert);
 		static bool isCornerMoveEnabled(void);
 
+		/*! \brief Defines the zoom factor below which the views must call setSimplifiedView(true) on their scenes.
+		 * A zero value disables the simplified view */
+		static void setSimplifiedViewZoom(double zoom);
+		static double getSimplifiedViewZoom(void);
+
 		static void setGridSize(unsigned size);
 		static void setGridOptions(bool show_grd, bool align_objs_grd, bool show_page_dlm);
 		static void getGridOptions(bool &show_grd, bool &align_objs_grd, bool &show_pag_dlm);
@@ -167,7 +194,8 @@ class ObjectsScene: public QGraphicsScene {
 		If the paramenter selected_only is true only selected objects will have the bounding rect calculated.
 		Currently this parameter is ignored when using seek_only_db_objs = false
 
-		Note: using this method with seek_only_db_objs=true can be time expensive depending on the size of the model so use it wisely. */
+		Note: when seek_only_db_objs=true the rect is calculated from the registered object views only (see obj_views) so
+		the cost of the method depends on the amount of objects in the model and not on the amount of graphical primitives in the scene. */
 		QRectF itemsBoundingRect(bool seek_only_db_objs=false, bool selected_only = false);
 
 		//! \brief Returns a vector containing all the page rects.
@@ -178,6 +206,36 @@ class ObjectsScene: public QGraphicsScene {
 		bool isRelationshipLineVisible(void);
 		bool isMovingObjects(void);
 
+		/*! \brief Returns the top-level object views of the specified type currently in the scene.
+		If BASE_OBJECT is used then all the object views are returned. The accepted types are OBJ_TABLE, OBJ_VIEW,
+		OBJ_SCHEMA, OBJ_RELATIONSHIP and OBJ_TEXTBOX */
+		QList<BaseObjectView *> getObjectViews(ObjectType obj_type=BASE_OBJECT);
+
+		//! \brief Returns the amount of top-level object views of the specified type (BASE_OBJECT for all types)
+		unsigned getObjectViewsCount(ObjectType obj_type=BASE_OBJECT);
+
+		/*! \brief Marks the relationship's line to be reconfigured in the next batch update instead of
+		doing it immediately. Several requests for the same relationship are merged into a single update */
+		void requestRelationshipUpdate(RelationshipView *rel);
+
+		//! \brief Removes the relationship from the batch update list (if it's pending)
+		void cancelRelationshipUpdate(RelationshipView *rel);
+
+		/*! \brief Toggles the level of detail used to draw the tables. In the simplified view the tables
+		 * are drawn with their titles and the columns count only, skipping the painting of all children objects,
+		 * which is the main bottleneck when a large model is zoomed out. If a valid area is provided only the tables
+		 * intersecting it are affected and the scene's current state is not changed. This is useful to temporarily
+		 * draw a portion of the scene in full detail (e.g. the magnifier tool) */
+		void setSimplifiedView(bool value, const QRectF &area=QRectF());
+
+		//! \brief Returns if the scene is currently drawing the tables in the simplified form
+		bool isSimplifiedView(void);
+
+		/*! \brief Toggles the device coordinate caching of the objects' children items (see BaseObjectView::setItemCacheable).
+		 * The cache must be disabled prior to render the scene to vector devices (SVG, printer) otherwise the cached
+		 * pixmaps will be drawn instead of the vector graphics */
+		void setItemsCacheEnabled(bool value);
+
 	public slots:
 		void alignObjectsToGrid(void);
 		void update(void);
@@ -193,6 +251,9 @@ class ObjectsScene: public QGraphicsScene {
 		//! \brief Moves the scene when the user puts the mouse cursor on one of scene's edges
 		void moveObjectScene(void);
 
+		//! \brief Reconfigures the lines of all the pending relationships at once
+		void updatePendingRelationships(void);
+
 		//! \brief Handles and redirects the signal emitted by the modified object
 		void emitObjectModification(BaseGraphicObject *object);
 
@@ -17,6 +17,7 @@
 */
 
 #include "relationshipview.h"
+#include "objectsscene.h"
 
 bool RelationshipView::hide_name_label=false;
 bool RelationshipView::use_curved_lines=true;
@@ -82,6 +83,11 @@ RelationshipView::~RelationshipView(void)
 {
 	QGraphicsItem *item=nullptr;
 	vector<vector<QGraphicsLineItem *> *> rel_lines = { &lines, &fk_lines, &pk_lines, &src_cf_lines, &dst_cf_lines };
+	ObjectsScene *scene=dynamic_cast<ObjectsScene *>(this->scene());
+
+	//Avoiding the scene to reconfigure the line of a destroyed relationship
+	if(scene)
+		scene->cancelRelationshipUpdate(this);
 
 	while(!curves.empty())
 	{
@@ -536,11 +542,11 @@ void RelationshipView::connectTables(void)
 			tables[i]->disconnect(this);
 
 			if(BaseObjectView::isPlaceholderEnabled())
-				connect(tables[i], SIGNAL(s_relUpdateRequest(void)), this, SLOT(configureLine(void)));
+				connect(tables[i], SIGNAL(s_relUpdateRequest(void)), this, SLOT(requestLineUpdate(void)));
 			else
-				connect(tables[i], SIGNAL(s_objectMoved(void)), this, SLOT(configureLine(void)));
+				connect(tables[i], SIGNAL(s_objectMoved(void)), this, SLOT(requestLineUpdate(void)));
 
-			connect(tables[i], SIGNAL(s_objectDimensionChanged(void)), this, SLOT(configureLine(void)));
+			connect(tables[i], SIGNAL(s_objectDimensionChanged(void)), this, SLOT(requestLineUpdate(void)));
 		}
 	}
 }
@@ -562,6 +568,16 @@ void RelationshipView::configureObject(void)
 	connect(rel_base, SIGNAL(s_objectModified()), this, SLOT(configureLine(void)));
 }
 
+void RelationshipView::requestLineUpdate(void)
+{
+	ObjectsScene *scene=dynamic_cast<ObjectsScene *>(this->scene());
+
+	if(scene)
+		scene->requestRelationshipUpdate(this);
+	else
+		configureLine();
+}
+
 void RelationshipView::configurePositionInfo(void)
 {
 	if(this->isSelected())
@@ -871,7 +887,8 @@ void RelationshipView::configureLine(void)
 						line = QLineF(tables[1]->getCenter(), points[points.size() - 1]);
 				}
 
-				if(rel_type==BaseRelationship::RELATIONSHIP_GEN || rel_type==BaseRelationship::RELATIONSHIP_DEP)
+				if(rel_type==BaseRelationship::RELATIONSHIP_GEN || rel_type==BaseRelationship::RELATIONSHIP_DEP ||
+					 rel_type==BaseRelationship::RELATIONSHIP_PART)
 					size_factor = 0.40;
 				else if(use_crows_foot)
 				{
@@ -886,6 +903,7 @@ void RelationshipView::configureLine(void)
 
 					if(rel_type == BaseRelationship::RELATIONSHIP_GEN ||
 						 rel_type == BaseRelationship::RELATIONSHIP_DEP ||
+						 rel_type == BaseRelationship::RELATIONSHIP_PART ||
 						 rel_type == BaseRelationship::RELATIONSHIP_11 ||
 						 (tab_idx == 0 && rel_type == BaseRelationship::RELATIONSHIP_1N) ||
 						 (tab_idx == 1 && rel_type == BaseRelationship::RELATIONSHIP_FK))
@@ -1007,9 +1025,11 @@ void RelationshipView::configureLine(void)
 				pen=BaseObjectView::getBorderStyle(ParsersAttributes::RELATIONSHIP);
 		}
 
-		//For dependency relationships the line is dashed
+		//For dependency relationships the line is dashed and for partitioning ones it's dash-dotted
 		if(rel_type==BaseRelationship::RELATIONSHIP_DEP)
 			pen.setStyle(Qt::DashLine);
+		else if(rel_type==BaseRelationship::RELATIONSHIP_PART)
+			pen.setStyle(Qt::DashDotLine);
 
 		/* For identifier relationships an additional point is created on the center of the
 		 line that supports the descriptor in order to modify the line thickness on the
@@ -1125,6 +1145,7 @@ void RelationshipView::configureLine(void)
 			 (!base_rel->isSelfRelationship() &&
 				((line_conn_mode != CONNECT_TABLE_EGDES && rel_type==BaseRelationship::RELATIONSHIP_DEP) ||
 				 (line_conn_mode != CONNECT_TABLE_EGDES && rel_type==BaseRelationship::RELATIONSHIP_GEN) ||
+				 (line_conn_mode != CONNECT_TABLE_EGDES && rel_type==BaseRelationship::RELATIONSHIP_PART) ||
 				 (line_conn_mode != CONNECT_TABLE_EGDES && rel_type==BaseRelationship::RELATIONSHIP_NN  && !use_crows_foot))))
 		{
 			for(i=0; i < 2; i++)
@@ -1266,6 +1287,8 @@ void RelationshipView::configureDescriptor(void)
 
 	if(rel_type==BaseRelationship::RELATIONSHIP_DEP)
 		pen.setStyle(Qt::DashLine);
+	else if(rel_type==BaseRelationship::RELATIONSHIP_PART)
+		pen.setStyle(Qt::DashDotLine);
 
 	descriptor->setPen(pen);
 
@@ -1290,7 +1313,8 @@ void RelationshipView::configureDescriptor(void)
 		descriptor->setBrush(BaseObjectView::getFillStyle(ParsersAttributes::RELATIONSHIP));
 
 	if(rel_type==BaseRelationship::RELATIONSHIP_DEP ||
-			rel_type==BaseRelationship::RELATIONSHIP_GEN)
+			rel_type==BaseRelationship::RELATIONSHIP_GEN ||
+			rel_type==BaseRelationship::RELATIONSHIP_PART)
 	{
 		pol.append(QPointF(0,0)); pol.append(QPointF(18,10));
 		pol.append(QPointF(0,20)); pol.append(QPointF(0,10));
@@ -1329,7 +1353,8 @@ void RelationshipView::configureDescriptor(void)
 				/* Workaround to avoid the inheritance / dependency relationship to get the descriptor rotated to the wrong side
 				 * We create and auxiliary line with points from the position at 65% of the curve to the 45% and use the
 				 * angle of that line instead of the angle at 50% of the curve */
-				if((rel_type == BaseRelationship::RELATIONSHIP_DEP || rel_type == BaseRelationship::RELATIONSHIP_GEN) &&
+				if((rel_type == BaseRelationship::RELATIONSHIP_DEP || rel_type == BaseRelationship::RELATIONSHIP_GEN ||
+						rel_type == BaseRelationship::RELATIONSHIP_PART) &&
 					 curve->isControlPointsInverted() && !curve->isSimpleCurve() && !curve->isStraightLine())
 				{
 					QLineF lin_aux = QLineF(path.pointAtPercent(0.65), path.pointAtPercent(0.45));
@@ -1403,7 +1428,8 @@ void RelationshipView::configureDescriptor(void)
 	descriptor->setVisible(!use_crows_foot ||
 												 (use_crows_foot && (
 														rel_type == BaseRelationship::RELATIONSHIP_DEP ||
-														rel_type == BaseRelationship::RELATIONSHIP_GEN)));
+														rel_type == BaseRelationship::RELATIONSHIP_GEN ||
+														rel_type == BaseRelationship::RELATIONSHIP_PART)));
 	obj_shadow->setVisible(descriptor->isVisible());
 }
 
@@ -1412,20 +1438,12 @@ void RelationshipView::configureCrowsFootDescriptors(void)
 	BaseRelationship * base_rel = dynamic_cast<BaseRelationship *>(this->getSourceObject());
 	Relationship *rel=dynamic_cast<Relationship *>(base_rel);
 
-	//Hiding all descriptors related to crow's foot when the notation is not being used
+	/* Hiding all descriptors related to crow's foot when the notation is not being used.
+	 * The children items are kept in their groups so they can be reused in a future call */
 	if(!use_crows_foot && cf_descriptors[BaseRelationship::SRC_TABLE])
 	{
 		for(unsigned tab_id = BaseRelationship::SRC_TABLE; tab_id <= BaseRelationship::DST_TABLE; tab_id++)
-		{
-			for(auto &item : cf_descriptors[tab_id]->childItems())
-			{
-				cf_descriptors[tab_id]->setRotation(0);
-				cf_descriptors[tab_id]->removeFromGroup(item);
-				this->removeFromGroup(item);
-				item->setVisible(false);
-				cf_descriptors[tab_id]->setVisible(false);
-			}
-		}
+			cf_descriptors[tab_id]->setVisible(false);
 	}
 	else if(use_crows_foot && base_rel &&
 		 (base_rel->getRelationshipType() == BaseRelationship::RELATIONSHIP_11 ||
@@ -1482,13 +1500,26 @@ void RelationshipView::configureCrowsFootDescriptors(void)
 			for(int idx = 0; idx < 4; idx++)
 			{
 				line_item = new QGraphicsLineItem;
+				line_item->setVisible(false);
 				src_cf_lines.push_back(line_item);
+				cf_descriptors[BaseRelationship::SRC_TABLE]->addToGroup(line_item);
 				cf_descriptors[BaseRelationship::SRC_TABLE]->setZValue(src_zvalue);
 
 				line_item = new QGraphicsLineItem;
+				line_item->setVisible(false);
 				dst_cf_lines.push_back(line_item);
+				cf_descriptors[BaseRelationship::DST_TABLE]->addToGroup(line_item);
 				cf_descriptors[BaseRelationship::DST_TABLE]->setZValue(dst_zvalue);
 			}
+
+			/* The descriptors' items are added to their groups only once (while the groups aren't rotated)
+			 * and from here on they are only repositioned and shown/hidden, avoiding the expensive
+			 * removeFromGroup()/addToGroup() calls (and the related transformations recalculation) on each line update */
+			for(int idx = 0; idx < 2; idx++)
+			{
+				round_cf_descriptors[idx]->setVisible(false);
+				cf_descriptors[idx]->addToGroup(round_cf_descriptors[idx]);
+			}
 		}
 		else
 		{
@@ -1511,11 +1542,7 @@ void RelationshipView::configureCrowsFootDescriptors(void)
 			cf_descriptors[tab_id]->setRotation(0);
 
 			for(auto &line : *cf_lines[tab_id])
-			{
-				cf_descriptors[tab_id]->removeFromGroup(line);
-				this->removeFromGroup(line);
 				line->setVisible(false);
-			}
 
 			//Configuring the minimum cardinality descriptor
 			if((tab_id == BaseRelationship::SRC_TABLE &&
@@ -1526,7 +1553,6 @@ void RelationshipView::configureCrowsFootDescriptors(void)
 			{
 
 				line_item = cf_lines[tab_id]->at(lin_idx++);
-				cf_descriptors[tab_id]->addToGroup(line_item);
 				line_item->setVisible(true);
 
 				line_item->setLine(QLineF(QPointF(0, -8 * factor), QPointF(0, 8 * factor)));
@@ -1551,14 +1577,12 @@ void RelationshipView::configureCrowsFootDescriptors(void)
 				}
 
 				line_item = cf_lines[tab_id]->at(lin_idx++);
-				cf_descriptors[tab_id]->addToGroup(line_item);
 				line_item->setVisible(true);
 				line_item->setLine(line);
 				line_item->setPos(px, 0);
 				line_item->setPen(pens[tab_id]);
 
 				line_item = cf_lines[tab_id]->at(lin_idx++);
-				cf_descriptors[tab_id]->addToGroup(line_item);
 				line_item->setVisible(true);
 				line_item->setLine(line1);
 				line_item->setPos(px, 0);
@@ -1566,15 +1590,12 @@ void RelationshipView::configureCrowsFootDescriptors(void)
 			}
 
 
-			cf_descriptors[tab_id]->removeFromGroup(round_cf_descriptors[tab_id]);
-			this->removeFromGroup(round_cf_descriptors[tab_id]);
 			round_cf_descriptors[tab_id]->setVisible(false);
 
 			//Configuring the maximum cardinality descriptor
 			if((tab_id == BaseRelationship::SRC_TABLE && mandatory[tab_id]) || rel_type == BaseRelationship::RELATIONSHIP_NN)
 			{
 				line_item = cf_lines[tab_id]->at(lin_idx++);
-				cf_descriptors[tab_id]->addToGroup(line_item);
 				line_item->setVisible(true);
 
 				line_item->setLine(QLineF(QPointF(0, -8 * factor), QPointF(0, 8 * factor)));
@@ -1587,7 +1608,6 @@ void RelationshipView::configureCrowsFootDescriptors(void)
 			{
 				//Configuring the circle which describes the optional cardinality
 				circle_item = round_cf_descriptors[tab_id];
-				cf_descriptors[tab_id]->addToGroup(circle_item);
 				circle_item->setVisible(true);
 				circle_item->setRect(QRectF(0, 0, GRAPHIC_PNT_RADIUS * 2.20 * factor, GRAPHIC_PNT_RADIUS * 2.20 * factor));
 
@@ -1807,7 +1827,27 @@ void RelationshipView::configureLabels(void)
 	{
 		Textbox *txtbox = dynamic_cast<Textbox *>(labels[BaseRelationship::REL_NAME_LABEL]->getSourceObject());
 
-		if(compact_view && !base_rel->getAlias().isEmpty())
+		QString part_bound;
+
+		/* In compact view the partitioning relationships without alias display only the partition bound
+		instead of the (usually long) relationship name so the partitions of a table are easier to tell apart */
+		if(compact_view && base_rel->getAlias().isEmpty() && rel_type==BaseRelationship::RELATIONSHIP_PART)
+		{
+			Table *part_tab=dynamic_cast<Table *>(base_rel->getTable(BaseRelationship::SRC_TABLE));
+
+			if(part_tab)
+				part_bound=(part_tab->isDefaultPartition() ? QString("DEFAULT") : part_tab->getPartitionBoundingExpr());
+		}
+
+		if(!part_bound.isEmpty())
+		{
+			if(txtbox->getComment() != part_bound)
+			{
+				txtbox->setComment(part_bound);
+				txtbox->setModified(true);
+			}
+		}
+		else if(compact_view && !base_rel->getAlias().isEmpty())
 		{
 			txtbox->setComment(base_rel->getAlias());
 			txtbox->setModified(true);
@@ -1828,7 +1868,8 @@ void RelationshipView::configureLabels(void)
 
 	if(!use_crows_foot &&
 		 rel_type!=BaseRelationship::RELATIONSHIP_GEN &&
-		 rel_type!=BaseRelationship::RELATIONSHIP_DEP)
+		 rel_type!=BaseRelationship::RELATIONSHIP_DEP &&
+		 rel_type!=BaseRelationship::RELATIONSHIP_PART)
 	{
 		QPointF pi, pf, p_int, pos;
 		unsigned idx, i1;
@@ -157,6 +157,13 @@ class RelationshipView: public BaseObjectView {
 		//! \brief Makes the comple relationship configuration
 		void configureObject(void);
 
+		/*! \brief Requests the line reconfiguration to the scene which will do it in a batch
+		together with other relationships (see ObjectsScene::requestRelationshipUpdate). This slot is
+		connected to the tables' signals instead of configureLine() in order to avoid reconfiguring the same
+		relationship several times when many tables are moved at once. If the relationship is not in
+		an ObjectsScene the line is reconfigured immediately */
+		void requestLineUpdate(void);
+
 	public:
 		static const unsigned CONNECT_CENTER_PNTS=0,
 		CONNECT_FK_TO_PK=1,
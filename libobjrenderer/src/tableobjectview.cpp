@@ -36,6 +36,7 @@ TableObjectView::TableObjectView(TableObject *object) : BaseObjectView(object)
 	for(unsigned i=0; i < 3; i++)
 	{
 		lables[i]=new QGraphicsSimpleTextItem;
+		setItemCacheable(lables[i]);
 		this->addToGroup(lables[i]);
 	}
 }
@@ -31,6 +31,10 @@ TableTitleView::TableTitleView(void) : BaseObjectView(nullptr)
 	box->setRoundedCorners(RoundedRectItem::TOPLEFT_CORNER | RoundedRectItem::TOPRIGHT_CORNER);
 	box->setZValue(0);
 
+	setItemCacheable(schema_name);
+	setItemCacheable(obj_name);
+	setItemCacheable(box);
+
 	this->addToGroup(box);
 	this->addToGroup(schema_name);
 	this->addToGroup(obj_name);
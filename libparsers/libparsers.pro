@@ -16,11 +16,15 @@ windows: DESTDIR = $$PWD
 HEADERS += src/schemaparser.h \
 	   src/xmlparser.h \
 	   src/attribsmap.h \
+	   src/attributekey.h \
+	   src/flatattribsmap.h \
 	   src/parsersattributes.h
 
 SOURCES += src/schemaparser.cpp \
 	   src/xmlparser.cpp \
-    src/parsersattributes.cpp
+    src/parsersattributes.cpp \
+    src/attributekey.cpp \
+    src/flatattribsmap.cpp
 
 unix|windows: LIBS += -L$$OUT_PWD/../libutils/ -lutils $$XML_LIB
 
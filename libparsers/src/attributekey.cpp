@@ -0,0 +1,113 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "attributekey.h"
+
+QHash<QString, unsigned> AttributeKey::key_ids;
+vector<QString> AttributeKey::key_names;
+QReadWriteLock AttributeKey::keys_lock;
+QThreadStorage<QHash<QString, unsigned>> AttributeKey::local_key_ids;
+
+AttributeKey::AttributeKey(void)
+{
+	id=0;
+}
+
+AttributeKey::AttributeKey(const QString &name)
+{
+	id=intern(name);
+}
+
+unsigned AttributeKey::intern(const QString &name)
+{
+	QHash<QString, unsigned> &local_ids=local_key_ids.localData();
+	QHash<QString, unsigned>::const_iterator itr=local_ids.constFind(name);
+	unsigned key_id=0;
+
+	if(itr!=local_ids.constEnd())
+		return(itr.value());
+
+	keys_lock.lockForRead();
+	itr=key_ids.constFind(name);
+
+	if(itr!=key_ids.constEnd())
+		key_id=itr.value();
+
+	keys_lock.unlock();
+
+	if(key_id==0)
+	{
+		QWriteLocker locker(&keys_lock);
+
+		//Another thread could have registered the name while the lock was released
+		itr=key_ids.constFind(name);
+
+		if(itr!=key_ids.constEnd())
+			key_id=itr.value();
+		else
+		{
+			key_names.push_back(name);
+			key_id=key_names.size();
+			key_ids[name]=key_id;
+		}
+	}
+
+	local_ids[name]=key_id;
+	return(key_id);
+}
+
+unsigned AttributeKey::getId(void) const
+{
+	return(id);
+}
+
+QString AttributeKey::getName(void) const
+{
+	return(getNameById(id));
+}
+
+QString AttributeKey::getNameById(unsigned key_id)
+{
+	QReadLocker locker(&keys_lock);
+
+	if(key_id==0 || key_id > key_names.size())
+		return(QString());
+
+	return(key_names[key_id - 1]);
+}
+
+bool AttributeKey::isNull(void) const
+{
+	return(id==0);
+}
+
+bool AttributeKey::operator == (const AttributeKey &key) const
+{
+	return(id==key.id);
+}
+
+bool AttributeKey::operator != (const AttributeKey &key) const
+{
+	return(id!=key.id);
+}
+
+unsigned AttributeKey::getKeyCount(void)
+{
+	QReadLocker locker(&keys_lock);
+	return(key_names.size());
+}
@@ -0,0 +1,79 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libparsers
+\class AttributeKey
+\brief Implements an interned attribute name. Each distinct name (usually one of the ParsersAttributes constants)
+is registered only once in a global table and represented by an integer atom, this way, comparing and hashing
+keys doesn't involve any string operation.
+\note The table of names only grows and is shared by all threads, so the access to it is guarded by a read/write lock.
+Each thread keeps its own copy of the atoms already resolved, so the lock is taken only the first time a thread uses a name.
+*/
+
+#ifndef ATTRIBUTE_KEY_H
+#define ATTRIBUTE_KEY_H
+
+#include <QString>
+#include <QHash>
+#include <QReadWriteLock>
+#include <QThreadStorage>
+#include <vector>
+
+using namespace std;
+
+class AttributeKey {
+	private:
+		//! \brief Stores the atom of each registered name
+		static QHash<QString, unsigned> key_ids;
+
+		//! \brief Stores the registered names. The atom of a name is its index in this vector plus one
+		static vector<QString> key_names;
+
+		static QReadWriteLock keys_lock;
+
+		//! \brief Atoms already resolved by the current thread (avoids the lock on the lookups of known names)
+		static QThreadStorage<QHash<QString, unsigned>> local_key_ids;
+
+		//! \brief The atom of the key (zero indicates a null key)
+		unsigned id;
+
+		//! \brief Returns the atom of the name registering it if needed
+		static unsigned intern(const QString &name);
+
+	public:
+		AttributeKey(void);
+
+		//! \brief Creates the key for the name. The implicit conversion lets QStrings be used as keys directly
+		AttributeKey(const QString &name);
+
+		unsigned getId(void) const;
+		QString getName(void) const;
+		bool isNull(void) const;
+
+		bool operator == (const AttributeKey &key) const;
+		bool operator != (const AttributeKey &key) const;
+
+		//! \brief Returns the name registered with the atom
+		static QString getNameById(unsigned key_id);
+
+		//! \brief Returns the amount of names registered so far
+		static unsigned getKeyCount(void);
+};
+
+#endif
@@ -0,0 +1,209 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "flatattribsmap.h"
+
+FlatAttribsMap::FlatAttribsMap(void)
+{
+	used=0;
+}
+
+FlatAttribsMap::FlatAttribsMap(const attribs_map &attribs) : FlatAttribsMap()
+{
+	(*this)=attribs;
+}
+
+unsigned FlatAttribsMap::getIdealSlot(unsigned key_id) const
+{
+	//The atoms are sequential so masking them spreads the keys evenly over the table
+	return(key_id & (slots.size() - 1));
+}
+
+int FlatAttribsMap::findSlot(unsigned key_id) const
+{
+	unsigned idx=0, mask=0;
+
+	if(slots.empty() || key_id==0)
+		return(-1);
+
+	mask=slots.size() - 1;
+	idx=getIdealSlot(key_id);
+
+	//The table is never full so the probing always finds the key or a free slot
+	while(slots[idx].key_id!=0)
+	{
+		if(slots[idx].key_id==key_id)
+			return(idx);
+
+		idx=(idx + 1) & mask;
+	}
+
+	return(-1);
+}
+
+void FlatAttribsMap::reserve(unsigned count)
+{
+	unsigned capacity=MIN_CAPACITY, idx=0, mask=0;
+	vector<Slot> old_slots;
+
+	//Keeps the load factor under 75%
+	if(count * 4 < slots.size() * 3)
+		return;
+
+	while(count * 4 >= capacity * 3)
+		capacity*=2;
+
+	if(capacity <= slots.size())
+		return;
+
+	old_slots.swap(slots);
+	slots.resize(capacity);
+	mask=capacity - 1;
+
+	for(auto &slot : old_slots)
+	{
+		if(slot.key_id==0)
+			continue;
+
+		idx=getIdealSlot(slot.key_id);
+
+		while(slots[idx].key_id!=0)
+			idx=(idx + 1) & mask;
+
+		slots[idx].key_id=slot.key_id;
+		slots[idx].value.swap(slot.value);
+	}
+}
+
+FlatAttribsMap &FlatAttribsMap::operator = (const attribs_map &attribs)
+{
+	clear();
+	reserve(attribs.size());
+
+	for(auto &attr : attribs)
+		(*this)[attr.first]=attr.second;
+
+	return(*this);
+}
+
+QString &FlatAttribsMap::operator [] (const AttributeKey &key)
+{
+	unsigned idx=0, mask=0;
+	int slot_idx=findSlot(key.getId());
+
+	if(slot_idx >= 0)
+		return(slots[slot_idx].value);
+
+	reserve(used + 1);
+	mask=slots.size() - 1;
+	idx=getIdealSlot(key.getId());
+
+	while(slots[idx].key_id!=0)
+		idx=(idx + 1) & mask;
+
+	slots[idx].key_id=key.getId();
+	used++;
+
+	return(slots[idx].value);
+}
+
+unsigned FlatAttribsMap::count(const AttributeKey &key) const
+{
+	return(findSlot(key.getId()) >= 0 ? 1 : 0);
+}
+
+QString FlatAttribsMap::value(const AttributeKey &key) const
+{
+	int slot_idx=findSlot(key.getId());
+	return(slot_idx >= 0 ? slots[slot_idx].value : QString());
+}
+
+unsigned FlatAttribsMap::erase(const AttributeKey &key)
+{
+	int slot_idx=findSlot(key.getId());
+	unsigned idx=0, next=0, ideal=0, mask=0;
+
+	if(slot_idx < 0)
+		return(0);
+
+	/* Backward shift deletion: the entries placed after the removed one in the same probe
+	sequence are moved back so no tombstones are needed during the lookups */
+	mask=slots.size() - 1;
+	idx=next=slot_idx;
+
+	while(true)
+	{
+		next=(next + 1) & mask;
+
+		if(slots[next].key_id==0)
+			break;
+
+		ideal=getIdealSlot(slots[next].key_id);
+
+		//Moves the entry only if its ideal slot isn't cyclically placed in the interval (idx, next]
+		if((idx <= next) ? (ideal <= idx || ideal > next) : (ideal <= idx && ideal > next))
+		{
+			slots[idx].key_id=slots[next].key_id;
+			slots[idx].value.swap(slots[next].value);
+			idx=next;
+		}
+	}
+
+	slots[idx].key_id=0;
+	slots[idx].value.clear();
+	used--;
+
+	return(1);
+}
+
+void FlatAttribsMap::clear(void)
+{
+	if(used==0)
+		return;
+
+	for(auto &slot : slots)
+	{
+		slot.key_id=0;
+		slot.value.clear();
+	}
+
+	used=0;
+}
+
+unsigned FlatAttribsMap::size(void) const
+{
+	return(used);
+}
+
+bool FlatAttribsMap::empty(void) const
+{
+	return(used==0);
+}
+
+attribs_map FlatAttribsMap::toAttribsMap(void) const
+{
+	attribs_map attribs;
+
+	for(auto &slot : slots)
+	{
+		if(slot.key_id!=0)
+			attribs[AttributeKey::getNameById(slot.key_id)]=slot.value;
+	}
+
+	return(attribs);
+}
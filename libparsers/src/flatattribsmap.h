@@ -0,0 +1,91 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libparsers
+\class FlatAttribsMap
+\brief Implements an attributes container with the same usage of attribs_map (operator [], count(), erase(), clear())
+but stored in a flat open addressing table (linear probing) indexed by interned keys (see AttributeKey). Lookups
+don't walk a tree comparing strings and the slots are reused between clear() calls, so this container is intended to
+be used where the attributes are queried intensively, e.g., in the SchemaParser during the code generation.
+\note Differently from attribs_map the attributes aren't sorted. Use toAttribsMap() when an ordered iteration is needed.
+*/
+
+#ifndef FLAT_ATTRIBS_MAP_H
+#define FLAT_ATTRIBS_MAP_H
+
+#include "attributekey.h"
+#include "attribsmap.h"
+
+class FlatAttribsMap {
+	private:
+		struct Slot {
+			//! \brief Atom of the key stored in the slot (zero indicates a free slot)
+			unsigned key_id;
+			QString value;
+
+			Slot(void) { key_id=0; }
+		};
+
+		//! \brief Initial amount of slots. Must be a power of two
+		static const unsigned MIN_CAPACITY=64;
+
+		vector<Slot> slots;
+
+		//! \brief Amount of used slots
+		unsigned used;
+
+		//! \brief Returns the first slot where the key should be stored
+		unsigned getIdealSlot(unsigned key_id) const;
+
+		//! \brief Returns the slot index that holds the key or -1 if the key doesn't exist
+		int findSlot(unsigned key_id) const;
+
+		//! \brief Resizes the table in order to store at least the provided amount of attributes
+		void reserve(unsigned count);
+
+	public:
+		FlatAttribsMap(void);
+		FlatAttribsMap(const attribs_map &attribs);
+
+		//! \brief Replaces the whole content of the container by the attributes of the provided map
+		FlatAttribsMap &operator = (const attribs_map &attribs);
+
+		//! \brief Returns a reference to the value of the key inserting an empty value when the key doesn't exist
+		QString &operator [] (const AttributeKey &key);
+
+		//! \brief Returns 1 when the key exists or 0 otherwise
+		unsigned count(const AttributeKey &key) const;
+
+		//! \brief Returns the value of the key or an empty string when the key doesn't exist
+		QString value(const AttributeKey &key) const;
+
+		//! \brief Removes the key returning the amount of removed elements (0 or 1)
+		unsigned erase(const AttributeKey &key);
+
+		//! \brief Removes all the attributes keeping the allocated slots
+		void clear(void);
+
+		unsigned size(void) const;
+		bool empty(void) const;
+
+		//! \brief Returns the attributes in an ordered map
+		attribs_map toAttribsMap(void) const;
+};
+
+#endif
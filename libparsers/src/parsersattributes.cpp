@@ -47,6 +47,7 @@ namespace ParsersAttributes {
 	ARGUMENTS=QString("arguments"),
 	ASC_ORDER=QString("asc-order"),
 	ASSIGNMENT=QString("assignment"),
+	ATTACH_PARTITION=QString("attach-partition"),
 	ATTRIBUTE=QString("attribute"),
     AUTOVACUUM_COUNT=QString("autovacuum-count"),
     AUTOANALYZE_COUNT=QString("autoanalyze-count"),
@@ -143,6 +144,7 @@ namespace ParsersAttributes {
 	DEFAULT_COLLATION=QString("default-collation"),
 	DEFAULT_FOR_OPS=QString("default-for-ops"),
 	DEFAULT_OWNER=QString("default-owner"),
+	DEFAULT_PARTITION=QString("default-partition"),
 	DEFAULT_SCHEMA=QString("default-schema"),
 	DEFAULT_TABLESPACE=QString("default-tablespace"),
 	DEFAULT_VALUE=QString("default-value"),
@@ -177,6 +179,7 @@ namespace ParsersAttributes {
 	END_EXP=QString("end-exp"),
 	ELEMENT=QString("element"),
 	ELEMENTS=QString("elements"),
+	ENABLE_TRACING=QString("enable-tracing"),
 	ENCODING=QString("encoding"),
 	ENCRYPTED=QString("encrypted"),
 	ENUM_TYPE=QString("enumeration"),
@@ -295,10 +298,12 @@ namespace ParsersAttributes {
 	LINE_HIGHLIGHT_COLOR=QString("line-highlight-color"),
 	LISTEN_ADDRESSES=QString("listen-addresses"),
 	LOCALE=QString("locale"),
+	LOCK_TIMEOUT=QString("lock-timeout"),
 	LOCKER_ARC=QString("locker-arc"),
 	LOCKER_BODY=QString("locker-body"),
 	LOGIN=QString("login"),
 	LOOKAHEAD_CHAR=QString("lookahead-char"),
+	LOW_LOCK=QString("low-lock"),
 	MATERIALIZED=QString("materialized"),
 	MAX_CONNECTIONS=QString("max-connections"),
 	MAX_VALUE=QString("max-value"),
@@ -311,6 +316,7 @@ namespace ParsersAttributes {
 	MIN_VALUE=QString("min-value"),
 	MODE=QString("mode"),
 	MODEL_AUTHOR=QString("author"),
+	NAME_FILTER=QString("name-filter"),
 	NAME_LABEL=QString("name-label"),
 	NAME_PATTERNS=QString("name-patterns"),
 	NAME=QString("name"),
@@ -324,6 +330,7 @@ namespace ParsersAttributes {
 	NONE=QString("none"),
 	NOT_EXT_OBJECT=QString("not-ext-object"),
 	NOT_NULL=QString("not-null"),
+	NOT_VALID=QString("not-valid"),
 	NULLS_FIRST=QString("nulls-first"),
 	OBJ_SELECTION=QString("obj-selection"),
 	OBJECT_ID=QString("object-id"),
@@ -343,6 +350,8 @@ namespace ParsersAttributes {
 	OPERATOR_FUNC=QString("operfunc"),
 	OPERATOR=QString("operator"),
 	OPERATORS=QString("operators"),
+	OPTIONS=QString("options"),
+	OPTIONS_CMDS=QString("options-cmds"),
 	OUTPUT_FUNC=QString("output"),
 	OWNER_COLUMN=QString("owner-col"),
 	OWNER=QString("owner"),
@@ -359,6 +368,10 @@ namespace ParsersAttributes {
 	PARENTS=QString("parents"),
 	PARSABLE=QString("parsable"),
 	PARTIAL_MATCH=QString("partial-match"),
+	PARTITION_BOUND_EXPR=QString("partition-bound-expr"),
+	PARTITION_KEY=QString("partitionkey"),
+	PARTITIONED_TABLE=QString("partitioned-table"),
+	PARTITIONING=QString("partitioning"),
 	PASSWORD=QString("password"),
 	PASSWORD_ENCRYPTION=QString("password-encryption"),
 	PATH=QString("path"),
@@ -380,6 +393,8 @@ namespace ParsersAttributes {
 	PORTRAIT=QString("portrait"),
 	POSITION_INFO=QString("pos-info"),
 	POSITION=QString("position"),
+	POST_TRANSACT_CMDS=QString("post-transact-cmds"),
+	PRE_TRANSACT_CMDS=QString("pre-transact-cmds"),
 	PRECISION=QString("precision"),
 	PREDICATE=QString("predicate"),
 	PREFERRED=QString("preferred"),
@@ -418,10 +433,12 @@ namespace ParsersAttributes {
 	RELATIONSHIP_FK=QString("relfk"),
 	RELATIONSHIP_GEN=QString("relgen"),
 	RELATIONSHIP_NN=QString("relnn"),
+	RELATIONSHIP_PART=QString("relpart"),
 	RELATIONSHIP=QString("relationship"),
 	RENAME=QString("rename"),
 	REPLICATION=QString("replication"),
 	RESTRICTION_FUNC=QString("restriction"),
+	RESET_OPTIONS=QString("reset-options"),
 	RESTART_SEQ=QString("restart-seq"),
 	RETURN_TABLE=QString("return-table"),
 	RETURN_TYPE=QString("return-type"),
@@ -466,6 +483,7 @@ namespace ParsersAttributes {
 	SIGNATURE=QString("signature"),
 	SIMPLE_EXP=QString("simple-exp"),
 	SIMPLIFIED_OBJ_CREATION=QString("simplified-obj-creation"),
+	SIMPLIFIED_VIEW_ZOOM=QString("simplified-view-zoom"),
 	SINGLE_PK_COLUMN=QString("single-pk-col"),
 	SIZE=QString("size"),
 	SNIPPET=QString("snippet"),
@@ -495,6 +513,8 @@ namespace ParsersAttributes {
 	SSL_KEY_FILE=QString("ssl-key-file"),
 	START=QString("start"),
 	STATE_TYPE=QString("state-type"),
+	STATISTICS=QString("statistics"),
+	STMT_TIMEOUT=QString("stmt-timeout"),
 	STORAGE_PARAMS=QString("stg-params"),
 	STORAGE=QString("storage"),
 	STRATEGY_NUM=QString("stg-number"),
@@ -555,6 +575,8 @@ namespace ParsersAttributes {
 	USE_UNIQUE_NAMES=QString("use-unique-names"),
 	USING_EXP=QString("using-exp"),
     VACUUM_COUNT=QString("vacuum-count"),
+	VALIDATE=QString("validate"),
+	VALIDATE_CMDS=QString("validate-cmds"),
 	VALIDATOR_FUNC=QString("validator"),
 	VALIDATOR=QString("validator"),
 	VALIDITY=QString("validity"),
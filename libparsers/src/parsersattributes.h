@@ -61,6 +61,7 @@ namespace ParsersAttributes {
 	ARGUMENTS,
 	ASC_ORDER,
 	ASSIGNMENT,
+	ATTACH_PARTITION,
 	ATTRIBUTE,
 	AUTO_BROWSE_DB,
 	AUTOSAVE_INTERVAL,
@@ -155,6 +156,7 @@ namespace ParsersAttributes {
 	DEFAULT_COLLATION,
 	DEFAULT_FOR_OPS,
 	DEFAULT_OWNER,
+	DEFAULT_PARTITION,
 	DEFAULT_SCHEMA,
 	DEFAULT_TABLESPACE,
 	DEFAULT_VALUE,
@@ -188,6 +190,7 @@ namespace ParsersAttributes {
 	DYNAMIC_SHARED_MEMORY,
 	ELEMENT,
 	ELEMENTS,
+	ENABLE_TRACING,
 	ENCODING,
 	ENCRYPTED,
 	END_EXP,
@@ -302,10 +305,12 @@ namespace ParsersAttributes {
 	LINE_HIGHLIGHT_COLOR,
 	LISTEN_ADDRESSES,
 	LOCALE,
+	LOCK_TIMEOUT,
 	LOCKER_ARC,
 	LOCKER_BODY,
 	LOGIN,
 	LOOKAHEAD_CHAR,
+	LOW_LOCK,
 	MATERIALIZED,
 	MAX_CONNECTIONS,
 	MAX_VALUE,
@@ -318,6 +323,7 @@ namespace ParsersAttributes {
 	MIN_VALUE,
 	MODE,
 	MODEL_AUTHOR,
+	NAME_FILTER,
 	NAME_LABEL,
 	NAME_PATTERNS,
 	NAME,
@@ -331,6 +337,7 @@ namespace ParsersAttributes {
 	NONE,
 	NOT_EXT_OBJECT,
 	NOT_NULL,
+	NOT_VALID,
 	NULLS_FIRST,
 	OBJ_SELECTION,
 	OBJECT_ID,
@@ -350,6 +357,8 @@ namespace ParsersAttributes {
 	OPERATOR_FUNC,
 	OPERATOR,
 	OPERATORS,
+	OPTIONS,
+	OPTIONS_CMDS,
 	OUTPUT_FUNC,
 	OWNER_COLUMN,
 	OWNER,
@@ -366,6 +375,10 @@ namespace ParsersAttributes {
 	PARENTS,
 	PARSABLE,
 	PARTIAL_MATCH,
+	PARTITION_BOUND_EXPR,
+	PARTITION_KEY,
+	PARTITIONED_TABLE,
+	PARTITIONING,
 	PASSWORD,
 	PASSWORD_ENCRYPTION,
 	PATH,
@@ -387,6 +400,8 @@ namespace ParsersAttributes {
 	PORTRAIT,
 	POSITION_INFO,
 	POSITION,
+	POST_TRANSACT_CMDS,
+	PRE_TRANSACT_CMDS,
 	PRECISION,
 	PREDICATE,
 	PREFERRED,
@@ -425,9 +440,11 @@ namespace ParsersAttributes {
 	RELATIONSHIP_FK,
 	RELATIONSHIP_GEN,
 	RELATIONSHIP_NN,
+	RELATIONSHIP_PART,
 	RELATIONSHIP,
 	RENAME,
 	REPLICATION,
+	RESET_OPTIONS,
 	RESTART_SEQ,
 	RESTRICTION_FUNC,
 	RETURN_TABLE,
@@ -468,6 +485,7 @@ namespace ParsersAttributes {
 	SIGNATURE,
 	SIMPLE_EXP,
 	SIMPLIFIED_OBJ_CREATION,
+	SIMPLIFIED_VIEW_ZOOM,
 	SINGLE_PK_COLUMN,
 	SIZE,
 	SNIPPET,
@@ -497,6 +515,8 @@ namespace ParsersAttributes {
 	SSL_KEY_FILE,
 	START,
 	STATE_TYPE,
+	STATISTICS,
+	STMT_TIMEOUT,
 	STORAGE_PARAMS,
 	STORAGE,
 	STRATEGY_NUM,
@@ -553,6 +573,8 @@ namespace ParsersAttributes {
 	USE_SORTING,
 	USE_UNIQUE_NAMES,
 	USING_EXP,
+	VALIDATE,
+	VALIDATE_CMDS,
 	VALIDATOR_FUNC,
 	VALIDATOR,
 	VALIDITY,
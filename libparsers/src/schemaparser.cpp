@@ -18,6 +18,7 @@
 
 #include "schemaparser.h"
 #include "parsersattributes.h"
+#include "tracer.h"
 
 const char SchemaParser::CHR_COMMENT='#';
 const char SchemaParser::CHR_LINE_END='\n';
@@ -59,13 +60,12 @@ const QString SchemaParser::TOKEN_LT_OP=QString("<");
 const QString SchemaParser::TOKEN_GT_EQ_OP=QString(">=");
 const QString SchemaParser::TOKEN_LT_EQ_OP=QString("<=");
 
-const QRegExp SchemaParser::ATTR_REGEXP=QRegExp("^([a-z])([a-z]*|(\\d)*|(\\-)*|(_)*)+", Qt::CaseInsensitive);
-
 SchemaParser::SchemaParser(void)
 {
 	line=column=comment_count=0;
 	ignore_unk_atribs=ignore_empty_atribs=false;
 	pgsql_version=PgSQLVersions::DEFAULT_VERSION;
+	attr_name_regexp=QRegExp("^([a-z])([a-z]*|(\\d)*|(\\-)*|(_)*)+", Qt::CaseInsensitive);
 }
 
 void SchemaParser::setPgSQLVersion(const QString &pgsql_ver)
@@ -249,7 +249,7 @@ QString SchemaParser::getAttribute(void)
 						.arg(filename).arg((line + comment_count + 1)).arg((column+1)),
 						ERR_INV_SYNTAX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
-	else if(!ATTR_REGEXP.exactMatch(atrib))
+	else if(!attr_name_regexp.exactMatch(atrib))
 	{
 		throw Exception(QString(Exception::getErrorMessage(ERR_INV_ATTRIBUTE))
 						.arg(atrib).arg(filename).arg((line + comment_count + 1)).arg((column+1)),
@@ -642,7 +642,7 @@ void SchemaParser::defineAttribute(void)
 		attrib=(use_val_as_name ? attributes[new_attrib] : new_attrib);
 
 		//Checking if the attribute has a valid name
-		if(!ATTR_REGEXP.exactMatch(attrib))
+		if(!attr_name_regexp.exactMatch(attrib))
 		{
 			throw Exception(QString(Exception::getErrorMessage(ERR_INV_ATTRIBUTE))
 							.arg(attrib).arg(filename).arg((line + comment_count + 1)).arg((column+1)),
@@ -688,7 +688,7 @@ void SchemaParser::unsetAttribute(void)
 										.arg(attrib).arg(filename).arg((line + comment_count +1)).arg((column+1)),
 										ERR_UNK_ATTRIBUTE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 					}
-					else if(!ATTR_REGEXP.exactMatch(attrib))
+					else if(!attr_name_regexp.exactMatch(attrib))
 					{
 						throw Exception(QString(Exception::getErrorMessage(ERR_INV_ATTRIBUTE))
 										.arg(attrib).arg(filename).arg((line + comment_count + 1)).arg((column+1)),
@@ -714,6 +714,7 @@ void SchemaParser::unsetAttribute(void)
 bool SchemaParser::evaluateExpression(void)
 {
 	QString current_line, cond, attrib, prev_cond;
+	AttributeKey attrib_key;
 	bool error=false, end_eval=false, expr_is_true=true, attrib_true=true, comp_true=true;
 	unsigned attrib_count=0, and_or_count=0;
 
@@ -774,9 +775,10 @@ bool SchemaParser::evaluateExpression(void)
 
 				case CHR_INI_ATTRIB:
 					attrib=getAttribute();
+					attrib_key=AttributeKey(attrib);
 
 					//Raises an error if the attribute does is unknown
-					if(attributes.count(attrib)==0 && !ignore_unk_atribs)
+					if(attributes.count(attrib_key)==0 && !ignore_unk_atribs)
 					{
 						throw Exception(Exception::getErrorMessage(ERR_UNK_ATTRIBUTE)
 										.arg(attrib).arg(filename).arg((line + comment_count +1)).arg((column+1)),
@@ -796,7 +798,7 @@ bool SchemaParser::evaluateExpression(void)
 					if(!error)
 					{
 						//Appliyng the NOT operator if found
-						attrib_true=(cond==TOKEN_NOT ? attributes[attrib].isEmpty() : !attributes[attrib].isEmpty());
+						attrib_true=(cond==TOKEN_NOT ? attributes[attrib_key].isEmpty() : !attributes[attrib_key].isEmpty());
 
 						//Executing the AND operation if the token is found
 						if(cond==TOKEN_AND || prev_cond==TOKEN_AND)
@@ -1019,6 +1021,7 @@ QString SchemaParser::getCodeDefinition(attribs_map &attribs)
 	unsigned end_cnt, if_cnt;
 	int if_level, prev_if_level;
 	QString atrib, cond, prev_cond, word, meta;
+	AttributeKey atrib_key;
 	bool error, if_expr;
 	char chr;
 	vector<bool> vet_expif, vet_tk_if, vet_tk_then, vet_tk_else;
@@ -1101,8 +1104,11 @@ QString SchemaParser::getCodeDefinition(attribs_map &attribs)
 				case CHR_END_ATTRIB:
 					atrib=getAttribute();
 
+					//The name is interned once and the key is reused in all the lookups below
+					atrib_key=AttributeKey(atrib);
+
 					//Checks if the attribute extracted belongs to the passed list of attributes
-					if(attributes.count(atrib)==0)
+					if(attributes.count(atrib_key)==0)
 					{
 						if(!ignore_unk_atribs)
 						{
@@ -1111,7 +1117,7 @@ QString SchemaParser::getCodeDefinition(attribs_map &attribs)
 											ERR_UNK_ATTRIBUTE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 						}
 						else
-							attributes[atrib]=QString();
+							attributes[atrib_key]=QString();
 					}
 
 					//If the parser is inside an 'if / else' extracting tokens
@@ -1141,7 +1147,7 @@ QString SchemaParser::getCodeDefinition(attribs_map &attribs)
 					{
 						/* If the attribute has no value set and parser must not ignore empty values
 						raises an exception */
-						if(attributes[atrib].isEmpty() && !ignore_empty_atribs)
+						if(attributes[atrib_key].isEmpty() && !ignore_empty_atribs)
 						{
 							throw Exception(QString(Exception::getErrorMessage(ERR_UNDEF_ATTRIB_VALUE))
 											.arg(atrib).arg(filename).arg(line + comment_count +1).arg(column+1),
@@ -1150,7 +1156,7 @@ QString SchemaParser::getCodeDefinition(attribs_map &attribs)
 
 						/* If the parser is not in an if / else, concatenates the value of the attribute
 							directly in definition in sql */
-						object_def+=attributes[atrib];
+						object_def+=attributes[atrib_key];
 					}
 				break;
 
@@ -1425,6 +1431,8 @@ QString SchemaParser::getCodeDefinition(attribs_map &attribs)
 
 QString SchemaParser::getCodeDefinition(const QString &filename, attribs_map &attribs)
 {
+	TRACE_SCOPE_SAMPLED("schemaparser", filename);
+
 	try
 	{
 		loadFile(filename);
@@ -33,6 +33,7 @@
 #include <QTextStream>
 #include "xmlparser.h"
 #include "attribsmap.h"
+#include "flatattribsmap.h"
 #include "pgsqlversions.h"
 
 class SchemaParser {
@@ -90,9 +91,6 @@ class SchemaParser {
 		TOKEN_GT_EQ_OP,// >= (greater or equal to)
 		TOKEN_LT_EQ_OP;// <= (less or equal to)
 
-		//! \brief RegExp used to validate attribute names
-		static const QRegExp ATTR_REGEXP;
-
 		//! \brief Get an attribute name from the buffer on the current position
 		QString getAttribute(void);
 
@@ -180,7 +178,13 @@ class SchemaParser {
 				  reference to the line on file that has syntax errors */
 		comment_count;
 
-		attribs_map attributes;
+		//! \brief Attributes being used in the current code generation (copied from the map passed to getCodeDefinition)
+		FlatAttribsMap attributes;
+
+		/*! \brief RegExp used to validate attribute names. This is an instance member (instead of a static one) because
+		QRegExp::exactMatch() changes the internal state of the object, so a shared instance can't be used by parsers
+		running in different threads at the same time (e.g. the catalogs used in the parallel database import) */
+		QRegExp attr_name_regexp;
 
 		//! \brief PostgreSQL version currently used by the parser
 		QString pgsql_version;
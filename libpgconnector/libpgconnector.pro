@@ -15,11 +15,17 @@ windows: DESTDIR = $$PWD
 
 HEADERS += src/resultset.h \
 	   src/connection.h \
-	   src/catalog.h
+	   src/connectionpool.h \
+	   src/catalog.h \
+	   src/sqlstatementsplitter.h \
+	   src/asyncquery.h
 
 SOURCES += src/resultset.cpp \
 	   src/connection.cpp \
-	   src/catalog.cpp
+	   src/connectionpool.cpp \
+	   src/catalog.cpp \
+	   src/sqlstatementsplitter.cpp \
+	   src/asyncquery.cpp
 
 unix|windows: LIBS += $$PGSQL_LIB\
                     -L$$OUT_PWD/../libpgmodeler/ -lpgmodeler \
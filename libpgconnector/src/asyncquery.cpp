@@ -0,0 +1,212 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "asyncquery.h"
+
+AsyncQuery::AsyncQuery(QObject *parent) : QObject(parent)
+{
+	read_notifier=nullptr;
+	running=cancelled=has_error=false;
+}
+
+AsyncQuery::~AsyncQuery(void)
+{
+	try
+	{
+		if(running)
+			cancel(true);
+	}
+	catch(Exception &)
+	{}
+
+	connection.close();
+}
+
+void AsyncQuery::setConnection(const Connection &conn)
+{
+	if(running)
+		throw Exception(ERR_ASYNC_QUERY_RUNNING, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	if(read_notifier)
+	{
+		delete(read_notifier);
+		read_notifier=nullptr;
+	}
+
+	connection.close();
+	connection=conn;
+}
+
+void AsyncQuery::execute(const QString &sql)
+{
+	if(running)
+		throw Exception(ERR_ASYNC_QUERY_RUNNING, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	try
+	{
+		result.clearResultSet();
+		error=Exception();
+		cancelled=has_error=false;
+
+		if(!connection.isStablished())
+		{
+			connection.connect();
+
+			//A new connection may use another socket, so the notifier is recreated
+			if(read_notifier)
+			{
+				delete(read_notifier);
+				read_notifier=nullptr;
+			}
+		}
+
+		connection.sendCommand(sql);
+		running=true;
+
+		if(!read_notifier)
+		{
+			read_notifier=new QSocketNotifier(connection.getSocket(), QSocketNotifier::Read, this);
+			connect(read_notifier, SIGNAL(activated(int)), this, SLOT(consumeInput()));
+		}
+
+		read_notifier->setEnabled(true);
+	}
+	catch(Exception &e)
+	{
+		running=false;
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void AsyncQuery::consumeInput(void)
+{
+	ResultSet res;
+
+	if(!running)
+		return;
+
+	try
+	{
+		connection.consumeInput();
+
+		//Retrieving all the results already received (the last one is kept)
+		while(!connection.isBusy())
+		{
+			try
+			{
+				if(!connection.getNextResult(res))
+				{
+					finishCommand();
+					return;
+				}
+
+				if(!has_error)
+					result=res;
+			}
+			catch(Exception &e)
+			{
+				//The remaining results must be read before reporting the error
+				if(!has_error)
+				{
+					error=Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, e.getExtraInfo());
+					has_error=true;
+				}
+			}
+		}
+	}
+	catch(Exception &e)
+	{
+		//Failing to read the socket means that the connection is broken
+		error=Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		has_error=true;
+		connection.close();
+		finishCommand();
+	}
+}
+
+void AsyncQuery::finishCommand(void)
+{
+	running=false;
+
+	if(read_notifier)
+		read_notifier->setEnabled(false);
+
+	if(cancelled)
+	{
+		result.clearResultSet();
+		emit s_commandCancelled();
+	}
+	else if(has_error)
+	{
+		result.clearResultSet();
+		emit s_commandFailed(error);
+	}
+	else
+		emit s_commandFinished();
+}
+
+void AsyncQuery::cancel(bool wait)
+{
+	ResultSet res;
+	bool has_result=true;
+
+	if(!running)
+		return;
+
+	cancelled=true;
+	connection.requestCancel();
+
+	if(wait)
+	{
+		if(read_notifier)
+			read_notifier->setEnabled(false);
+
+		//Discarding the results until the server aborts the command (getNextResult() blocks here)
+		while(has_result)
+		{
+			try
+			{
+				has_result=connection.getNextResult(res);
+			}
+			catch(Exception &)
+			{}
+		}
+
+		finishCommand();
+	}
+}
+
+bool AsyncQuery::isRunning(void)
+{
+	return(running);
+}
+
+bool AsyncQuery::isCancelled(void)
+{
+	return(cancelled);
+}
+
+void AsyncQuery::getResultSet(ResultSet &res)
+{
+	res=result;
+}
+
+QStringList AsyncQuery::getNotices(void)
+{
+	return(connection.getNotices());
+}
@@ -0,0 +1,95 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgconnector
+\class AsyncQuery
+\brief Executes SQL commands without blocking the caller. The command is sent to the server and the results are
+read as they arrive through a socket notifier integrated to the event loop of the thread that owns the object,
+so several queries can run concurrently without creating one thread per operation. The completion of the command
+is informed through signals and the running command can be cancelled in the server.
+\note The object holds its own copy of the connection which is opened in the first execution and kept open
+between executions until setConnection() is called again or the object is destroyed.
+*/
+
+#ifndef ASYNC_QUERY_H
+#define ASYNC_QUERY_H
+
+#include "connection.h"
+#include <QObject>
+#include <QSocketNotifier>
+
+class AsyncQuery: public QObject {
+	private:
+		Q_OBJECT
+
+		Connection connection;
+
+		//! \brief Notifies when there is data to be read in the connection socket
+		QSocketNotifier *read_notifier;
+
+		//! \brief Stores the last result returned by the command
+		ResultSet result;
+
+		//! \brief Stores the error raised by the command (if any)
+		Exception error;
+
+		bool running, cancelled, has_error;
+
+		//! \brief Stops monitoring the connection socket and emits the signal related to the command completion
+		void finishCommand(void);
+
+	private slots:
+		//! \brief Reads the data available in the connection socket and retrieves the results already received
+		void consumeInput(void);
+
+	public:
+		AsyncQuery(QObject *parent=nullptr);
+		~AsyncQuery(void);
+
+		/*! \brief Defines the connection used to run the commands. The previous connection is closed.
+		This method raises an error if there is a running command */
+		void setConnection(const Connection &conn);
+
+		/*! \brief Sends the command to the server and returns immediately. One of the signals s_commandFinished(),
+		s_commandFailed() or s_commandCancelled() is emitted when the command completes.
+		This method raises an error if there is a running command */
+		void execute(const QString &sql);
+
+		/*! \brief Requests the cancel of the running command to the server. When wait is true the method blocks until
+		the server aborts the command, otherwise s_commandCancelled() is emitted later */
+		void cancel(bool wait=false);
+
+		bool isRunning(void);
+
+		bool isCancelled(void);
+
+		/*! \brief Moves the result of the last statement executed by the command to the provided result set.
+		 The result is available only after the emission of s_commandFinished() */
+		void getResultSet(ResultSet &res);
+
+		//! \brief Returns the notices generated by the last command
+		QStringList getNotices(void);
+
+	signals:
+		void s_commandFinished(void);
+		void s_commandFailed(Exception e);
+		void s_commandCancelled(void);
+};
+
+#endif
@@ -16,6 +16,8 @@
 # Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
 */
 #include "catalog.h"
+#include <QCryptographicHash>
+#include "tracer.h"
 
 const QString Catalog::QUERY_LIST=QString("list");
 const QString Catalog::QUERY_ATTRIBS=QString("attribs");
@@ -26,6 +28,17 @@ const QString Catalog::BOOL_FIELD=QString("_bool");
 const QString Catalog::ARRAY_PATTERN=QString("((\\[)[0-9]+(\\:)[0-9]+(\\])=)?(\\{)((.)+(,)*)*(\\})$");
 const QString Catalog::GET_EXT_OBJS_SQL=QString("SELECT objid AS oid FROM pg_depend WHERE objid > 0 AND refobjid > 0 AND deptype='e'");
 const QString Catalog::PGMODELER_TEMP_DB_OBJ=QString("__pgmodeler_tmp");
+const QString Catalog::PREPARED_STMT_PREFIX=QString("pgmodeler_catalog_");
+const QString Catalog::PARAM_PLACEHOLDER=QString("__pgmodeler_param%1__");
+
+const QStringList Catalog::QUERY_PARAMS={ ParsersAttributes::SCHEMA, ParsersAttributes::TABLE, ParsersAttributes::NAME,
+																					ParsersAttributes::FILTER_OIDS, ParsersAttributes::NAME_FILTER };
+
+//The OIDs below are the ones of the types text and oid[] defined on PostgreSQL source code src/include/catalog/pg_type.h
+const vector<Oid> Catalog::QUERY_PARAM_TYPES={ 25, 25, 25, 1028, 25 };
+
+map<QString, QString> Catalog::query_shapes;
+QMutex Catalog::cache_mutex;
 
 bool Catalog::use_cached_queries=false;
 attribs_map Catalog::catalog_queries;
@@ -62,14 +75,28 @@ map<ObjectType, QString> Catalog::name_fields=
 	{OBJ_EVENT_TRIGGER, "evtname"}, {OBJ_POLICY, "polname"}
 };
 
+map<ObjectType, QString> Catalog::sch_fields=
+{ {OBJ_EXTENSION, "ex.extnamespace"}, {OBJ_FUNCTION, "pr.pronamespace"}, {OBJ_AGGREGATE, "pr.pronamespace"},
+	{OBJ_OPERATOR, "op.oprnamespace"}, {OBJ_OPCLASS, "op.opcnamespace"}, {OBJ_OPFAMILY, "op.opfnamespace"},
+	{OBJ_COLLATION, "cl.collnamespace"}, {OBJ_CONVERSION, "cn.connamespace"}, {OBJ_VIEW, "vw.relnamespace"},
+	{OBJ_SEQUENCE, "sq.relnamespace"}, {OBJ_DOMAIN, "dm.typnamespace"}, {OBJ_TYPE, "tp.typnamespace"},
+	{OBJ_TABLE, "tb.relnamespace"}
+};
+
 Catalog::Catalog(void)
 {
 	last_sys_oid=0;
+	cache_results=false;
 	setFilter(EXCL_EXTENSION_OBJS | EXCL_SYSTEM_OBJS);
+
+	//Catalog queries don't depend on session state so the connections are always taken from the pool
+	connection.setPooled(true);
 }
 
 Catalog::Catalog(const Catalog &catalog)
 {
+	cache_results=false;
+	connection.setPooled(true);
 	(*this)=catalog;
 }
 
@@ -79,11 +106,21 @@ void Catalog::setConnection(Connection &conn)
 	{
 		ResultSet res;
 		QStringList ext_obj;
+		bool same_conn=(connection.getConnectionParams()==conn.getConnectionParams());
 
-		connection.close();
+		closeConnection();
 		connection.setConnectionParams(conn.getConnectionParams());
 		connection.connect();
 
+		/* While the results are cached for the same server and database the data below is kept as well,
+		both are discarded only on an explicit refresh (see invalidateResultCache()) or when the connection changes */
+		if(same_conn && cache_results && !result_cache.empty())
+			return;
+
+		invalidateResultCache();
+		ext_obj_oids.clear();
+		not_ext_queries.clear();
+
 		//Retrieving the last system oid
 		executeCatalogQuery(QUERY_LIST, OBJ_DATABASE, res, true,
 		{{ParsersAttributes::NAME, conn.getConnectionParam(Connection::PARAM_DB_NAME)}});
@@ -109,15 +146,35 @@ void Catalog::setConnection(Connection &conn)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
 void Catalog::closeConnection(void)
 {
+	/* The cached results are kept since the catalog is usually connected again to the same database,
+	the prepared statements are tracked by the connection pool which keeps them between sessions */
 	connection.close();
 }
 
+void Catalog::setResultCacheEnabled(bool value)
+{
+	cache_results=value;
+
+	if(!cache_results)
+		invalidateResultCache();
+}
+
+bool Catalog::isResultCacheEnabled(void)
+{
+	return(cache_results);
+}
+
+void Catalog::invalidateResultCache(void)
+{
+	result_cache.clear();
+}
+
 void Catalog::setFilter(unsigned filter)
 {
 	bool list_all=(LIST_ALL_OBJS & filter) == LIST_ALL_OBJS;
@@ -157,6 +214,8 @@ bool Catalog::isExtensionObject(unsigned oid)
 
 void Catalog::loadCatalogQuery(const QString &qry_id)
 {
+	QMutexLocker locker(&cache_mutex);
+
 	if((!use_cached_queries) ||
 			(use_cached_queries && catalog_queries.count(qry_id)==0))
 	{
@@ -166,8 +225,7 @@ void Catalog::loadCatalogQuery(const QString &qry_id)
 						  qry_id + GlobalAttributes::SCHEMA_EXT);
 
 		if(!input.open(QFile::ReadOnly))
-			throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_ACCESSED).arg(input.fileName()),
-							ERR_FILE_DIR_NOT_ACCESSED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ERR_FILE_DIR_NOT_ACCESSED, { input.fileName() },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 		catalog_queries[qry_id]=QString(input.readAll());
 		input.close();
@@ -176,9 +234,28 @@ void Catalog::loadCatalogQuery(const QString &qry_id)
 	schparser.loadBuffer(catalog_queries[qry_id]);
 }
 
-QString Catalog::getCatalogQuery(const QString &qry_type, ObjectType obj_type, bool single_result, attribs_map attribs)
+QString Catalog::getCatalogQuery(const QString &qry_type, ObjectType obj_type, bool single_result, attribs_map attribs, QStringList &param_vals)
 {
-	QString sql, custom_filter;
+	QString sql, custom_filter, shape_key, placeholder;
+	attribs_map inline_attribs;
+	bool has_placeholders=false, has_custom_filter=false;
+
+	param_vals.clear();
+
+	/* Replacing the values of the parameterized attributes by placeholders. Only non-empty
+	values are replaced so the conditional blocks in the query files are evaluated in the same way */
+	for(int idx=0; idx < QUERY_PARAMS.size(); idx++)
+	{
+		QString value=attribs.count(QUERY_PARAMS[idx]) ? attribs[QUERY_PARAMS[idx]] : QString();
+
+		if(!value.isEmpty() && QUERY_PARAMS[idx]==ParsersAttributes::FILTER_OIDS)
+			value=QString("{%1}").arg(value);
+
+		param_vals.push_back(value);
+
+		if(!value.isEmpty() && QUERY_PARAMS[idx]!=ParsersAttributes::NAME_FILTER)
+			attribs[QUERY_PARAMS[idx]]=PARAM_PLACEHOLDER.arg(idx + 1);
+	}
 
 	/* Escaping apostrophe (') in the attributes values to avoid SQL errors
 	 * due to support to this char in the middle of objects' names */
@@ -206,9 +283,36 @@ QString Catalog::getCatalogQuery(const QString &qry_type, ObjectType obj_type, b
 	if(attribs.count(ParsersAttributes::CUSTOM_FILTER))
 	{
 		custom_filter=attribs[ParsersAttributes::CUSTOM_FILTER];
+		has_custom_filter=!custom_filter.isEmpty();
 		attribs.erase(ParsersAttributes::CUSTOM_FILTER);
 	}
 
+	/* Converting the name filter into an expression over the object's name field so only the objects
+	which names start with the provided pattern are returned by the server */
+	if(attribs.count(ParsersAttributes::NAME_FILTER))
+	{
+		int param_idx=QUERY_PARAMS.indexOf(ParsersAttributes::NAME_FILTER);
+		QString name_filter=param_vals[param_idx], name_expr;
+
+		attribs.erase(ParsersAttributes::NAME_FILTER);
+		param_vals[param_idx].clear();
+
+		if(!name_filter.isEmpty() && !name_fields[obj_type].isEmpty())
+		{
+			//Escaping the LIKE wildcards so they are matched literally
+			name_filter.replace(QString("\\"), QString("\\\\"));
+			name_filter.replace(QString("%"), QString("\\%"));
+			name_filter.replace(QString("_"), QString("\\_"));
+			param_vals[param_idx]=name_filter + QString("%");
+			name_expr=QString("%1 ILIKE $%2").arg(name_fields[obj_type]).arg(param_idx + 1);
+
+			if(custom_filter.isEmpty())
+				custom_filter=name_expr;
+			else
+				custom_filter=QString("(%1) AND (%2)").arg(custom_filter, name_expr);
+		}
+	}
+
 	if(exclude_ext_objs && obj_type!=OBJ_DATABASE &&	obj_type!=OBJ_ROLE && obj_type!=OBJ_TABLESPACE && obj_type!=OBJ_EXTENSION)
 	{
 		if(ext_oid_fields.count(obj_type)==0)
@@ -217,11 +321,80 @@ QString Catalog::getCatalogQuery(const QString &qry_type, ObjectType obj_type, b
 			attribs[ParsersAttributes::NOT_EXT_OBJECT]=getNotExtObjectQuery(ext_oid_fields[obj_type]);
 	}
 
+	attribs[ParsersAttributes::PGSQL_VERSION]=schparser.getPgSQLVersion();
+
+	//The query shape is determined by all the attributes (with placeholders in place of the parameters values)
+	shape_key=QString("%1:%2:%3:%4\n").arg(obj_type).arg(single_result).arg(custom_filter).arg(qry_type);
+
+	for(auto &attr : attribs)
+		shape_key+=attr.first + QChar('=') + attr.second + QChar('\n');
+
+	shape_key=QString(QCryptographicHash::hash(shape_key.toUtf8(), QCryptographicHash::Md5).toHex());
+
+	cache_mutex.lock();
+	if(query_shapes.count(shape_key))
+		sql=query_shapes[shape_key];
+	cache_mutex.unlock();
+
+	if(!sql.isEmpty())
+		return(sql);
+
+	inline_attribs=attribs;
+	sql=generateCatalogQuery(obj_type, single_result, attribs, custom_filter);
+
+	//Replacing the placeholders by the parameters references
+	for(int idx=0; idx < QUERY_PARAMS.size(); idx++)
+	{
+		placeholder=PARAM_PLACEHOLDER.arg(idx + 1);
+		sql.replace(QString("'%1'").arg(placeholder), QString("$%1").arg(idx + 1));
+		sql.replace(QRegExp(QString("IN\\s*\\(\\s*%1\\s*\\)").arg(placeholder)), QString("= ANY($%1)").arg(idx + 1));
+		has_placeholders=has_placeholders || sql.contains(placeholder);
+	}
+
+	/* If a placeholder is used in a form that can't be replaced by a parameter reference
+	the query is generated with the values inlined (not cached) */
+	if(has_placeholders)
+	{
+		for(int idx=0; idx < QUERY_PARAMS.size(); idx++)
+		{
+			if(inline_attribs.count(QUERY_PARAMS[idx]) && !param_vals[idx].isEmpty())
+			{
+				QString value=param_vals[idx];
+
+				if(QUERY_PARAMS[idx]==ParsersAttributes::FILTER_OIDS)
+					value=value.mid(1, value.size() - 2);
+
+				inline_attribs[QUERY_PARAMS[idx]]=value.replace(QChar('\''), QString("''"));
+			}
+		}
+
+		return(generateCatalogQuery(obj_type, single_result, inline_attribs, custom_filter));
+	}
+
+	/* Queries with custom filters usually carry values (e.g. oids) in the filter, so their shapes hardly repeat
+	and aren't stored. The amount of shapes is also limited since the cache is shared by all catalogs */
+	if(!has_custom_filter)
+	{
+		cache_mutex.lock();
+
+		if(query_shapes.size() >= MAX_QUERY_SHAPES)
+			query_shapes.clear();
+
+		query_shapes[shape_key]=sql;
+		cache_mutex.unlock();
+	}
+
+	return(sql);
+}
+
+QString Catalog::generateCatalogQuery(ObjectType obj_type, bool single_result, attribs_map &attribs, const QString &custom_filter)
+{
+	QString sql;
+
 	loadCatalogQuery(BaseObject::getSchemaName(obj_type));
 	schparser.ignoreUnkownAttributes(true);
 	schparser.ignoreEmptyAttributes(true);
 
-	attribs[ParsersAttributes::PGSQL_VERSION]=schparser.getPgSQLVersion();
 	sql=schparser.getCodeDefinition(attribs).simplified();
 
 	//Appeding the custom filter to the whole catalog query
@@ -248,15 +421,74 @@ QString Catalog::getCatalogQuery(const QString &qry_type, ObjectType obj_type, b
 	return(sql);
 }
 
+void Catalog::executeCatalogCommand(const QString &sql, const QStringList &param_vals, ResultSet &result, bool prepare)
+{
+	QString stmt_name, cache_key;
+
+	if(cache_results)
+	{
+		cache_key=QString(QCryptographicHash::hash((sql + QChar('\n') + param_vals.join(QChar('\n'))).toUtf8(),
+																							 QCryptographicHash::Md5).toHex());
+
+		if(result_cache.count(cache_key))
+		{
+			TRACE_COUNTER("catalog", QString("cached results"), 1);
+			result=result_cache[cache_key];
+			return;
+		}
+	}
+
+	if(!prepare)
+		connection.executeDMLCommand(sql, QUERY_PARAM_TYPES, param_vals, result);
+	else
+	{
+		stmt_name=PREPARED_STMT_PREFIX + QString(QCryptographicHash::hash(sql.toUtf8(), QCryptographicHash::Md5).toHex());
+
+		if(!connection.isStatementPrepared(stmt_name))
+			connection.prepareCommand(stmt_name, sql, QUERY_PARAM_TYPES);
+
+		try
+		{
+			connection.executePreparedCommand(stmt_name, param_vals, result);
+		}
+		catch(Exception &e)
+		{
+			//If the session was reset meanwhile (invalid_sql_statement_name) the statement is prepared again
+			if(e.getExtraInfo()!=QString("26000"))
+				throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			connection.prepareCommand(stmt_name, sql, QUERY_PARAM_TYPES);
+			connection.executePreparedCommand(stmt_name, param_vals, result);
+		}
+	}
+
+	if(cache_results)
+		result_cache[cache_key]=result;
+}
+
 void Catalog::executeCatalogQuery(const QString &qry_type, ObjectType obj_type, ResultSet &result, bool single_result, attribs_map attribs)
 {
+	TRACE_SCOPE_SAMPLED("catalog", qry_type);
+
 	try
 	{
-		connection.executeDMLCommand(getCatalogQuery(qry_type, obj_type, single_result, attribs), result);
+		QStringList param_vals;
+		QString sql;
+
+		/* Only the queries without custom filters are prepared since they are the ones which shapes repeat,
+		custom filters usually carry values (e.g. oids) that would create a new statement on each call */
+		bool prepare=!attribs.count(ParsersAttributes::CUSTOM_FILTER) ||
+								 attribs[ParsersAttributes::CUSTOM_FILTER].isEmpty();
+
+		sql=getCatalogQuery(qry_type, obj_type, single_result, attribs, param_vals);
+		executeCatalogCommand(sql, param_vals, result, prepare);
+
+		TRACE_COUNTER("catalog", QString("queries"), 1);
+		TRACE_SAMPLE(QString("catalog.%1 rows").arg(BaseObject::getSchemaName(obj_type)), result.getTupleCount());
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__,
 						QString("catalog: %1").arg(BaseObject::getSchemaName(obj_type)));
 	}
 }
@@ -276,7 +508,7 @@ unsigned Catalog::getObjectCount(ObjectType obj_type, const QString &sch_name, c
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -324,7 +556,7 @@ void Catalog::getObjectsOIDs(map<ObjectType, vector<unsigned> > &obj_oids, map<u
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -352,7 +584,7 @@ attribs_map Catalog::getObjectsNames(ObjectType obj_type, const QString &sch_nam
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -363,8 +595,10 @@ vector<attribs_map> Catalog::getObjectsNames(vector<ObjectType> obj_types, const
 		ResultSet res;
 		vector<attribs_map> objects;
 		QString sql, select_kw=QString("SELECT");
-		QStringList queries;
+		QStringList queries, param_vals;
 		attribs_map attribs;
+		bool prepare=!extra_attribs.count(ParsersAttributes::CUSTOM_FILTER) ||
+								 extra_attribs[ParsersAttributes::CUSTOM_FILTER].isEmpty();
 
 		extra_attribs[ParsersAttributes::SCHEMA]=sch_name;
 		extra_attribs[ParsersAttributes::TABLE]=tab_name;
@@ -372,7 +606,7 @@ vector<attribs_map> Catalog::getObjectsNames(vector<ObjectType> obj_types, const
 		for(ObjectType obj_type : obj_types)
 		{
 			//Build the catalog query for the specified object type
-			sql=getCatalogQuery(QUERY_LIST, obj_type, false, extra_attribs);
+			sql=getCatalogQuery(QUERY_LIST, obj_type, false, extra_attribs, param_vals);
 
 			/* For certain objects the catalog query will be empty due to the
 			absence of that kind of element in the version of the database.
@@ -394,7 +628,8 @@ vector<attribs_map> Catalog::getObjectsNames(vector<ObjectType> obj_types, const
 		if(sort_results)
 			sql += QString(" ORDER BY oid, object_type");
 
-		connection.executeDMLCommand(sql, res);
+		//All the subqueries receive the same attributes so they share the same parameters
+		executeCatalogCommand(sql, param_vals, res, prepare);
 
 		if(res.accessTuple(ResultSet::FIRST_TUPLE))
 		{
@@ -413,7 +648,60 @@ vector<attribs_map> Catalog::getObjectsNames(vector<ObjectType> obj_types, const
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+}
+
+attribs_map Catalog::getObjectsSchemas(vector<ObjectType> obj_types, attribs_map extra_attribs)
+{
+	try
+	{
+		ResultSet res;
+		attribs_map schemas;
+		QString sql, select_kw=QString("SELECT");
+		QStringList queries, param_vals;
+		bool prepare=!extra_attribs.count(ParsersAttributes::CUSTOM_FILTER) ||
+								 extra_attribs[ParsersAttributes::CUSTOM_FILTER].isEmpty();
+
+		for(ObjectType obj_type : obj_types)
+		{
+			if(sch_fields.count(obj_type)==0)
+				continue;
+
+			sql=getCatalogQuery(QUERY_LIST, obj_type, false, extra_attribs, param_vals);
+
+			if(!sql.isEmpty())
+			{
+				//Injecting the schema oid field so the listing query can be used as a subquery returning only the schemas
+				sql.replace(sql.indexOf(select_kw), select_kw.size(),
+										QString("%1 %2 AS sch_oid, ").arg(select_kw).arg(sch_fields[obj_type]));
+
+				queries.push_back(QString("SELECT sch_oid FROM (%1\n) AS _obj%2").arg(sql).arg(obj_type));
+			}
+		}
+
+		if(queries.isEmpty())
+			return(schemas);
+
+		sql=QString("SELECT oid, nspname AS name FROM pg_namespace WHERE oid IN (%1)").arg(queries.join(QString(" UNION ")));
+
+		//All the subqueries receive the same attributes so they share the same parameters
+		executeCatalogCommand(sql, param_vals, res, prepare);
+
+		if(res.accessTuple(ResultSet::FIRST_TUPLE))
+		{
+			do
+			{
+				schemas[res.getColumnValue(ParsersAttributes::OID)]=res.getColumnValue(ParsersAttributes::NAME);
+			}
+			while(res.accessTuple(ResultSet::NEXT_TUPLE));
+		}
+
+		return(schemas);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -439,7 +727,7 @@ attribs_map Catalog::getAttributes(const QString &obj_name, ObjectType obj_type,
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -472,7 +760,7 @@ vector<attribs_map> Catalog::getMultipleAttributes(ObjectType obj_type, attribs_
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -484,13 +772,19 @@ QString Catalog::getCommentQuery(const QString &oid_field, bool is_shared_obj)
 	{
 		attribs_map attribs={{ParsersAttributes::OID, oid_field},
 												 {ParsersAttributes::SHARED_OBJ, (is_shared_obj ? ParsersAttributes::_TRUE_ : QString())}};
+		QString key=oid_field + (is_shared_obj ? QString(":shared") : QString());
+
+		if(!comment_queries.count(key))
+		{
+			loadCatalogQuery(query_id);
+			comment_queries[key]=schparser.getCodeDefinition(attribs).simplified();
+		}
 
-		loadCatalogQuery(query_id);
-		return(schparser.getCodeDefinition(attribs).simplified());
+		return(comment_queries[key]);
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__,
 						QString("catalog: %1").arg(query_id));
 	}
 }
@@ -504,13 +798,18 @@ QString Catalog::getNotExtObjectQuery(const QString &oid_field)
 		attribs_map attribs={{ParsersAttributes::OID, oid_field},
 							 {ParsersAttributes::EXT_OBJ_OIDS, ext_obj_oids}};
 
+		//The subquery depends only on the extension objects' oids so it's generated once per connection
+		if(!not_ext_queries.count(oid_field))
+		{
+			loadCatalogQuery(query_id);
+			not_ext_queries[oid_field]=schparser.getCodeDefinition(attribs).simplified();
+		}
 
-		loadCatalogQuery(query_id);
-		return(schparser.getCodeDefinition(attribs).simplified());
+		return(not_ext_queries[oid_field]);
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__,
 						QString("catalog: %1").arg(query_id));
 	}
 }
@@ -575,7 +874,7 @@ vector<attribs_map> Catalog::getObjectsAttributes(ObjectType obj_type, const QSt
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__,
 						QApplication::translate("Catalog","Object type: %1","", -1).arg(BaseObject::getSchemaName(obj_type)));
 	}
 }
@@ -589,7 +888,7 @@ attribs_map Catalog::getObjectAttributes(ObjectType obj_type, unsigned oid, cons
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__,
 						QApplication::translate("Catalog","Object type: %1","", -1).arg(BaseObject::getSchemaName(obj_type)));
 	}
 }
@@ -620,7 +919,7 @@ QString Catalog::getObjectOID(const QString &name, ObjectType obj_type, const QS
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__,
 						QApplication::translate("Catalog","Object type: %1","", -1).arg(BaseObject::getSchemaName(obj_type)));
 	}
 }
@@ -659,7 +958,7 @@ attribs_map Catalog::getServerAttributes(void)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e,
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__,
 						QApplication::translate("Catalog","Object type: server","", -1));
 	}
 
@@ -774,10 +1073,13 @@ void Catalog::operator = (const Catalog &catalog)
 		this->exclude_sys_objs=catalog.exclude_sys_objs;
 		this->exclude_array_types=catalog.exclude_array_types;
 		this->list_only_sys_objs=catalog.list_only_sys_objs;
+		this->cache_results=catalog.cache_results;
+		this->not_ext_queries.clear();
+		this->result_cache.clear();
 		this->connection.connect();
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
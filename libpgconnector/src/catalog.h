@@ -31,6 +31,8 @@ This class is the basis for the reverse engineering feature.
 #include "tableobject.h"
 #include <QTextStream>
 #include <QApplication>
+#include <QMutex>
+#include <set>
 
 class Catalog {
 	private:
@@ -47,7 +49,40 @@ class Catalog {
 		GET_EXT_OBJS_SQL,
 
 		//! \brief This pattern matches the PostgreSQL array values in format [n:n]={a,b,c,d,...} or {a,b,c,d,...}
-		ARRAY_PATTERN;
+		ARRAY_PATTERN,
+
+		//! \brief Prefix of the names of the prepared statements created by the catalog
+		PREPARED_STMT_PREFIX,
+
+		//! \brief Placeholder used in place of the parameterized attributes values while generating the catalog queries
+		PARAM_PLACEHOLDER;
+
+		/*! \brief Attributes which values are sent as parameters ($1, $2, ...) instead of being inlined in the catalog
+		queries. The position in the list is the number of the parameter */
+		static const QStringList QUERY_PARAMS;
+
+		//! \brief Data types (OIDs) of the catalog query parameters (same order as QUERY_PARAMS)
+		static const vector<Oid> QUERY_PARAM_TYPES;
+
+		/*! \brief Stores the parameterized catalog queries already generated by SchemaParser indexed by the hash of
+		the attributes used to generate them. This way the same query shape isn't generated twice.
+		The cache is cleared when it reaches MAX_QUERY_SHAPES entries */
+		static map<QString, QString> query_shapes;
+
+		//! \brief Maximum amount of query shapes kept in cache
+		static const unsigned MAX_QUERY_SHAPES=500;
+
+		//! \brief Guards the static caches (query shapes and query files) since catalogs are used in several threads (import, diff)
+		static QMutex cache_mutex;
+
+		//! \brief Results of the catalog queries executed in the current connection indexed by the hash of the query and its parameters
+		map<QString, ResultSet> result_cache;
+
+		//! \brief Indicates if the results of catalog queries must be cached (see setResultCacheEnabled())
+		bool cache_results;
+
+		//! \brief Stores the subqueries generated by getNotExtObjectQuery() and getCommentQuery() indexed by their arguments
+		attribs_map not_ext_queries, comment_queries;
 
 		/*! \brief Stores in comma seperated way the oids of all objects created by extensions. This
 		attribute is use when filtering objects that are created by extensions */
@@ -60,6 +95,10 @@ class Catalog {
 		/*! \brief This map stores the name field for each object type. Refer to catalog query schema files for details */
 		static map<ObjectType, QString> name_fields;
 
+		/*! \brief This map stores the field that holds the schema oid for each object type that belongs to schemas.
+		Refer to catalog query schema files for details */
+		static map<ObjectType, QString> sch_fields;
+
 		/*! \brief This map stores the oid field name that is used to check if the object (or its parent) is part of a extension
 		(see getNotExtObjectQuery()). By default the attribute oid_fields is used instead for that purpose, but, for some objects,
 		there are different fields that tells if the object (or its parent) is part of extension. */
@@ -98,11 +137,23 @@ class Catalog {
 		/*! \brief Executes a query on the catalog for the specified object type. If the parameter 'single_result' is true
 		the query will return only one tuple on the result set. Additional attributes can be passed so that SchemaParser will
 		use them when parsing the schema file for the object. A special extra attribute is accepted but not passed to SchemaParser:
-		ParsersAttributes::CUSTOM_FILTER that will be appended to the current filter expression */
+		ParsersAttributes::CUSTOM_FILTER that will be appended to the current filter expression. The extra attribute
+		ParsersAttributes::NAME_FILTER is also handled specially: it is converted to a case insensitive "starts with"
+		comparison over the object's name field so the filtering is done on the server side */
 		void executeCatalogQuery(const QString &qry_type, ObjectType obj_type, ResultSet &result, bool single_result=false, attribs_map attribs=attribs_map());
 
-		//! \brief Returns the catalog query according to the type of the object type provided
-		QString getCatalogQuery(const QString &qry_type, ObjectType obj_type, bool single_result=false, attribs_map attribs=attribs_map());
+		/*! \brief Returns the catalog query according to the type of the object type provided. The values of the attributes listed in
+		QUERY_PARAMS are replaced by parameters and stored in param_vals. The generated query is cached so the next calls with the same
+		attributes (except the parameterized values) don't need to run the SchemaParser again */
+		QString getCatalogQuery(const QString &qry_type, ObjectType obj_type, bool single_result, attribs_map attribs, QStringList &param_vals);
+
+		//! \brief Generates the catalog query running the SchemaParser over the query file of the object type
+		QString generateCatalogQuery(ObjectType obj_type, bool single_result, attribs_map &attribs, const QString &custom_filter);
+
+		/*! \brief Executes a catalog query generated by getCatalogQuery(). When 'prepare' is true the query is compiled into a
+		server side prepared statement in the first execution and the next executions only bind the parameters. The result is
+		cached when the result cache is enabled */
+		void executeCatalogCommand(const QString &sql, const QStringList &param_vals, ResultSet &result, bool prepare);
 
 		/*! \brief Recreates the attribute map in such way that attribute names that have
 		underscores have this char replaced by dashes. Another special operation made is to replace
@@ -158,6 +209,17 @@ class Catalog {
 		//! \brief Configures the catalog query filter
 		void setFilter(unsigned filter);
 
+		/*! \brief Enables the caching of the catalog queries results in the current connection. Useful when the same objects
+		are queried several times (e.g. the database explorer). The cache is kept when the catalog is reconnected to the same database
+		and is discarded only when the connection changes or via invalidateResultCache() */
+		void setResultCacheEnabled(bool value);
+
+		//! \brief Returns if the catalog queries results are cached
+		bool isResultCacheEnabled(void);
+
+		//! \brief Discards all the cached catalog queries results forcing the next queries to reach the server
+		void invalidateResultCache(void);
+
 		//! \brief Returns the last system object oid registered on the database
 		unsigned getLastSysObjectOID(void);
 
@@ -185,6 +247,11 @@ class Catalog {
 		the specified list of types.	A schema name can be specified in order to filter only objects of the specifed schema */
 		vector<attribs_map> getObjectsNames(vector<ObjectType> obj_types, const QString &sch_name=QString(), const QString &tab_name=QString(), attribs_map extra_attribs=attribs_map(), bool sort_results=false);
 
+		/*! \brief Returns an attributes map containing the oids (key) and names (values) of the schemas that contain at least
+		one object of the specified types. All types are queried at once and the extra attributes (e.g. the name filter) are
+		applied to the objects, not to the schemas. Types that don't belong to schemas are ignored */
+		attribs_map getObjectsSchemas(vector<ObjectType> obj_types, attribs_map extra_attribs=attribs_map());
+
 		//! \brief Returns a set of multiple attributes (several tuples) for the specified object type
 		vector<attribs_map> getMultipleAttributes(ObjectType obj_type, attribs_map extra_attribs=attribs_map());
 
@@ -20,6 +20,7 @@
 #include <QTextStream>
 #include <iostream>
 #include "parsersattributes.h"
+#include "tracer.h"
 
 const QString Connection::SSL_DESABLE=QString("disable");
 const QString Connection::SSL_ALLOW=QString("allow");
@@ -51,12 +52,13 @@ const QString Connection::SERVER_VERSION=QString("server-version");
 bool Connection::notice_enabled=false;
 bool Connection::print_sql=false;
 bool Connection::silence_conn_err=true;
-QStringList Connection::notices;
+QThreadStorage<QStringList> Connection::notices;
 
 Connection::Connection(void)
 {
 	connection=nullptr;
 	auto_browse_db=false;	
+	pooled=false;
 	cmd_exec_timeout=0;
 
 	for(unsigned idx=OP_VALIDATION; idx <= OP_DIFF; idx++)
@@ -72,7 +74,11 @@ Connection::~Connection(void)
 {
 	if(connection)
 	{
-		PQfinish(connection);
+		if(pooled)
+			ConnectionPool::release(pool_key, connection);
+		else
+			PQfinish(connection);
+
 		connection=nullptr;
 	}
 }
@@ -118,6 +124,29 @@ void Connection::setAutoBrowseDB(bool value)
 	auto_browse_db=value;
 }
 
+void Connection::setPooled(bool value)
+{
+	if(connection)
+		throw Exception(ERR_CONNECTION_ALREADY_STABLISHED, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	pooled=value;
+}
+
+bool Connection::isPooled(void)
+{
+	return(pooled);
+}
+
+QString Connection::getPoolKey(void)
+{
+	QString alias=connection_params[PARAM_ALIAS];
+
+	if(alias.isEmpty())
+		return(getConnectionId(true, true));
+
+	return(QString("%1@%2").arg(connection_params[PARAM_DB_NAME]).arg(alias));
+}
+
 void Connection::generateConnectionString(void)
 {
 	QString value, param_str = QString("%1=%2 ");
@@ -157,7 +186,7 @@ void Connection::generateConnectionString(void)
 
 void Connection::noticeProcessor(void *, const char *message)
 {
-	notices.push_back(QString(message));
+	notices.localData().push_back(QString(message));
 }
 
 void Connection::validateConnectionStatus(void)
@@ -167,10 +196,24 @@ void Connection::validateConnectionStatus(void)
 		qint64 dt=(QDateTime::currentDateTime().toMSecsSinceEpoch() -
 							 last_cmd_execution.toMSecsSinceEpoch())/1000;
 
+		/* Instead of dropping the connection after the timeout we check if the server is still
+		there and reopen the session if it was closed meanwhile. A session that had an open transaction
+		can't be silently recovered so the timeout is reported in that case */
 		if(dt >= cmd_exec_timeout)
 		{
-			close();
-			throw Exception(ERR_CONNECTION_TIMEOUT, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+			//The transaction status must be read before the health check since a broken connection reports it as unknown
+			bool in_transaction=(PQtransactionStatus(connection)!=PQTRANS_IDLE);
+
+			if(ConnectionPool::isHealthy(connection))
+				in_transaction=false;
+			else if(!in_transaction)
+				PQreset(connection);
+
+			if(in_transaction || PQstatus(connection)==CONNECTION_BAD)
+			{
+				close();
+				throw Exception(ERR_CONNECTION_TIMEOUT, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+			}
 		}
 	}
 
@@ -179,6 +222,8 @@ void Connection::validateConnectionStatus(void)
 										.arg(connection_params[PARAM_SERVER_FQDN].isEmpty() ? connection_params[PARAM_SERVER_IP] : connection_params[PARAM_SERVER_FQDN])
 										.arg(connection_params[PARAM_PORT]),
 										ERR_CONNECTION_BROKEN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	last_cmd_execution=QDateTime::currentDateTime();
 }
 
 void Connection::setNoticeEnabled(bool value)
@@ -213,6 +258,8 @@ bool Connection::isConnErrorSilenced(void)
 
 void Connection::connect(void)
 {
+	TRACE_SCOPE("connection", "connect");
+
 	/* If the connection string is not established indicates that the user
 		is trying to connect without configuring connection parameters,
 		thus an error is raised */
@@ -232,7 +279,15 @@ void Connection::connect(void)
 	}
 
 	//Try to connect to the database
-	connection=PQconnectdb(connection_str.toStdString().c_str());
+	if(pooled)
+	{
+		//The pool raises its own errors so the pool key is only stored when the descriptor is acquired
+		connection=ConnectionPool::acquire(getPoolKey(), connection_str);
+		pool_key=getPoolKey();
+	}
+	else
+		connection=PQconnectdb(connection_str.toStdString().c_str());
+
 	last_cmd_execution=QDateTime::currentDateTime();
 
 	/* If the connection descriptor has not been allocated or if the connection state
@@ -245,7 +300,7 @@ void Connection::connect(void)
 						__PRETTY_FUNCTION__, __FILE__, __LINE__);
 	}
 
-	notices.clear();
+	notices.localData().clear();
 
 	if(!notice_enabled)
 		//Completely disable notice/warnings in the connection
@@ -259,11 +314,15 @@ void Connection::close(void)
 {
 	if(connection)
 	{
+		//Gives back the descriptor to the pool which decides if it can be reused or not
+		if(pooled)
+			ConnectionPool::release(pool_key, connection);
 		//Finalizes the connection if the status is OK
-		if(PQstatus(connection)==CONNECTION_OK)
+		else if(PQstatus(connection)==CONNECTION_OK)
 			PQfinish(connection);
 
 		connection=nullptr;
+		prepared_stmts.clear();
 		last_cmd_execution=QDateTime();
 	}
 }
@@ -336,6 +395,17 @@ bool Connection::isStablished(void)
 	return(connection!=nullptr);
 }
 
+bool Connection::isInTransaction(void)
+{
+	PGTransactionStatusType status;
+
+	if(!connection)
+		return(false);
+
+	status=PQtransactionStatus(connection);
+	return(status==PQTRANS_INTRANS || status==PQTRANS_INERROR);
+}
+
 bool Connection::isConfigured(void)
 {
 	return(!connection_str.isEmpty());
@@ -382,11 +452,13 @@ QString  Connection::getPgSQLVersion(bool major_only)
 
 QStringList Connection::getNotices(void)
 {
-	return (notices);
+	return(notices.localData());
 }
 
 void Connection::executeDMLCommand(const QString &sql, ResultSet &result)
 {
+	TRACE_SCOPE_SAMPLED("connection", "executeDMLCommand");
+
 	ResultSet *new_res=nullptr;
 	PGresult *sql_res=nullptr;
 
@@ -395,10 +467,10 @@ void Connection::executeDMLCommand(const QString &sql, ResultSet &result)
 		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
 
 	validateConnectionStatus();
-	notices.clear();
+	notices.localData().clear();
 
 	//Alocates a new result to receive the resultset returned by the sql command
-	sql_res=PQexec(connection, sql.toStdString().c_str());
+	sql_res=PQexec(connection, sql.toUtf8().constData());
 
 	//Prints the SQL to stdout when the flag is active
 	if(print_sql)
@@ -422,13 +494,129 @@ void Connection::executeDMLCommand(const QString &sql, ResultSet &result)
 	//Copy the new resultset to the parameter resultset
 	result=*(new_res);
 
-	//Deallocate the new resultset
+	//Deallocate the new resultset (and the result descriptor)
 	delete(new_res);
-	PQclear(sql_res);
+
+	TRACE_COUNTER("connection", QString("commands"), 1);
+	TRACE_SAMPLE(QString("connection.rows"), result.getTupleCount());
+}
+
+void Connection::storeCommandResult(PGresult *sql_res, const QString &sql, ResultSet &result)
+{
+	ResultSet *new_res=nullptr;
+	int res_state=PQresultStatus(sql_res);
+
+	//Prints the SQL to stdout when the flag is active
+	if(print_sql)
+	{
+		QTextStream out(stdout);
+		out << QString("\n---\n") << sql << endl;
+	}
+
+	if(!sql_res || res_state==PGRES_FATAL_ERROR || res_state==PGRES_BAD_RESPONSE)
+	{
+		QString msg=(sql_res ? QString(PQresultErrorMessage(sql_res)) : QString(PQerrorMessage(connection))),
+				field=QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE));
+
+		PQclear(sql_res);
+
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED)).arg(msg),
+						ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr,	field);
+	}
+
+	new_res=new ResultSet(sql_res);
+	result=*(new_res);
+	delete(new_res);
+
+	TRACE_COUNTER("connection", QString("commands"), 1);
+	TRACE_SAMPLE(QString("connection.rows"), result.getTupleCount());
+}
+
+void Connection::executeDMLCommand(const QString &sql, const vector<Oid> &param_types, const QStringList &param_vals, ResultSet &result)
+{
+	TRACE_SCOPE_SAMPLED("connection", "executeDMLCommand");
+
+	vector<QByteArray> values;
+	vector<const char *> value_ptrs;
+
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	validateConnectionStatus();
+	notices.localData().clear();
+
+	//The byte arrays must be alive until the command is sent
+	for(auto &val : param_vals)
+		values.push_back(val.toUtf8());
+
+	for(unsigned i=0; i < values.size(); i++)
+		value_ptrs.push_back(param_vals[i].isEmpty() ? nullptr : values[i].constData());
+
+	storeCommandResult(PQexecParams(connection, sql.toUtf8().constData(), value_ptrs.size(),
+																	param_types.size() >= value_ptrs.size() ? param_types.data() : nullptr,
+																	value_ptrs.data(), nullptr, nullptr, 0),
+										 sql, result);
+}
+
+void Connection::prepareCommand(const QString &stmt_name, const QString &sql, const vector<Oid> &param_types)
+{
+	ResultSet res;
+
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	validateConnectionStatus();
+	notices.localData().clear();
+
+	storeCommandResult(PQprepare(connection, stmt_name.toUtf8().constData(), sql.toUtf8().constData(),
+															 param_types.size(), param_types.data()),
+										 QString("PREPARE %1 AS %2").arg(stmt_name).arg(sql), res);
+
+	if(pooled)
+		ConnectionPool::registerPreparedStatement(connection, stmt_name);
+	else
+		prepared_stmts.insert(stmt_name);
+}
+
+bool Connection::isStatementPrepared(const QString &stmt_name)
+{
+	if(!connection)
+		return(false);
+
+	if(pooled)
+		return(ConnectionPool::isStatementPrepared(connection, stmt_name));
+
+	return(prepared_stmts.count(stmt_name)!=0);
+}
+
+void Connection::executePreparedCommand(const QString &stmt_name, const QStringList &param_vals, ResultSet &result)
+{
+	TRACE_SCOPE_SAMPLED("connection", "executePreparedCommand");
+
+	vector<QByteArray> values;
+	vector<const char *> value_ptrs;
+
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	validateConnectionStatus();
+	notices.localData().clear();
+
+	for(auto &val : param_vals)
+		values.push_back(val.toUtf8());
+
+	for(unsigned i=0; i < values.size(); i++)
+		value_ptrs.push_back(param_vals[i].isEmpty() ? nullptr : values[i].constData());
+
+	storeCommandResult(PQexecPrepared(connection, stmt_name.toUtf8().constData(), value_ptrs.size(),
+																		value_ptrs.data(), nullptr, nullptr, 0),
+										 QString("EXECUTE %1 ('%2')").arg(stmt_name).arg(param_vals.join(QString("', '"))), result);
 }
 
 void Connection::executeDDLCommand(const QString &sql)
 {
+	TRACE_SCOPE_SAMPLED("connection", "executeDDLCommand");
+
 	PGresult *sql_res=nullptr;
 
 	//Raise an error in case the user try to close a not opened connection
@@ -436,8 +624,8 @@ void Connection::executeDDLCommand(const QString &sql)
 		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
 
 	validateConnectionStatus();
-	notices.clear();
-	sql_res=PQexec(connection, sql.toStdString().c_str());
+	notices.localData().clear();
+	sql_res=PQexec(connection, sql.toUtf8().constData());
 
 	//Prints the SQL to stdout when the flag is active
 	if(print_sql)
@@ -459,6 +647,7 @@ void Connection::executeDDLCommand(const QString &sql)
 	}
 
 	PQclear(sql_res);
+	TRACE_COUNTER("connection", QString("commands"), 1);
 }
 
 void Connection::setDefaultForOperation(unsigned op_id, bool value)
@@ -511,6 +700,7 @@ void Connection::operator = (const Connection &conn)
 		this->close();
 
 	this->auto_browse_db=conn.auto_browse_db;
+	this->pooled=conn.pooled;
 	this->connection_params=conn.connection_params;
 	this->connection_str=conn.connection_str;
 	this->connection=nullptr;
@@ -521,8 +711,107 @@ void Connection::operator = (const Connection &conn)
 
 void Connection::requestCancel(void)
 {
+	PGcancel *cancel=nullptr;
+	char err_buf[256];
+
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	//Sending the cancel request to the server using a separated (thread safe) cancel object
+	cancel=PQgetCancel(connection);
+
+	if(cancel)
+	{
+		PQcancel(cancel, err_buf, sizeof(err_buf));
+		PQfreeCancel(cancel);
+	}
+}
+
+void Connection::sendCommand(const QString &sql)
+{
+	//Raise an error in case the user try to send a command through a not opened connection
 	if(!connection)
 		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
 
-	PQrequestCancel(connection);
+	validateConnectionStatus();
+	notices.localData().clear();
+
+	//Prints the SQL to stdout when the flag is active
+	if(print_sql)
+	{
+		QTextStream out(stdout);
+		out << QString("\n---\n") << sql << endl;
+	}
+
+	if(PQsendQuery(connection, sql.toUtf8().constData())==0)
+	{
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED))
+						.arg(PQerrorMessage(connection)),
+						ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+	}
+}
+
+int Connection::getSocket(void)
+{
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	return(PQsocket(connection));
+}
+
+void Connection::consumeInput(void)
+{
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	if(PQconsumeInput(connection)==0)
+	{
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED))
+						.arg(PQerrorMessage(connection)),
+						ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+	}
+}
+
+bool Connection::isBusy(void)
+{
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	return(PQisBusy(connection)==1);
+}
+
+bool Connection::getNextResult(ResultSet &result)
+{
+	ResultSet *new_res=nullptr;
+	PGresult *sql_res=nullptr;
+	int res_state=0;
+
+	if(!connection)
+		throw Exception(ERR_OPR_NOT_ALOC_CONN, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	sql_res=PQgetResult(connection);
+
+	//There are no more results for the command sent
+	if(!sql_res)
+		return(false);
+
+	res_state=PQresultStatus(sql_res);
+
+	//Raise an error in case the command sql execution is not sucessful
+	if(res_state==PGRES_FATAL_ERROR || res_state==PGRES_BAD_RESPONSE)
+	{
+		QString msg = QString(PQresultErrorMessage(sql_res)),
+				field = QString(PQresultErrorField(sql_res, PG_DIAG_SQLSTATE));
+
+		PQclear(sql_res);
+
+		throw Exception(QString(Exception::getErrorMessage(ERR_CMD_SQL_NOT_EXECUTED)).arg(msg),
+						ERR_CMD_SQL_NOT_EXECUTED, __PRETTY_FUNCTION__, __FILE__, __LINE__, nullptr,	field);
+	}
+
+	new_res=new ResultSet(sql_res);
+	result=*(new_res);
+	delete(new_res);
+
+	return(true);
 }
@@ -28,8 +28,10 @@
 
 #include "resultset.h"
 #include "attribsmap.h"
+#include "connectionpool.h"
 #include <QRegExp>
 #include <QDateTime>
+#include <QThreadStorage>
 
 class Connection {
 	private:
@@ -42,6 +44,17 @@ class Connection {
 		//! \brief Formated connection string
 		QString connection_str;
 
+		//! \brief Key of the pool from which the current descriptor was acquired (only for pooled connections)
+		QString pool_key;
+
+		/*! \brief Indicates that the descriptor is acquired from/released to the ConnectionPool instead
+		of being opened/closed on each connect()/close() */
+		bool pooled;
+
+		/*! \brief Names of the statements prepared in the current session (only for non pooled connections,
+		the pool itself tracks the statements of its connections since they survive the release) */
+		set<QString> prepared_stmts;
+
 		/*! \brief Date-time value used to check the timeout between commands execution.
 		This attribute is used to abort the command execution to avoid program crashes
 		if the connection is closed by the server due to timeouts */
@@ -53,8 +66,9 @@ class Connection {
 		unsigned cmd_exec_timeout;
 
 		/*! \brief List of notices generated during the command execution
-		The list is filled only if notice_enabled is true */
-		static QStringList notices;
+		The list is filled only if notice_enabled is true. Each thread has its own list
+		since the connections can be used concurrently (e.g. parallel import) */
+		static QThreadStorage<QStringList> notices;
 
 		//! \brief Generates the connection string based on the parameter map
 		void generateConnectionString(void);
@@ -88,11 +102,16 @@ class Connection {
 		is used if none is explicitly specified by the user in the UI */
 		default_for_oper[4];
 
-		/*! \brief Validates the connection status (command exec. timeout and connection status) and
-		raise errors in case of exceeded timeout or bad connection. This method is called prior any
-		command execution */
+		/*! \brief Validates the connection status prior any command execution. When the connection stays idle
+		for more than the command execution timeout a health check is done (see ConnectionPool::isHealthy()) and a
+		connection closed by the server is transparently reset if no transaction was in progress. Errors are raised
+		if the connection can't be recovered */
 		void validateConnectionStatus(void);
 
+		/*! \brief Stores the result descriptor returned by a parameterized command into the result set
+		raising an error if the command failed. The descriptor is always deallocated */
+		void storeCommandResult(PGresult *sql_res, const QString &sql, ResultSet &result);
+
 	public:
 		//! \brief Constants used to reference the connections parameters
 		static const QString	PARAM_ALIAS,
@@ -168,6 +187,16 @@ class Connection {
 		//! \brief Set if the database configured on the connection is auto browseable when using the SQLTool manage database
 		void setAutoBrowseDB(bool value);
 
+		/*! \brief Configures the connection to use the shared ConnectionPool. This is intended to short-lived connections
+		that don't depend on session state across connect()/close() (e.g. catalog queries). Must be called before connect() */
+		void setPooled(bool value);
+
+		//! \brief Returns if the connection uses the shared connection pool
+		bool isPooled(void);
+
+		//! \brief Returns the key of the pool used by the connection (connection alias and database name)
+		QString getPoolKey(void);
+
 		//! \brief Open the connection to the database.
 		void connect(void);
 
@@ -180,6 +209,24 @@ class Connection {
 		//! \brief Request the cancel of the running command on a opened connection
 		void requestCancel(void);
 
+		/*! \brief Sends the command to the server without waiting for the results. The results must be
+		retrieved with getNextResult() until it returns false. Use consumeInput() and isBusy() to avoid blocking
+		when reading the results (see AsyncQuery) */
+		void sendCommand(const QString &sql);
+
+		//! \brief Returns the socket descriptor of the connection to the server
+		int getSocket(void);
+
+		//! \brief Reads the data available on the connection socket (if any) without blocking
+		void consumeInput(void);
+
+		//! \brief Returns if getNextResult() would block waiting for the server
+		bool isBusy(void);
+
+		/*! \brief Stores in the result set the next result of the command sent by sendCommand().
+		Returns false when there are no more results. Raises an error if the command failed */
+		bool getNextResult(ResultSet &result);
+
 		//! \brief Returns the value of specified parameter name
 		QString getConnectionParam(const QString &param);
 
@@ -214,6 +261,9 @@ class Connection {
 		//! \brief Returns if the connection is stablished
 		bool isStablished(void);
 
+		//! \brief Returns if the connection is inside a transaction block (including failed ones waiting for a rollback)
+		bool isInTransaction(void);
+
 		//! \brief Returns if the connection is configured (has some attributes set)
 		bool isConfigured(void);
 
@@ -224,6 +274,22 @@ class Connection {
 		 Its mandatory to specify the object to receive the returned resultset. */
 		void executeDMLCommand(const QString &sql, ResultSet &result);
 
+		/*! \brief Executes a parameterized DML command (using $1, $2, ... placeholders) without preparing it.
+		The values are sent separately from the command so no quoting is needed. Empty values are sent as NULL */
+		void executeDMLCommand(const QString &sql, const vector<Oid> &param_types, const QStringList &param_vals, ResultSet &result);
+
+		/*! \brief Creates a named prepared statement in the current session. The command is parsed and planned
+		only once by the server and can be executed several times via executePreparedCommand().
+		Prepared statements are discarded when the connection is closed, except for pooled connections
+		which keep them while the descriptor lives in the pool */
+		void prepareCommand(const QString &stmt_name, const QString &sql, const vector<Oid> &param_types);
+
+		//! \brief Returns if the named statement was already prepared in the current session (see prepareCommand())
+		bool isStatementPrepared(const QString &stmt_name);
+
+		//! \brief Executes a statement created by prepareCommand(). Empty values are sent as NULL
+		void executePreparedCommand(const QString &stmt_name, const QStringList &param_vals, ResultSet &result);
+
 		/*! \brief Executes a DDL command on the server using the opened connection.
 		 The user don't need to specify the resultset since the commando executed is intended
 		 to be an data definition one  */
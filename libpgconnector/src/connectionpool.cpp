@@ -0,0 +1,326 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "connectionpool.h"
+
+QMutex ConnectionPool::mutex;
+QWaitCondition ConnectionPool::conn_released;
+map<QString, ConnectionPool::Pool> ConnectionPool::pools;
+map<PGconn *, set<QString>> ConnectionPool::prepared_stmts;
+unsigned ConnectionPool::max_connections=ConnectionPool::DEFAULT_MAX_CONNECTIONS;
+unsigned ConnectionPool::max_idle_time=ConnectionPool::DEFAULT_MAX_IDLE_TIME;
+unsigned ConnectionPool::wait_timeout=ConnectionPool::DEFAULT_WAIT_TIMEOUT;
+PQnoticeReceiver ConnectionPool::default_notice_rec=nullptr;
+
+bool ConnectionPool::isHealthy(PGconn *conn)
+{
+	if(!conn || PQstatus(conn)!=CONNECTION_OK)
+		return(false);
+
+	/* libpq sockets are non-blocking so this call only reads what is pending, if the server
+	closed the connection the EOF is read here and the status changes to CONNECTION_BAD */
+	if(PQconsumeInput(conn)==0)
+		return(false);
+
+	return(PQstatus(conn)==CONNECTION_OK);
+}
+
+bool ConnectionPool::finishSessionReset(PGconn *conn)
+{
+	PGresult *res=nullptr;
+	bool reset_ok=true;
+
+	if(!isHealthy(conn))
+		return(false);
+
+	//Reading the results of the reset commands sent in release()
+	while((res=PQgetResult(conn)))
+	{
+		reset_ok=reset_ok && (PQresultStatus(res)==PGRES_COMMAND_OK || PQresultStatus(res)==PGRES_TUPLES_OK);
+		PQclear(res);
+	}
+
+	return(reset_ok && PQstatus(conn)==CONNECTION_OK && PQtransactionStatus(conn)==PQTRANS_IDLE);
+}
+
+QString ConnectionPool::getSessionResetCommand(PGconn *conn)
+{
+	QString cmd=QString("CLOSE ALL; SET SESSION AUTHORIZATION DEFAULT; RESET ALL; UNLISTEN *; SELECT pg_advisory_unlock_all(); DISCARD TEMP;");
+
+	//DISCARD SEQUENCES is available only from PostgreSQL 9.4
+	if(PQserverVersion(conn) >= 90400)
+		cmd+=QString(" DISCARD SEQUENCES;");
+
+	return(cmd);
+}
+
+void ConnectionPool::finishConnection(PGconn *conn)
+{
+	prepared_stmts.erase(conn);
+	PQfinish(conn);
+}
+
+void ConnectionPool::evictIdleConnections(Pool &pool)
+{
+	QDateTime now=QDateTime::currentDateTime();
+	vector<IdleConnection>::iterator itr=pool.idle_conns.begin();
+
+	while(itr!=pool.idle_conns.end())
+	{
+		if(itr->release_time.secsTo(now) >= static_cast<qint64>(max_idle_time))
+		{
+			finishConnection(itr->connection);
+			itr=pool.idle_conns.erase(itr);
+			pool.metrics.evictions++;
+		}
+		else
+			itr++;
+	}
+}
+
+void ConnectionPool::clearPool(Pool &pool)
+{
+	for(auto &idle_conn : pool.idle_conns)
+		finishConnection(idle_conn.connection);
+
+	pool.idle_conns.clear();
+	pool.expired_conns.insert(pool.used_conns.begin(), pool.used_conns.end());
+}
+
+PGconn *ConnectionPool::acquire(const QString &pool_key, const QString &conn_str)
+{
+	QMutexLocker locker(&mutex);
+	Pool &pool=pools[pool_key];
+	PGconn *conn=nullptr;
+
+	//The connection parameters were changed (e.g. in connections settings) so the old connections are discarded
+	if(pool.conn_str!=conn_str)
+	{
+		clearPool(pool);
+		pool.conn_str=conn_str;
+	}
+
+	evictIdleConnections(pool);
+
+	while(!conn)
+	{
+		//Reusing the most recently released connection since it's the most likely to be alive
+		while(!pool.idle_conns.empty() && !conn)
+		{
+			conn=pool.idle_conns.back().connection;
+			pool.idle_conns.pop_back();
+
+			if(finishSessionReset(conn))
+				pool.metrics.hits++;
+			else
+			{
+				finishConnection(conn);
+				conn=nullptr;
+				pool.metrics.evictions++;
+			}
+		}
+
+		if(conn || (pool.used_conns.size() + pool.opening) < max_connections)
+			break;
+
+		pool.metrics.waits++;
+
+		if(!conn_released.wait(&mutex, wait_timeout))
+			throw Exception(Exception::getErrorMessage(ERR_CONN_POOL_WAIT_TIMEOUT).arg(pool_key).arg(max_connections),
+											ERR_CONN_POOL_WAIT_TIMEOUT, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+	}
+
+	if(conn)
+	{
+		pool.used_conns.insert(conn);
+		return(conn);
+	}
+
+	//Opening a new connection without holding the lock since the handshake can take a while
+	pool.opening++;
+	locker.unlock();
+	conn=PQconnectdb(conn_str.toStdString().c_str());
+	locker.relock();
+	pool.opening--;
+
+	if(conn==nullptr || PQstatus(conn)==CONNECTION_BAD)
+	{
+		QString err_msg=(conn ? QString(PQerrorMessage(conn)) : QString());
+
+		if(conn)
+			PQfinish(conn);
+
+		conn_released.wakeOne();
+		throw Exception(Exception::getErrorMessage(ERR_CONNECTION_NOT_STABLISHED).arg(err_msg),
+										ERR_CONNECTION_NOT_STABLISHED, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+	}
+
+	//Passing a null receiver only returns the current one (the libpq's default)
+	if(!default_notice_rec)
+		default_notice_rec=PQsetNoticeReceiver(conn, nullptr, nullptr);
+
+	pool.metrics.opens++;
+	pool.used_conns.insert(conn);
+	return(conn);
+}
+
+void ConnectionPool::release(const QString &pool_key, PGconn *conn)
+{
+	QMutexLocker locker(&mutex);
+	Pool &pool=pools[pool_key];
+	bool reusable=false;
+
+	if(!conn)
+		return;
+
+	pool.used_conns.erase(conn);
+
+	/* Only idle connections are kept. The session state (settings, cursors, temp tables) is discarded
+	asynchronously, the result is read when the connection is acquired again (see finishSessionReset()) */
+	reusable=pool.expired_conns.count(conn)==0 &&
+					 pool.idle_conns.size() < max_connections &&
+					 isHealthy(conn) &&
+					 PQtransactionStatus(conn)==PQTRANS_IDLE &&
+					 PQsendQuery(conn, getSessionResetCommand(conn).toUtf8().constData())==1;
+
+	pool.expired_conns.erase(conn);
+
+	if(reusable)
+	{
+		IdleConnection idle_conn;
+
+		//Restoring the default notice handling so the next owner can enable or disable notices as usual
+		if(default_notice_rec)
+			PQsetNoticeReceiver(conn, default_notice_rec, nullptr);
+
+		idle_conn.connection=conn;
+		idle_conn.release_time=QDateTime::currentDateTime();
+		pool.idle_conns.push_back(idle_conn);
+	}
+	else
+		finishConnection(conn);
+
+	conn_released.wakeOne();
+}
+
+void ConnectionPool::evictIdleConnections(void)
+{
+	QMutexLocker locker(&mutex);
+
+	for(auto &itr : pools)
+		evictIdleConnections(itr.second);
+}
+
+void ConnectionPool::clear(const QString &pool_key)
+{
+	QMutexLocker locker(&mutex);
+
+	if(pool_key.isEmpty())
+	{
+		for(auto &itr : pools)
+			clearPool(itr.second);
+	}
+	else if(pools.count(pool_key))
+		clearPool(pools[pool_key]);
+}
+
+void ConnectionPool::registerPreparedStatement(PGconn *conn, const QString &stmt_name)
+{
+	QMutexLocker locker(&mutex);
+	prepared_stmts[conn].insert(stmt_name);
+}
+
+bool ConnectionPool::isStatementPrepared(PGconn *conn, const QString &stmt_name)
+{
+	QMutexLocker locker(&mutex);
+	map<PGconn *, set<QString>>::iterator itr=prepared_stmts.find(conn);
+
+	return(itr!=prepared_stmts.end() && itr->second.count(stmt_name)!=0);
+}
+
+void ConnectionPool::setMaxConnections(unsigned max_conns)
+{
+	QMutexLocker locker(&mutex);
+	max_connections=(max_conns==0 ? 1 : max_conns);
+}
+
+void ConnectionPool::setMaxIdleTime(unsigned seconds)
+{
+	QMutexLocker locker(&mutex);
+	max_idle_time=seconds;
+}
+
+void ConnectionPool::setWaitTimeout(unsigned msecs)
+{
+	QMutexLocker locker(&mutex);
+	wait_timeout=msecs;
+}
+
+unsigned ConnectionPool::getMaxConnections(void)
+{
+	return(max_connections);
+}
+
+unsigned ConnectionPool::getMaxIdleTime(void)
+{
+	return(max_idle_time);
+}
+
+unsigned ConnectionPool::getWaitTimeout(void)
+{
+	return(wait_timeout);
+}
+
+QStringList ConnectionPool::getPoolKeys(void)
+{
+	QMutexLocker locker(&mutex);
+	QStringList keys;
+
+	for(auto &itr : pools)
+		keys.push_back(itr.first);
+
+	return(keys);
+}
+
+unsigned ConnectionPool::getFreeConnections(const QString &pool_key)
+{
+	QMutexLocker locker(&mutex);
+	unsigned used=0;
+
+	if(pools.count(pool_key))
+		used=pools[pool_key].used_conns.size() + pools[pool_key].opening;
+
+	return(used < max_connections ? max_connections - used : 0);
+}
+
+ConnectionPool::PoolMetrics ConnectionPool::getMetrics(const QString &pool_key)
+{
+	QMutexLocker locker(&mutex);
+	PoolMetrics metrics;
+
+	if(pools.count(pool_key))
+	{
+		Pool &pool=pools[pool_key];
+
+		metrics=pool.metrics;
+		metrics.in_use=pool.used_conns.size();
+		metrics.idle=pool.idle_conns.size();
+	}
+
+	return(metrics);
+}
@@ -0,0 +1,191 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgconnector
+\class ConnectionPool
+\brief Keeps the libpq connections released by pooled Connection instances (see Connection::setPooled())
+opened so they can be reused by the next Connection that uses the same alias and database, avoiding
+to pay the TCP, TLS and authentication handshakes every time a short-lived connection is opened.
+\note Connections are given back to the pool only when they are healthy and not inside a transaction.
+The session state is reset before a connection is reused, except for the prepared statements, which are kept
+(and tracked per connection) so the catalog queries don't need to be prepared again. All methods are thread safe.
+*/
+
+#ifndef CONNECTION_POOL_H
+#define CONNECTION_POOL_H
+
+#include "exception.h"
+#include <libpq-fe.h>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QDateTime>
+#include <QStringList>
+#include <map>
+#include <vector>
+#include <set>
+
+using namespace std;
+
+class ConnectionPool {
+	public:
+		//! \brief Stores the usage statistics of a pool (see getMetrics())
+		struct PoolMetrics {
+			//! \brief Amount of acquisitions served by an idle connection
+			unsigned hits,
+
+			//! \brief Amount of acquisitions that had to wait for a connection to be released
+			waits,
+
+			//! \brief Amount of connections opened in the server
+			opens,
+
+			//! \brief Amount of idle connections closed due to timeout or failed health checks
+			evictions,
+
+			//! \brief Amount of connections currently in use / idle
+			in_use, idle;
+
+			PoolMetrics(void)
+			{
+				hits=waits=opens=evictions=in_use=idle=0;
+			}
+		};
+
+		//! \brief Default maximum amount of simultaneous connections per pool
+		static const unsigned DEFAULT_MAX_CONNECTIONS=8,
+
+		//! \brief Default time (in seconds) that a connection can stay idle in the pool before being closed
+		DEFAULT_MAX_IDLE_TIME=300,
+
+		//! \brief Default time (in miliseconds) to wait for a connection when the pool limit is reached
+		DEFAULT_WAIT_TIMEOUT=30000;
+
+	private:
+		//! \brief Stores an idle connection and the moment it was released
+		struct IdleConnection {
+			PGconn *connection;
+			QDateTime release_time;
+		};
+
+		struct Pool {
+			//! \brief Connection string used to open the connections of the pool
+			QString conn_str;
+
+			//! \brief Idle connections ready to be reused (the most recently released at the back)
+			vector<IdleConnection> idle_conns;
+
+			//! \brief Connections currently acquired by Connection instances
+			set<PGconn *> used_conns,
+
+			//! \brief Connections in use that must be closed when released (see clear())
+			expired_conns;
+
+			//! \brief Amount of connections being opened (counted in the pool limit)
+			unsigned opening;
+
+			PoolMetrics metrics;
+
+			Pool(void)
+			{
+				opening=0;
+			}
+		};
+
+		//! \brief Guards the pools against concurrent access (import, diff and export run in their own threads)
+		static QMutex mutex;
+
+		//! \brief Wakes the threads waiting for a connection to be released in a full pool
+		static QWaitCondition conn_released;
+
+		//! \brief Pools indexed by the key generated by Connection (alias and database name)
+		static map<QString, Pool> pools;
+
+		//! \brief Names of the statements prepared in each pooled connection (see registerPreparedStatement())
+		static map<PGconn *, set<QString>> prepared_stmts;
+
+		static unsigned max_connections, max_idle_time, wait_timeout;
+
+		/*! \brief Notice receiver installed by libpq in new connections. It is restored when a connection
+		is released since the previous owner may have replaced it (see Connection::connect()) */
+		static PQnoticeReceiver default_notice_rec;
+
+		/*! \brief Finishes the reset started when the connection was released (see getSessionResetCommand()) and
+		returns false if the connection can't be reused anymore */
+		static bool finishSessionReset(PGconn *conn);
+
+		/*! \brief Returns the commands that reset the session state of a released connection. This is the same as
+		DISCARD ALL without DEALLOCATE ALL and DISCARD PLANS, so the prepared statements survive the release */
+		static QString getSessionResetCommand(PGconn *conn);
+
+		//! \brief Closes the connection forgetting the statements prepared in it
+		static void finishConnection(PGconn *conn);
+
+		//! \brief Closes all the connections of the pool that are idle for more than max_idle_time
+		static void evictIdleConnections(Pool &pool);
+
+		//! \brief Closes the idle connections of the pool and marks the ones in use to be closed when released
+		static void clearPool(Pool &pool);
+
+	public:
+		/*! \brief Returns if the connection is still usable. The data pending on the connection socket is read
+		(without blocking) so a connection closed by the server (e.g. due to timeouts) is detected without a round trip */
+		static bool isHealthy(PGconn *conn);
+
+		/*! \brief Returns an opened connection for the pool identified by the key. An idle connection is reused if
+		available, otherwise a new one is opened using the connection string. If the pool is full the method waits
+		for a connection to be released raising an error in case of timeout */
+		static PGconn *acquire(const QString &pool_key, const QString &conn_str);
+
+		/*! \brief Gives back the connection to the pool. Broken connections, connections inside a transaction or
+		exceeding the pool limit are closed */
+		static void release(const QString &pool_key, PGconn *conn);
+
+		//! \brief Closes all idle connections that exceeded the idle time in all pools
+		static void evictIdleConnections(void);
+
+		/*! \brief Closes the idle connections of the specified pool. If the key is empty all pools are cleared.
+		Connections in use are closed when they are released */
+		static void clear(const QString &pool_key=QString());
+
+		//! \brief Registers that the named statement was prepared in the pooled connection
+		static void registerPreparedStatement(PGconn *conn, const QString &stmt_name);
+
+		//! \brief Returns if the named statement was already prepared in the pooled connection
+		static bool isStatementPrepared(PGconn *conn, const QString &stmt_name);
+
+		static void setMaxConnections(unsigned max_conns);
+		static void setMaxIdleTime(unsigned seconds);
+		static void setWaitTimeout(unsigned msecs);
+
+		static unsigned getMaxConnections(void);
+		static unsigned getMaxIdleTime(void);
+		static unsigned getWaitTimeout(void);
+
+		//! \brief Returns the keys of all pools created so far
+		static QStringList getPoolKeys(void);
+
+		/*! \brief Returns the amount of connections that can still be acquired from the specified pool without
+		waiting for other connections to be released (idle connections are counted as free) */
+		static unsigned getFreeConnections(const QString &pool_key);
+
+		//! \brief Returns the statistics of the specified pool
+		static PoolMetrics getMetrics(const QString &pool_key);
+};
+
+#endif
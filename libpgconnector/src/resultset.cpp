@@ -22,7 +22,6 @@ ResultSet::ResultSet(void)
 {
 	sql_result=nullptr;
 	empty_result=false;
-	is_res_copied=false;
 	current_tuple=-1;
 }
 
@@ -61,7 +60,6 @@ ResultSet::ResultSet(PGresult *sql_result)
 		default:
 			empty_result=(res_state!=PGRES_TUPLES_OK && res_state!=PGRES_SINGLE_TUPLE && res_state!=PGRES_EMPTY_QUERY);
 			current_tuple=-1;
-			is_res_copied=false;
 		break;
 	}
 }
@@ -73,15 +71,13 @@ ResultSet::~ResultSet(void)
 
 void ResultSet::clearResultSet(void)
 {
-	/* Destroy the resultset of the object if it was not copied
-		to another class instance (see 'operator =') */
-	if(sql_result && !is_res_copied)
+	//Destroy the resultset of the object
+	if(sql_result)
 		PQclear(sql_result);
 
 	//Reset the other attributes
 	sql_result=nullptr;
 	empty_result=false;
-	is_res_copied=false;
 	current_tuple=-1;
 }
 
@@ -324,18 +320,19 @@ bool ResultSet::isValid(void)
 
 void ResultSet::operator = (ResultSet &res)
 {
-	/* Mark the result parameter as copied, avoiding
-		the sql_result attribute to be deallocated */
-	res.is_res_copied=true;
+	if(this==&res)
+		return;
 
 	/* If the resultset 'this' is allocated,
 		it will be deallocated to avoid memory leaks */
 	clearResultSet();
 
-	//Copy the parameter restulset attributes to 'this' resultset
+	/* Copy the parameter restulset attributes to 'this' resultset. Since the descriptor is duplicated
+	the parameter keeps the ownership over its own descriptor */
 	this->current_tuple=res.current_tuple;
 	this->empty_result=res.empty_result;
-	this->sql_result=PQcopyResult(res.sql_result, PG_COPYRES_TUPLES | PG_COPYRES_ATTRS | PG_COPYRES_EVENTS);
-	this->is_res_copied=false;
+
+	if(res.sql_result)
+		this->sql_result=PQcopyResult(res.sql_result, PG_COPYRES_TUPLES | PG_COPYRES_ATTRS | PG_COPYRES_EVENTS);
 }
 
@@ -38,14 +38,6 @@ It the resultset contains data the user must call ResultSet::accessTuple() to ac
 
 class ResultSet {
 	private:
-		/*! \brief Indicates whether the result was copied, this flag is used
-	 to avoid segmentation faults when calling the destructor.
-	 As the pointer 'sql_result' is copied
-	 to other elements if it is destroyed can cause
-	 reference fails. Thus, such a pointer is only deleted
-	 when this flag is marked as false */
-		bool is_res_copied;
-
 		void validateColumnIndex(int column_idx);
 
 		int validateColumnName(const QString &column_name);
@@ -125,7 +117,8 @@ class ResultSet {
 
 		void clearResultSet(void);
 
-		//! \brief Make a copy between two resultsets
+		/*! \brief Make a copy between two resultsets. The result descriptor is duplicated
+		so both instances own (and release) their own copies */
 		void operator = (ResultSet &res);
 
 		friend class Connection;
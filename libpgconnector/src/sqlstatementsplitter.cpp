@@ -0,0 +1,519 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "sqlstatementsplitter.h"
+
+/* Types with multiple words in their SQL names (e.g. OPERATOR CLASS) must be
+tested before the ones which names are a prefix of them (e.g. OPERATOR) */
+const vector<ObjectType> SQLStatementSplitter::obj_types={ OBJ_OPFAMILY, OBJ_OPCLASS, OBJ_EVENT_TRIGGER,
+																													 OBJ_ROLE, OBJ_FUNCTION, OBJ_TRIGGER, OBJ_INDEX, OBJ_POLICY,
+																													 OBJ_RULE, OBJ_TABLE, OBJ_VIEW, OBJ_DOMAIN, OBJ_SCHEMA,
+																													 OBJ_AGGREGATE, OBJ_OPERATOR, OBJ_SEQUENCE, OBJ_CONVERSION,
+																													 OBJ_CAST, OBJ_LANGUAGE, OBJ_COLLATION, OBJ_EXTENSION,
+																													 OBJ_TYPE, OBJ_TABLESPACE, OBJ_DATABASE };
+
+SQLStatementSplitter::SQLStatementSplitter(const QString &buffer)
+{
+	commented_drops=false;
+	setBuffer(buffer);
+}
+
+void SQLStatementSplitter::setBuffer(const QString &buffer)
+{
+	this->buffer=buffer;
+	position=0;
+}
+
+void SQLStatementSplitter::setCommentedDropsEnabled(bool value)
+{
+	commented_drops=value;
+}
+
+bool SQLStatementSplitter::isIdentifierChar(const QChar &chr)
+{
+	return(chr.isLetterOrNumber() || chr==QChar('_') || chr==QChar('$'));
+}
+
+int SQLStatementSplitter::skipQuoted(int pos, int end, const QChar &delim, bool escapes)
+{
+	const QChar *data=buffer.constData();
+
+	pos++;
+
+	while(pos < end)
+	{
+		if(escapes && data[pos]==QChar('\\'))
+			pos+=2;
+		else if(data[pos]==delim)
+		{
+			//A doubled delimiter is an escaped delimiter
+			if(pos + 1 < end && data[pos + 1]==delim)
+				pos+=2;
+			else
+				return(pos + 1);
+		}
+		else
+			pos++;
+	}
+
+	return(end);
+}
+
+int SQLStatementSplitter::skipBlockComment(int pos, int end)
+{
+	const QChar *data=buffer.constData();
+	int depth=0;
+
+	while(pos < end)
+	{
+		if(data[pos]==QChar('/') && pos + 1 < end && data[pos + 1]==QChar('*'))
+		{
+			depth++;
+			pos+=2;
+		}
+		else if(data[pos]==QChar('*') && pos + 1 < end && data[pos + 1]==QChar('/'))
+		{
+			depth--;
+			pos+=2;
+
+			if(depth==0)
+				return(pos);
+		}
+		else
+			pos++;
+	}
+
+	return(end);
+}
+
+int SQLStatementSplitter::skipDollarQuoted(int pos, int end)
+{
+	const QChar *data=buffer.constData();
+	int tag_end=pos + 1, close_pos=-1;
+
+	//The tag follows the identifier rules but can't contain dollar signs nor start with a digit ($1 is a parameter)
+	if(tag_end < end && (data[tag_end].isLetter() || data[tag_end]==QChar('_')))
+	{
+		while(tag_end < end && (data[tag_end].isLetterOrNumber() || data[tag_end]==QChar('_')))
+			tag_end++;
+	}
+
+	if(tag_end >= end || data[tag_end]!=QChar('$'))
+		return(-1);
+
+	tag_end++;
+	close_pos=buffer.indexOf(buffer.midRef(pos, tag_end - pos), tag_end);
+
+	if(close_pos < 0 || close_pos >= end)
+		return(end);
+
+	return(close_pos + (tag_end - pos));
+}
+
+int SQLStatementSplitter::findStatementEnd(int pos)
+{
+	const QChar *data=buffer.constData();
+	int end=buffer.size(), depth=0, aux_pos=0;
+	QChar chr;
+
+	while(pos < end)
+	{
+		chr=data[pos];
+
+		if(chr==QChar('\''))
+		{
+			//Strings in the form E'...' accept backslash escapes
+			bool escapes=(pos > 0 && (data[pos - 1]==QChar('E') || data[pos - 1]==QChar('e')) &&
+										(pos < 2 || !isIdentifierChar(data[pos - 2])));
+			pos=skipQuoted(pos, end, chr, escapes);
+		}
+		else if(chr==QChar('"'))
+			pos=skipQuoted(pos, end, chr, false);
+		else if(chr==QChar('-') && pos + 1 < end && data[pos + 1]==QChar('-'))
+		{
+			aux_pos=buffer.indexOf(QChar('\n'), pos);
+			pos=(aux_pos < 0 ? end : aux_pos + 1);
+		}
+		else if(chr==QChar('/') && pos + 1 < end && data[pos + 1]==QChar('*'))
+			pos=skipBlockComment(pos, end);
+		else if(chr==QChar('$') && (pos==0 || !isIdentifierChar(data[pos - 1])) &&
+						(aux_pos=skipDollarQuoted(pos, end)) >= 0)
+			pos=aux_pos;
+		else
+		{
+			if(chr==QChar('('))
+				depth++;
+			else if(chr==QChar(')') && depth > 0)
+				depth--;
+			else if(chr==QChar(';') && depth==0)
+				return(pos + 1);
+
+			pos++;
+		}
+	}
+
+	return(end);
+}
+
+int SQLStatementSplitter::findCopyDataEnd(int pos)
+{
+	int end=buffer.size(), line_end=0;
+
+	//The data block ends in a line containing only \.
+	while(pos < end)
+	{
+		line_end=buffer.indexOf(QChar('\n'), pos);
+
+		if(line_end < 0)
+			line_end=end;
+
+		if(buffer.midRef(pos, line_end - pos).trimmed()==QString("\\."))
+			return(line_end < end ? line_end + 1 : end);
+
+		pos=line_end + 1;
+	}
+
+	return(end);
+}
+
+int SQLStatementSplitter::readWord(int pos, int end, QString &word)
+{
+	const QChar *data=buffer.constData();
+	int start=0, depth=0;
+
+	word.clear();
+
+	//Skipping spaces and comments
+	while(pos < end)
+	{
+		if(data[pos].isSpace())
+			pos++;
+		else if(data[pos]==QChar('-') && pos + 1 < end && data[pos + 1]==QChar('-'))
+		{
+			while(pos < end && data[pos]!=QChar('\n'))
+				pos++;
+		}
+		else if(data[pos]==QChar('/') && pos + 1 < end && data[pos + 1]==QChar('*'))
+			pos=skipBlockComment(pos, end);
+		else
+			break;
+	}
+
+	if(pos >= end)
+		return(end);
+
+	start=pos;
+
+	if(data[pos]==QChar('('))
+	{
+		//Reading a parenthesized group as a single word (e.g. function signatures)
+		while(pos < end)
+		{
+			if(data[pos]==QChar('"') || data[pos]==QChar('\''))
+				pos=skipQuoted(pos, end, data[pos], false);
+			else
+			{
+				if(data[pos]==QChar('('))
+					depth++;
+				else if(data[pos]==QChar(')'))
+					depth--;
+
+				pos++;
+
+				if(depth==0)
+					break;
+			}
+		}
+	}
+	else if(isIdentifierChar(data[pos]) || data[pos]==QChar('"'))
+	{
+		//Reading a (possibly qualified and quoted) name
+		while(pos < end)
+		{
+			if(data[pos]==QChar('"'))
+				pos=skipQuoted(pos, end, data[pos], false);
+			else if(isIdentifierChar(data[pos]) || data[pos]==QChar('.'))
+				pos++;
+			else
+				break;
+		}
+	}
+	else
+	{
+		//Reading an operator or a single punctuation char
+		while(pos < end && QString("+-*/<>=~!@#%^&|`?").contains(data[pos]))
+			pos++;
+
+		if(pos==start)
+			pos++;
+	}
+
+	word=buffer.mid(start, pos - start);
+	return(pos);
+}
+
+void SQLStatementSplitter::classifyStatement(Statement &stmt)
+{
+	static const QStringList modifiers={ QString("OR"), QString("REPLACE"), QString("UNIQUE"), QString("MATERIALIZED"),
+																			 QString("RECURSIVE"), QString("UNLOGGED"), QString("TEMP"), QString("TEMPORARY"),
+																			 QString("GLOBAL"), QString("LOCAL"), QString("TRUSTED"), QString("PROCEDURAL"),
+																			 QString("DEFAULT"), QString("CONSTRAINT") },
+			name_prefixes={ QString("IF"), QString("NOT"), QString("EXISTS"), QString("CONCURRENTLY"), QString("ONLY") },
+			tx_commands={ QString("BEGIN"), QString("START"), QString("COMMIT"), QString("END"), QString("ROLLBACK"),
+										QString("ABORT"), QString("SAVEPOINT"), QString("RELEASE") },
+			no_tx_objects={ QString("DATABASE"), QString("TABLESPACE"), QString("SYSTEM") };
+	static const unsigned MAX_WORDS=20;
+	int pos=stmt.start, end=stmt.start + stmt.length;
+	QStringList words, keywords;
+	QString word, cmd;
+	QStringList sql_name;
+	int idx=1;
+
+	stmt.cmd_type=CMD_OTHER;
+	stmt.obj_type=BASE_OBJECT;
+	stmt.obj_name.clear();
+	stmt.tx_control=stmt.no_tx_block=false;
+
+	while(pos < end && static_cast<unsigned>(words.size()) < MAX_WORDS)
+	{
+		pos=readWord(pos, end, word);
+
+		if(word.isEmpty() || word==QString(";"))
+			break;
+
+		words.push_back(word);
+		keywords.push_back(word.toUpper());
+	}
+
+	if(keywords.isEmpty())
+		return;
+
+	cmd=keywords[0];
+
+	stmt.tx_control=tx_commands.contains(cmd) ||
+									(cmd==QString("PREPARE") && keywords.size() > 1 && keywords[1]==QString("TRANSACTION"));
+
+	//Commands that PostgreSQL refuses to run inside a transaction block
+	stmt.no_tx_block=(cmd==QString("VACUUM")) ||
+									 ((cmd==QString("CREATE") || cmd==QString("DROP")) && keywords.contains(QString("CONCURRENTLY"))) ||
+									 ((cmd==QString("CREATE") || cmd==QString("DROP") || cmd==QString("ALTER") || cmd==QString("REINDEX")) &&
+										keywords.size() > 1 && no_tx_objects.contains(keywords[1]) &&
+										(cmd!=QString("ALTER") || keywords[1]==QString("SYSTEM")));
+
+	if(cmd==QString("COPY"))
+	{
+		int from_idx=keywords.indexOf(QString("FROM"));
+		stmt.has_copy_data=(from_idx > 0 && from_idx + 1 < keywords.size() && keywords[from_idx + 1]==QString("STDIN"));
+		return;
+	}
+
+	//Statements like COMMENT ON DATABASE are classified only to be identified as database related commands
+	if(cmd==QString("COMMENT") && keywords.size() > 2 && keywords[2]==QString("DATABASE"))
+	{
+		stmt.obj_type=OBJ_DATABASE;
+		return;
+	}
+
+	if(cmd==QString("CREATE"))
+		stmt.cmd_type=CMD_CREATE;
+	else if(cmd==QString("ALTER"))
+		stmt.cmd_type=CMD_ALTER;
+	else if(cmd==QString("DROP"))
+		stmt.cmd_type=CMD_DROP;
+	else
+		return;
+
+	while(idx < keywords.size() && modifiers.contains(keywords[idx]))
+		idx++;
+
+	for(ObjectType obj_tp : obj_types)
+	{
+		sql_name=BaseObject::getSQLName(obj_tp).split(QChar(' '));
+
+		if(keywords.mid(idx, sql_name.size())==sql_name)
+		{
+			stmt.obj_type=obj_tp;
+			idx+=sql_name.size();
+			break;
+		}
+	}
+
+	if(stmt.obj_type==BASE_OBJECT)
+	{
+		stmt.cmd_type=CMD_OTHER;
+		return;
+	}
+
+	while(idx < keywords.size() && name_prefixes.contains(keywords[idx]))
+		idx++;
+
+	if(idx >= words.size())
+		return;
+
+	if(stmt.obj_type==OBJ_CAST)
+		stmt.obj_name=QString("cast") + QString(words[idx]).replace(QRegExp(QString("( )+(AS)( )+"), Qt::CaseInsensitive), QString(","));
+	else
+	{
+		stmt.obj_name=words[idx];
+
+		//Functions and aggregates are identified by their signatures
+		if((stmt.obj_type==OBJ_FUNCTION || stmt.obj_type==OBJ_AGGREGATE) &&
+			 idx + 1 < words.size() && words[idx + 1].startsWith(QChar('(')))
+			stmt.obj_name+=words[idx + 1];
+	}
+
+	stmt.obj_name.remove(QChar('"'));
+
+	//Columns and constraints handled via ALTER TABLE ... [ADD|DROP] [COLUMN|CONSTRAINT] are identified as table.object
+	if(stmt.cmd_type==CMD_ALTER && stmt.obj_type==OBJ_TABLE && idx + 3 < keywords.size() &&
+		 (keywords[idx + 1]==QString("ADD") || keywords[idx + 1]==QString("DROP")) &&
+		 (keywords[idx + 2]==QString("COLUMN") || keywords[idx + 2]==QString("CONSTRAINT")))
+	{
+		stmt.obj_type=(keywords[idx + 2]==QString("COLUMN") ? OBJ_COLUMN : OBJ_CONSTRAINT);
+		stmt.cmd_type=(keywords[idx + 1]==QString("ADD") ? CMD_CREATE : CMD_DROP);
+		idx+=3;
+
+		while(idx < keywords.size() && name_prefixes.contains(keywords[idx]))
+			idx++;
+
+		if(idx < words.size())
+			stmt.obj_name+=QChar('.') + QString(words[idx]).remove(QChar('"'));
+	}
+}
+
+bool SQLStatementSplitter::isCommentedDrop(int pos, int end, Statement &stmt)
+{
+	const QChar *data=buffer.constData();
+	unsigned comm_cnt=0;
+	QStringRef cmd;
+
+	while(pos + 1 < end && data[pos]==QChar('-') && data[pos + 1]==QChar('-'))
+	{
+		comm_cnt++;
+		pos+=2;
+
+		while(pos < end && data[pos]==QChar(' '))
+			pos++;
+	}
+
+	/* If the count of comment indicators (--) is 1 indicates that the DDL of the
+	object related to the DROP is enabled, so the DROP is returned otherwise ignored */
+	if(comm_cnt!=1)
+		return(false);
+
+	while(end > pos && data[end - 1].isSpace())
+		end--;
+
+	cmd=buffer.midRef(pos, end - pos);
+
+	if(!cmd.startsWith(QString("DROP ")) &&
+		 !(cmd.startsWith(QString("ALTER TABLE ")) && cmd.contains(QString(" DROP "))))
+		return(false);
+
+	stmt=Statement();
+	stmt.start=pos;
+	stmt.length=end - pos;
+	stmt.commented=true;
+	classifyStatement(stmt);
+
+	return(true);
+}
+
+bool SQLStatementSplitter::next(Statement &stmt)
+{
+	const QChar *data=buffer.constData();
+	int end=buffer.size(), line_end=0, stmt_end=0;
+
+	while(position < end)
+	{
+		//Skipping spaces and comments between the statements
+		if(data[position].isSpace())
+			position++;
+		else if(data[position]==QChar('-') && position + 1 < end && data[position + 1]==QChar('-'))
+		{
+			line_end=buffer.indexOf(QChar('\n'), position);
+
+			if(line_end < 0)
+				line_end=end;
+
+			if(commented_drops && isCommentedDrop(position, line_end, stmt))
+			{
+				position=line_end;
+				return(true);
+			}
+
+			position=line_end;
+		}
+		else if(data[position]==QChar('/') && position + 1 < end && data[position + 1]==QChar('*'))
+			position=skipBlockComment(position, end);
+		//Ignoring empty statements
+		else if(data[position]==QChar(';'))
+			position++;
+		else
+		{
+			stmt_end=findStatementEnd(position);
+
+			stmt=Statement();
+			stmt.start=position;
+			stmt.length=stmt_end - position;
+			classifyStatement(stmt);
+
+			//The data block of a COPY FROM STDIN starts in the line after the command
+			if(stmt.has_copy_data)
+			{
+				line_end=buffer.indexOf(QChar('\n'), stmt_end);
+				stmt_end=findCopyDataEnd(line_end < 0 ? end : line_end + 1);
+				stmt.length=stmt_end - stmt.start;
+			}
+
+			position=stmt_end;
+			return(true);
+		}
+	}
+
+	return(false);
+}
+
+QString SQLStatementSplitter::getStatement(const Statement &stmt)
+{
+	return(buffer.mid(stmt.start, stmt.length));
+}
+
+int SQLStatementSplitter::getPosition(void)
+{
+	return(position);
+}
+
+int SQLStatementSplitter::getBufferSize(void)
+{
+	return(buffer.size());
+}
+
+vector<SQLStatementSplitter::Statement> SQLStatementSplitter::split(const QString &buffer, bool commented_drops)
+{
+	SQLStatementSplitter splitter(buffer);
+	SQLStatementSplitter::Statement stmt;
+	vector<SQLStatementSplitter::Statement> stmts;
+
+	splitter.setCommentedDropsEnabled(commented_drops);
+
+	while(splitter.next(stmt))
+		stmts.push_back(stmt);
+
+	return(stmts);
+}
@@ -0,0 +1,142 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgconnector
+\class SQLStatementSplitter
+\brief Splits a buffer containing several SQL commands into single statements in one linear pass. The splitter
+understands the PostgreSQL lexical rules that may hide a statement terminator: single quoted strings (including
+the E'' escape form), quoted identifiers, dollar quoted bodies, line and (nested) block comments, parenthesis
+(e.g. multiple rule actions) and the data blocks of COPY ... FROM STDIN. The statements are returned as spans
+(offsets) of the buffer, so no text is copied until getStatement() is called, and each one is classified
+with its command, object type and object name.
+*/
+
+#ifndef SQL_STATEMENT_SPLITTER_H
+#define SQL_STATEMENT_SPLITTER_H
+
+#include "baseobject.h"
+
+class SQLStatementSplitter {
+	public:
+		static const unsigned CMD_OTHER=0,
+		CMD_CREATE=1,
+		CMD_ALTER=2,
+		CMD_DROP=3;
+
+		struct Statement {
+			//! \brief Offset and length of the statement in the buffer (including the terminator, if any)
+			int start, length;
+
+			//! \brief Command of the statement (CMD_CREATE, CMD_ALTER, CMD_DROP or CMD_OTHER)
+			unsigned cmd_type;
+
+			//! \brief Type of the object handled by the statement (BASE_OBJECT when it can't be determined)
+			ObjectType obj_type;
+
+			//! \brief Name of the object handled by the statement (without quotes)
+			QString obj_name;
+
+			//! \brief Indicates that the statement was extracted from a commented DROP command (see setCommentedDropsEnabled())
+			bool commented;
+
+			//! \brief Indicates that the statement is a COPY ... FROM STDIN followed by its data block
+			bool has_copy_data;
+
+			//! \brief Indicates that the statement controls the transaction (BEGIN, COMMIT, ROLLBACK, SAVEPOINT, etc)
+			bool tx_control;
+
+			/*! \brief Indicates that the statement can't run inside a transaction block (e.g. VACUUM, CREATE DATABASE,
+			CREATE INDEX CONCURRENTLY) */
+			bool no_tx_block;
+
+			Statement(void)
+			{
+				start=length=0;
+				cmd_type=CMD_OTHER;
+				obj_type=BASE_OBJECT;
+				commented=has_copy_data=tx_control=no_tx_block=false;
+			}
+		};
+
+	private:
+		//! \brief Buffer being splitted (implicitly shared with the caller's string)
+		QString buffer;
+
+		//! \brief Current position of the splitter in the buffer
+		int position;
+
+		/*! \brief Indicates that lines in the form "-- DROP ..." or "-- ALTER TABLE ... DROP ..." (commented
+		only once) must be returned as statements. pgModeler generates the DROP commands of the objects in this form */
+		bool commented_drops;
+
+		//! \brief Object types in the order they are tested against the statement words
+		static const vector<ObjectType> obj_types;
+
+		static bool isIdentifierChar(const QChar &chr);
+
+		//! \brief Returns the position after the quoted string/identifier started at pos
+		int skipQuoted(int pos, int end, const QChar &delim, bool escapes);
+
+		//! \brief Returns the position after the block comment started at pos
+		int skipBlockComment(int pos, int end);
+
+		//! \brief Returns the position after the dollar quoted string started at pos or -1 if there is no dollar quote at pos
+		int skipDollarQuoted(int pos, int end);
+
+		//! \brief Returns the position after the first statement terminator found from pos
+		int findStatementEnd(int pos);
+
+		//! \brief Returns the position after the data block of a COPY FROM STDIN started at pos (the line after the command)
+		int findCopyDataEnd(int pos);
+
+		/*! \brief Reads the next word of the statement (an identifier, a qualified name, a parenthesized group or an
+		operator) skipping spaces and comments and returns the position after it */
+		int readWord(int pos, int end, QString &word);
+
+		//! \brief Fills the command, object type and object name of the statement
+		void classifyStatement(Statement &stmt);
+
+		//! \brief Checks if the line comment in the interval [pos, end) is a commented DROP command configuring the statement
+		bool isCommentedDrop(int pos, int end, Statement &stmt);
+
+	public:
+		SQLStatementSplitter(const QString &buffer=QString());
+
+		//! \brief Defines the buffer to be splitted and restarts the splitter
+		void setBuffer(const QString &buffer);
+
+		void setCommentedDropsEnabled(bool value);
+
+		/*! \brief Reads the next statement from the buffer. Returns false when there are no more statements.
+		Empty statements (a sole terminator) and comments are skipped */
+		bool next(Statement &stmt);
+
+		//! \brief Returns the text of the statement
+		QString getStatement(const Statement &stmt);
+
+		//! \brief Returns the current position of the splitter in the buffer
+		int getPosition(void);
+
+		int getBufferSize(void);
+
+		//! \brief Returns all the statements of the buffer
+		static vector<Statement> split(const QString &buffer, bool commented_drops=false);
+};
+
+#endif
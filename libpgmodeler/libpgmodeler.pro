@@ -37,6 +37,8 @@ HEADERS += src/textbox.h \
 	   src/conversion.h \
 	   src/schema.h \
 	   src/indexelement.h \
+	   src/partitionkey.h \
+	   src/storageparameters.h \
 	   src/index.h \
 	   src/basegraphicobject.h \
 	   src/relationship.h \
@@ -60,7 +62,8 @@ HEADERS += src/textbox.h \
 		 src/tag.h \
 		 src/eventtrigger.h \
 		 src/genericsql.h \
-		 src/policy.h
+		 src/policy.h \
+		 src/objectsearchindex.h
 
 SOURCES +=  src/textbox.cpp \
 	    src/domain.cpp \
@@ -71,6 +74,8 @@ SOURCES +=  src/textbox.cpp \
 	    src/column.cpp \
 	    src/tablespace.cpp \
 	    src/indexelement.cpp \
+	    src/partitionkey.cpp \
+	    src/storageparameters.cpp \
 	    src/index.cpp \
 	    src/operator.cpp \
 	    src/constraint.cpp \
@@ -109,7 +114,8 @@ SOURCES +=  src/textbox.cpp \
 			src/eventtrigger.cpp \
 			src/operation.cpp \
 			src/genericsql.cpp \
-			src/policy.cpp
+			src/policy.cpp \
+			src/objectsearchindex.cpp
 
 unix|windows: LIBS += -L$$OUT_PWD/../libparsers/ -lparsers \
                     -L$$OUT_PWD/../libutils/ -lutils
@@ -45,7 +45,11 @@ void BaseGraphicObject::setModified(bool value)
 	is_modified=value;
 
 	if(is_modified)
-		emit s_objectModified();
+	{
+		//The container of the object may postpone the update (e.g. while the model runs a batch, see DatabaseModel::startBatch())
+		if(!update_handler || !update_handler->deferObjectUpdate(this))
+			emit s_objectModified();
+	}
 }
 
 void BaseGraphicObject::setSQLDisabled(bool value)
@@ -111,6 +115,11 @@ void BaseGraphicObject::setReceiverObject(QObject *obj)
 	receiver_object=obj;
 }
 
+void BaseGraphicObject::setUpdateHandler(ObjectUpdateHandler *handler)
+{
+	update_handler=handler;
+}
+
 QObject *BaseGraphicObject::getReceiverObject(void)
 {
 	return(receiver_object);
@@ -32,6 +32,19 @@ this is treated in the BaseObjectView class on libobjrenderer library
 #include <QPointF>
 #include "baseobject.h"
 
+class BaseGraphicObject;
+
+/*! \brief Interface of the containers that can postpone the updates of the graphical objects they hold
+(e.g. DatabaseModel while running a batch). It's registered in the objects via BaseGraphicObject::setUpdateHandler() */
+class ObjectUpdateHandler {
+	public:
+		virtual ~ObjectUpdateHandler(void){}
+
+		/*! \brief Must return true when the update of the modified object is postponed by the handler.
+		In that case the object doesn't emit s_objectModified() by itself */
+		virtual bool deferObjectUpdate(BaseGraphicObject *object)=0;
+};
+
 class BaseGraphicObject: public QObject, public BaseObject {
 	private:
 		Q_OBJECT
@@ -55,6 +68,12 @@ class BaseGraphicObject: public QObject, public BaseObject {
 		 it in the QGraphcisScene) */
 		QObject *receiver_object;
 
+		//! \brief Handler that may postpone the updates of the object when it's modified (see setModified())
+		ObjectUpdateHandler *update_handler;
+
+		//! \brief Registers the handler of the updates of the object. Used by the model when the object is added/removed
+		void setUpdateHandler(ObjectUpdateHandler *handler);
+
 	protected:
 		/*! \brief Method that defines the objects position attributes used in generation
 		 of XML code definition */
@@ -83,7 +102,7 @@ class BaseGraphicObject: public QObject, public BaseObject {
 		void setPosition(QPointF pos);
 
 		/*! \brief Sets if the objects is modified or not.
-		 This method emits the signal s_objectModified() */
+		 This method emits the signal s_objectModified() unless the update handler postpones it */
 		virtual void setModified(bool value);
 
 		virtual void setSQLDisabled(bool value);
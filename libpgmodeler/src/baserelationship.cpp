@@ -95,6 +95,7 @@ void BaseRelationship::configureRelationship(void)
 	attributes[ParsersAttributes::RELATIONSHIP_NN]=QString();
 	attributes[ParsersAttributes::RELATIONSHIP_GEN]=QString();
 	attributes[ParsersAttributes::RELATIONSHIP_DEP]=QString();
+	attributes[ParsersAttributes::RELATIONSHIP_PART]=QString();
 	attributes[ParsersAttributes::RELATIONSHIP_1N]=QString();
 	attributes[ParsersAttributes::RELATIONSHIP_11]=QString();
 	attributes[ParsersAttributes::CONSTRAINTS]=QString();
@@ -116,7 +117,7 @@ void BaseRelationship::configureRelationship(void)
 	attributes[ParsersAttributes::REFERENCE_FK]=QString();
 
 	//Check if the relationship type is valid
-	if(rel_type <= RELATIONSHIP_FK)
+	if(rel_type <= RELATIONSHIP_PART)
 	{
 		//Raises an error if one of the tables is not allocated
 		if(!src_table || !dst_table)
@@ -128,16 +129,18 @@ void BaseRelationship::configureRelationship(void)
 		/* Raises an error if the relationship type is generalization or dependency
 			and the source and destination table are the same. */
 		if((rel_type==RELATIONSHIP_GEN ||
-			rel_type==RELATIONSHIP_DEP) && src_table==dst_table)
+			rel_type==RELATIONSHIP_DEP ||
+			rel_type==RELATIONSHIP_PART) && src_table==dst_table)
 			throw Exception(ERR_INV_INH_COPY_RELATIONSHIP,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 		//Allocates the textbox for the name label
 		lables[REL_NAME_LABEL]=new Textbox;
 		lables[REL_NAME_LABEL]->setTextAttribute(Textbox::ITALIC_TXT, true);
 
-		//Allocates the cardinality labels only when the relationship is not generalization or dependency (copy)
+		//Allocates the cardinality labels only when the relationship is not generalization, dependency (copy) or partitioning
 		if(rel_type!=RELATIONSHIP_GEN &&
-				rel_type!=RELATIONSHIP_DEP)
+				rel_type!=RELATIONSHIP_DEP &&
+				rel_type!=RELATIONSHIP_PART)
 		{
 			lables[SRC_CARD_LABEL]=new Textbox;
 			lables[DST_CARD_LABEL]=new Textbox;
@@ -507,6 +510,7 @@ QString BaseRelationship::getRelTypeAttribute(void)
 		case RELATIONSHIP_NN: return(ParsersAttributes::RELATIONSHIP_NN); break;
 		case RELATIONSHIP_GEN: return(ParsersAttributes::RELATIONSHIP_GEN); break;
 		case RELATIONSHIP_FK: return(ParsersAttributes::RELATIONSHIP_FK); break;
+		case RELATIONSHIP_PART: return(ParsersAttributes::RELATIONSHIP_PART); break;
 		default:
 			if(src_table->getObjectType()==OBJ_VIEW)
 				return(ParsersAttributes::RELATION_TAB_VIEW);
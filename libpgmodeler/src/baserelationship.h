@@ -65,7 +65,7 @@ class BaseRelationship: public BaseGraphicObject  {
 		*dst_table;
 
 		/*! \brief Relationship type. It can be "One to One", "One to Many", "Many to Many",
-		 "Generalization", "Dependecy". The constants RELATIONSHIP_??? are used
+		 "Generalization", "Dependecy", "Partitioning". The constants RELATIONSHIP_??? are used
 		 to assign a type to the relationship */
 		unsigned rel_type;
 
@@ -99,7 +99,8 @@ class BaseRelationship: public BaseGraphicObject  {
 		RELATIONSHIP_NN=12, //! \brief Many to many
 		RELATIONSHIP_GEN=13, //! \brief Generalization (Inheritance)
 		RELATIONSHIP_DEP=14, //! \brief Dependency (table-view) / Copy (table-table)
-		RELATIONSHIP_FK=15; //! \brief Relationship generated by creating a foreign key manually on a table
+		RELATIONSHIP_FK=15, //! \brief Relationship generated by creating a foreign key manually on a table
+		RELATIONSHIP_PART=16; //! \brief Partitioning (the source table is a partition of the destination table)
 
 		//! \brief Constats used to reference the relationship labels
 		static const unsigned SRC_CARD_LABEL=0,
@@ -17,6 +17,7 @@
 */
 
 #include "basetable.h"
+#include "tableobject.h"
 
 BaseTable::BaseTable(void)
 {
@@ -61,6 +62,71 @@ QString BaseTable::getAlterDefinition(BaseObject *object)
 	}
 }
 
+void BaseTable::invalidateNameIndex(ObjectType obj_type)
+{
+	if(obj_type==BASE_OBJECT)
+		name_indexes.clear();
+	else
+		name_indexes.erase(obj_type);
+}
+
+void BaseTable::addToNameIndex(TableObject *object, vector<TableObject *> &obj_list)
+{
+	auto itr=name_indexes.find(object->getObjectType());
+
+	//The index of the type is created only on the next search
+	if(itr==name_indexes.end())
+		return;
+
+	if(!obj_list.empty() && obj_list.back()==object)
+	{
+		//In case of duplicated names the first object is kept, as done by the linear search
+		if(!itr->second.contains(object->getName()))
+			itr->second.insert(object->getName(), obj_list.size() - 1);
+	}
+	else
+		name_indexes.erase(itr);
+}
+
+int BaseTable::getObjectIndexByName(const QString &name, ObjectType obj_type, vector<TableObject *> &obj_list)
+{
+	QHash<QString, int>::const_iterator itr;
+	int idx=-1;
+
+	for(unsigned attempt=0; attempt < 2; attempt++)
+	{
+		if(name_indexes.count(obj_type)==0)
+		{
+			QHash<QString, int> &index=name_indexes[obj_type];
+
+			index.reserve(obj_list.size());
+
+			//In case of duplicated names the first object is kept, as done by the linear search
+			for(unsigned i=0; i < obj_list.size(); i++)
+			{
+				if(!index.contains(obj_list[i]->getName()))
+					index.insert(obj_list[i]->getName(), i);
+			}
+		}
+
+		QHash<QString, int> &index=name_indexes[obj_type];
+		itr=index.find(name);
+
+		if(itr==index.end())
+			return(-1);
+
+		idx=itr.value();
+
+		if(idx < static_cast<int>(obj_list.size()) && obj_list[idx]->getName()==name)
+			return(idx);
+
+		//The object changed its position since the index creation so the index is recreated
+		name_indexes.erase(obj_type);
+	}
+
+	return(-1);
+}
+
 void BaseTable::operator = (BaseTable &tab)
 {
 	(*dynamic_cast<BaseGraphicObject *>(this))=dynamic_cast<BaseGraphicObject &>(tab);
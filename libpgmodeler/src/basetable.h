@@ -28,14 +28,27 @@
 
 #include "basegraphicobject.h"
 #include "tag.h"
+#include <QHash>
+
+class TableObject;
 
 class BaseTable: public BaseGraphicObject {
 	private:
 		bool hide_ext_attribs;
 
+		/*! \brief Stores, per object type, the position of the children objects in their lists indexed by name.
+		The index of a type is created on the first search and discarded when objects of that type are added,
+		removed or renamed (see invalidateNameIndex()) */
+		map<ObjectType, QHash<QString, int>> name_indexes;
+
 	protected:
 		Tag *tag;
 
+		/*! \brief Returns the position of the object with the provided (unformatted) name in the list using the name index
+		of the type. Positions changed without invalidating the index (e.g. objects swapped) are detected and the index
+		is recreated. Returns -1 when the object doesn't exist */
+		int getObjectIndexByName(const QString &name, ObjectType obj_type, vector<TableObject *> &obj_list);
+
 	public:
 		BaseTable(void);
 
@@ -76,6 +89,15 @@ class BaseTable: public BaseGraphicObject {
 		//! \brief Returns all child objects of the table
 		virtual vector<BaseObject *> getObjects(void)=0;
 
+		/*! \brief Discards the name index of the specified children type (BASE_OBJECT discards all indexes).
+		This method is called automatically when a child object is renamed (see TableObject::setName()) or removed */
+		void invalidateNameIndex(ObjectType obj_type=BASE_OBJECT);
+
+		/*! \brief Updates the name index of the type of the object just stored in the provided list. An object appended
+		to the list is inserted in the existing index while an object inserted before others shifts their positions,
+		so in that case the index of the type is discarded */
+		void addToNameIndex(TableObject *object, vector<TableObject *> &obj_list);
+
 		virtual QString getCodeDefinition(unsigned tipo_def)=0;
 
 		virtual QString getAlterDefinition(BaseObject *object);
@@ -35,9 +35,16 @@ Column::Column(void)
 	attributes[ParsersAttributes::START]=QString();
 	attributes[ParsersAttributes::CACHE]=QString();
 	attributes[ParsersAttributes::CYCLE]=QString();
+	attributes[ParsersAttributes::STATISTICS]=QString();
+	attributes[ParsersAttributes::STORAGE]=QString();
+	attributes[ParsersAttributes::OPTIONS]=QString();
+	attributes[ParsersAttributes::OPTIONS_CMDS]=QString();
 
 	parent_rel=sequence=nullptr;
 	identity_type=BaseType::null;
+	storage_type=BaseType::null;
+	statistics_target=-1;
+	storage_params=StorageParameters(OBJ_COLUMN);
 }
 
 void Column::setName(const QString &name)
@@ -50,7 +57,7 @@ void Column::setName(const QString &name)
 		prev_name=this->obj_name;
 
 		//Tries to define the new name to column
-		BaseObject::setName(name);
+		TableObject::setName(name);
 
 		/* Case no error is raised stored the old name on the
 		 respective column attribute */
@@ -232,6 +239,95 @@ void Column::setIdSeqAttributes(QString minv, QString maxv, QString inc, QString
 	seq_cycle = cycle;
 }
 
+void Column::setStatisticsTarget(int target)
+{
+	//The upper limit is the one accepted by ALTER TABLE ... SET STATISTICS
+	if(target < -1 || target > 10000)
+		throw Exception(Exception::getErrorMessage(ERR_ASG_INV_STATISTICS_TARGET)
+										.arg(target).arg(this->getName()),
+										ERR_ASG_INV_STATISTICS_TARGET,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	setCodeInvalidated(statistics_target != target);
+	statistics_target=target;
+}
+
+void Column::setStorageType(StorageType storage)
+{
+	setCodeInvalidated(storage_type != storage);
+	storage_type=storage;
+}
+
+void Column::setStorageParameter(const QString &name, const QString &value)
+{
+	try
+	{
+		setCodeInvalidated(storage_params.getParameter(name) != value);
+		storage_params.setParameter(name, value);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void Column::setStorageParameters(const QString &params_str)
+{
+	try
+	{
+		storage_params.setParameters(params_str);
+		setCodeInvalidated(true);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+int Column::getStatisticsTarget(void)
+{
+	return(statistics_target);
+}
+
+StorageType Column::getStorageType(void)
+{
+	return(storage_type);
+}
+
+QString Column::getStorageParameter(const QString &name)
+{
+	return(storage_params.getParameter(name));
+}
+
+StorageParameters Column::getStorageParameters(void)
+{
+	return(storage_params);
+}
+
+QString Column::getStorageDefinition(void)
+{
+	if(statistics_target < 0 && storage_type.getTypeId()==BaseType::null && storage_params.isEmpty())
+		return(QString());
+
+	try
+	{
+		attribs_map attribs;
+
+		attribs[ParsersAttributes::HAS_CHANGES]=ParsersAttributes::_TRUE_;
+		attribs[ParsersAttributes::TABLE]=(getParentTable() ? getParentTable()->getName(true) : QString());
+		attribs[ParsersAttributes::NAME]=this->getName(true);
+		attribs[ParsersAttributes::STATISTICS]=(statistics_target >= 0 ? QString::number(statistics_target) : QString());
+		attribs[ParsersAttributes::STORAGE]=(storage_type.getTypeId()!=BaseType::null ? (~storage_type).toUpper() : QString());
+		attribs[ParsersAttributes::OPTIONS]=storage_params.getCodeDefinition(SchemaParser::SQL_DEFINITION);
+
+		//Only the storage related commands of the column's alter schema are generated
+		return(BaseObject::getAlterDefinition(this->getSchemaName(), attribs, true, true));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+	}
+}
+
 QString Column::getCodeDefinition(unsigned def_type)
 {
 	QString code_def=getCachedCode(def_type, false);
@@ -270,6 +366,14 @@ QString Column::getCodeDefinition(unsigned def_type)
 
 	attributes[ParsersAttributes::NOT_NULL]=(!not_null ? QString() : ParsersAttributes::_TRUE_);
 	attributes[ParsersAttributes::DECL_IN_TABLE]=(isDeclaredInTable() ? ParsersAttributes::_TRUE_ : QString());
+	attributes[ParsersAttributes::STATISTICS]=(statistics_target >= 0 ? QString::number(statistics_target) : QString());
+	attributes[ParsersAttributes::STORAGE]=(storage_type.getTypeId()!=BaseType::null ? ~storage_type : QString());
+	attributes[ParsersAttributes::OPTIONS]=storage_params.getCodeDefinition(def_type);
+	attributes[ParsersAttributes::OPTIONS_CMDS]=QString();
+
+	//Columns declared in the table have their storage commands generated by the parent table (see Table::setColumnsAttribute)
+	if(def_type==SchemaParser::SQL_DEFINITION && !isDeclaredInTable())
+		attributes[ParsersAttributes::OPTIONS_CMDS]=getStorageDefinition();
 
 	return(BaseObject::__getCodeDefinition(def_type));
 }
@@ -309,6 +413,22 @@ QString Column::getAlterDefinition(BaseObject *object)
 		if(this->not_null!=col->not_null)
 			attribs[ParsersAttributes::NOT_NULL]=(!col->not_null ? ParsersAttributes::UNSET : ParsersAttributes::_TRUE_);
 
+		attribs[ParsersAttributes::STATISTICS]=QString();
+		attribs[ParsersAttributes::STORAGE]=QString();
+		attribs[ParsersAttributes::OPTIONS]=QString();
+		attribs[ParsersAttributes::RESET_OPTIONS]=QString();
+
+		//Resetting the statistics target to the system default is done by setting it to -1
+		if(this->statistics_target!=col->statistics_target)
+			attribs[ParsersAttributes::STATISTICS]=QString::number(col->statistics_target);
+
+		/* There's no command to reset the storage mode to the data type's default (which is unknown for user defined types)
+		so only changes to an explicit storage mode are generated */
+		if(this->storage_type!=col->storage_type && col->storage_type.getTypeId()!=BaseType::null)
+			attribs[ParsersAttributes::STORAGE]=(~col->storage_type).toUpper();
+
+		storage_params.getDifferences(col->storage_params, attribs[ParsersAttributes::OPTIONS], attribs[ParsersAttributes::RESET_OPTIONS]);
+
 		attribs[ParsersAttributes::NEW_IDENTITY_TYPE] = QString();
 
 		if(this->identity_type == BaseType::null && col->identity_type != BaseType::null)
@@ -381,6 +501,8 @@ QString Column::getAlterDefinition(BaseObject *object)
 
 void Column::operator = (Column &col)
 {
+	BaseTable *prev_table=this->getParentTable();
+
 	this->comment=col.comment;
 	this->is_protected=col.is_protected;
 
@@ -403,9 +525,14 @@ void Column::operator = (Column &col)
 	this->seq_min_value = col.seq_min_value;
 	this->seq_start = col.seq_start;
 
+	this->statistics_target = col.statistics_target;
+	this->storage_type = col.storage_type;
+	this->storage_params = col.storage_params;
+
 	this->setParentTable(col.getParentTable());
 	this->setAddedByCopy(false);
 	this->setAddedByGeneralization(false);
 	this->setAddedByLinking(false);
 	this->setCodeInvalidated(true);
+	this->invalidateNameIndexes(prev_table);
 }
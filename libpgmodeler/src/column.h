@@ -27,6 +27,7 @@
 #define COLUMN_H
 
 #include "tableobject.h"
+#include "storageparameters.h"
 
 class Column: public TableObject{
 	protected:
@@ -77,6 +78,15 @@ class Column: public TableObject{
 		//! \brief Underlying sequence's cache value (only for identity column)
 		seq_cache;
 
+		//! \brief Statistics target used by ANALYZE (-1 means the system default)
+		int statistics_target;
+
+		//! \brief Storage mode of the column (null means the data type's default)
+		StorageType storage_type;
+
+		//! \brief Attribute options of the column (n_distinct, n_distinct_inherited)
+		StorageParameters storage_params;
+
 	public:
 		Column(void);
 
@@ -138,6 +148,27 @@ class Column: public TableObject{
 		//! \brief Sets at once all the necessary fields to define the underlying sequence's attributes
 		void setIdSeqAttributes(QString minv, QString maxv, QString inc, QString start, QString cache, bool cycle);
 
+		//! \brief Defines the statistics target of the column. Use -1 to fallback to the system default
+		void setStatisticsTarget(int target);
+
+		//! \brief Defines the storage mode of the column. Use BaseType::null to fallback to the data type's default
+		void setStorageType(StorageType storage);
+
+		//! \brief Defines the value of an attribute option (n_distinct, n_distinct_inherited). An empty value removes the option
+		void setStorageParameter(const QString &name, const QString &value);
+
+		//! \brief Replaces the attribute options by the ones in the string in the form name=value[,name=value...]
+		void setStorageParameters(const QString &params_str);
+
+		int getStatisticsTarget(void);
+		StorageType getStorageType(void);
+		QString getStorageParameter(const QString &name);
+		StorageParameters getStorageParameters(void);
+
+		/*! \brief Returns the ALTER TABLE commands that configure the statistics target, storage mode and attribute options
+		of the column. An empty string is returned when the column uses the defaults */
+		QString getStorageDefinition(void);
+
 		bool isIdSeqCycle(void);
 		QString getIdSeqMaxValue(void);
 		QString getIdSeqMinValue(void);
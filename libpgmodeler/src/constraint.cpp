@@ -24,6 +24,7 @@ Constraint::Constraint(void)
 	obj_type=OBJ_CONSTRAINT;
 	deferrable=false;
 	no_inherit=false;
+	not_valid=false;
 	fill_factor=0;
 	index_type=BaseType::null;
 
@@ -47,6 +48,7 @@ Constraint::Constraint(void)
 	attributes[ParsersAttributes::DECL_IN_TABLE]=QString();
 	attributes[ParsersAttributes::FACTOR]=QString();
 	attributes[ParsersAttributes::NO_INHERIT]=QString();
+	attributes[ParsersAttributes::NOT_VALID]=QString();
 	attributes[ParsersAttributes::ELEMENTS]=QString();
 }
 
@@ -261,6 +263,12 @@ void Constraint::setNoInherit(bool value)
 	no_inherit=value;
 }
 
+void Constraint::setNotValid(bool value)
+{
+	setCodeInvalidated(not_valid != value);
+	not_valid=value;
+}
+
 unsigned Constraint::getFillFactor(void)
 {
 	return(fill_factor);
@@ -389,6 +397,11 @@ bool Constraint::isNoInherit(void)
 	return(no_inherit);
 }
 
+bool Constraint::isNotValid(void)
+{
+	return(not_valid);
+}
+
 bool Constraint::isReferRelationshipAddedColumn(void)
 {
 	vector<Column *>::iterator itr, itr_end;
@@ -716,6 +729,13 @@ QString Constraint::getCodeDefinition(unsigned def_type, bool inc_addedbyrel)
 
 	setDeclInTableAttribute();
 
+	//NOT VALID is accepted only when adding foreign keys and check constraints through ALTER TABLE
+	if(not_valid && attributes[ParsersAttributes::DECL_IN_TABLE].isEmpty() &&
+		 (constr_type==ConstraintType::foreign_key || constr_type==ConstraintType::check))
+		attributes[ParsersAttributes::NOT_VALID]=ParsersAttributes::_TRUE_;
+	else
+		attributes[ParsersAttributes::NOT_VALID]=QString();
+
 	if(fill_factor!=0 && (constr_type==ConstraintType::primary_key || constr_type==ConstraintType::unique))
 		attributes[ParsersAttributes::FACTOR]=QString("%1").arg(fill_factor);
 	else
@@ -730,6 +750,29 @@ QString Constraint::getDropDefinition(bool cascade)
 	return(TableObject::getDropDefinition(cascade));
 }
 
+QString Constraint::getValidateDefinition(void)
+{
+	if(!getParentTable() ||
+		 (constr_type!=ConstraintType::foreign_key && constr_type!=ConstraintType::check))
+		return(QString());
+
+	try
+	{
+		attribs_map attribs;
+
+		attribs[ParsersAttributes::HAS_CHANGES]=ParsersAttributes::_TRUE_;
+		attribs[ParsersAttributes::VALIDATE]=ParsersAttributes::_TRUE_;
+		attribs[ParsersAttributes::TABLE]=getParentTable()->getName(true);
+		attribs[ParsersAttributes::NAME]=this->getName(true);
+
+		return(BaseObject::getAlterDefinition(this->getSchemaName(), attribs, false, true));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
 QString Constraint::getSignature(bool format)
 {
 	if(!getParentTable())
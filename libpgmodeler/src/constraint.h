@@ -40,7 +40,11 @@ class Constraint: public TableObject{
 		bool deferrable,
 
 		//! \brief Indicates if the constraint will be copied or not to the child tables of the contraint's table (only for check constraint)
-		no_inherit;
+		no_inherit,
+
+		/*! \brief Indicates that the constraint must be added without checking the existing rows (NOT VALID).
+		This flag is not stored in the model, it is used only by the diff process (only for foreign keys and check constraints) */
+		not_valid;
 
 		//! \brief Deferral type for the constraint (except for check contraints)
 		DeferralType deferral_type;
@@ -140,6 +144,9 @@ class Constraint: public TableObject{
 		//! \brief Defines if the constraints is propagated to child tables (only for exclude constraints)
 		void setNoInherit(bool value);
 
+		//! \brief Defines if the constraint must be added as NOT VALID (only for foreign keys and check constraints not declared in the table)
+		void setNotValid(bool value);
+
 		//! \brief Returns the constraint fill factor
 		unsigned getFillFactor(void);
 
@@ -189,6 +196,9 @@ class Constraint: public TableObject{
 		//! \brief Returns if the constraints will propagated to child tables
 		bool isNoInherit(void);
 
+		//! \brief Returns if the constraint will be added as NOT VALID
+		bool isNotValid(void);
+
 		/*! \brief Returns whether the constraint references columns added
 		 by relationship. This method is used as auxiliary
 		 to control which constraints reference columns added by the
@@ -219,6 +229,10 @@ class Constraint: public TableObject{
 
 		virtual QString getDropDefinition(bool cascade) final;
 
+		/*! \brief Returns the command that validates the existing rows of the table against the constraint (ALTER TABLE ... VALIDATE CONSTRAINT).
+		An empty string is returned for constraints other than foreign keys and check constraints */
+		QString getValidateDefinition(void);
+
 		//! \brief Indicates whether the column exists on the specified internal column list
 		bool isColumnExists(Column *column, unsigned col_type);
 
@@ -18,6 +18,8 @@
 
 #include "databasemodel.h"
 #include "pgmodelerns.h"
+#include "objectsearchindex.h"
+#include "tracer.h"
 
 unsigned DatabaseModel::dbmodel_id=2000;
 
@@ -40,7 +42,8 @@ DatabaseModel::DatabaseModel(void)
 
 	conn_limit=-1;
 	last_zoom=1;
-	loading_model=invalidated=append_at_eod=prepend_at_bod=false;
+	loading_model=invalidated=append_at_eod=prepend_at_bod=batch_rels_invalidated=batch_updates_deferred=false;
+	batch_level=batch_added=batch_removed=0;
 	attributes[ParsersAttributes::ENCODING]=QString();
 	attributes[ParsersAttributes::TEMPLATE_DB]=QString();
 	attributes[ParsersAttributes::CONN_LIMIT]=QString();
@@ -218,7 +221,7 @@ void DatabaseModel::addObject(BaseObject *object, int obj_idx)
 		}
 		catch(Exception &e)
 		{
-			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+			throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		}
 	}
 }
@@ -286,7 +289,7 @@ void DatabaseModel::removeObject(BaseObject *object, int obj_idx)
 		}
 		catch(Exception &e)
 		{
-			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+			throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		}
 	}
 }
@@ -396,10 +399,7 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 			there is some other tablespace pointing to the same directory */
 			if(tabspc->getDirectory()==aux_tabspc->getDirectory())
 			{
-				throw Exception(Exception::getErrorMessage(ERR_ASG_DUP_TABLESPACE_DIR)
-								.arg(tabspc->getName())
-								.arg(aux_tabspc->getName()),
-								ERR_ASG_DUP_TABLESPACE_DIR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(ERR_ASG_DUP_TABLESPACE_DIR, { tabspc->getName(), aux_tabspc->getName() },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 			}
 
 			itr++;
@@ -436,7 +436,7 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	obj_list=getObjectList(object->getObjectType());
@@ -457,6 +457,13 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 	}
 
 	object->setDatabase(this);
+
+	if(BaseGraphicObject::isGraphicObject(object->getObjectType()))
+		dynamic_cast<BaseGraphicObject *>(object)->setUpdateHandler(this);
+
+	if(batch_level > 0)
+		batch_added++;
+
 	emit s_objectAdded(object);
 	this->setInvalidated(true);
 }
@@ -528,6 +535,17 @@ void DatabaseModel::__removeObject(BaseObject *object, int obj_idx, bool check_r
 		}
 
 		object->setDatabase(nullptr);
+
+		if(BaseGraphicObject::isGraphicObject(obj_type))
+			dynamic_cast<BaseGraphicObject *>(object)->setUpdateHandler(nullptr);
+
+		if(batch_level > 0)
+		{
+			QMutexLocker locker(&batch_mutex);
+			batch_pending_updates.erase(dynamic_cast<BaseGraphicObject *>(object));
+			batch_removed++;
+		}
+
 		emit s_objectRemoved(object);
 	}
 }
@@ -801,7 +819,7 @@ void DatabaseModel::addTable(Table *table, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -825,7 +843,7 @@ void DatabaseModel::removeTable(Table *table, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -838,7 +856,7 @@ void DatabaseModel::addSequence(Sequence *sequence, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -860,7 +878,7 @@ void DatabaseModel::removeSequence(Sequence *sequence, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -872,7 +890,7 @@ void DatabaseModel::addCollation(Collation *collation, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -894,7 +912,7 @@ void DatabaseModel::removeCollation(Collation *collation, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -909,7 +927,7 @@ void DatabaseModel::addExtension(Extension *extension, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -931,7 +949,7 @@ void DatabaseModel::addTag(Tag *tag, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -943,7 +961,7 @@ void DatabaseModel::removeTag(Tag *tag, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -965,7 +983,7 @@ void DatabaseModel::addEventTrigger(EventTrigger *evnttrig, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -977,7 +995,7 @@ void DatabaseModel::removeEventTrigger(EventTrigger *evnttrig, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -999,7 +1017,7 @@ void DatabaseModel::addGenericSQL(GenericSQL *genericsql, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1011,7 +1029,7 @@ void DatabaseModel::removeGenericSQL(GenericSQL *genericsql, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1036,7 +1054,7 @@ void DatabaseModel::removeExtension(Extension *extension, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1052,7 +1070,7 @@ void DatabaseModel::addView(View *view, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1078,7 +1096,7 @@ void DatabaseModel::removeView(View *view, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1299,17 +1317,19 @@ void DatabaseModel::disconnectRelationships(void)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
 void DatabaseModel::validateRelationships(void)
 {
+	TRACE_SCOPE("model", "validateRelationships");
+
 	vector<BaseObject *>::iterator itr, itr_end, itr_ant;
 	Relationship *rel=nullptr;
 	BaseRelationship *base_rel=nullptr;
 	vector<BaseObject *> vet_rel, vet_rel_inv, rels, fail_rels;
-	bool found_inval_rel, valid_fail_rels=false;
+	bool found_inval_rel, valid_fail_rels=false, children_changed=false;
 	vector<Exception> errors;
 	map<unsigned, QString>::iterator itr1, itr1_end;
 	map<unsigned, Exception> error_map;
@@ -1319,6 +1339,13 @@ void DatabaseModel::validateRelationships(void)
 	vector<Schema *> schemas;
 	BaseTable *tab1=nullptr, *tab2=nullptr;
 
+	//Inside a batch the relationships are validated only once in finishBatch()
+	if(batch_level > 0)
+	{
+		batch_rels_invalidated=true;
+		return;
+	}
+
 	itr=relationships.begin();
 	itr_end=relationships.end();
 
@@ -1377,6 +1404,8 @@ void DatabaseModel::validateRelationships(void)
 		//If there is some invalidated relationship or special objects to be recreated
 		if(found_inval_rel || !xml_special_objs.empty())
 		{
+			children_changed=true;
+
 			//Stores the special objects definition if there is some invalidated relationships
 			if(!loading_model && xml_special_objs.empty())
 				storeSpecialObjectsXML();
@@ -1545,6 +1574,17 @@ void DatabaseModel::validateRelationships(void)
 	//The validation continues until there is some invalid relationship
 	while(found_inval_rel);
 
+	/* Reconnecting the relationships recreates the columns/constraints added by them and the special objects, changing the
+	children of any table or view, so all of them are notified */
+	if(!loading_model && children_changed)
+	{
+		for(auto &tab : tables)
+			notifyObjectRenamed(tab);
+
+		for(auto &view : views)
+			notifyObjectRenamed(view);
+	}
+
 	if(!loading_model)
 	{
 		//Updates the schemas to ajdust its sizes due to the tables resizings
@@ -1601,6 +1641,111 @@ void DatabaseModel::validateRelationships(void)
 	}
 }
 
+void DatabaseModel::startBatch(void)
+{
+	if(batch_level==0)
+	{
+		batch_rels_invalidated=false;
+		batch_added=batch_removed=0;
+		batch_fk_tables.clear();
+
+		QMutexLocker locker(&batch_mutex);
+		batch_updates_deferred=true;
+	}
+
+	batch_level++;
+}
+
+void DatabaseModel::finishBatch(void)
+{
+	if(batch_level==0)
+		return;
+
+	batch_level--;
+
+	if(batch_level > 0)
+		return;
+
+	try
+	{
+		if(batch_rels_invalidated)
+		{
+			batch_rels_invalidated=false;
+			validateRelationships();
+		}
+
+		/* The fk relationships are updated only for the tables that still exist in the model since
+		some of them could be removed (and even destroyed) in the same batch */
+		for(auto &tab : batch_fk_tables)
+		{
+			if(std::find(tables.begin(), tables.end(), tab)!=tables.end())
+				updateTableFKRelationships(tab);
+		}
+
+		batch_fk_tables.clear();
+
+		finishDeferredUpdates();
+		emit s_batchFinished(batch_added, batch_removed);
+	}
+	catch(Exception &e)
+	{
+		batch_fk_tables.clear();
+		finishDeferredUpdates();
+		emit s_batchFinished(batch_added, batch_removed);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+}
+
+bool DatabaseModel::isBatchRunning(void)
+{
+	return(batch_level > 0);
+}
+
+bool DatabaseModel::deferObjectUpdate(BaseGraphicObject *object)
+{
+	QMutexLocker locker(&batch_mutex);
+
+	if(!batch_updates_deferred || !object)
+		return(false);
+
+	batch_pending_updates.insert(object);
+	return(true);
+}
+
+void DatabaseModel::finishDeferredUpdates(void)
+{
+	vector<BaseGraphicObject *> objects, rels, schemas;
+	ObjectType obj_type;
+
+	batch_mutex.lock();
+
+	/* Schemas are resized according to the tables and views inside them and relationships are
+	connected to the tables borders, so these objects are updated after all the others */
+	for(auto &obj : batch_pending_updates)
+	{
+		obj_type=obj->getObjectType();
+
+		if(obj_type==OBJ_SCHEMA)
+			schemas.push_back(obj);
+		else if(obj_type==OBJ_RELATIONSHIP || obj_type==BASE_RELATIONSHIP)
+			rels.push_back(obj);
+		else
+			objects.push_back(obj);
+	}
+
+	batch_pending_updates.clear();
+	batch_updates_deferred=false;
+
+	//The signals are emitted without holding the lock since the receivers may modify the objects again
+	batch_mutex.unlock();
+
+	objects.insert(objects.end(), rels.begin(), rels.end());
+	objects.insert(objects.end(), schemas.begin(), schemas.end());
+
+	for(auto &obj : objects)
+		emit obj->s_objectModified();
+}
+
 void DatabaseModel::checkRelationshipRedundancy(Relationship *rel)
 {
 	try
@@ -1620,7 +1765,8 @@ void DatabaseModel::checkRelationshipRedundancy(Relationship *rel)
 			 rel->hasIndentifierAttribute())) ||
 
 				(rel_type==Relationship::RELATIONSHIP_GEN ||
-				 rel_type==Relationship::RELATIONSHIP_DEP))
+				 rel_type==Relationship::RELATIONSHIP_DEP ||
+				 rel_type==Relationship::RELATIONSHIP_PART))
 		{
 			BaseTable *ref_table=nullptr, *src_table=nullptr;
 			Table *recv_table=nullptr;
@@ -1662,7 +1808,8 @@ void DatabaseModel::checkRelationshipRedundancy(Relationship *rel)
 							  (rel_aux->isIdentifier() ||
 							   rel_aux->hasIndentifierAttribute())) ||
 							 (aux_rel_type==Relationship::RELATIONSHIP_GEN ||
-							  aux_rel_type==Relationship::RELATIONSHIP_DEP)))
+							  aux_rel_type==Relationship::RELATIONSHIP_DEP ||
+							  aux_rel_type==Relationship::RELATIONSHIP_PART)))
 
 					{
 						//The receiver table will be the receiver from the current relationship
@@ -1693,7 +1840,7 @@ void DatabaseModel::checkRelationshipRedundancy(Relationship *rel)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1897,7 +2044,7 @@ void DatabaseModel::storeSpecialObjectsXML(void)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1935,7 +2082,7 @@ void DatabaseModel::createSpecialObject(const QString &xml_def, unsigned obj_id)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e, xml_def);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, xml_def);
 	}
 }
 
@@ -1985,7 +2132,7 @@ void DatabaseModel::addRelationship(BaseRelationship *rel, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2022,13 +2169,15 @@ void DatabaseModel::removeRelationship(BaseRelationship *rel, int obj_idx)
 			}
 
 			//Updating the fk relationships for the receiver table after removing the old relationship
-			if(recv_tab)
+			if(recv_tab && batch_level > 0)
+				batch_fk_tables.push_back(recv_tab);
+			else if(recv_tab)
 				updateTableFKRelationships(recv_tab);
 		}
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2128,7 +2277,7 @@ void DatabaseModel::addTextbox(Textbox *txtbox, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2140,7 +2289,7 @@ void DatabaseModel::removeTextbox(Textbox *txtbox, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2162,7 +2311,7 @@ void DatabaseModel::addSchema(Schema *schema, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2184,7 +2333,7 @@ void DatabaseModel::removeSchema(Schema *schema, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2196,7 +2345,7 @@ void DatabaseModel::addRole(Role *role, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2218,7 +2367,7 @@ void DatabaseModel::removeRole(Role *role, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2230,7 +2379,7 @@ void DatabaseModel::addTablespace(Tablespace *tabspc, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2252,7 +2401,7 @@ void DatabaseModel::removeTablespace(Tablespace *tabspc, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2264,7 +2413,7 @@ void DatabaseModel::addCast(Cast *cast, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2276,7 +2425,7 @@ void DatabaseModel::removeCast(Cast *cast, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2298,7 +2447,7 @@ void DatabaseModel::addConversion(Conversion *conv, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2310,7 +2459,7 @@ void DatabaseModel::removeConversion(Conversion *conv, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2333,7 +2482,7 @@ void DatabaseModel::addLanguage(Language *lang, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2355,7 +2504,7 @@ void DatabaseModel::removeLanguage(Language *lang, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2367,7 +2516,7 @@ void DatabaseModel::addFunction(Function *func, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2389,7 +2538,7 @@ void DatabaseModel::removeFunction(Function *func, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2401,7 +2550,7 @@ void DatabaseModel::addAggregate(Aggregate *aggreg, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2423,7 +2572,7 @@ void DatabaseModel::removeAggregate(Aggregate *aggreg, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2465,7 +2614,7 @@ void DatabaseModel::addDomain(Domain *domain, int obj_idx)
 		}
 		catch(Exception &e)
 		{
-			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+			throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		}
 	}
 }
@@ -2478,7 +2627,7 @@ void DatabaseModel::removeDomain(Domain *domain, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2500,7 +2649,7 @@ void DatabaseModel::addOperatorFamily(OperatorFamily *op_family, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2522,7 +2671,7 @@ void DatabaseModel::removeOperatorFamily(OperatorFamily *op_family, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2534,7 +2683,7 @@ void DatabaseModel::addOperatorClass(OperatorClass *op_class, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2546,7 +2695,7 @@ void DatabaseModel::removeOperatorClass(OperatorClass *op_class, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2568,7 +2717,7 @@ void DatabaseModel::addOperator(Operator *oper, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2580,7 +2729,7 @@ void DatabaseModel::removeOperator(Operator *oper, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2631,7 +2780,7 @@ void DatabaseModel::addType(Type *type, int obj_idx)
 		}
 		catch(Exception &e)
 		{
-			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+			throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		}
 	}
 }
@@ -2644,7 +2793,7 @@ void DatabaseModel::removeType(Type *type, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2669,7 +2818,7 @@ void DatabaseModel::removeUserType(BaseObject *object, int obj_idx)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2697,7 +2846,7 @@ void DatabaseModel::addPermissions(const vector<Permission *> &perms)
 			itr++;
 		}
 
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2712,21 +2861,13 @@ void DatabaseModel::addPermission(Permission *perm)
 
 		if(getPermissionIndex(perm, false) >=0)
 		{
-			throw Exception(Exception::getErrorMessage(ERR_ASG_DUPLIC_PERMISSION)
-							.arg(perm->getObject()->getName())
-							.arg(perm->getObject()->getTypeName()),
-							ERR_ASG_DUPLIC_PERMISSION,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ERR_ASG_DUPLIC_PERMISSION, { perm->getObject()->getName(), perm->getObject()->getTypeName() },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		}
 		//Raises an error if the permission is referencing an object that does not exists on model
 		else if(perm->getObject()!=this &&
 				((tab_obj && (getObjectIndex(tab_obj->getParentTable()) < 0)) ||
 				 (!tab_obj && (getObjectIndex(perm->getObject()) < 0))))
-			throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-							.arg(perm->getName())
-							.arg(perm->getObject()->getTypeName())
-							.arg(perm->getObject()->getName())
-							.arg(perm->getObject()->getTypeName()),
-							ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { perm->getName(), perm->getObject()->getTypeName(), perm->getObject()->getName(), perm->getObject()->getTypeName() },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 		permissions.push_back(perm);
 		perm->setDatabase(this);
@@ -2734,14 +2875,10 @@ void DatabaseModel::addPermission(Permission *perm)
 	catch(Exception &e)
 	{
 		if(e.getErrorType()==ERR_ASG_DUPLIC_OBJECT)
-			throw
-			Exception(Exception::getErrorMessage(ERR_ASG_DUPLIC_PERMISSION)
-					  .arg(perm->getObject()->getName())
-					  .arg(perm->getObject()->getTypeName()),
-					  ERR_ASG_DUPLIC_PERMISSION,__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+			throw Exception(ERR_ASG_DUPLIC_PERMISSION, { perm->getObject()->getName(), perm->getObject()->getTypeName() },__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
 
 		else
-			throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+			throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2753,7 +2890,7 @@ void DatabaseModel::removePermission(Permission *perm)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2940,11 +3077,13 @@ void DatabaseModel::configureDatabase(attribs_map &attribs)
 	if(!attribs[ParsersAttributes::CONN_LIMIT].isEmpty())
 		conn_limit=attribs[ParsersAttributes::CONN_LIMIT].toInt();
 
-	setBasicAttributes(this);
+	setBasicAttributes(this, attribs);
 }
 
 void DatabaseModel::loadModel(const QString &filename)
 {
+	TRACE_SCOPE("model", "loadModel");
+
 	if(!filename.isEmpty())
 	{
 		QString dtd_file, str_aux, elem_name;
@@ -3013,13 +3152,15 @@ void DatabaseModel::loadModel(const QString &filename)
 
 						if(obj_type==OBJ_DATABASE)
 						{
-							xmlparser.getElementAttributes(attribs);
+							getObjectRecord(attribs);
 							configureDatabase(attribs);
 						}
 						else
 						{
 							try
 							{
+								TRACE_SCOPE("model", elem_name);
+
 								//Saves the current position of the parser before create any object
 								xmlparser.savePosition();
 								object=createObject(obj_type);
@@ -3032,7 +3173,8 @@ void DatabaseModel::loadModel(const QString &filename)
 									/* If there is at least one inheritance relationship we need to flag this situation
 									 in order to do an addtional rel. validation in the end of loading */
 									if(!found_inh_rel && object->getObjectType()==OBJ_RELATIONSHIP &&
-											dynamic_cast<Relationship *>(object)->getRelationshipType()==BaseRelationship::RELATIONSHIP_GEN)
+											(dynamic_cast<Relationship *>(object)->getRelationshipType()==BaseRelationship::RELATIONSHIP_GEN ||
+											 dynamic_cast<Relationship *>(object)->getRelationshipType()==BaseRelationship::RELATIONSHIP_PART))
 										found_inh_rel=true;
 
 									emit s_objectLoaded((xmlparser.getCurrentBufferLine()/static_cast<float>(xmlparser.getBufferLineCount()))*100,
@@ -3047,7 +3189,7 @@ void DatabaseModel::loadModel(const QString &filename)
 							catch(Exception &e)
 							{
 								QString info_adicional=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename()).arg(xmlparser.getCurrentElement()->line);
-								throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, info_adicional);
+								throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, info_adicional);
 							}
 						}
 					}
@@ -3116,7 +3258,7 @@ void DatabaseModel::loadModel(const QString &filename)
 				throw Exception(str_aux,ERR_LOAD_INV_MODEL_FILE,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
 			}
 			else
-				throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
+				throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, extra_info);
 		}
 	}
 }
@@ -3193,30 +3335,10 @@ BaseObject *DatabaseModel::createObject(ObjectType obj_type)
 	return(object);
 }
 
-void DatabaseModel::setBasicAttributes(BaseObject *object)
+void DatabaseModel::loadBasicAttributes(attribs_map &attribs)
 {
-	attribs_map attribs, attribs_aux;
+	attribs_map attribs_aux;
 	QString elem_name;
-	BaseObject *tabspc=nullptr, *owner=nullptr, *collation=nullptr;
-	Schema *schema=nullptr;
-	ObjectType obj_type=BASE_OBJECT, obj_type_aux;
-	bool has_error=false, protected_obj=false, sql_disabled=false;
-
-	if(!object)
-		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
-	xmlparser.getElementAttributes(attribs);
-
-	obj_type_aux=object->getObjectType();
-
-	if(obj_type_aux!=OBJ_CAST)
-		object->setName(attribs[ParsersAttributes::NAME]);
-
-	if(BaseObject::acceptsAlias(obj_type_aux))
-		object->setAlias(attribs[ParsersAttributes::ALIAS]);
-
-	protected_obj=attribs[ParsersAttributes::PROTECTED]==ParsersAttributes::_TRUE_;
-	sql_disabled=attribs[ParsersAttributes::SQL_DISABLED]==ParsersAttributes::_TRUE_;
 
 	xmlparser.savePosition();
 
@@ -3228,109 +3350,142 @@ void DatabaseModel::setBasicAttributes(BaseObject *object)
 			{
 				elem_name=xmlparser.getElementName();
 
-				//Defines the object's comment
-				if(elem_name==ParsersAttributes::COMMENT)
+				//The comment and custom SQL are stored as the element's content
+				if(elem_name==ParsersAttributes::COMMENT ||
+					 elem_name==ParsersAttributes::APPENDED_SQL ||
+					 elem_name==ParsersAttributes::PREPENDED_SQL)
 				{
 					xmlparser.savePosition();
 					xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
-					object->setComment(xmlparser.getElementContent());
+					attribs[elem_name]=xmlparser.getElementContent();
 					xmlparser.restorePosition();
 				}
-				//Defines the object's schema
-				else if(elem_name==ParsersAttributes::SCHEMA)
-				{
-					obj_type=OBJ_SCHEMA;
-					xmlparser.getElementAttributes(attribs_aux);
-					schema=dynamic_cast<Schema *>(getObject(attribs_aux[ParsersAttributes::NAME], obj_type));
-					object->setSchema(schema);
-					has_error=(!schema && !attribs_aux[ParsersAttributes::NAME].isEmpty());
-				}
-				//Defines the object's tablespace
-				else if(elem_name==ParsersAttributes::TABLESPACE)
-				{
-					obj_type=OBJ_TABLESPACE;
-					xmlparser.getElementAttributes(attribs_aux);
-					tabspc=getObject(attribs_aux[ParsersAttributes::NAME], obj_type);
-					object->setTablespace(tabspc);
-					has_error=(!tabspc && !attribs_aux[ParsersAttributes::NAME].isEmpty());
-				}
-				//Defines the object's owner
-				else if(elem_name==ParsersAttributes::ROLE)
-				{
-					obj_type=OBJ_ROLE;
-					xmlparser.getElementAttributes(attribs_aux);
-					owner=getObject(attribs_aux[ParsersAttributes::NAME], obj_type);
-					object->setOwner(owner);
-					has_error=(!owner && !attribs_aux[ParsersAttributes::NAME].isEmpty());
-				}
-				//Defines the object's schema
-				else if(elem_name==ParsersAttributes::COLLATION)
+				//The schema, tablespace, owner and collation are stored by their names
+				else if(elem_name==ParsersAttributes::SCHEMA ||
+								elem_name==ParsersAttributes::TABLESPACE ||
+								elem_name==ParsersAttributes::COLLATION ||
+								elem_name==ParsersAttributes::ROLE)
 				{
-					obj_type=OBJ_COLLATION;
 					xmlparser.getElementAttributes(attribs_aux);
-					collation=getObject(attribs_aux[ParsersAttributes::NAME], obj_type);
-					object->setCollation(collation);
-					has_error=(!collation && !attribs_aux[ParsersAttributes::NAME].isEmpty());
-				}
-				else if(elem_name==ParsersAttributes::APPENDED_SQL)
-				{
-					xmlparser.savePosition();
-					xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
-					object->setAppendedSQL(xmlparser.getElementContent());
-					xmlparser.restorePosition();
-				}
-				else if(elem_name==ParsersAttributes::PREPENDED_SQL)
-				{
-					xmlparser.savePosition();
-					xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
-					object->setPrependedSQL(xmlparser.getElementContent());
-					xmlparser.restorePosition();
+					attribs[elem_name==ParsersAttributes::ROLE ? ParsersAttributes::OWNER : elem_name]=attribs_aux[ParsersAttributes::NAME];
 				}
-				//Defines the object's position (only for graphical objects)
 				else if(elem_name==ParsersAttributes::POSITION)
 				{
-					xmlparser.getElementAttributes(attribs);
-
-					if(elem_name==ParsersAttributes::POSITION &&
-							(obj_type_aux!=OBJ_RELATIONSHIP &&
-							 obj_type_aux!=BASE_RELATIONSHIP))
-					{
-						dynamic_cast<BaseGraphicObject *>(object)->setPosition(QPointF(attribs[ParsersAttributes::X_POS].toDouble(),
-																			   attribs[ParsersAttributes::Y_POS].toDouble()));
-
-
-					}
+					xmlparser.getElementAttributes(attribs_aux);
+					attribs[ParsersAttributes::X_POS]=attribs_aux[ParsersAttributes::X_POS];
+					attribs[ParsersAttributes::Y_POS]=attribs_aux[ParsersAttributes::Y_POS];
 				}
 			}
 		}
-		while(!has_error && xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
+		while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 	}
 
 	xmlparser.restorePosition();
-	object->setProtected(protected_obj);
-	object->setSQLDisabled(sql_disabled);
+}
+
+void DatabaseModel::getObjectRecord(attribs_map &attribs)
+{
+	xmlparser.getElementAttributes(attribs);
+	loadBasicAttributes(attribs);
+}
+
+void DatabaseModel::setBasicAttributes(BaseObject *object)
+{
+	attribs_map attribs, elem_attribs;
+
+	if(!object)
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	/* Only the basic attributes of the element are copied to the record since some
+	objects have attributes with the same name of the basic child elements (e.g. collation) */
+	xmlparser.getElementAttributes(elem_attribs);
+
+	for(auto &attr : { ParsersAttributes::NAME, ParsersAttributes::ALIAS,
+										 ParsersAttributes::PROTECTED, ParsersAttributes::SQL_DISABLED })
+		attribs[attr]=elem_attribs[attr];
 
-	if(has_error)
+	loadBasicAttributes(attribs);
+	setBasicAttributes(object, attribs);
+}
+
+void DatabaseModel::setBasicAttributes(BaseObject *object, attribs_map &attribs)
+{
+	BaseObject *ref_obj=nullptr;
+	ObjectType obj_type=BASE_OBJECT;
+	QString ref_name;
+	vector<pair<QString, ObjectType>> ref_attribs={{ ParsersAttributes::SCHEMA, OBJ_SCHEMA },
+																									{ ParsersAttributes::TABLESPACE, OBJ_TABLESPACE },
+																									{ ParsersAttributes::OWNER, OBJ_ROLE },
+																									{ ParsersAttributes::COLLATION, OBJ_COLLATION }};
+
+	if(!object)
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	obj_type=object->getObjectType();
+
+	if(obj_type!=OBJ_CAST)
+		object->setName(attribs[ParsersAttributes::NAME]);
+
+	if(BaseObject::acceptsAlias(obj_type))
+		object->setAlias(attribs[ParsersAttributes::ALIAS]);
+
+	if(attribs.count(ParsersAttributes::COMMENT))
+		object->setComment(attribs[ParsersAttributes::COMMENT]);
+
+	if(attribs.count(ParsersAttributes::APPENDED_SQL))
+		object->setAppendedSQL(attribs[ParsersAttributes::APPENDED_SQL]);
+
+	if(attribs.count(ParsersAttributes::PREPENDED_SQL))
+		object->setPrependedSQL(attribs[ParsersAttributes::PREPENDED_SQL]);
+
+	//Assigning the referenced objects using the names stored in the record
+	for(auto &ref_attr : ref_attribs)
+	{
+		ref_name=(attribs.count(ref_attr.first) ? attribs[ref_attr.first] : QString());
+
+		if(ref_name.isEmpty() ||
+			 (ref_attr.second==OBJ_TABLESPACE && !BaseObject::acceptsTablespace(obj_type)) ||
+			 (ref_attr.second==OBJ_ROLE && !BaseObject::acceptsOwner(obj_type)))
+			continue;
+
+		ref_obj=getObject(ref_name, ref_attr.second);
+
+		if(!ref_obj)
+		{
+			throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { object->getName(), object->getTypeName(), ref_name, BaseObject::getTypeName(ref_attr.second) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		}
+
+		if(ref_attr.second==OBJ_SCHEMA)
+			object->setSchema(ref_obj);
+		else if(ref_attr.second==OBJ_TABLESPACE)
+			object->setTablespace(ref_obj);
+		else if(ref_attr.second==OBJ_ROLE)
+			object->setOwner(ref_obj);
+		else
+			object->setCollation(ref_obj);
+	}
+
+	//Defines the object's position (only for graphical objects)
+	if(attribs.count(ParsersAttributes::X_POS) &&
+		 obj_type!=OBJ_RELATIONSHIP && obj_type!=BASE_RELATIONSHIP &&
+		 dynamic_cast<BaseGraphicObject *>(object))
 	{
-		throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-						.arg(object->getName())
-						.arg(object->getTypeName())
-						.arg(attribs_aux[ParsersAttributes::NAME])
-				.arg(BaseObject::getTypeName(obj_type)),
-				ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		dynamic_cast<BaseGraphicObject *>(object)->setPosition(QPointF(attribs[ParsersAttributes::X_POS].toDouble(),
+																																		attribs[ParsersAttributes::Y_POS].toDouble()));
 	}
-	else if(!object->getSchema() &&
-			(obj_type_aux==OBJ_FUNCTION || obj_type_aux==OBJ_TABLE ||
-			 obj_type_aux==OBJ_VIEW  || obj_type_aux==OBJ_DOMAIN ||
-			 obj_type_aux==OBJ_AGGREGATE || obj_type_aux==OBJ_OPERATOR ||
-			 obj_type_aux==OBJ_SEQUENCE || obj_type_aux==OBJ_CONVERSION ||
-			 obj_type_aux==OBJ_TYPE || obj_type_aux==OBJ_OPFAMILY ||
-			 obj_type_aux==OBJ_OPCLASS))
+
+	object->setProtected(attribs[ParsersAttributes::PROTECTED]==ParsersAttributes::_TRUE_);
+	object->setSQLDisabled(attribs[ParsersAttributes::SQL_DISABLED]==ParsersAttributes::_TRUE_);
+
+	if(!object->getSchema() &&
+			(obj_type==OBJ_FUNCTION || obj_type==OBJ_TABLE ||
+			 obj_type==OBJ_VIEW  || obj_type==OBJ_DOMAIN ||
+			 obj_type==OBJ_AGGREGATE || obj_type==OBJ_OPERATOR ||
+			 obj_type==OBJ_SEQUENCE || obj_type==OBJ_CONVERSION ||
+			 obj_type==OBJ_TYPE || obj_type==OBJ_OPFAMILY ||
+			 obj_type==OBJ_OPCLASS))
 	{
-		throw Exception(Exception::getErrorMessage(ERR_ALOC_OBJECT_NO_SCHEMA)
-						.arg(object->getName())
-						.arg(object->getTypeName()),
-						ERR_ALOC_OBJECT_NO_SCHEMA,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ERR_ALOC_OBJECT_NO_SCHEMA, { object->getName(), object->getTypeName() },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -3370,12 +3525,58 @@ double DatabaseModel::getLastZoomFactor(void)
 Role *DatabaseModel::createRole(void)
 {
 	attribs_map attribs, attribs_aux;
+	QString elem_name, roles_attr;
+
+	try
+	{
+		getObjectRecord(attribs);
+
+		//Gathering the member roles of each type in the comma separated lists of the record
+		xmlparser.savePosition();
+
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
+		{
+			do
+			{
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
+				{
+					elem_name=xmlparser.getElementName();
+
+					if(elem_name==ParsersAttributes::ROLES)
+					{
+						xmlparser.getElementAttributes(attribs_aux);
+
+						if(attribs_aux[ParsersAttributes::ROLE_TYPE]==ParsersAttributes::REFER)
+							roles_attr=ParsersAttributes::REF_ROLES;
+						else if(attribs_aux[ParsersAttributes::ROLE_TYPE]==ParsersAttributes::MEMBER)
+							roles_attr=ParsersAttributes::MEMBER_ROLES;
+						else
+							roles_attr=ParsersAttributes::ADMIN_ROLES;
+
+						if(!attribs[roles_attr].isEmpty())
+							attribs[roles_attr]+=QString(",");
+
+						attribs[roles_attr]+=attribs_aux[ParsersAttributes::NAMES];
+					}
+				}
+			}
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
+		}
+
+		xmlparser.restorePosition();
+		return(createRole(attribs));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+}
+
+Role *DatabaseModel::createRole(attribs_map &attribs)
+{
 	Role *role=nullptr, *ref_role=nullptr;
-	int i, len;
-	bool marked;
+	int i;
 	QStringList list;
-	QString elem_name;
-	unsigned role_type;
 
 	QString op_attribs[]={ ParsersAttributes::SUPERUSER, ParsersAttributes::CREATEDB,
 						   ParsersAttributes::CREATEROLE, ParsersAttributes::INHERIT,
@@ -3387,13 +3588,13 @@ Role *DatabaseModel::createRole(void)
 						 Role::OP_LOGIN, Role::OP_ENCRYPTED,
 						 Role::OP_REPLICATION, Role::OP_BYPASSRLS };
 
+	QString roles_attribs[]={ ParsersAttributes::REF_ROLES, ParsersAttributes::MEMBER_ROLES, ParsersAttributes::ADMIN_ROLES };
+	unsigned role_types[]={ Role::REF_ROLE, Role::MEMBER_ROLE, Role::ADMIN_ROLE };
+
 	try
 	{
 		role=new Role;
-		setBasicAttributes(role);
-
-		//Gets all the attributes values from the XML
-		xmlparser.getElementAttributes(attribs);
+		setBasicAttributes(role, attribs);
 
 		role->setPassword(attribs[ParsersAttributes::PASSWORD]);
 		role->setValidity(attribs[ParsersAttributes::VALIDITY]);
@@ -3401,67 +3602,34 @@ Role *DatabaseModel::createRole(void)
 		if(!attribs[ParsersAttributes::CONN_LIMIT].isEmpty())
 			role->setConnectionLimit(attribs[ParsersAttributes::CONN_LIMIT].toInt());
 
-		//Setting up the role options according to the configured on the XML
+		//Setting up the role options according to the configured on the record
 		for(i=0; i < 8; i++)
-		{
-			marked=attribs[op_attribs[i]]==ParsersAttributes::_TRUE_;
-			role->setOption(op_vect[i], marked);
-		}
+			role->setOption(op_vect[i], attribs[op_attribs[i]]==ParsersAttributes::_TRUE_);
 
-		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
+		//The member roles names are separated by comma, so it is needed to split them
+		for(i=0; i < 3; i++)
 		{
-			do
-			{
-				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
-				{
-					elem_name=xmlparser.getElementName();
-
-					//Getting the member roles
-					if(elem_name==ParsersAttributes::ROLES)
-					{
-						//Gets the member roles attributes
-						xmlparser.getElementAttributes(attribs_aux);
-
-						//The member roles names are separated by comma, so it is needed to split them
-						list=attribs_aux[ParsersAttributes::NAMES].split(',');
-						len=list.size();
-
-						//Identifying the member role type
-						if(attribs_aux[ParsersAttributes::ROLE_TYPE]==ParsersAttributes::REFER)
-							role_type=Role::REF_ROLE;
-						else if(attribs_aux[ParsersAttributes::ROLE_TYPE]==ParsersAttributes::MEMBER)
-							role_type=Role::MEMBER_ROLE;
-						else
-							role_type=Role::ADMIN_ROLE;
-
-						for(i=0; i < len; i++)
-						{
-							//Gets the role using the name from the model using the name from the list
-							ref_role=dynamic_cast<Role *>(getObject(list[i].trimmed(),OBJ_ROLE));
+			list=attribs[roles_attribs[i]].split(',', QString::SkipEmptyParts);
 
-							//Raises an error if the roles doesn't exists
-							if(!ref_role)
-							{
-								throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-												.arg(role->getName())
-												.arg(BaseObject::getTypeName(OBJ_ROLE))
-												.arg(list[i])
-												.arg(BaseObject::getTypeName(OBJ_ROLE)),
-												ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-							}
+			for(auto &name : list)
+			{
+				//Gets the role using the name from the model using the name from the list
+				ref_role=dynamic_cast<Role *>(getObject(name.trimmed(),OBJ_ROLE));
 
-							role->addRole(role_type, ref_role);
-						}
-					}
+				//Raises an error if the roles doesn't exists
+				if(!ref_role)
+				{
+					throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { role->getName(), BaseObject::getTypeName(OBJ_ROLE), name, BaseObject::getTypeName(OBJ_ROLE) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 				}
+
+				role->addRole(role_types[i], ref_role);
 			}
-			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
 	{
 		if(role) delete(role);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(role);
@@ -3470,19 +3638,32 @@ Role *DatabaseModel::createRole(void)
 Tablespace *DatabaseModel::createTablespace(void)
 {
 	attribs_map attribs;
+
+	try
+	{
+		getObjectRecord(attribs);
+		return(createTablespace(attribs));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+}
+
+Tablespace *DatabaseModel::createTablespace(attribs_map &attribs)
+{
 	Tablespace *tabspc=nullptr;
 
 	try
 	{
 		tabspc=new Tablespace;
-		setBasicAttributes(tabspc);
-		xmlparser.getElementAttributes(attribs);
+		setBasicAttributes(tabspc, attribs);
 		tabspc->setDirectory(attribs[ParsersAttributes::DIRECTORY]);
 	}
 	catch(Exception &e)
 	{
 		if(tabspc) delete(tabspc);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(tabspc);
@@ -3490,14 +3671,27 @@ Tablespace *DatabaseModel::createTablespace(void)
 
 Schema *DatabaseModel::createSchema(void)
 {
-	Schema *schema=nullptr;
 	attribs_map attribs;
 
+	try
+	{
+		getObjectRecord(attribs);
+		return(createSchema(attribs));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+}
+
+Schema *DatabaseModel::createSchema(attribs_map &attribs)
+{
+	Schema *schema=nullptr;
+
 	try
 	{
 		schema=new Schema;
-		xmlparser.getElementAttributes(attribs);
-		setBasicAttributes(schema);
+		setBasicAttributes(schema, attribs);
 		schema->setFillColor(QColor(attribs[ParsersAttributes::FILL_COLOR]));
 		schema->setRectVisible(attribs[ParsersAttributes::RECT_VISIBLE]==ParsersAttributes::_TRUE_);
 		schema->setFadedOut(attribs[ParsersAttributes::FADED_OUT]==ParsersAttributes::_TRUE_);
@@ -3505,7 +3699,7 @@ Schema *DatabaseModel::createSchema(void)
 	catch(Exception &e)
 	{
 		if(schema) delete(schema);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(schema);
@@ -3515,20 +3709,20 @@ Language *DatabaseModel::createLanguage(void)
 {
 	attribs_map attribs;
 	Language *lang=nullptr;
-	BaseObject *func=nullptr;
-	QString signature, ref_type;
+	QString ref_type;
 	ObjectType obj_type;
 
 	try
 	{
-		lang=new Language;
-		xmlparser.getElementAttributes(attribs);
-		setBasicAttributes(lang);
+		getObjectRecord(attribs);
 
-		lang->setTrusted(attribs[ParsersAttributes::TRUSTED]==ParsersAttributes::_TRUE_);
+		//The functions are stored in the record by their signatures using the reference type as key
+		xmlparser.savePosition();
 
 		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
+			attribs_map func_attribs;
+
 			do
 			{
 				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
@@ -3537,51 +3731,68 @@ Language *DatabaseModel::createLanguage(void)
 
 					if(obj_type==OBJ_FUNCTION)
 					{
-						xmlparser.getElementAttributes(attribs);
+						xmlparser.getElementAttributes(func_attribs);
 
 						//Gets the function reference type
-						ref_type=attribs[ParsersAttributes::REF_TYPE];
+						ref_type=func_attribs[ParsersAttributes::REF_TYPE];
 
 						//Only VALIDATOR, HANDLER and INLINE functions are accepted for the language
-						if(ref_type==ParsersAttributes::VALIDATOR_FUNC ||
-								ref_type==ParsersAttributes::HANDLER_FUNC ||
-								ref_type==ParsersAttributes::INLINE_FUNC)
-						{
-							//Gets the function signature and tries to retrieve it from the model
-							signature=attribs[ParsersAttributes::SIGNATURE];
-							func=getObject(signature, OBJ_FUNCTION);
-
-							//Raises an error if the function doesn't exists
-							if(!func)
-								throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-												.arg(lang->getName())
-												.arg(lang->getTypeName())
-												.arg(signature)
-												.arg(BaseObject::getTypeName(OBJ_FUNCTION)),
-												ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
-							if(ref_type==ParsersAttributes::VALIDATOR_FUNC)
-								lang->setFunction(dynamic_cast<Function *>(func), Language::VALIDATOR_FUNC);
-							else if(ref_type==ParsersAttributes::HANDLER_FUNC)
-								lang->setFunction(dynamic_cast<Function *>(func), Language::HANDLER_FUNC);
-							else
-								lang->setFunction(dynamic_cast<Function *>(func), Language::INLINE_FUNC);
-
-						}
-						else
+						if(ref_type!=ParsersAttributes::VALIDATOR_FUNC &&
+							 ref_type!=ParsersAttributes::HANDLER_FUNC &&
+							 ref_type!=ParsersAttributes::INLINE_FUNC)
 							//Raises an error if the function type is invalid
 							throw Exception(ERR_REF_FUNCTION_INV_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+						attribs[ref_type]=func_attribs[ParsersAttributes::SIGNATURE];
 					}
 				}
 			}
 			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 
+		xmlparser.restorePosition();
+		lang=createLanguage(attribs);
+	}
+	catch(Exception &e)
+	{
+		if(lang) delete(lang);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+
+	return(lang);
+}
+
+Language *DatabaseModel::createLanguage(attribs_map &attribs)
+{
+	Language *lang=nullptr;
+	BaseObject *func=nullptr;
+	QString func_attribs[]={ ParsersAttributes::VALIDATOR_FUNC, ParsersAttributes::HANDLER_FUNC, ParsersAttributes::INLINE_FUNC };
+	unsigned func_types[]={ Language::VALIDATOR_FUNC, Language::HANDLER_FUNC, Language::INLINE_FUNC };
+
+	try
+	{
+		lang=new Language;
+		setBasicAttributes(lang, attribs);
+		lang->setTrusted(attribs[ParsersAttributes::TRUSTED]==ParsersAttributes::_TRUE_);
+
+		for(unsigned i=0; i < 3; i++)
+		{
+			if(attribs[func_attribs[i]].isEmpty())
+				continue;
+
+			func=getObject(attribs[func_attribs[i]], OBJ_FUNCTION);
+
+			//Raises an error if the function doesn't exists
+			if(!func)
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { lang->getName(), lang->getTypeName(), attribs[func_attribs[i]], BaseObject::getTypeName(OBJ_FUNCTION) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			lang->setFunction(dynamic_cast<Function *>(func), func_types[i]);
+		}
 	}
 	catch(Exception &e)
 	{
 		if(lang) delete(lang);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(lang);
@@ -3599,36 +3810,8 @@ Function *DatabaseModel::createFunction(void)
 
 	try
 	{
-		func=new Function;
-		setBasicAttributes(func);
-		xmlparser.getElementAttributes(attribs);
-
-		if(!attribs[ParsersAttributes::RETURNS_SETOF].isEmpty())
-			func->setReturnSetOf(attribs[ParsersAttributes::RETURNS_SETOF]==
-					ParsersAttributes::_TRUE_);
-
-		if(!attribs[ParsersAttributes::WINDOW_FUNC].isEmpty())
-			func->setWindowFunction(attribs[ParsersAttributes::WINDOW_FUNC]==
-					ParsersAttributes::_TRUE_);
-
-		if(!attribs[ParsersAttributes::LEAKPROOF].isEmpty())
-			func->setLeakProof(attribs[ParsersAttributes::LEAKPROOF]==
-					ParsersAttributes::_TRUE_);
-
-		if(!attribs[ParsersAttributes::BEHAVIOR_TYPE].isEmpty())
-			func->setBehaviorType(BehaviorType(attribs[ParsersAttributes::BEHAVIOR_TYPE]));
-
-		if(!attribs[ParsersAttributes::FUNCTION_TYPE].isEmpty())
-			func->setFunctionType(FunctionType(attribs[ParsersAttributes::FUNCTION_TYPE]));
-
-		if(!attribs[ParsersAttributes::SECURITY_TYPE].isEmpty())
-			func->setSecurityType(SecurityType(attribs[ParsersAttributes::SECURITY_TYPE]));
-
-		if(!attribs[ParsersAttributes::EXECUTION_COST].isEmpty())
-			func->setExecutionCost(attribs[ParsersAttributes::EXECUTION_COST].toInt());
-
-		if(!attribs[ParsersAttributes::ROW_AMOUNT].isEmpty())
-			func->setRowAmount(attribs[ParsersAttributes::ROW_AMOUNT].toInt());
+		getObjectRecord(attribs);
+		func=createFunction(attribs);
 
 		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
@@ -3673,7 +3856,7 @@ Function *DatabaseModel::createFunction(void)
 						catch(Exception &e)
 						{
 							xmlparser.restorePosition();
-							throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+							throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 						}
 					}
 					//Gets the function language
@@ -3684,12 +3867,7 @@ Function *DatabaseModel::createFunction(void)
 
 						//Raises an error if the function doesn't exisits
 						if(!object)
-							throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-											.arg(func->getName())
-											.arg(func->getTypeName())
-											.arg(attribs[ParsersAttributes::NAME])
-								.arg(BaseObject::getTypeName(OBJ_LANGUAGE)),
-								ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { func->getName(), func->getTypeName(), attribs[ParsersAttributes::NAME], BaseObject::getTypeName(OBJ_LANGUAGE) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 						func->setLanguage(dynamic_cast<Language *>(object));
 					}
@@ -3729,12 +3907,87 @@ Function *DatabaseModel::createFunction(void)
 		}
 
 		if(e.getErrorType()==ERR_REF_INEXIST_USER_TYPE)
-			throw Exception(Exception::getErrorMessage(ERR_ASG_OBJ_INV_DEFINITION)
-							.arg(str_aux)
-							.arg(BaseObject::getTypeName(OBJ_FUNCTION)),
-							ERR_ASG_OBJ_INV_DEFINITION,__PRETTY_FUNCTION__,__FILE__,__LINE__,&e, getErrorExtraInfo());
+			throw Exception(ERR_ASG_OBJ_INV_DEFINITION, { str_aux, BaseObject::getTypeName(OBJ_FUNCTION) },__PRETTY_FUNCTION__,__FILE__,__LINE__,&e, getErrorExtraInfo());
+		else
+			throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+
+	return(func);
+}
+
+Function *DatabaseModel::createFunction(attribs_map &attribs)
+{
+	Function *func=nullptr;
+	BaseObject *lang=nullptr;
+	QString str_aux;
+
+	try
+	{
+		func=new Function;
+		setBasicAttributes(func, attribs);
+
+		if(!attribs[ParsersAttributes::RETURNS_SETOF].isEmpty())
+			func->setReturnSetOf(attribs[ParsersAttributes::RETURNS_SETOF]==
+					ParsersAttributes::_TRUE_);
+
+		if(!attribs[ParsersAttributes::WINDOW_FUNC].isEmpty())
+			func->setWindowFunction(attribs[ParsersAttributes::WINDOW_FUNC]==
+					ParsersAttributes::_TRUE_);
+
+		if(!attribs[ParsersAttributes::LEAKPROOF].isEmpty())
+			func->setLeakProof(attribs[ParsersAttributes::LEAKPROOF]==
+					ParsersAttributes::_TRUE_);
+
+		if(!attribs[ParsersAttributes::BEHAVIOR_TYPE].isEmpty())
+			func->setBehaviorType(BehaviorType(attribs[ParsersAttributes::BEHAVIOR_TYPE]));
+
+		if(!attribs[ParsersAttributes::FUNCTION_TYPE].isEmpty())
+			func->setFunctionType(FunctionType(attribs[ParsersAttributes::FUNCTION_TYPE]));
+
+		if(!attribs[ParsersAttributes::SECURITY_TYPE].isEmpty())
+			func->setSecurityType(SecurityType(attribs[ParsersAttributes::SECURITY_TYPE]));
+
+		if(!attribs[ParsersAttributes::EXECUTION_COST].isEmpty())
+			func->setExecutionCost(attribs[ParsersAttributes::EXECUTION_COST].toInt());
+
+		if(!attribs[ParsersAttributes::ROW_AMOUNT].isEmpty())
+			func->setRowAmount(attribs[ParsersAttributes::ROW_AMOUNT].toInt());
+
+		if(!attribs[ParsersAttributes::LANGUAGE].isEmpty())
+		{
+			lang=getObject(attribs[ParsersAttributes::LANGUAGE], OBJ_LANGUAGE);
+
+			//Raises an error if the language doesn't exisits
+			if(!lang)
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { func->getName(), func->getTypeName(), attribs[ParsersAttributes::LANGUAGE], BaseObject::getTypeName(OBJ_LANGUAGE) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			func->setLanguage(dynamic_cast<Language *>(lang));
+		}
+
+		//In the record the return type is stored in its textual form
+		if(!attribs[ParsersAttributes::RETURN_TYPE].isEmpty())
+			func->setReturnType(PgSQLType::parseString(attribs[ParsersAttributes::RETURN_TYPE]));
+
+		if(!attribs[ParsersAttributes::LIBRARY].isEmpty())
+		{
+			func->setLibrary(attribs[ParsersAttributes::LIBRARY]);
+			func->setSymbol(attribs[ParsersAttributes::SYMBOL]);
+		}
+		else if(!attribs[ParsersAttributes::DEFINITION].isEmpty())
+			func->setSourceCode(attribs[ParsersAttributes::DEFINITION]);
+	}
+	catch(Exception &e)
+	{
+		if(func)
+		{
+			str_aux=func->getName(true);
+			delete(func);
+		}
+
+		if(e.getErrorType()==ERR_REF_INEXIST_USER_TYPE)
+			throw Exception(ERR_ASG_OBJ_INV_DEFINITION, { str_aux, BaseObject::getTypeName(OBJ_FUNCTION) },__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
 		else
-			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+			throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(func);
@@ -3781,7 +4034,7 @@ Parameter DatabaseModel::createParameter(void)
 	{
 		QString extra_info=getErrorExtraInfo();
 		xmlparser.restorePosition();
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, extra_info);
 	}
 
 	return(param);
@@ -3822,12 +4075,7 @@ TypeAttribute DatabaseModel::createTypeAttribute(void)
 						//Raises an error if the operator class doesn't exists
 						if(!collation)
 						{
-							throw Exception(QString(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL))
-											.arg(tpattrib.getName())
-											.arg(tpattrib.getTypeName())
-											.arg(attribs[ParsersAttributes::NAME])
-									.arg(BaseObject::getTypeName(OBJ_COLLATION)),
-									ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { tpattrib.getName(), tpattrib.getTypeName(), attribs[ParsersAttributes::NAME], BaseObject::getTypeName(OBJ_COLLATION) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 						}
 
 						tpattrib.setCollation(collation);
@@ -3843,7 +4091,7 @@ TypeAttribute DatabaseModel::createTypeAttribute(void)
 	{
 		QString extra_info=getErrorExtraInfo();
 		xmlparser.restorePosition();
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, extra_info);
 	}
 
 	return(tpattrib);
@@ -3909,69 +4157,27 @@ PgSQLType DatabaseModel::createPgSQLType(void)
 Type *DatabaseModel::createType(void)
 {
 	attribs_map attribs;
-	map<QString, unsigned> func_types;
+	map<QString, unsigned> func_types={{ ParsersAttributes::INPUT_FUNC, Type::INPUT_FUNC },
+																		 { ParsersAttributes::OUTPUT_FUNC, Type::OUTPUT_FUNC },
+																		 { ParsersAttributes::SEND_FUNC, Type::SEND_FUNC },
+																		 { ParsersAttributes::RECV_FUNC, Type::RECV_FUNC },
+																		 { ParsersAttributes::TPMOD_IN_FUNC, Type::TPMOD_IN_FUNC },
+																		 { ParsersAttributes::TPMOD_OUT_FUNC, Type::TPMOD_OUT_FUNC },
+																		 { ParsersAttributes::ANALYZE_FUNC, Type::ANALYZE_FUNC },
+																		 { ParsersAttributes::CANONICAL_FUNC, Type::CANONICAL_FUNC },
+																		 { ParsersAttributes::SUBTYPE_DIFF_FUNC, Type::SUBTYPE_DIFF_FUNC }};
 	Type *type=nullptr;
 	int count, i;
 	QStringList enums;
 	QString elem, str_aux;
-	BaseObject *func=nullptr, *collation=nullptr;
+	BaseObject *func=nullptr;
 	OperatorClass *op_class=nullptr;
 	PgSQLType aux_type;
 
 	try
 	{
-		type=new Type;
-		setBasicAttributes(type);
-		xmlparser.getElementAttributes(attribs);
-
-		if(attribs[ParsersAttributes::CONFIGURATION]==ParsersAttributes::BASE_TYPE)
-		{
-			type->setConfiguration(Type::BASE_TYPE);
-			type->setByValue(attribs[ParsersAttributes::BY_VALUE]==ParsersAttributes::_TRUE_);
-
-			if(!attribs[ParsersAttributes::INTERNAL_LENGTH].isEmpty())
-				type->setInternalLength(attribs[ParsersAttributes::INTERNAL_LENGTH].toUInt());
-
-			if(!attribs[ParsersAttributes::ALIGNMENT].isEmpty())
-				type->setAlignment(attribs[ParsersAttributes::ALIGNMENT]);
-
-			if(!attribs[ParsersAttributes::STORAGE].isEmpty())
-				type->setStorage(attribs[ParsersAttributes::STORAGE]);
-
-			if(!attribs[ParsersAttributes::ELEMENT].isEmpty())
-				type->setElement(attribs[ParsersAttributes::ELEMENT]);
-
-			if(!attribs[ParsersAttributes::DELIMITER].isEmpty())
-				type->setDelimiter(attribs[ParsersAttributes::DELIMITER][0].toLatin1());
-
-			if(!attribs[ParsersAttributes::DEFAULT_VALUE].isEmpty())
-				type->setDefaultValue(attribs[ParsersAttributes::DEFAULT_VALUE]);
-
-			if(!attribs[ParsersAttributes::CATEGORY].isEmpty())
-				type->setCategory(attribs[ParsersAttributes::CATEGORY]);
-
-			if(!attribs[ParsersAttributes::PREFERRED].isEmpty())
-				type->setPreferred(attribs[ParsersAttributes::PREFERRED]==ParsersAttributes::_TRUE_);
-
-			//Configuring an auxiliary map used to reference the functions used by base type
-			func_types[ParsersAttributes::INPUT_FUNC]=Type::INPUT_FUNC;
-			func_types[ParsersAttributes::OUTPUT_FUNC]=Type::OUTPUT_FUNC;
-			func_types[ParsersAttributes::SEND_FUNC]=Type::SEND_FUNC;
-			func_types[ParsersAttributes::RECV_FUNC]=Type::RECV_FUNC;
-			func_types[ParsersAttributes::TPMOD_IN_FUNC]=Type::TPMOD_IN_FUNC;
-			func_types[ParsersAttributes::TPMOD_OUT_FUNC]=Type::TPMOD_OUT_FUNC;
-			func_types[ParsersAttributes::ANALYZE_FUNC]=Type::ANALYZE_FUNC;
-		}
-		else if(attribs[ParsersAttributes::CONFIGURATION]==ParsersAttributes::COMPOSITE_TYPE)
-			type->setConfiguration(Type::COMPOSITE_TYPE);
-		else if(attribs[ParsersAttributes::CONFIGURATION]==ParsersAttributes::ENUM_TYPE)
-			type->setConfiguration(Type::ENUMERATION_TYPE);
-		else
-		{
-			type->setConfiguration(Type::RANGE_TYPE);
-			func_types[ParsersAttributes::CANONICAL_FUNC]=Type::CANONICAL_FUNC;
-			func_types[ParsersAttributes::SUBTYPE_DIFF_FUNC]=Type::SUBTYPE_DIFF_FUNC;
-		}
+		getObjectRecord(attribs);
+		type=createType(attribs);
 
 		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
@@ -4006,25 +4212,7 @@ Type *DatabaseModel::createType(void)
 						else
 							type->setLikeType(aux_type);
 					}
-					else if(elem==ParsersAttributes::COLLATION)
-					{
-						xmlparser.getElementAttributes(attribs);
-						collation=getObject(attribs[ParsersAttributes::NAME], OBJ_COLLATION);
-
-						//Raises an error if the operator class doesn't exists
-						if(!collation)
-						{
-							throw Exception(QString(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL))
-											.arg(type->getName())
-											.arg(type->getTypeName())
-											.arg(attribs[ParsersAttributes::NAME])
-									.arg(BaseObject::getTypeName(OBJ_COLLATION)),
-									ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-						}
-
-						type->setCollation(collation);
-					}
-					if(elem==ParsersAttributes::OP_CLASS)
+					else if(elem==ParsersAttributes::OP_CLASS)
 					{
 						xmlparser.getElementAttributes(attribs);
 						op_class=dynamic_cast<OperatorClass *>(getObject(attribs[ParsersAttributes::NAME], OBJ_OPCLASS));
@@ -4032,17 +4220,12 @@ Type *DatabaseModel::createType(void)
 						//Raises an error if the operator class doesn't exists
 						if(!op_class)
 						{
-							throw Exception(QString(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL))
-											.arg(type->getName())
-											.arg(type->getTypeName())
-											.arg(attribs[ParsersAttributes::NAME])
-									.arg(BaseObject::getTypeName(OBJ_OPCLASS)),
-									ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { type->getName(), type->getTypeName(), attribs[ParsersAttributes::NAME], BaseObject::getTypeName(OBJ_OPCLASS) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 						}
 
 						type->setSubtypeOpClass(op_class);
 					}
-					//Configuring the functions used by the type (only for BASE type)
+					//Configuring the functions used by the type (only for BASE / RANGE type)
 					else if(elem==ParsersAttributes::FUNCTION)
 					{
 						xmlparser.getElementAttributes(attribs);
@@ -4052,12 +4235,7 @@ Type *DatabaseModel::createType(void)
 
 						//Raises an error if the function doesn't exists
 						if(!func && !attribs[ParsersAttributes::SIGNATURE].isEmpty())
-							throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-											.arg(type->getName())
-											.arg(type->getTypeName())
-											.arg(attribs[ParsersAttributes::SIGNATURE])
-								.arg(BaseObject::getTypeName(OBJ_FUNCTION)),
-								ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { type->getName(), type->getTypeName(), attribs[ParsersAttributes::SIGNATURE], BaseObject::getTypeName(OBJ_FUNCTION) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 						//Raises an error if the function type is invalid
 						else if(func_types.count(attribs[ParsersAttributes::REF_TYPE])==0)
 							throw Exception(ERR_REF_FUNCTION_INV_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
@@ -4078,68 +4256,200 @@ Type *DatabaseModel::createType(void)
 		}
 
 		if(e.getErrorType()==ERR_REF_INEXIST_USER_TYPE)
-			throw Exception(Exception::getErrorMessage(ERR_ASG_OBJ_INV_DEFINITION)
-							.arg(str_aux)
-							.arg(type->getTypeName()),
-							ERR_ASG_OBJ_INV_DEFINITION,__PRETTY_FUNCTION__,__FILE__,__LINE__,&e, getErrorExtraInfo());
+			throw Exception(ERR_ASG_OBJ_INV_DEFINITION, { str_aux, BaseObject::getTypeName(OBJ_TYPE) },__PRETTY_FUNCTION__,__FILE__,__LINE__,&e, getErrorExtraInfo());
 		else
-			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+			throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
 	}
 
 	return(type);
 }
 
-Domain *DatabaseModel::createDomain(void)
+Type *DatabaseModel::createType(attribs_map &attribs)
 {
-	attribs_map attribs;
-	Domain *domain=nullptr;
-	QString elem;
+	map<QString, unsigned> func_types={{ ParsersAttributes::INPUT_FUNC, Type::INPUT_FUNC },
+																		 { ParsersAttributes::OUTPUT_FUNC, Type::OUTPUT_FUNC },
+																		 { ParsersAttributes::SEND_FUNC, Type::SEND_FUNC },
+																		 { ParsersAttributes::RECV_FUNC, Type::RECV_FUNC },
+																		 { ParsersAttributes::TPMOD_IN_FUNC, Type::TPMOD_IN_FUNC },
+																		 { ParsersAttributes::TPMOD_OUT_FUNC, Type::TPMOD_OUT_FUNC },
+																		 { ParsersAttributes::ANALYZE_FUNC, Type::ANALYZE_FUNC },
+																		 { ParsersAttributes::CANONICAL_FUNC, Type::CANONICAL_FUNC },
+																		 { ParsersAttributes::SUBTYPE_DIFF_FUNC, Type::SUBTYPE_DIFF_FUNC }};
+	Type *type=nullptr;
+	BaseObject *func=nullptr;
+	OperatorClass *op_class=nullptr;
+	QString str_aux;
 
 	try
 	{
-		domain=new Domain;
-		setBasicAttributes(domain);
-		xmlparser.getElementAttributes(attribs);
+		type=new Type;
 
-		if(!attribs[ParsersAttributes::DEFAULT_VALUE].isEmpty())
-			domain->setDefaultValue(attribs[ParsersAttributes::DEFAULT_VALUE]);
+		if(attribs[ParsersAttributes::CONFIGURATION]==ParsersAttributes::BASE_TYPE)
+			type->setConfiguration(Type::BASE_TYPE);
+		else if(attribs[ParsersAttributes::CONFIGURATION]==ParsersAttributes::COMPOSITE_TYPE)
+			type->setConfiguration(Type::COMPOSITE_TYPE);
+		else if(attribs[ParsersAttributes::CONFIGURATION]==ParsersAttributes::ENUM_TYPE)
+			type->setConfiguration(Type::ENUMERATION_TYPE);
+		else
+			type->setConfiguration(Type::RANGE_TYPE);
 
-		domain->setNotNull(attribs[ParsersAttributes::NOT_NULL]==ParsersAttributes::_TRUE_);
+		//The basic attributes are assigned only after the configuration since changing it resets the type's collation
+		setBasicAttributes(type, attribs);
 
-		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
+		if(type->getConfiguration()==Type::BASE_TYPE)
 		{
-			do
+			type->setByValue(attribs[ParsersAttributes::BY_VALUE]==ParsersAttributes::_TRUE_);
+
+			if(!attribs[ParsersAttributes::INTERNAL_LENGTH].isEmpty())
+				type->setInternalLength(attribs[ParsersAttributes::INTERNAL_LENGTH].toUInt());
+
+			if(!attribs[ParsersAttributes::ALIGNMENT].isEmpty())
+				type->setAlignment(attribs[ParsersAttributes::ALIGNMENT]);
+
+			if(!attribs[ParsersAttributes::STORAGE].isEmpty())
+				type->setStorage(attribs[ParsersAttributes::STORAGE]);
+
+			if(!attribs[ParsersAttributes::ELEMENT].isEmpty())
+				type->setElement(attribs[ParsersAttributes::ELEMENT]);
+
+			if(!attribs[ParsersAttributes::DELIMITER].isEmpty())
+				type->setDelimiter(attribs[ParsersAttributes::DELIMITER][0].toLatin1());
+
+			if(!attribs[ParsersAttributes::DEFAULT_VALUE].isEmpty())
+				type->setDefaultValue(attribs[ParsersAttributes::DEFAULT_VALUE]);
+
+			if(!attribs[ParsersAttributes::CATEGORY].isEmpty())
+				type->setCategory(attribs[ParsersAttributes::CATEGORY]);
+
+			if(!attribs[ParsersAttributes::PREFERRED].isEmpty())
+				type->setPreferred(attribs[ParsersAttributes::PREFERRED]==ParsersAttributes::_TRUE_);
+		}
+		//In the record the enumerations are stored as a comma separated list
+		else if(type->getConfiguration()==Type::ENUMERATION_TYPE &&
+						!attribs[ParsersAttributes::ENUMERATIONS].isEmpty())
+		{
+			for(auto &enum_val : attribs[ParsersAttributes::ENUMERATIONS].split(','))
+				type->addEnumeration(enum_val);
+		}
+		else if(type->getConfiguration()==Type::RANGE_TYPE)
+		{
+			if(!attribs[ParsersAttributes::SUBTYPE].isEmpty())
+				type->setSubtype(PgSQLType::parseString(attribs[ParsersAttributes::SUBTYPE]));
+
+			if(!attribs[ParsersAttributes::OP_CLASS].isEmpty())
 			{
-				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
-				{
-					elem=xmlparser.getElementName();
+				op_class=dynamic_cast<OperatorClass *>(getObject(attribs[ParsersAttributes::OP_CLASS], OBJ_OPCLASS));
 
-					//If a type element is found it'll be extracted an type which the domain is applied
-					if(elem==ParsersAttributes::TYPE)
-					{
-						domain->setType(createPgSQLType());
-					}
-					else if(elem==ParsersAttributes::CONSTRAINT)
-					{
-						xmlparser.savePosition();
-						xmlparser.getElementAttributes(attribs);
-						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
-						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
-						domain->addCheckConstraint(attribs[ParsersAttributes::NAME], xmlparser.getElementContent());
-						xmlparser.restorePosition();
-					}
+				//Raises an error if the operator class doesn't exists
+				if(!op_class)
+				{
+					throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { type->getName(), type->getTypeName(), attribs[ParsersAttributes::OP_CLASS], BaseObject::getTypeName(OBJ_OPCLASS) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 				}
+
+				type->setSubtypeOpClass(op_class);
 			}
-			while(xmlparser.accessElement(xmlparser.NEXT_ELEMENT));
+		}
+
+		//The functions used by the type are referenced by their signatures
+		for(auto &func_type : func_types)
+		{
+			if(attribs[func_type.first].isEmpty())
+				continue;
+
+			func=getObject(attribs[func_type.first], OBJ_FUNCTION);
+
+			//Raises an error if the function doesn't exists
+			if(!func)
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { type->getName(), type->getTypeName(), attribs[func_type.first], BaseObject::getTypeName(OBJ_FUNCTION) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			type->setFunction(func_type.second, dynamic_cast<Function *>(func));
 		}
 	}
 	catch(Exception &e)
 	{
-		if(domain) delete(domain);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
-	}
-
-	return(domain);
+		if(type)
+		{
+			str_aux=type->getName(true);
+			delete(type);
+		}
+
+		if(e.getErrorType()==ERR_REF_INEXIST_USER_TYPE)
+			throw Exception(ERR_ASG_OBJ_INV_DEFINITION, { str_aux, BaseObject::getTypeName(OBJ_TYPE) },__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		else
+			throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	return(type);
+}
+
+Domain *DatabaseModel::createDomain(void)
+{
+	attribs_map attribs;
+	Domain *domain=nullptr;
+	QString elem;
+
+	try
+	{
+		getObjectRecord(attribs);
+		domain=createDomain(attribs);
+
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
+		{
+			do
+			{
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
+				{
+					elem=xmlparser.getElementName();
+
+					//If a type element is found it'll be extracted an type which the domain is applied
+					if(elem==ParsersAttributes::TYPE)
+					{
+						domain->setType(createPgSQLType());
+					}
+					else if(elem==ParsersAttributes::CONSTRAINT)
+					{
+						xmlparser.savePosition();
+						xmlparser.getElementAttributes(attribs);
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+						domain->addCheckConstraint(attribs[ParsersAttributes::NAME], xmlparser.getElementContent());
+						xmlparser.restorePosition();
+					}
+				}
+			}
+			while(xmlparser.accessElement(xmlparser.NEXT_ELEMENT));
+		}
+	}
+	catch(Exception &e)
+	{
+		if(domain) delete(domain);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+
+	return(domain);
+}
+
+Domain *DatabaseModel::createDomain(attribs_map &attribs)
+{
+	Domain *domain=nullptr;
+
+	try
+	{
+		domain=new Domain;
+		setBasicAttributes(domain, attribs);
+
+		if(!attribs[ParsersAttributes::DEFAULT_VALUE].isEmpty())
+			domain->setDefaultValue(attribs[ParsersAttributes::DEFAULT_VALUE]);
+
+		domain->setNotNull(attribs[ParsersAttributes::NOT_NULL]==ParsersAttributes::_TRUE_);
+	}
+	catch(Exception &e)
+	{
+		if(domain) delete(domain);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	return(domain);
 }
 
 Cast *DatabaseModel::createCast(void)
@@ -4153,18 +4463,8 @@ Cast *DatabaseModel::createCast(void)
 
 	try
 	{
-		cast=new Cast;
-		setBasicAttributes(cast);
-		xmlparser.getElementAttributes(attribs);
-
-		if(attribs[ParsersAttributes::CAST_TYPE]==ParsersAttributes::IMPLICIT)
-			cast->setCastType(Cast::IMPLICIT);
-		else if(attribs[ParsersAttributes::CAST_TYPE]==ParsersAttributes::ASSIGNMENT)
-			cast->setCastType(Cast::ASSIGNMENT);
-		else
-			cast->setCastType(Cast::EXPLICIT);
-
-		cast->setInOut(attribs[ParsersAttributes::IO_CAST]==ParsersAttributes::_TRUE_);
+		getObjectRecord(attribs);
+		cast=createCast(attribs);
 
 		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
@@ -4192,12 +4492,7 @@ Cast *DatabaseModel::createCast(void)
 
 						//Raises an error if the function doesn't exists
 						if(!func && !attribs[ParsersAttributes::SIGNATURE].isEmpty())
-							throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-											.arg(cast->getName())
-											.arg(cast->getTypeName())
-											.arg(attribs[ParsersAttributes::SIGNATURE])
-								.arg(BaseObject::getTypeName(OBJ_FUNCTION)),
-								ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { cast->getName(), cast->getTypeName(), attribs[ParsersAttributes::SIGNATURE], BaseObject::getTypeName(OBJ_FUNCTION) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 						cast->setCastFunction(dynamic_cast<Function *>(func));
 					}
@@ -4209,7 +4504,53 @@ Cast *DatabaseModel::createCast(void)
 	catch(Exception &e)
 	{
 		if(cast) delete(cast);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+
+	return(cast);
+}
+
+Cast *DatabaseModel::createCast(attribs_map &attribs)
+{
+	Cast *cast=nullptr;
+	BaseObject *func=nullptr;
+
+	try
+	{
+		cast=new Cast;
+		setBasicAttributes(cast, attribs);
+
+		if(attribs[ParsersAttributes::CAST_TYPE]==ParsersAttributes::IMPLICIT)
+			cast->setCastType(Cast::IMPLICIT);
+		else if(attribs[ParsersAttributes::CAST_TYPE]==ParsersAttributes::ASSIGNMENT)
+			cast->setCastType(Cast::ASSIGNMENT);
+		else
+			cast->setCastType(Cast::EXPLICIT);
+
+		cast->setInOut(attribs[ParsersAttributes::IO_CAST]==ParsersAttributes::_TRUE_);
+
+		//The types must be assigned before the function since this one is validated against them
+		if(!attribs[ParsersAttributes::SOURCE_TYPE].isEmpty())
+			cast->setDataType(Cast::SRC_TYPE, PgSQLType::parseString(attribs[ParsersAttributes::SOURCE_TYPE]));
+
+		if(!attribs[ParsersAttributes::DEST_TYPE].isEmpty())
+			cast->setDataType(Cast::DST_TYPE, PgSQLType::parseString(attribs[ParsersAttributes::DEST_TYPE]));
+
+		if(!attribs[ParsersAttributes::FUNCTION].isEmpty())
+		{
+			func=getObject(attribs[ParsersAttributes::FUNCTION], OBJ_FUNCTION);
+
+			//Raises an error if the function doesn't exists
+			if(!func)
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { cast->getName(), cast->getTypeName(), attribs[ParsersAttributes::FUNCTION], BaseObject::getTypeName(OBJ_FUNCTION) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			cast->setCastFunction(dynamic_cast<Function *>(func));
+		}
+	}
+	catch(Exception &e)
+	{
+		if(cast) delete(cast);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(cast);
@@ -4224,17 +4565,8 @@ Conversion *DatabaseModel::createConversion(void)
 
 	try
 	{
-		conv=new Conversion;
-		setBasicAttributes(conv);
-		xmlparser.getElementAttributes(attribs);
-
-		conv->setEncoding(Conversion::SRC_ENCODING,
-						  EncodingType(attribs[ParsersAttributes::SRC_ENCODING]));
-
-		conv->setEncoding(Conversion::DST_ENCODING,
-						  EncodingType(attribs[ParsersAttributes::DST_ENCODING]));
-
-		conv->setDefault(attribs[ParsersAttributes::DEFAULT]==ParsersAttributes::_TRUE_);
+		getObjectRecord(attribs);
+		conv=createConversion(attribs);
 
 		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
@@ -4251,12 +4583,7 @@ Conversion *DatabaseModel::createConversion(void)
 
 						//Raises an error if the function doesn't exists
 						if(!func && !attribs[ParsersAttributes::SIGNATURE].isEmpty())
-							throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-											.arg(conv->getName())
-											.arg(conv->getTypeName())
-											.arg(attribs[ParsersAttributes::SIGNATURE])
-								.arg(BaseObject::getTypeName(OBJ_FUNCTION)),
-								ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { conv->getName(), conv->getTypeName(), attribs[ParsersAttributes::SIGNATURE], BaseObject::getTypeName(OBJ_FUNCTION) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 						conv->setConversionFunction(dynamic_cast<Function *>(func));
 					}
@@ -4268,7 +4595,45 @@ Conversion *DatabaseModel::createConversion(void)
 	catch(Exception &e)
 	{
 		if(conv) delete(conv);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+
+	return(conv);
+}
+
+Conversion *DatabaseModel::createConversion(attribs_map &attribs)
+{
+	Conversion *conv=nullptr;
+	BaseObject *func=nullptr;
+
+	try
+	{
+		conv=new Conversion;
+		setBasicAttributes(conv, attribs);
+
+		conv->setEncoding(Conversion::SRC_ENCODING,
+						  EncodingType(attribs[ParsersAttributes::SRC_ENCODING]));
+
+		conv->setEncoding(Conversion::DST_ENCODING,
+						  EncodingType(attribs[ParsersAttributes::DST_ENCODING]));
+
+		conv->setDefault(attribs[ParsersAttributes::DEFAULT]==ParsersAttributes::_TRUE_);
+
+		if(!attribs[ParsersAttributes::FUNCTION].isEmpty())
+		{
+			func=getObject(attribs[ParsersAttributes::FUNCTION], OBJ_FUNCTION);
+
+			//Raises an error if the function doesn't exists
+			if(!func)
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { conv->getName(), conv->getTypeName(), attribs[ParsersAttributes::FUNCTION], BaseObject::getTypeName(OBJ_FUNCTION) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			conv->setConversionFunction(dynamic_cast<Function *>(func));
+		}
+	}
+	catch(Exception &e)
+	{
+		if(conv) delete(conv);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(conv);
@@ -4287,12 +4652,8 @@ Operator *DatabaseModel::createOperator(void)
 
 	try
 	{
-		oper=new Operator;
-		setBasicAttributes(oper);
-		xmlparser.getElementAttributes(attribs);
-
-		oper->setMerges(attribs[ParsersAttributes::MERGES]==ParsersAttributes::_TRUE_);
-		oper->setHashes(attribs[ParsersAttributes::HASHES]==ParsersAttributes::_TRUE_);
+		getObjectRecord(attribs);
+		oper=createOperator(attribs);
 
 		func_types[ParsersAttributes::OPERATOR_FUNC]=Operator::FUNC_OPERATOR;
 		func_types[ParsersAttributes::JOIN_FUNC]=Operator::FUNC_JOIN;
@@ -4316,12 +4677,7 @@ Operator *DatabaseModel::createOperator(void)
 
 						//Raises an error if the auxiliary operator doesn't exists
 						if(!oper_aux && !attribs[ParsersAttributes::SIGNATURE].isEmpty())
-							throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-											.arg(oper->getSignature(true))
-											.arg(oper->getTypeName())
-											.arg(attribs[ParsersAttributes::SIGNATURE])
-								.arg(BaseObject::getTypeName(OBJ_OPERATOR)),
-								ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { oper->getSignature(true), oper->getTypeName(), attribs[ParsersAttributes::SIGNATURE], BaseObject::getTypeName(OBJ_OPERATOR) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 						oper->setOperator(dynamic_cast<Operator *>(oper_aux),
 										  oper_types[attribs[ParsersAttributes::REF_TYPE]]);
@@ -4345,12 +4701,7 @@ Operator *DatabaseModel::createOperator(void)
 
 						//Raises an error if the function doesn't exists on the model
 						if(!func && !attribs[ParsersAttributes::SIGNATURE].isEmpty())
-							throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-											.arg(oper->getName())
-											.arg(oper->getTypeName())
-											.arg(attribs[ParsersAttributes::SIGNATURE])
-								.arg(BaseObject::getTypeName(OBJ_FUNCTION)),
-								ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { oper->getName(), oper->getTypeName(), attribs[ParsersAttributes::SIGNATURE], BaseObject::getTypeName(OBJ_FUNCTION) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 						oper->setFunction(dynamic_cast<Function *>(func),
 										  func_types[attribs[ParsersAttributes::REF_TYPE]]);
@@ -4363,7 +4714,70 @@ Operator *DatabaseModel::createOperator(void)
 	catch(Exception &e)
 	{
 		if(oper) delete(oper);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+
+	return(oper);
+}
+
+Operator *DatabaseModel::createOperator(attribs_map &attribs)
+{
+	Operator *oper=nullptr;
+	BaseObject *func=nullptr, *oper_aux=nullptr;
+	QString arg_attribs[]={ ParsersAttributes::LEFT_TYPE, ParsersAttributes::RIGHT_TYPE },
+			func_attribs[]={ ParsersAttributes::OPERATOR_FUNC, ParsersAttributes::JOIN_FUNC, ParsersAttributes::RESTRICTION_FUNC },
+			oper_attribs[]={ ParsersAttributes::COMMUTATOR_OP, ParsersAttributes::NEGATOR_OP };
+	unsigned arg_types[]={ Operator::LEFT_ARG, Operator::RIGHT_ARG },
+			func_types[]={ Operator::FUNC_OPERATOR, Operator::FUNC_JOIN, Operator::FUNC_RESTRICT },
+			oper_types[]={ Operator::OPER_COMMUTATOR, Operator::OPER_NEGATOR };
+
+	try
+	{
+		oper=new Operator;
+		setBasicAttributes(oper, attribs);
+
+		oper->setMerges(attribs[ParsersAttributes::MERGES]==ParsersAttributes::_TRUE_);
+		oper->setHashes(attribs[ParsersAttributes::HASHES]==ParsersAttributes::_TRUE_);
+
+		//The argument types are assigned first since the functions and operators are validated against them
+		for(unsigned i=0; i < 2; i++)
+		{
+			if(!attribs[arg_attribs[i]].isEmpty())
+				oper->setArgumentType(PgSQLType::parseString(attribs[arg_attribs[i]]), arg_types[i]);
+		}
+
+		for(unsigned i=0; i < 3; i++)
+		{
+			if(attribs[func_attribs[i]].isEmpty())
+				continue;
+
+			func=getObject(attribs[func_attribs[i]], OBJ_FUNCTION);
+
+			//Raises an error if the function doesn't exists on the model
+			if(!func)
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { oper->getName(), oper->getTypeName(), attribs[func_attribs[i]], BaseObject::getTypeName(OBJ_FUNCTION) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			oper->setFunction(dynamic_cast<Function *>(func), func_types[i]);
+		}
+
+		for(unsigned i=0; i < 2; i++)
+		{
+			if(attribs[oper_attribs[i]].isEmpty())
+				continue;
+
+			oper_aux=getObject(attribs[oper_attribs[i]], OBJ_OPERATOR);
+
+			//Raises an error if the auxiliary operator doesn't exists
+			if(!oper_aux)
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { oper->getSignature(true), oper->getTypeName(), attribs[oper_attribs[i]], BaseObject::getTypeName(OBJ_OPERATOR) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			oper->setOperator(dynamic_cast<Operator *>(oper_aux), oper_types[i]);
+		}
+	}
+	catch(Exception &e)
+	{
+		if(oper) delete(oper);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(oper);
@@ -4382,12 +4796,8 @@ OperatorClass *DatabaseModel::createOperatorClass(void)
 
 	try
 	{
-		op_class=new OperatorClass;
-		setBasicAttributes(op_class);
-		xmlparser.getElementAttributes(attribs);
-
-		op_class->setIndexingType(IndexingType(attribs[ParsersAttributes::INDEX_TYPE]));
-		op_class->setDefault(attribs[ParsersAttributes::DEFAULT]==ParsersAttributes::_TRUE_);
+		getObjectRecord(attribs);
+		op_class=createOperatorClass(attribs);
 
 		elem_types[ParsersAttributes::FUNCTION]=OperatorClassElement::FUNCTION_ELEM;
 		elem_types[ParsersAttributes::OPERATOR]=OperatorClassElement::OPERATOR_ELEM;
@@ -4408,12 +4818,7 @@ OperatorClass *DatabaseModel::createOperatorClass(void)
 
 						//Raises an error if the operator family doesn't exists
 						if(!object)
-							throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-											.arg(op_class->getName())
-											.arg(op_class->getTypeName())
-											.arg(attribs[ParsersAttributes::SIGNATURE])
-								.arg(BaseObject::getTypeName(OBJ_OPFAMILY)),
-								ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { op_class->getName(), op_class->getTypeName(), attribs[ParsersAttributes::SIGNATURE], BaseObject::getTypeName(OBJ_OPFAMILY) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 						op_class->setFamily(dynamic_cast<OperatorFamily *>(object));
 					}
@@ -4458,12 +4863,7 @@ OperatorClass *DatabaseModel::createOperatorClass(void)
 								object=getObject(attribs_aux[ParsersAttributes::SIGNATURE],OBJ_OPFAMILY);
 
 								if(!object && !attribs_aux[ParsersAttributes::SIGNATURE].isEmpty())
-									throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-													.arg(op_class->getName())
-													.arg(op_class->getTypeName())
-													.arg(attribs_aux[ParsersAttributes::SIGNATURE])
-										.arg(BaseObject::getTypeName(OBJ_OPFAMILY)),
-										ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+									throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { op_class->getName(), op_class->getTypeName(), attribs_aux[ParsersAttributes::SIGNATURE], BaseObject::getTypeName(OBJ_OPFAMILY) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 								class_elem.setOperatorFamily(dynamic_cast<OperatorFamily *>(object));
 								xmlparser.restorePosition();
@@ -4481,7 +4881,43 @@ OperatorClass *DatabaseModel::createOperatorClass(void)
 	catch(Exception &e)
 	{
 		if(op_class) delete(op_class);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+
+	return(op_class);
+}
+
+OperatorClass *DatabaseModel::createOperatorClass(attribs_map &attribs)
+{
+	OperatorClass *op_class=nullptr;
+	BaseObject *family=nullptr;
+
+	try
+	{
+		op_class=new OperatorClass;
+		setBasicAttributes(op_class, attribs);
+
+		op_class->setIndexingType(IndexingType(attribs[ParsersAttributes::INDEX_TYPE]));
+		op_class->setDefault(attribs[ParsersAttributes::DEFAULT]==ParsersAttributes::_TRUE_);
+
+		if(!attribs[ParsersAttributes::FAMILY].isEmpty())
+		{
+			family=getObject(attribs[ParsersAttributes::FAMILY], OBJ_OPFAMILY);
+
+			//Raises an error if the operator family doesn't exists
+			if(!family)
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { op_class->getName(), op_class->getTypeName(), attribs[ParsersAttributes::FAMILY], BaseObject::getTypeName(OBJ_OPFAMILY) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			op_class->setFamily(dynamic_cast<OperatorFamily *>(family));
+		}
+
+		if(!attribs[ParsersAttributes::TYPE].isEmpty())
+			op_class->setDataType(PgSQLType::parseString(attribs[ParsersAttributes::TYPE]));
+	}
+	catch(Exception &e)
+	{
+		if(op_class) delete(op_class);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(op_class);
@@ -4490,19 +4926,32 @@ OperatorClass *DatabaseModel::createOperatorClass(void)
 OperatorFamily *DatabaseModel::createOperatorFamily(void)
 {
 	attribs_map attribs;
+
+	try
+	{
+		getObjectRecord(attribs);
+		return(createOperatorFamily(attribs));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+}
+
+OperatorFamily *DatabaseModel::createOperatorFamily(attribs_map &attribs)
+{
 	OperatorFamily *op_family=nullptr;
 
 	try
 	{
 		op_family=new OperatorFamily;
-		setBasicAttributes(op_family);
-		xmlparser.getElementAttributes(attribs);
+		setBasicAttributes(op_family, attribs);
 		op_family->setIndexingType(IndexingType(attribs[ParsersAttributes::INDEX_TYPE]));
 	}
 	catch(Exception &e)
 	{
 		if(op_family) delete(op_family);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(op_family);
@@ -4518,11 +4967,8 @@ Aggregate *DatabaseModel::createAggregate(void)
 
 	try
 	{
-		aggreg=new Aggregate;
-		setBasicAttributes(aggreg);
-		xmlparser.getElementAttributes(attribs);
-
-		aggreg->setInitialCondition(attribs[ParsersAttributes::INITIAL_COND]);
+		getObjectRecord(attribs);
+		aggreg=createAggregate(attribs);
 
 		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
@@ -4549,12 +4995,7 @@ Aggregate *DatabaseModel::createAggregate(void)
 
 						//Raises an error if the function doesn't exists on the model
 						if(!func && !attribs[ParsersAttributes::SIGNATURE].isEmpty())
-							throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-											.arg(aggreg->getName())
-											.arg(aggreg->getTypeName())
-											.arg(attribs[ParsersAttributes::SIGNATURE])
-								.arg(BaseObject::getTypeName(OBJ_FUNCTION)),
-								ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { aggreg->getName(), aggreg->getTypeName(), attribs[ParsersAttributes::SIGNATURE], BaseObject::getTypeName(OBJ_FUNCTION) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 						if(attribs[ParsersAttributes::REF_TYPE]==ParsersAttributes::TRANSITION_FUNC)
 							aggreg->setFunction(Aggregate::TRANSITION_FUNC,
@@ -4571,7 +5012,61 @@ Aggregate *DatabaseModel::createAggregate(void)
 	catch(Exception &e)
 	{
 		if(aggreg) delete(aggreg);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+
+	return(aggreg);
+}
+
+Aggregate *DatabaseModel::createAggregate(attribs_map &attribs)
+{
+	Aggregate *aggreg=nullptr;
+	BaseObject *func=nullptr, *sort_op=nullptr;
+	QString func_attribs[]={ ParsersAttributes::TRANSITION_FUNC, ParsersAttributes::FINAL_FUNC };
+	unsigned func_types[]={ Aggregate::TRANSITION_FUNC, Aggregate::FINAL_FUNC };
+
+	try
+	{
+		aggreg=new Aggregate;
+		setBasicAttributes(aggreg, attribs);
+		aggreg->setInitialCondition(attribs[ParsersAttributes::INITIAL_COND]);
+
+		/* The input types (a comma separated list, they never carry modifiers) and the state type
+		 are assigned first since the functions and the sort operator are validated against them */
+		for(auto &type : attribs[ParsersAttributes::TYPES].split(',', QString::SkipEmptyParts))
+			aggreg->addDataType(PgSQLType::parseString(type.trimmed()));
+
+		if(!attribs[ParsersAttributes::STATE_TYPE].isEmpty())
+			aggreg->setStateType(PgSQLType::parseString(attribs[ParsersAttributes::STATE_TYPE]));
+
+		for(unsigned i=0; i < 2; i++)
+		{
+			if(attribs[func_attribs[i]].isEmpty())
+				continue;
+
+			func=getObject(attribs[func_attribs[i]], OBJ_FUNCTION);
+
+			//Raises an error if the function doesn't exists on the model
+			if(!func)
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { aggreg->getName(), aggreg->getTypeName(), attribs[func_attribs[i]], BaseObject::getTypeName(OBJ_FUNCTION) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			aggreg->setFunction(func_types[i], dynamic_cast<Function *>(func));
+		}
+
+		if(!attribs[ParsersAttributes::SORT_OP].isEmpty())
+		{
+			sort_op=getObject(attribs[ParsersAttributes::SORT_OP], OBJ_OPERATOR);
+
+			if(!sort_op)
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { aggreg->getName(), aggreg->getTypeName(), attribs[ParsersAttributes::SORT_OP], BaseObject::getTypeName(OBJ_OPERATOR) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			aggreg->setSortOperator(dynamic_cast<Operator *>(sort_op));
+		}
+	}
+	catch(Exception &e)
+	{
+		if(aggreg) delete(aggreg);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(aggreg);
@@ -4587,20 +5082,13 @@ Table *DatabaseModel::createTable(void)
 	ObjectType obj_type;
 	vector<unsigned> idxs;
 	vector<QString> names;
+	vector<PartitionKey> part_keys;
+	PartitionKey part_key;
 
 	try
 	{
-		table=new Table;
-		setBasicAttributes(table);
-		xmlparser.getElementAttributes(attribs);
-
-		table->setWithOIDs(attribs[ParsersAttributes::OIDS]==ParsersAttributes::_TRUE_);
-		table->setUnlogged(attribs[ParsersAttributes::UNLOGGED]==ParsersAttributes::_TRUE_);
-		table->setRLSEnabled(attribs[ParsersAttributes::RLS_ENABLED]==ParsersAttributes::_TRUE_);
-		table->setRLSForced(attribs[ParsersAttributes::RLS_FORCED]==ParsersAttributes::_TRUE_);
-		table->setGenerateAlterCmds(attribs[ParsersAttributes::GEN_ALTER_CMDS]==ParsersAttributes::_TRUE_);
-		table->setExtAttribsHidden(attribs[ParsersAttributes::HIDE_EXT_ATTRIBS]==ParsersAttributes::_TRUE_);
-		table->setFadedOut(attribs[ParsersAttributes::FADED_OUT]==ParsersAttributes::_TRUE_);
+		getObjectRecord(attribs);
+		table=createTable(attribs);
 
 		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
@@ -4623,12 +5111,7 @@ Table *DatabaseModel::createTable(void)
 
 						if(!tag)
 						{
-							throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-											.arg(attribs[ParsersAttributes::NAME])
-									.arg(BaseObject::getTypeName(OBJ_TABLE))
-									.arg(aux_attribs[ParsersAttributes::TABLE])
-									.arg(BaseObject::getTypeName(OBJ_TAG))
-									, ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { attribs[ParsersAttributes::NAME], BaseObject::getTypeName(OBJ_TABLE), aux_attribs[ParsersAttributes::TABLE], BaseObject::getTypeName(OBJ_TAG) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 						}
 
 						table->setTag(dynamic_cast<Tag *>(tag));
@@ -4675,6 +5158,20 @@ Table *DatabaseModel::createTable(void)
 						table->setInitialData(xmlparser.getElementContent());
 						xmlparser.restorePosition();
 					}
+					//Retrieving the partition keys (they are assigned only after all columns are created)
+					else if(elem==ParsersAttributes::PARTITION_KEY)
+					{
+						part_key=PartitionKey();
+						createElement(part_key, nullptr, table);
+						part_keys.push_back(part_key);
+					}
+					else if(elem==ParsersAttributes::PARTITION_BOUND_EXPR)
+					{
+						xmlparser.savePosition();
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+						table->setPartitionBoundingExpr(xmlparser.getElementContent());
+						xmlparser.restorePosition();
+					}
 
 					if(object)
 						table->addObject(object);
@@ -4685,6 +5182,7 @@ Table *DatabaseModel::createTable(void)
 			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 
+		table->addPartitionKeys(part_keys);
 		table->setProtected(table->isProtected());
 	}
 	catch(Exception &e)
@@ -4693,7 +5191,36 @@ Table *DatabaseModel::createTable(void)
 		xmlparser.restorePosition();
 
 		if(table) delete(table);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, extra_info);
+	}
+
+	return(table);
+}
+
+Table *DatabaseModel::createTable(attribs_map &attribs)
+{
+	Table *table=nullptr;
+
+	try
+	{
+		table=new Table;
+		setBasicAttributes(table, attribs);
+
+		table->setWithOIDs(attribs[ParsersAttributes::OIDS]==ParsersAttributes::_TRUE_);
+		table->setUnlogged(attribs[ParsersAttributes::UNLOGGED]==ParsersAttributes::_TRUE_);
+		table->setRLSEnabled(attribs[ParsersAttributes::RLS_ENABLED]==ParsersAttributes::_TRUE_);
+		table->setRLSForced(attribs[ParsersAttributes::RLS_FORCED]==ParsersAttributes::_TRUE_);
+		table->setGenerateAlterCmds(attribs[ParsersAttributes::GEN_ALTER_CMDS]==ParsersAttributes::_TRUE_);
+		table->setExtAttribsHidden(attribs[ParsersAttributes::HIDE_EXT_ATTRIBS]==ParsersAttributes::_TRUE_);
+		table->setFadedOut(attribs[ParsersAttributes::FADED_OUT]==ParsersAttributes::_TRUE_);
+		table->setPartitioningType(PartitioningType(attribs[ParsersAttributes::PARTITIONING]));
+		table->setDefaultPartition(attribs[ParsersAttributes::DEFAULT_PARTITION]==ParsersAttributes::_TRUE_);
+		table->setStorageParameters(attribs[ParsersAttributes::OPTIONS]);
+	}
+	catch(Exception &e)
+	{
+		if(table) delete(table);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(table);
@@ -4703,15 +5230,53 @@ Column *DatabaseModel::createColumn(void)
 {
 	attribs_map attribs;
 	Column *column=nullptr;
-	BaseObject *seq=nullptr;
 	QString elem;
 
+	try
+	{
+		getObjectRecord(attribs);
+		column=createColumn(attribs);
+
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
+		{
+			do
+			{
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
+				{
+					elem=xmlparser.getElementName();
+
+					if(elem==ParsersAttributes::TYPE)
+					{
+						column->setType(createPgSQLType());
+					}
+				}
+			}
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
+		}
+	}
+	catch(Exception &e)
+	{
+		if(column) delete(column);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+
+	return(column);
+}
+
+Column *DatabaseModel::createColumn(attribs_map &attribs)
+{
+	Column *column=nullptr;
+	BaseObject *seq=nullptr;
+
 	try
 	{
 		column=new Column;
-		setBasicAttributes(column);
+		setBasicAttributes(column, attribs);
+
+		//In the record the data type is stored in its textual form
+		if(!attribs[ParsersAttributes::TYPE].isEmpty())
+			column->setType(PgSQLType::parseString(attribs[ParsersAttributes::TYPE]));
 
-		xmlparser.getElementAttributes(attribs);
 		column->setNotNull(attribs[ParsersAttributes::NOT_NULL]==ParsersAttributes::_TRUE_);
 		column->setDefaultValue(attribs[ParsersAttributes::DEFAULT_VALUE]);
 		column->setIdSeqAttributes(attribs[ParsersAttributes::MIN_VALUE], attribs[ParsersAttributes::MAX_VALUE], attribs[ParsersAttributes::INCREMENT],
@@ -4720,6 +5285,14 @@ Column *DatabaseModel::createColumn(void)
 		if(!attribs[ParsersAttributes::IDENTITY_TYPE].isEmpty())
 			column->setIdentityType(IdentityType(attribs[ParsersAttributes::IDENTITY_TYPE]));
 
+		if(!attribs[ParsersAttributes::STATISTICS].isEmpty())
+			column->setStatisticsTarget(attribs[ParsersAttributes::STATISTICS].toInt());
+
+		if(!attribs[ParsersAttributes::STORAGE].isEmpty())
+			column->setStorageType(StorageType(attribs[ParsersAttributes::STORAGE]));
+
+		column->setStorageParameters(attribs[ParsersAttributes::OPTIONS]);
+
 		if(!attribs[ParsersAttributes::SEQUENCE].isEmpty())
 		{
 			seq=getObject(attribs[ParsersAttributes::SEQUENCE], OBJ_SEQUENCE);
@@ -4733,56 +5306,145 @@ Column *DatabaseModel::createColumn(void)
 					ERR_PERM_REF_INEXIST_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 
-			column->setSequence(seq);
+			column->setSequence(seq);
+		}
+	}
+	catch(Exception &e)
+	{
+		if(column) delete(column);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	return(column);
+}
+
+Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
+{
+	attribs_map attribs;
+	Constraint *constr=nullptr;
+	Table *table=nullptr,*table_aux=nullptr;
+	Column *column=nullptr;
+	Relationship *rel=nullptr;
+	QString elem;
+	bool ins_constr_table=(parent_obj==nullptr);
+	QStringList col_list;
+	int count, i;
+	unsigned col_type;
+	ObjectType obj_type=OBJ_TABLE;
+	ExcludeElement exc_elem;
+
+	try
+	{
+		getObjectRecord(attribs);
+		constr=createConstraint(attribs, parent_obj);
+		table=dynamic_cast<Table *>(constr->getParentTable());
+
+		if(parent_obj)
+		{
+			obj_type=parent_obj->getObjectType();
+			rel=dynamic_cast<Relationship *>(parent_obj);
+		}
+		else
+			parent_obj=table;
+
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
+		{
+			do
+			{
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
+				{
+					elem=xmlparser.getElementName();
+
+					if(elem==ParsersAttributes::EXCLUDE_ELEMENT)
+					{
+						createElement(exc_elem, constr, parent_obj);
+						constr->addExcludeElement(exc_elem);
+					}
+					else if(elem==ParsersAttributes::EXPRESSION)
+					{
+						xmlparser.savePosition();
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+
+						constr->setExpression(xmlparser.getElementContent());
+
+						xmlparser.restorePosition();
+					}
+					else if(elem==ParsersAttributes::COLUMNS)
+					{
+						xmlparser.getElementAttributes(attribs);
+
+						col_list=attribs[ParsersAttributes::NAMES].split(',');
+						count=col_list.count();
+
+						if(attribs[ParsersAttributes::REF_TYPE]==ParsersAttributes::SRC_COLUMNS)
+							col_type=Constraint::SOURCE_COLS;
+						else
+							col_type=Constraint::REFERENCED_COLS;
+
+						for(i=0; i < count; i++)
+						{
+							if(col_type==Constraint::SOURCE_COLS)
+							{
+								if(obj_type==OBJ_TABLE)
+								{
+									column=table->getColumn(col_list[i]);
+
+									//If the column doesn't exists tries to get it searching by the old name
+									if(!column)
+										column=table->getColumn(col_list[i], true);
+								}
+								else
+									column=dynamic_cast<Column *>(rel->getObject(col_list[i], OBJ_COLUMN));
+							}
+							else
+							{
+								table_aux=dynamic_cast<Table *>(constr->getReferencedTable());
+								column=table_aux->getColumn(col_list[i]);
+
+								//If the column doesn't exists tries to get it searching by the old name
+								if(!column)
+									column=table_aux->getColumn(col_list[i], true);
+							}
+
+							constr->addColumn(column, col_type);
+						}
+					}
+				}
+			}
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 
-		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
+		if(ins_constr_table)
 		{
-			do
+			if(constr->getConstraintType()!=ConstraintType::primary_key)
 			{
-				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
-				{
-					elem=xmlparser.getElementName();
-
-					if(elem==ParsersAttributes::TYPE)
-					{
-						column->setType(createPgSQLType());
-					}
-				}
+				table->addConstraint(constr);
+				if(this->getObjectIndex(table) >= 0)
+					table->setModified(true);
 			}
-			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 	}
 	catch(Exception &e)
 	{
-		if(column) delete(column);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		if(constr) delete(constr);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
 	}
 
-	return(column);
+	return(constr);
 }
 
-Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
+Constraint *DatabaseModel::createConstraint(attribs_map &attribs, BaseObject *parent_obj)
 {
-	attribs_map attribs;
 	Constraint *constr=nullptr;
 	BaseObject *ref_table=nullptr;
-	Table *table=nullptr,*table_aux=nullptr;
-	Column *column=nullptr;
-	Relationship *rel=nullptr;
-	QString elem, str_aux;
-	bool deferrable, ins_constr_table=false;
+	Table *table=nullptr;
+	QString str_aux;
+	bool deferrable;
 	ConstraintType constr_type;
-	QStringList col_list;
-	int count, i;
-	unsigned col_type;
 	ObjectType obj_type;
-	ExcludeElement exc_elem;
 
 	try
 	{
-		xmlparser.getElementAttributes(attribs);
-
 		//If the constraint parent is allocated
 		if(parent_obj)
 		{
@@ -4791,18 +5453,14 @@ Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
 			//Identifies the correct parent type
 			if(obj_type==OBJ_TABLE)
 				table=dynamic_cast<Table *>(parent_obj);
-			else if(obj_type==OBJ_RELATIONSHIP)
-				rel=dynamic_cast<Relationship *>(parent_obj);
-			else
+			else if(obj_type!=OBJ_RELATIONSHIP)
 				//Raises an error if the user tries to create a constraint in a invalid parent
 				throw Exception(ERR_OPR_OBJ_INV_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		}
 		else
 		{
-			obj_type=OBJ_TABLE;
 			table=dynamic_cast<Table *>(getObject(attribs[ParsersAttributes::TABLE], OBJ_TABLE));
 			parent_obj=table;
-			ins_constr_table=true;
 
 			//Raises an error if the parent table doesn't exists
 			if(!table)
@@ -4837,13 +5495,7 @@ Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
 		if(!attribs[ParsersAttributes::FACTOR].isEmpty())
 			constr->setFillFactor(attribs[ParsersAttributes::FACTOR].toUInt());
 
-		setBasicAttributes(constr);
-
-		//Raises an error if the constraint is a primary key and no parent object is specified
-		if(!parent_obj && constr_type==ConstraintType::primary_key)
-			throw Exception(Exception::getErrorMessage(ERR_INV_PRIM_KEY_ALOCATION)
-							.arg(constr->getName()),
-							ERR_INV_PRIM_KEY_ALOCATION,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		setBasicAttributes(constr, attribs);
 
 		deferrable=(attribs[ParsersAttributes::DEFERRABLE]==ParsersAttributes::_TRUE_);
 		constr->setDeferrable(deferrable);
@@ -4864,7 +5516,7 @@ Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
 
 			ref_table=getObject(attribs[ParsersAttributes::REF_TABLE], OBJ_TABLE);
 
-			if(!ref_table && table->getName(true)==attribs[ParsersAttributes::REF_TABLE])
+			if(!ref_table && table && table->getName(true)==attribs[ParsersAttributes::REF_TABLE])
 				ref_table=table;
 
 			//Raises an error if the referenced table doesn't exists
@@ -4890,88 +5542,15 @@ Constraint *DatabaseModel::createConstraint(BaseObject *parent_obj)
 			constr->setIndexType(attribs[ParsersAttributes::INDEX_TYPE]);
 		}
 
-
-		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
-		{
-			do
-			{
-				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
-				{
-					elem=xmlparser.getElementName();
-
-					if(elem==ParsersAttributes::EXCLUDE_ELEMENT)
-					{
-						createElement(exc_elem, constr, parent_obj);
-						constr->addExcludeElement(exc_elem);
-					}
-					else if(elem==ParsersAttributes::EXPRESSION)
-					{
-						xmlparser.savePosition();
-						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
-
-						constr->setExpression(xmlparser.getElementContent());
-
-						xmlparser.restorePosition();
-					}
-					else if(elem==ParsersAttributes::COLUMNS)
-					{
-						xmlparser.getElementAttributes(attribs);
-
-						col_list=attribs[ParsersAttributes::NAMES].split(',');
-						count=col_list.count();
-
-						if(attribs[ParsersAttributes::REF_TYPE]==ParsersAttributes::SRC_COLUMNS)
-							col_type=Constraint::SOURCE_COLS;
-						else
-							col_type=Constraint::REFERENCED_COLS;
-
-						for(i=0; i < count; i++)
-						{
-							if(col_type==Constraint::SOURCE_COLS)
-							{
-								if(obj_type==OBJ_TABLE)
-								{
-									column=table->getColumn(col_list[i]);
-
-									//If the column doesn't exists tries to get it searching by the old name
-									if(!column)
-										column=table->getColumn(col_list[i], true);
-								}
-								else
-									column=dynamic_cast<Column *>(rel->getObject(col_list[i], OBJ_COLUMN));
-							}
-							else
-							{
-								table_aux=dynamic_cast<Table *>(ref_table);
-								column=table_aux->getColumn(col_list[i]);
-
-								//If the column doesn't exists tries to get it searching by the old name
-								if(!column)
-									column=table_aux->getColumn(col_list[i], true);
-							}
-
-							constr->addColumn(column, col_type);
-						}
-					}
-				}
-			}
-			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
-		}
-
-		if(ins_constr_table)
-		{
-			if(constr->getConstraintType()!=ConstraintType::primary_key)
-			{
-				table->addConstraint(constr);
-				if(this->getObjectIndex(table) >= 0)
-					table->setModified(true);
-			}
-		}
+		//In the record the expression of check and exclude constraints is stored as raw text
+		if((constr_type==ConstraintType::check || constr_type==ConstraintType::exclude) &&
+			 !attribs[ParsersAttributes::EXPRESSION].isEmpty())
+			constr->setExpression(attribs[ParsersAttributes::EXPRESSION]);
 	}
 	catch(Exception &e)
 	{
 		if(constr) delete(constr);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(constr);
@@ -4986,15 +5565,22 @@ void DatabaseModel::createElement(Element &elem, TableObject *tab_obj, BaseObjec
 	Collation *collation=nullptr;
 	QString xml_elem;
 
+	//Partition keys have no owner table object so the errors reference the table itself
+	BaseObject *owner_obj=(tab_obj ? dynamic_cast<BaseObject *>(tab_obj) : parent_obj);
+
 	xml_elem=xmlparser.getElementName();
 
-	if(xml_elem==ParsersAttributes::INDEX_ELEMENT || xml_elem==ParsersAttributes::EXCLUDE_ELEMENT)
+	if(xml_elem==ParsersAttributes::INDEX_ELEMENT || xml_elem==ParsersAttributes::EXCLUDE_ELEMENT ||
+		 xml_elem==ParsersAttributes::PARTITION_KEY)
 	{
 		xmlparser.getElementAttributes(attribs);
 
-		elem.setSortingAttribute(Element::ASC_ORDER, attribs[ParsersAttributes::ASC_ORDER]==ParsersAttributes::_TRUE_);
-		elem.setSortingAttribute(Element::NULLS_FIRST, attribs[ParsersAttributes::NULLS_FIRST]==ParsersAttributes::_TRUE_);
-		elem.setSortingEnabled(attribs[ParsersAttributes::USE_SORTING]!=ParsersAttributes::_FALSE_);
+		if(xml_elem!=ParsersAttributes::PARTITION_KEY)
+		{
+			elem.setSortingAttribute(Element::ASC_ORDER, attribs[ParsersAttributes::ASC_ORDER]==ParsersAttributes::_TRUE_);
+			elem.setSortingAttribute(Element::NULLS_FIRST, attribs[ParsersAttributes::NULLS_FIRST]==ParsersAttributes::_TRUE_);
+			elem.setSortingEnabled(attribs[ParsersAttributes::USE_SORTING]!=ParsersAttributes::_FALSE_);
+		}
 
 		xmlparser.savePosition();
 		xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
@@ -5013,12 +5599,7 @@ void DatabaseModel::createElement(Element &elem, TableObject *tab_obj, BaseObjec
 					//Raises an error if the operator class doesn't exists
 					if(!op_class)
 					{
-						throw Exception(QString(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL))
-										.arg(tab_obj->getName())
-										.arg(tab_obj->getTypeName())
-										.arg(attribs[ParsersAttributes::SIGNATURE])
-								.arg(BaseObject::getTypeName(OBJ_OPCLASS)),
-								ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { owner_obj->getName(), owner_obj->getTypeName(), attribs[ParsersAttributes::SIGNATURE], BaseObject::getTypeName(OBJ_OPCLASS) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 					}
 
 					elem.setOperatorClass(op_class);
@@ -5032,17 +5613,13 @@ void DatabaseModel::createElement(Element &elem, TableObject *tab_obj, BaseObjec
 					//Raises an error if the operator doesn't exists
 					if(!oper)
 					{
-						throw Exception(QString(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL))
-										.arg(tab_obj->getName())
-										.arg(tab_obj->getTypeName())
-										.arg(attribs[ParsersAttributes::SIGNATURE])
-								.arg(BaseObject::getTypeName(OBJ_OPERATOR)),
-								ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { owner_obj->getName(), owner_obj->getTypeName(), attribs[ParsersAttributes::SIGNATURE], BaseObject::getTypeName(OBJ_OPERATOR) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 					}
 
 					dynamic_cast<ExcludeElement &>(elem).setOperator(oper);
 				}
-				else if(xml_elem==ParsersAttributes::COLLATION && dynamic_cast<IndexElement *>(&elem))
+				else if(xml_elem==ParsersAttributes::COLLATION &&
+								(dynamic_cast<IndexElement *>(&elem) || dynamic_cast<PartitionKey *>(&elem)))
 				{
 					xmlparser.getElementAttributes(attribs);
 					collation=dynamic_cast<Collation *>(getObject(attribs[ParsersAttributes::NAME], OBJ_COLLATION));
@@ -5050,15 +5627,13 @@ void DatabaseModel::createElement(Element &elem, TableObject *tab_obj, BaseObjec
 					//Raises an error if the operator class doesn't exists
 					if(!collation)
 					{
-						throw Exception(QString(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL))
-										.arg(tab_obj->getName())
-										.arg(tab_obj->getTypeName())
-										.arg(attribs[ParsersAttributes::NAME])
-								.arg(BaseObject::getTypeName(OBJ_COLLATION)),
-								ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { owner_obj->getName(), owner_obj->getTypeName(), attribs[ParsersAttributes::NAME], BaseObject::getTypeName(OBJ_COLLATION) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 					}
 
-					dynamic_cast<IndexElement &>(elem).setCollation(collation);
+					if(dynamic_cast<IndexElement *>(&elem))
+						dynamic_cast<IndexElement &>(elem).setCollation(collation);
+					else
+						dynamic_cast<PartitionKey &>(elem).setCollation(collation);
 				}
 				else if(xml_elem==ParsersAttributes::COLUMN)
 				{
@@ -5079,12 +5654,7 @@ void DatabaseModel::createElement(Element &elem, TableObject *tab_obj, BaseObjec
 					//Raises an error if the column doesn't exists
 					if(!column)
 					{
-						throw Exception(QString(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL))
-										.arg(tab_obj->getName())
-										.arg(tab_obj->getTypeName())
-										.arg(attribs[ParsersAttributes::NAME])
-								.arg(BaseObject::getTypeName(OBJ_COLUMN)),
-								ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { owner_obj->getName(), owner_obj->getTypeName(), attribs[ParsersAttributes::NAME], BaseObject::getTypeName(OBJ_COLUMN) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 					}
 
 					elem.setColumn(column);
@@ -5140,7 +5710,7 @@ QString DatabaseModel::getAlterDefinition(BaseObject *object)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -5154,8 +5724,56 @@ Index *DatabaseModel::createIndex(void)
 
 	try
 	{
-		xmlparser.getElementAttributes(attribs);
+		getObjectRecord(attribs);
+		index=createIndex(attribs);
+		table=index->getParentTable();
+
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
+		{
+			do
+			{
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
+				{
+					elem=xmlparser.getElementName();
+
+					if(elem==ParsersAttributes::INDEX_ELEMENT)
+					{
+						createElement(idx_elem, index, table);
+						index->addIndexElement(idx_elem);
+					}
+					else if(elem==ParsersAttributes::PREDICATE)
+					{
+						xmlparser.savePosition();
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+						str_aux=xmlparser.getElementContent();
+						xmlparser.restorePosition();
+						index->setPredicate(str_aux);
+					}
+				}
+			}
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
+		}
+
+		table->addObject(index);
+		table->setModified(true);
+	}
+	catch(Exception &e)
+	{
+		if(index) delete(index);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+
+	return(index);
+}
+
+Index *DatabaseModel::createIndex(attribs_map &attribs)
+{
+	Index *index=nullptr;
+	QString str_aux;
+	BaseTable *table=nullptr;
 
+	try
+	{
 		table=dynamic_cast<BaseTable *>(getObject(attribs[ParsersAttributes::TABLE], OBJ_TABLE));
 
 		if(!table)
@@ -5174,7 +5792,7 @@ Index *DatabaseModel::createIndex(void)
 		}
 
 		index=new Index;
-		setBasicAttributes(index);
+		setBasicAttributes(index, attribs);
 		index->setParentTable(table);
 		index->setIndexAttribute(Index::CONCURRENT, attribs[ParsersAttributes::CONCURRENT]==ParsersAttributes::_TRUE_);
 		index->setIndexAttribute(Index::UNIQUE, attribs[ParsersAttributes::UNIQUE]==ParsersAttributes::_TRUE_);
@@ -5182,6 +5800,31 @@ Index *DatabaseModel::createIndex(void)
 		index->setIndexAttribute(Index::BUFFERING, attribs[ParsersAttributes::BUFFERING]==ParsersAttributes::_TRUE_);
 		index->setIndexingType(attribs[ParsersAttributes::INDEX_TYPE]);
 		index->setFillFactor(attribs[ParsersAttributes::FACTOR].toUInt());
+		index->setStorageParameters(attribs[ParsersAttributes::OPTIONS]);
+		index->setPredicate(attribs[ParsersAttributes::PREDICATE]);
+	}
+	catch(Exception &e)
+	{
+		if(index) delete(index);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	return(index);
+}
+
+Rule *DatabaseModel::createRule(void)
+{
+	attribs_map attribs;
+	Rule *rule=nullptr;
+	QString elem, str_aux;
+	BaseTable *table=nullptr;
+
+	try
+	{
+		getObjectRecord(attribs);
+
+		//The condition and commands are stored as the contents of child elements
+		xmlparser.savePosition();
 
 		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
@@ -5191,68 +5834,83 @@ Index *DatabaseModel::createIndex(void)
 				{
 					elem=xmlparser.getElementName();
 
-					if(elem==ParsersAttributes::INDEX_ELEMENT)
-					{
-						createElement(idx_elem, index, table);
-						index->addIndexElement(idx_elem);
-					}
-					else if(elem==ParsersAttributes::PREDICATE)
+					if(elem==ParsersAttributes::COMMANDS ||
+							elem==ParsersAttributes::CONDITION)
 					{
 						xmlparser.savePosition();
 						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
-						str_aux=xmlparser.getElementContent();
+						attribs[elem]=xmlparser.getElementContent();
 						xmlparser.restorePosition();
-						index->setPredicate(str_aux);
 					}
 				}
 			}
 			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 
-		table->addObject(index);
+		xmlparser.restorePosition();
+
+		rule=createRule(attribs);
+		table=rule->getParentTable();
+		table->addObject(rule);
 		table->setModified(true);
 	}
 	catch(Exception &e)
 	{
-		if(index) delete(index);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		if(rule) delete(rule);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
 	}
 
-	return(index);
+	return(rule);
 }
 
-Rule *DatabaseModel::createRule(void)
+Rule *DatabaseModel::createRule(attribs_map &attribs)
 {
-	attribs_map attribs;
-	QStringList cmd_list;
 	Rule *rule=nullptr;
-	QString elem, str_aux;
-	int count, i;
 	BaseTable *table=nullptr;
 
 	try
 	{
-		rule=new Rule;
-		setBasicAttributes(rule);
-
-		xmlparser.getElementAttributes(attribs);
-
 		table=dynamic_cast<BaseTable *>(getObject(attribs[ParsersAttributes::TABLE], OBJ_TABLE));
 
 		if(!table)
 			table=dynamic_cast<BaseTable *>(getObject(attribs[ParsersAttributes::TABLE], OBJ_VIEW));
 
 		if(!table)
-			throw Exception(QString(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL))
-							.arg(attribs[ParsersAttributes::NAME])
-				.arg(BaseObject::getTypeName(OBJ_RULE))
-				.arg(attribs[ParsersAttributes::TABLE])
-				.arg(BaseObject::getTypeName(OBJ_TABLE)),
-				ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
+			throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { attribs[ParsersAttributes::NAME], BaseObject::getTypeName(OBJ_RULE), attribs[ParsersAttributes::TABLE], BaseObject::getTypeName(OBJ_TABLE) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
+		rule=new Rule;
+		setBasicAttributes(rule, attribs);
+		rule->setParentTable(table);
 		rule->setExecutionType(attribs[ParsersAttributes::EXEC_TYPE]);
 		rule->setEventType(attribs[ParsersAttributes::EVENT_TYPE]);
+		rule->setConditionalExpression(attribs[ParsersAttributes::CONDITION]);
+
+		//The commands are stored in the record separated by semicolon
+		for(auto &cmd : attribs[ParsersAttributes::COMMANDS].split(';', QString::SkipEmptyParts))
+			rule->addCommand(cmd);
+	}
+	catch(Exception &e)
+	{
+		if(rule) delete(rule);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	return(rule);
+}
+
+Trigger *DatabaseModel::createTrigger(void)
+{
+	attribs_map attribs, attribs_aux;
+	Trigger *trigger=nullptr;
+	QString elem;
+	BaseTable *table=nullptr;
+
+	try
+	{
+		getObjectRecord(attribs);
+
+		//The function, condition and columns are written as child elements
+		xmlparser.savePosition();
 
 		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
@@ -5262,78 +5920,66 @@ Rule *DatabaseModel::createRule(void)
 				{
 					elem=xmlparser.getElementName();
 
-					if(elem==ParsersAttributes::COMMANDS ||
-							elem==ParsersAttributes::CONDITION)
+					if(elem==ParsersAttributes::FUNCTION)
+					{
+						xmlparser.getElementAttributes(attribs_aux);
+						attribs[ParsersAttributes::TRIGGER_FUNC]=attribs_aux[ParsersAttributes::SIGNATURE];
+					}
+					else if(elem==ParsersAttributes::CONDITION)
 					{
 						xmlparser.savePosition();
 						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
-
-						str_aux=xmlparser.getElementContent();
+						attribs[ParsersAttributes::CONDITION]=xmlparser.getElementContent();
 						xmlparser.restorePosition();
-
-						if(elem==ParsersAttributes::COMMANDS)
-						{
-							cmd_list=str_aux.split(';');
-							count=cmd_list.count();
-							for(i=0; i < count; i++)
-							{
-								if(!cmd_list[i].isEmpty())
-									rule->addCommand(cmd_list[i]);
-							}
-						}
-						else
-							rule->setConditionalExpression(str_aux);
+					}
+					else if(elem==ParsersAttributes::COLUMNS)
+					{
+						xmlparser.getElementAttributes(attribs_aux);
+						attribs[ParsersAttributes::COLUMNS]=attribs_aux[ParsersAttributes::NAMES];
 					}
 				}
 			}
 			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 
-		table->addObject(rule);
+		xmlparser.restorePosition();
+
+		trigger=createTrigger(attribs);
+		table=trigger->getParentTable();
+		table->addObject(trigger);
 		table->setModified(true);
 	}
 	catch(Exception &e)
 	{
-		if(rule) delete(rule);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		if(trigger) delete(trigger);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
 	}
 
-	return(rule);
+	return(trigger);
 }
 
-Trigger *DatabaseModel::createTrigger(void)
+Trigger *DatabaseModel::createTrigger(attribs_map &attribs)
 {
-	attribs_map attribs;
 	Trigger *trigger=nullptr;
-	QString elem, str_aux;
 	QStringList list_aux;
-	int count, i;
 	BaseObject *ref_table=nullptr, *func=nullptr;
 	Column *column=nullptr;
 	BaseTable *table=nullptr;
 
 	try
 	{
-		xmlparser.getElementAttributes(attribs);
-
 		table=dynamic_cast<BaseTable *>(getObject(attribs[ParsersAttributes::TABLE], OBJ_TABLE));
 
 		if(!table)
 			table=dynamic_cast<BaseTable *>(getObject(attribs[ParsersAttributes::TABLE], OBJ_VIEW));
 
 		if(!table)
-			throw Exception(QString(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL))
-							.arg(attribs[ParsersAttributes::NAME])
-				.arg(BaseObject::getTypeName(OBJ_TRIGGER))
-				.arg(attribs[ParsersAttributes::TABLE])
-				.arg(BaseObject::getTypeName(OBJ_TABLE)),
-				ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-
+			throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { attribs[ParsersAttributes::NAME], BaseObject::getTypeName(OBJ_TRIGGER), attribs[ParsersAttributes::TABLE], BaseObject::getTypeName(OBJ_TABLE) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 		trigger=new Trigger;
 		trigger->setParentTable(table);
 
-		setBasicAttributes(trigger);
+		setBasicAttributes(trigger, attribs);
 
 		trigger->setConstraint(attribs[ParsersAttributes::CONSTRAINT]==ParsersAttributes::_TRUE_);
 
@@ -5353,14 +5999,8 @@ Trigger *DatabaseModel::createTrigger(void)
 
 		trigger->setFiringType(FiringType(attribs[ParsersAttributes::FIRING_TYPE]));
 
-
-		list_aux=attribs[ParsersAttributes::ARGUMENTS].split(',');
-		count=list_aux.count();
-		for(i=0; i < count; i++)
-		{
-			if(!list_aux[i].isEmpty())
-				trigger->addArgument(list_aux[i]);
-		}
+		for(auto &arg : attribs[ParsersAttributes::ARGUMENTS].split(',', QString::SkipEmptyParts))
+			trigger->addArgument(arg);
 
 		trigger->setDeferrable(attribs[ParsersAttributes::DEFERRABLE]==ParsersAttributes::_TRUE_);
 
@@ -5377,81 +6017,42 @@ Trigger *DatabaseModel::createTrigger(void)
 			//Raises an error if the trigger is referencing a inexistent table
 			if(!ref_table)
 			{
-				throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-								.arg(trigger->getName())
-								.arg(trigger->getTypeName())
-								.arg(attribs[ParsersAttributes::REF_TABLE])
-						.arg(BaseObject::getTypeName(OBJ_TABLE)),
-						ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { trigger->getName(), trigger->getTypeName(), attribs[ParsersAttributes::REF_TABLE], BaseObject::getTypeName(OBJ_TABLE) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 			}
 
 			trigger->setReferecendTable(dynamic_cast<BaseTable *>(ref_table));
 		}
 
-		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
+		if(!attribs[ParsersAttributes::TRIGGER_FUNC].isEmpty())
 		{
-			do
-			{
-				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
-				{
-					elem=xmlparser.getElementName();
-
-					if(elem==ParsersAttributes::FUNCTION)
-					{
-						xmlparser.getElementAttributes(attribs);
-						func=getObject(attribs[ParsersAttributes::SIGNATURE], OBJ_FUNCTION);
+			func=getObject(attribs[ParsersAttributes::TRIGGER_FUNC], OBJ_FUNCTION);
 
-						//Raises an error if the function doesn't exists
-						if(!func && !attribs[ParsersAttributes::SIGNATURE].isEmpty())
-						{
-							str_aux=QString(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL))
-									.arg(trigger->getName())
-									.arg(trigger->getTypeName())
-									.arg(attribs[ParsersAttributes::SIGNATURE])
-									.arg(BaseObject::getTypeName(OBJ_FUNCTION));
+			//Raises an error if the function doesn't exists
+			if(!func)
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { trigger->getName(), trigger->getTypeName(), attribs[ParsersAttributes::TRIGGER_FUNC], BaseObject::getTypeName(OBJ_FUNCTION) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-							throw Exception(str_aux,ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-						}
+			trigger->setFunction(dynamic_cast<Function *>(func));
+		}
 
-						trigger->setFunction(dynamic_cast<Function *>(func));
-					}
-					else if(elem==ParsersAttributes::CONDITION)
-					{
-						xmlparser.savePosition();
-						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
-						str_aux=xmlparser.getElementContent();
-						xmlparser.restorePosition();
-						trigger->setCondition(str_aux);
-					}
-					else if(elem==ParsersAttributes::COLUMNS)
-					{
-						xmlparser.getElementAttributes(attribs);
+		trigger->setCondition(attribs[ParsersAttributes::CONDITION]);
 
-						list_aux=attribs[ParsersAttributes::NAMES].split(',');
-						count=list_aux.count();
+		//The columns are stored in the record by their names separated by comma
+		list_aux=attribs[ParsersAttributes::COLUMNS].split(',', QString::SkipEmptyParts);
 
-						for(i=0; i < count; i++)
-						{
-							column=dynamic_cast<Column *>(table->getObject(list_aux[i].trimmed(), OBJ_COLUMN));
+		for(auto &col_name : list_aux)
+		{
+			column=dynamic_cast<Column *>(table->getObject(col_name.trimmed(), OBJ_COLUMN));
 
-							if(!column && dynamic_cast<Table *>(table))
-								column=dynamic_cast<Table *>(table)->getColumn(list_aux[i].trimmed(), true);
+			if(!column && dynamic_cast<Table *>(table))
+				column=dynamic_cast<Table *>(table)->getColumn(col_name.trimmed(), true);
 
-							trigger->addColumn(column);
-						}
-					}
-				}
-			}
-			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
+			trigger->addColumn(column);
 		}
-
-		table->addObject(trigger);
-		table->setModified(true);
 	}
 	catch(Exception &e)
 	{
 		if(trigger) delete(trigger);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(trigger);
@@ -5459,30 +6060,17 @@ Trigger *DatabaseModel::createTrigger(void)
 
 Policy *DatabaseModel::createPolicy(void)
 {
-	attribs_map attribs;
+	attribs_map attribs, attribs_aux;
 	Policy *policy=nullptr;
 	QString elem;
 	BaseTable *table=nullptr;
 
 	try
 	{
-		policy=new Policy;
-		setBasicAttributes(policy);
-
-		xmlparser.getElementAttributes(attribs);
-
-		table=dynamic_cast<BaseTable *>(getObject(attribs[ParsersAttributes::TABLE], OBJ_TABLE));
-
-		if(!table)
-			throw Exception(QString(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL))
-											.arg(attribs[ParsersAttributes::NAME])
-											.arg(BaseObject::getTypeName(OBJ_POLICY))
-											.arg(attribs[ParsersAttributes::TABLE])
-											.arg(BaseObject::getTypeName(OBJ_TABLE)),
-				ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		getObjectRecord(attribs);
 
-		policy->setPermissive(attribs[ParsersAttributes::PERMISSIVE] == ParsersAttributes::_TRUE_);
-		policy->setPolicyCommand(PolicyCmdType(attribs[ParsersAttributes::COMMAND]));
+		//The expressions and roles are written as child elements
+		xmlparser.savePosition();
 
 		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
@@ -5494,56 +6082,81 @@ Policy *DatabaseModel::createPolicy(void)
 
 					if(elem==ParsersAttributes::EXPRESSION)
 					{
-						xmlparser.getElementAttributes(attribs);
+						xmlparser.getElementAttributes(attribs_aux);
 						xmlparser.savePosition();
 						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
 
-						if(attribs[ParsersAttributes::TYPE] == ParsersAttributes::USING_EXP)
-							policy->setUsingExpression(xmlparser.getElementContent());
-						else if(attribs[ParsersAttributes::TYPE] == ParsersAttributes::CHECK_EXP)
-							policy->setCheckExpression(xmlparser.getElementContent());
+						if(attribs_aux[ParsersAttributes::TYPE] == ParsersAttributes::USING_EXP ||
+							 attribs_aux[ParsersAttributes::TYPE] == ParsersAttributes::CHECK_EXP)
+							attribs[attribs_aux[ParsersAttributes::TYPE]]=xmlparser.getElementContent();
 
 						xmlparser.restorePosition();
 					}
-					else if(xmlparser.getElementName()==ParsersAttributes::ROLES)
+					else if(elem==ParsersAttributes::ROLES)
 					{
-						QStringList rol_names;
-						Role *role = nullptr;
-
-						xmlparser.getElementAttributes(attribs);
-
-						rol_names = attribs[ParsersAttributes::NAMES].split(',');
-
-						for(auto &name : rol_names)
-						{
-							role=dynamic_cast<Role *>(getObject(name.trimmed(), OBJ_ROLE));
-
-							//Raises an error if the referenced role doesn't exists
-							if(!role)
-							{
-								throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-																.arg(policy->getName())
-																.arg(policy->getTypeName())
-																.arg(name)
-																.arg(BaseObject::getTypeName(OBJ_ROLE)),
-																ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-							}
-
-							policy->addRole(role);
-						}
+						xmlparser.getElementAttributes(attribs_aux);
+						attribs[ParsersAttributes::ROLES]=attribs_aux[ParsersAttributes::NAMES];
 					}
 				}
 			}
 			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 
+		xmlparser.restorePosition();
+
+		policy=createPolicy(attribs);
+		table=policy->getParentTable();
 		table->addObject(policy);
 		table->setModified(true);
 	}
 	catch(Exception &e)
 	{
 		if(policy) delete(policy);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+
+	return(policy);
+}
+
+Policy *DatabaseModel::createPolicy(attribs_map &attribs)
+{
+	Policy *policy=nullptr;
+	BaseTable *table=nullptr;
+	Role *role=nullptr;
+
+	try
+	{
+		table=dynamic_cast<BaseTable *>(getObject(attribs[ParsersAttributes::TABLE], OBJ_TABLE));
+
+		if(!table)
+			throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { attribs[ParsersAttributes::NAME], BaseObject::getTypeName(OBJ_POLICY), attribs[ParsersAttributes::TABLE], BaseObject::getTypeName(OBJ_TABLE) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		policy=new Policy;
+		setBasicAttributes(policy, attribs);
+		policy->setParentTable(table);
+		policy->setPermissive(attribs[ParsersAttributes::PERMISSIVE] == ParsersAttributes::_TRUE_);
+		policy->setPolicyCommand(PolicyCmdType(attribs[ParsersAttributes::COMMAND]));
+		policy->setUsingExpression(attribs[ParsersAttributes::USING_EXP]);
+		policy->setCheckExpression(attribs[ParsersAttributes::CHECK_EXP]);
+
+		//The roles are stored in the record by their names separated by comma
+		for(auto &name : attribs[ParsersAttributes::ROLES].split(',', QString::SkipEmptyParts))
+		{
+			role=dynamic_cast<Role *>(getObject(name.trimmed(), OBJ_ROLE));
+
+			//Raises an error if the referenced role doesn't exists
+			if(!role)
+			{
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { policy->getName(), policy->getTypeName(), name, BaseObject::getTypeName(OBJ_ROLE) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			}
+
+			policy->addRole(role);
+		}
+	}
+	catch(Exception &e)
+	{
+		if(policy) delete(policy);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(policy);
@@ -5551,17 +6164,15 @@ Policy *DatabaseModel::createPolicy(void)
 
 EventTrigger *DatabaseModel::createEventTrigger(void)
 {
-	attribs_map attribs;
-	EventTrigger *event_trig=nullptr;
-	BaseObject *func=nullptr;
+	attribs_map attribs, attribs_aux;
 	QString elem;
 
 	try
 	{
-		event_trig=new EventTrigger;
-		setBasicAttributes(event_trig);
-		xmlparser.getElementAttributes(attribs);
-		event_trig->setEvent(EventTriggerType(attribs[ParsersAttributes::EVENT]));
+		getObjectRecord(attribs);
+
+		//The function and the filter are written as child elements
+		xmlparser.savePosition();
 
 		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
@@ -5573,37 +6184,61 @@ EventTrigger *DatabaseModel::createEventTrigger(void)
 
 					if(elem==ParsersAttributes::FUNCTION)
 					{
-						xmlparser.getElementAttributes(attribs);
-						func=getObject(attribs[ParsersAttributes::SIGNATURE], OBJ_FUNCTION);
-
-						//Raises an error if the function doesn't exists
-						if(!func && !attribs[ParsersAttributes::SIGNATURE].isEmpty())
-						{
-							throw Exception(QString(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL))
-											.arg(event_trig->getName())
-											.arg(event_trig->getTypeName())
-											.arg(attribs[ParsersAttributes::SIGNATURE])
-									.arg(BaseObject::getTypeName(OBJ_FUNCTION)),
-									ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-						}
-
-						event_trig->setFunction(dynamic_cast<Function *>(func));
+						xmlparser.getElementAttributes(attribs_aux);
+						attribs[ParsersAttributes::FUNCTION]=attribs_aux[ParsersAttributes::SIGNATURE];
 					}
 					else if(elem==ParsersAttributes::FILTER)
 					{
-						xmlparser.getElementAttributes(attribs);
-						event_trig->setFilter(attribs[ParsersAttributes::VARIABLE], attribs[ParsersAttributes::VALUES].split(','));
+						xmlparser.getElementAttributes(attribs_aux);
+						attribs[ParsersAttributes::VARIABLE]=attribs_aux[ParsersAttributes::VARIABLE];
+						attribs[ParsersAttributes::VALUES]=attribs_aux[ParsersAttributes::VALUES];
 					}
 				}
 			}
 			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
 
+		xmlparser.restorePosition();
+		return(createEventTrigger(attribs));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+}
+
+EventTrigger *DatabaseModel::createEventTrigger(attribs_map &attribs)
+{
+	EventTrigger *event_trig=nullptr;
+	BaseObject *func=nullptr;
+
+	try
+	{
+		event_trig=new EventTrigger;
+		setBasicAttributes(event_trig, attribs);
+		event_trig->setEvent(EventTriggerType(attribs[ParsersAttributes::EVENT]));
+
+		if(!attribs[ParsersAttributes::FUNCTION].isEmpty())
+		{
+			func=getObject(attribs[ParsersAttributes::FUNCTION], OBJ_FUNCTION);
+
+			//Raises an error if the function doesn't exists
+			if(!func)
+			{
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { event_trig->getName(), event_trig->getTypeName(), attribs[ParsersAttributes::FUNCTION], BaseObject::getTypeName(OBJ_FUNCTION) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			}
+
+			event_trig->setFunction(dynamic_cast<Function *>(func));
+		}
+
+		//The filter values are stored in the record separated by comma
+		if(!attribs[ParsersAttributes::VALUES].isEmpty())
+			event_trig->setFilter(attribs[ParsersAttributes::VARIABLE], attribs[ParsersAttributes::VALUES].split(','));
 	}
 	catch(Exception &e)
 	{
 		if(event_trig) delete(event_trig);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(event_trig);
@@ -5631,7 +6266,7 @@ GenericSQL *DatabaseModel::createGenericSQL(void)
 	catch(Exception &e)
 	{
 		if(genericsql) delete(genericsql);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
 	}
 
 	return(genericsql);
@@ -5640,6 +6275,20 @@ GenericSQL *DatabaseModel::createGenericSQL(void)
 Sequence *DatabaseModel::createSequence(bool ignore_onwer)
 {
 	attribs_map attribs;
+
+	try
+	{
+		getObjectRecord(attribs);
+		return(createSequence(attribs, ignore_onwer));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+}
+
+Sequence *DatabaseModel::createSequence(attribs_map &attribs, bool ignore_onwer)
+{
 	Sequence *sequence=nullptr;
 	BaseObject *table=nullptr;
 	Column *column=nullptr;
@@ -5650,8 +6299,7 @@ Sequence *DatabaseModel::createSequence(bool ignore_onwer)
 	try
 	{
 		sequence=new Sequence;
-		setBasicAttributes(sequence);
-		xmlparser.getElementAttributes(attribs);
+		setBasicAttributes(sequence, attribs);
 
 		sequence->setValues(attribs[ParsersAttributes::MIN_VALUE],
 				attribs[ParsersAttributes::MAX_VALUE],
@@ -5699,9 +6347,7 @@ Sequence *DatabaseModel::createSequence(bool ignore_onwer)
 
 			//Raises an error if the column doesn't exists
 			if(!column && !ignore_onwer)
-				throw Exception(Exception::getErrorMessage(ERR_ASG_INEXIST_OWNER_COL_SEQ)
-								.arg(sequence->getName(true)),
-								ERR_ASG_INEXIST_OWNER_COL_SEQ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(ERR_ASG_INEXIST_OWNER_COL_SEQ, { sequence->getName(true) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 			sequence->setOwnerColumn(column);
 		}
@@ -5709,7 +6355,7 @@ Sequence *DatabaseModel::createSequence(bool ignore_onwer)
 	catch(Exception &e)
 	{
 		if(sequence) delete(sequence);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(sequence);
@@ -5732,15 +6378,8 @@ View *DatabaseModel::createView(void)
 
 	try
 	{
-		view=new View;
-		setBasicAttributes(view);
-
-		xmlparser.getElementAttributes(attribs);
-		view->setMaterialized(attribs[ParsersAttributes::MATERIALIZED]==ParsersAttributes::_TRUE_);
-		view->setRecursive(attribs[ParsersAttributes::RECURSIVE]==ParsersAttributes::_TRUE_);
-		view->setWithNoData(attribs[ParsersAttributes::WITH_NO_DATA]==ParsersAttributes::_TRUE_);
-		view->setExtAttribsHidden(attribs[ParsersAttributes::HIDE_EXT_ATTRIBS]==ParsersAttributes::_TRUE_);
-		view->setFadedOut(attribs[ParsersAttributes::FADED_OUT]==ParsersAttributes::_TRUE_);
+		getObjectRecord(attribs);
+		view=createView(attribs);
 
 		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
 		{
@@ -5857,12 +6496,7 @@ View *DatabaseModel::createView(void)
 
 						if(!tag)
 						{
-							throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-											.arg(attribs[ParsersAttributes::NAME])
-									.arg(BaseObject::getTypeName(OBJ_TABLE))
-									.arg(aux_attribs[ParsersAttributes::TABLE])
-									.arg(BaseObject::getTypeName(OBJ_TAG))
-									, ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { attribs[ParsersAttributes::NAME], BaseObject::getTypeName(OBJ_TABLE), aux_attribs[ParsersAttributes::TABLE], BaseObject::getTypeName(OBJ_TAG) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 						}
 
 						view->setTag(dynamic_cast<Tag *>(tag));
@@ -5897,7 +6531,31 @@ View *DatabaseModel::createView(void)
 	catch(Exception &e)
 	{
 		if(view) delete(view);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+
+	return(view);
+}
+
+View *DatabaseModel::createView(attribs_map &attribs)
+{
+	View *view=nullptr;
+
+	try
+	{
+		view=new View;
+		setBasicAttributes(view, attribs);
+
+		view->setMaterialized(attribs[ParsersAttributes::MATERIALIZED]==ParsersAttributes::_TRUE_);
+		view->setRecursive(attribs[ParsersAttributes::RECURSIVE]==ParsersAttributes::_TRUE_);
+		view->setWithNoData(attribs[ParsersAttributes::WITH_NO_DATA]==ParsersAttributes::_TRUE_);
+		view->setExtAttribsHidden(attribs[ParsersAttributes::HIDE_EXT_ATTRIBS]==ParsersAttributes::_TRUE_);
+		view->setFadedOut(attribs[ParsersAttributes::FADED_OUT]==ParsersAttributes::_TRUE_);
+	}
+	catch(Exception &e)
+	{
+		if(view) delete(view);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(view);
@@ -5905,53 +6563,50 @@ View *DatabaseModel::createView(void)
 
 Collation *DatabaseModel::createCollation(void)
 {
-	Collation *collation=nullptr;
-	BaseObject *copy_coll=nullptr;
-	EncodingType encoding;
 	attribs_map attribs;
 
 	try
 	{
-		collation=new Collation;
-		setBasicAttributes(collation);
+		getObjectRecord(attribs);
+		return(createCollation(attribs));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+}
 
-		xmlparser.getElementAttributes(attribs);
+Collation *DatabaseModel::createCollation(attribs_map &attribs)
+{
+	Collation *collation=nullptr;
 
-		encoding=EncodingType(attribs[ParsersAttributes::ENCODING]);
-		collation->setEncoding(encoding);
+	try
+	{
+		collation=new Collation;
+
+		/* When the collation is created from another collation this one is assigned by setBasicAttributes()
+		 since the record stores the source collation's name in the same attribute used by other objects */
+		setBasicAttributes(collation, attribs);
 
-		//Creating a collation from a base locale
-		if(!attribs[ParsersAttributes::LOCALE].isEmpty())
-			collation->setLocale(attribs[ParsersAttributes::LOCALE]);
-		//Creating a collation from another collation
-		else if(!attribs[ParsersAttributes::COLLATION].isEmpty())
+		if(!collation->getCollation())
 		{
-			copy_coll=this->getObject(attribs[ParsersAttributes::COLLATION], OBJ_COLLATION);
+			collation->setEncoding(EncodingType(attribs[ParsersAttributes::ENCODING]));
 
-			//Raises an error if the copy collation doesn't exists
-			if(!copy_coll)
+			//Creating a collation from a base locale
+			if(!attribs[ParsersAttributes::LOCALE].isEmpty())
+				collation->setLocale(attribs[ParsersAttributes::LOCALE]);
+			//Creating a collation using LC_COLLATE and LC_CTYPE params
+			else
 			{
-				throw Exception(QString(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL))
-								.arg(collation->getName())
-								.arg(BaseObject::getTypeName(OBJ_COLLATION))
-								.arg(attribs[ParsersAttributes::COLLATION])
-						.arg(BaseObject::getTypeName(OBJ_COLLATION)),
-						ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				collation->setLocalization(Collation::_LC_COLLATE, attribs[ParsersAttributes::_LC_COLLATE_]);
+				collation->setLocalization(Collation::_LC_CTYPE, attribs[ParsersAttributes::_LC_CTYPE_]);
 			}
-
-			collation->setCollation(dynamic_cast<Collation *>(copy_coll));
-		}
-		//Creating a collation using LC_COLLATE and LC_CTYPE params
-		else
-		{
-			collation->setLocalization(Collation::_LC_COLLATE, attribs[ParsersAttributes::_LC_COLLATE_]);
-			collation->setLocalization(Collation::_LC_CTYPE, attribs[ParsersAttributes::_LC_CTYPE_]);
 		}
 	}
 	catch(Exception &e)
 	{
 		if(collation) delete(collation);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(collation);
@@ -5959,14 +6614,27 @@ Collation *DatabaseModel::createCollation(void)
 
 Extension *DatabaseModel::createExtension(void)
 {
-	Extension *extension=nullptr;
 	attribs_map attribs;
 
+	try
+	{
+		getObjectRecord(attribs);
+		return(createExtension(attribs));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
+	}
+}
+
+Extension *DatabaseModel::createExtension(attribs_map &attribs)
+{
+	Extension *extension=nullptr;
+
 	try
 	{
 		extension=new Extension;
-		xmlparser.getElementAttributes(attribs);
-		setBasicAttributes(extension);
+		setBasicAttributes(extension, attribs);
 
 		extension->setHandlesType(attribs[ParsersAttributes::HANDLES_TYPE]==ParsersAttributes::_TRUE_);
 		extension->setVersion(Extension::CUR_VERSION, attribs[ParsersAttributes::CUR_VERSION]);
@@ -5975,7 +6643,7 @@ Extension *DatabaseModel::createExtension(void)
 	catch(Exception &e)
 	{
 		if(extension) delete(extension);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	return(extension);
@@ -6015,7 +6683,7 @@ Tag *DatabaseModel::createTag(void)
 	catch(Exception &e)
 	{
 		if(tag) delete(tag);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
 	}
 }
 
@@ -6045,7 +6713,7 @@ Textbox *DatabaseModel::createTextbox(void)
 	catch(Exception &e)
 	{
 		if(txtbox) delete(txtbox);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
 	}
 
 	return(txtbox);
@@ -6129,10 +6797,7 @@ BaseRelationship *DatabaseModel::createRelationship(void)
 				is being created before the fk that represents it (inconsistence!). In this case an error is raised. */
 				if(fks.empty())
 				{
-					throw Exception(Exception::getErrorMessage(ERR_ALOC_INV_FK_RELATIONSHIP)
-									.arg(attribs[ParsersAttributes::NAME])
-							.arg(tables[0]->getName(true)),
-							ERR_ALOC_INV_FK_RELATIONSHIP,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+					throw Exception(ERR_ALOC_INV_FK_RELATIONSHIP, { attribs[ParsersAttributes::NAME], tables[0]->getName(true) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 				}
 
 				base_rel=new BaseRelationship(BaseRelationship::RELATIONSHIP_FK, tables[0], tables[1], false, false);
@@ -6144,12 +6809,7 @@ BaseRelationship *DatabaseModel::createRelationship(void)
 				base_rel->setName(attribs[ParsersAttributes::NAME]);
 
 			if(!base_rel)
-				throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-								.arg(this->getName())
-								.arg(this->getTypeName())
-								.arg(attribs[ParsersAttributes::NAME])
-					.arg(BaseObject::getTypeName(BASE_RELATIONSHIP)),
-					ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { this->getName(), this->getTypeName(), attribs[ParsersAttributes::NAME], BaseObject::getTypeName(BASE_RELATIONSHIP) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 			base_rel->blockSignals(loading_model);
 			base_rel->disconnectRelationship();
@@ -6188,6 +6848,8 @@ BaseRelationship *DatabaseModel::createRelationship(void)
 				rel_type=BaseRelationship::RELATIONSHIP_GEN;
 			else if(attribs[ParsersAttributes::TYPE]==ParsersAttributes::RELATIONSHIP_DEP)
 				rel_type=BaseRelationship::RELATIONSHIP_DEP;
+			else if(attribs[ParsersAttributes::TYPE]==ParsersAttributes::RELATIONSHIP_PART)
+				rel_type=BaseRelationship::RELATIONSHIP_PART;
 
 			rel=new Relationship(rel_type,
 								 dynamic_cast<Table *>(tables[0]),
@@ -6288,7 +6950,7 @@ BaseRelationship *DatabaseModel::createRelationship(void)
 		if(base_rel && base_rel->getObjectType()==OBJ_RELATIONSHIP)
 			delete(base_rel);
 
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
 	}
 
 	if(rel)
@@ -6378,10 +7040,7 @@ Permission *DatabaseModel::createPermission(void)
 
 		//Raises an error if the permission references an object that does not exists
 		if(!object)
-			throw Exception(Exception::getErrorMessage(ERR_PERM_REF_INEXIST_OBJECT)
-							.arg(obj_name)
-							.arg(BaseObject::getTypeName(obj_type)),
-							ERR_PERM_REF_INEXIST_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ERR_PERM_REF_INEXIST_OBJECT, { obj_name, BaseObject::getTypeName(obj_type) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 		perm=new Permission(object);
 		perm->setRevoke(revoke);
@@ -6465,7 +7124,7 @@ Permission *DatabaseModel::createPermission(void)
 	catch(Exception &e)
 	{
 		if(perm) delete(perm);
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, getErrorExtraInfo());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, getErrorExtraInfo());
 	}
 
 	return(perm);
@@ -6480,12 +7139,7 @@ void DatabaseModel::validateColumnRemoval(Column *column)
 
 		//Raises an error if there are objects referencing the column
 		if(!refs.empty())
-			throw Exception(Exception::getErrorMessage(ERR_REM_DIRECT_REFERENCE)
-							.arg(column->getParentTable()->getName(true) + QString(".") + column->getName(true))
-							.arg(column->getTypeName())
-							.arg(refs[0]->getName(true))
-				.arg(refs[0]->getTypeName()),
-				ERR_REM_DIRECT_REFERENCE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			throw Exception(ERR_REM_DIRECT_REFERENCE, { column->getParentTable()->getName(true) + QString(".") + column->getName(true), column->getTypeName(), refs[0]->getName(true), refs[0]->getTypeName() },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -6511,7 +7165,7 @@ void DatabaseModel::validateRelationships(TableObject *object, Table *parent_tab
 							  dynamic_cast<Constraint *>(object)->getConstraintType()==ConstraintType::primary_key));
 
 			/* Additional validation for columns: checks if the parent table participates on a
-			generalization/copy as destination table */
+			generalization/partitioning as destination table */
 			if(obj_type==OBJ_COLUMN)
 			{
 				itr=relationships.begin();
@@ -6521,7 +7175,8 @@ void DatabaseModel::validateRelationships(TableObject *object, Table *parent_tab
 				{
 					rel=dynamic_cast<Relationship *>(*itr);
 					itr++;
-					ref_tab_inheritance=(rel->getRelationshipType()==Relationship::RELATIONSHIP_GEN &&
+					ref_tab_inheritance=((rel->getRelationshipType()==Relationship::RELATIONSHIP_GEN ||
+																rel->getRelationshipType()==Relationship::RELATIONSHIP_PART) &&
 										 rel->getReferenceTable()==parent_tab);
 				}
 			}
@@ -6536,7 +7191,7 @@ void DatabaseModel::validateRelationships(TableObject *object, Table *parent_tab
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -6607,7 +7262,7 @@ QString DatabaseModel::__getCodeDefinition(unsigned def_type)
 	{
 		this->appended_sql=bkp_appended_sql;
 		this->prepended_sql=bkp_prepended_sql;
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -6618,6 +7273,8 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type)
 
 QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 {
+	TRACE_SCOPE("model", def_type==SchemaParser::SQL_DEFINITION ? "getCodeDefinition (SQL)" : "getCodeDefinition (XML)");
+
 	attribs_map attribs_aux;
 	unsigned general_obj_cnt, gen_defs_count;
 	bool sql_disabled=false;
@@ -6795,7 +7452,7 @@ QString DatabaseModel::getCodeDefinition(unsigned def_type, bool export_file)
 				}
 			}
 		}
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 
 	attribs_aux[ParsersAttributes::EXPORT_TO_FILE]=(export_file ? ParsersAttributes::_TRUE_ : QString());
@@ -7232,14 +7889,15 @@ vector<BaseObject *> DatabaseModel::getCreationOrder(BaseObject *object, bool on
 
 void DatabaseModel::saveModel(const QString &filename, unsigned def_type)
 {
+	TRACE_SCOPE("model", "saveModel");
+
 	QFile output(filename);
 	QByteArray buf;
 
 	output.open(QFile::WriteOnly);
 
 	if(!output.isOpen())
-		throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(filename),
-						ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ERR_FILE_DIR_NOT_WRITTEN, { filename },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	try
 	{
@@ -7250,8 +7908,7 @@ void DatabaseModel::saveModel(const QString &filename, unsigned def_type)
 	catch(Exception &e)
 	{
 		if(output.isOpen()) output.close();
-		throw Exception(Exception::getErrorMessage(ERR_FILE_NOT_WRITTER_INV_DEF).arg(filename),
-						ERR_FILE_NOT_WRITTER_INV_DEF,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(ERR_FILE_NOT_WRITTER_INV_DEF, { filename },__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 	}
 }
 
@@ -8737,6 +9394,13 @@ void DatabaseModel::getObjectReferences(BaseObject *object, vector<BaseObject *>
 						Index *index=nullptr;
 						Constraint *constr=nullptr;
 
+						//The partition keys are not objects so the table itself is referenced
+						if(tab->isPartitionKeyRefColumn(column))
+						{
+							refer=true;
+							refs.push_back(tab);
+						}
+
 						count=tab->getConstraintCount();
 						for(idx=0; idx < count && (!exclusion_mode || (exclusion_mode && !refer)); idx++)
 						{
@@ -9097,7 +9761,8 @@ void DatabaseModel::createSystemObjects(bool create_public)
 	setDefaultObject(getObject(QString("public"), OBJ_SCHEMA), OBJ_SCHEMA);
 }
 
-vector<BaseObject *> DatabaseModel::findObjects(const QString &pattern, vector<ObjectType> types, bool format_obj_names, bool case_sensitive, bool is_regexp, bool exact_match)
+vector<BaseObject *> DatabaseModel::findObjects(const QString &pattern, vector<ObjectType> types, bool format_obj_names, bool case_sensitive,
+																								bool is_regexp, bool exact_match, const QString &search_attr)
 {
 	vector<BaseObject *> list, objs;
 	vector<BaseObject *>::iterator end;
@@ -9105,19 +9770,7 @@ vector<BaseObject *> DatabaseModel::findObjects(const QString &pattern, vector<O
 	vector<BaseObject *> tables;
 	bool inc_tabs=false, inc_views=false;
 	ObjectType obj_type;
-	QRegExp regexp;
-	QString obj_name;
-
-	//Configuring the regex style
-	regexp.setPattern(pattern);
-	regexp.setCaseSensitivity(case_sensitive ?  Qt::CaseSensitive :  Qt::CaseInsensitive);
-
-	if(is_regexp)
-		regexp.setPatternSyntax(QRegExp::RegExp2);
-	else if(exact_match)
-		regexp.setPatternSyntax(QRegExp::FixedString);
-	else
-		regexp.setPatternSyntax(QRegExp::Wildcard);
+	QRegExp regexp=ObjectSearchIndex::createSearchRegExp(pattern, case_sensitive, is_regexp, exact_match);
 
 	//If there is some table object types on the type list, gather tables and views
 	while(itr_tp!=types.end() && (!inc_views || !inc_tabs))
@@ -9175,31 +9828,10 @@ vector<BaseObject *> DatabaseModel::findObjects(const QString &pattern, vector<O
 	//Try to find  the objects on the configured list
 	while(!objs.empty())
 	{
-		//Quotes are removed from the name by default
-		if(format_obj_names && !exact_match)
-		{
-			if(TableObject::isTableObject(objs.back()->getObjectType()))
-			{
-				TableObject *tab_obj=dynamic_cast<TableObject *>(objs.back());
-
-				if(tab_obj->getParentTable())
-					obj_name=tab_obj->getParentTable()->getName(true);
-			}
-
-			obj_name+=objs.back()->getName(true, true);
-			obj_name.remove('"');
-		}
-		else
-			obj_name=objs.back()->getName();
-
-		//Try to match the name on the configured regexp
-		if((exact_match && pattern==obj_name) ||
-				(exact_match && regexp.exactMatch(obj_name)) ||
-				(!exact_match && regexp.indexIn(obj_name) >= 0))
+		if(ObjectSearchIndex::matchesObject(objs.back(), pattern, regexp, search_attr, format_obj_names, exact_match))
 			list.push_back(objs.back());
 
 		objs.pop_back();
-		obj_name.clear();
 	}
 
 	//Removing the duplicate items on the list
@@ -9215,6 +9847,20 @@ void DatabaseModel::setInvalidated(bool value)
 	this->invalidated=value;
 }
 
+void DatabaseModel::notifyObjectRenamed(BaseObject *object)
+{
+	TableObject *tab_obj=dynamic_cast<TableObject *>(object);
+
+	if(!object)
+		return;
+
+	//Table children are notified through their parent table
+	if(tab_obj && tab_obj->getParentTable())
+		object=tab_obj->getParentTable();
+
+	emit s_objectRenamed(object);
+}
+
 bool DatabaseModel::isInvalidated(void)
 {
 	return(invalidated);
@@ -9311,8 +9957,7 @@ void DatabaseModel::saveObjectsMetadata(const QString &filename, unsigned option
 	output.open(QFile::WriteOnly);
 
 	if(!output.isOpen())
-		throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(filename),
-										ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		throw Exception(ERR_FILE_DIR_NOT_WRITTEN, { filename },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	try
 	{
@@ -9602,8 +10247,7 @@ void DatabaseModel::saveObjectsMetadata(const QString &filename, unsigned option
 	catch(Exception &e)
 	{
 		if(output.isOpen()) output.close();
-		throw Exception(Exception::getErrorMessage(ERR_FILE_NOT_WRITTER_INV_DEF).arg(filename),
-										ERR_FILE_NOT_WRITTER_INV_DEF,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(ERR_FILE_NOT_WRITTER_INV_DEF, { filename },__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 	}
 }
 
@@ -9900,6 +10544,6 @@ void DatabaseModel::loadObjectsMetadata(const QString &filename, unsigned option
 		if(xmlparser.getCurrentElement())
 			extra_info=QString(QObject::trUtf8("%1 (line: %2)")).arg(xmlparser.getLoadedFilename()).arg(xmlparser.getCurrentElement()->line);
 
-		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, extra_info);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, extra_info);
 	}
 }
@@ -29,6 +29,7 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 
 #include <QFile>
 #include <QObject>
+#include <QMutex>
 #include <QStringList>
 #include "baseobject.h"
 #include "table.h"
@@ -55,11 +56,12 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #include "eventtrigger.h"
 #include "genericsql.h"
 #include <algorithm>
+#include <set>
 #include <locale.h>
 
 class ModelWidget;
 
-class DatabaseModel:  public QObject, public BaseObject {
+class DatabaseModel:  public QObject, public BaseObject, public ObjectUpdateHandler {
 	private:
 		Q_OBJECT
 
@@ -135,7 +137,30 @@ class DatabaseModel:  public QObject, public BaseObject {
 		append_at_eod,
 
 		//! \brief Indicates that prepended SQL commands must be put at the very beginning of model definition
-		prepend_at_bod;
+		prepend_at_bod,
+
+		//! \brief Indicates that a full relationship validation was requested while a batch was running
+		batch_rels_invalidated,
+
+		//! \brief Indicates that the updates of the modified graphical objects are postponed until the end of the current batch
+		batch_updates_deferred;
+
+		//! \brief Nesting level of the batches opened via startBatch()
+		unsigned batch_level,
+
+		//! \brief Amount of objects added to / removed from the model in the current batch
+		batch_added, batch_removed;
+
+		/*! \brief Tables which fk relationships must be updated after the postponed relationship validation
+		of the current batch (see removeRelationship()) */
+		vector<Table *> batch_fk_tables;
+
+		//! \brief Graphical objects of the model that were modified while the updates were postponed (see deferObjectUpdate())
+		set<BaseGraphicObject *> batch_pending_updates;
+
+		/*! \brief Guards the postponed updates since the objects can be modified in threads other than the one
+		running the batch (e.g. model validation) */
+		QMutex batch_mutex;
 
 		//! \brief Stores the last position on the model where the user was editing objects
 		QPoint last_pos;
@@ -146,6 +171,10 @@ class DatabaseModel:  public QObject, public BaseObject {
 		 the object index */
 		BaseObject *getObject(const QString &name, ObjectType obj_type, int &obj_idx);
 
+		/*! \brief Resumes the updates of the graphical objects emitting s_objectModified() once for each object
+		modified during the batch. Schemas are notified after the tables and views they contain */
+		void finishDeferredUpdates(void);
+
 		//! \brief Generic method that adds an object to the model
 		void __addObject(BaseObject *object, int obj_idx=-1);
 
@@ -169,6 +198,14 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Returns extra error info when loading database models
 		QString getErrorExtraInfo(void);
 
+		/*! \brief Stores in the record the basic attributes which are written as child elements of the current
+		 XML element (comment, appended/prepended SQL, schema, owner, tablespace, collation and position) */
+		void loadBasicAttributes(attribs_map &attribs);
+
+		/*! \brief Flattens the current XML element into a record (element attributes plus the basic attributes)
+		 that can be passed to the record based create* methods */
+		void getObjectRecord(attribs_map &attribs);
+
 	public:
 		static const unsigned META_DB_ATTRIBUTES=1,	//! \brief Handle database model attribute when save/load metadata file
 		META_OBJS_POSITIONING=2,	//! \brief Handle objects' positioning when save/load metadata file
@@ -204,9 +241,29 @@ class DatabaseModel:  public QObject, public BaseObject {
 		 by relationship) in order to be reconstructed in a posterior moment */
 		void storeSpecialObjectsXML(void);
 
-		//! \brief Validates all the relationship, propagating all column modifications over the tables
+		/*! \brief Validates all the relationship, propagating all column modifications over the tables.
+		When called inside a batch the validation is postponed to finishBatch() */
 		void validateRelationships(void);
 
+		/*! \brief Starts a batch of changes over the model. Until the outermost finishBatch() is called, the full
+		relationship validations (e.g. the ones done when adding or removing relationships) are postponed and the
+		graphical objects modified are redrawn only once. Batches are intended to bulk operations like pasting,
+		removing several objects or undoing/redoing operation chains */
+		void startBatch(void);
+
+		/*! \brief Finishes the current batch. The outermost call validates the relationships once (if needed),
+		redraws the modified graphical objects and emits s_batchFinished(). Errors raised by the postponed
+		validation are redirected to the caller */
+		void finishBatch(void);
+
+		//! \brief Returns if there is a batch running on the model
+		bool isBatchRunning(void);
+
+		/*! \brief Stores the object to be updated at the end of the current batch returning true. When the updates
+		aren't postponed nothing is done and false is returned so the object can notify the change by itself.
+		The model is registered as update handler of the graphical objects added to it (see BaseGraphicObject::setModified()) */
+		virtual bool deferObjectUpdate(BaseGraphicObject *object);
+
 		//! \brief Returns the list of specified object type that belongs to the passed schema
 		vector<BaseObject *> getObjects(ObjectType obj_type, BaseObject *schema=nullptr);
 
@@ -302,6 +359,10 @@ class DatabaseModel:  public QObject, public BaseObject {
 
 		BaseObject *getDefaultObject(ObjectType obj_type);
 
+		/*! \brief Emits s_objectRenamed() for the object or, in case of table children, for its parent table. Must be called
+		by the operations that rename objects, move them to other schemas, change their comments or add/remove table children */
+		void notifyObjectRenamed(BaseObject *object);
+
 		//! \brief Returns if the model is invalidated. When true its recommended to validate model using Model validation tool
 		bool isInvalidated(void);
 
@@ -486,12 +547,53 @@ class DatabaseModel:  public QObject, public BaseObject {
 
 		void setBasicAttributes(BaseObject *object);
 
+		/*! \brief Configures the basic attributes of the object from a flat record. References to schema, owner,
+		 tablespace and collation are resolved by name in the model */
+		void setBasicAttributes(BaseObject *object, attribs_map &attribs);
+
 		void configureDatabase(attribs_map &attribs);
 		PgSQLType createPgSQLType(void);
 		BaseObject *createObject(ObjectType obj_type);
 		Role *createRole(void);
 		Tablespace *createTablespace(void);
 		Schema *createSchema(void);
+
+		/*! \brief Creates objects directly from flat records (the same attributes used in the XML elements) avoiding the
+		 XML generation and parsing when the attributes come from another source, e.g., the catalog during the reverse engineering */
+		Role *createRole(attribs_map &attribs);
+		Tablespace *createTablespace(attribs_map &attribs);
+		Schema *createSchema(attribs_map &attribs);
+		Extension *createExtension(attribs_map &attribs);
+		Sequence *createSequence(attribs_map &attribs, bool ignore_onwer=false);
+		Table *createTable(attribs_map &attribs);
+		Column *createColumn(attribs_map &attribs);
+
+		/*! \brief Creates objects with nested definitions from flat records. Data types are stored in their textual form
+		 and references by name (functions by signature). The nested parts (parameters, elements, columns, references,
+		 type attributes, domain checks, operator class elements) are not part of the record and must be added by the caller.
+		 Lists (roles, columns, arguments, aggregate input types) are comma separated and the rule commands are separated
+		 by semicolon. The domain's type is assigned by the caller since its modifiers don't come in the record. The created
+		 index, constraint, rule, trigger and policy are not inserted in their parent table. When parent_obj is null the
+		 constraint's table is resolved by name */
+		Function *createFunction(attribs_map &attribs);
+		Type *createType(attribs_map &attribs);
+		View *createView(attribs_map &attribs);
+		Index *createIndex(attribs_map &attribs);
+		Constraint *createConstraint(attribs_map &attribs, BaseObject *parent_obj);
+		Language *createLanguage(attribs_map &attribs);
+		Domain *createDomain(attribs_map &attribs);
+		Cast *createCast(attribs_map &attribs);
+		Conversion *createConversion(attribs_map &attribs);
+		Operator *createOperator(attribs_map &attribs);
+		OperatorFamily *createOperatorFamily(attribs_map &attribs);
+		OperatorClass *createOperatorClass(attribs_map &attribs);
+		Aggregate *createAggregate(attribs_map &attribs);
+		Collation *createCollation(attribs_map &attribs);
+		Rule *createRule(attribs_map &attribs);
+		Trigger *createTrigger(attribs_map &attribs);
+		Policy *createPolicy(attribs_map &attribs);
+		EventTrigger *createEventTrigger(attribs_map &attribs);
+
 		Language *createLanguage(void);
 		Function *createFunction(void);
 		Parameter createParameter(void);
@@ -583,9 +685,11 @@ class DatabaseModel:  public QObject, public BaseObject {
 		void createSystemObjects(bool create_public);
 
 		/*! \brief Returns a list of object searching them using the specified pattern. The search can be delimited by filtering the object's types.
-		The additional bool params are: case sensitive name search, name pattern is a regexp, exact match for names. */
+		The additional bool params are: case sensitive name search, name pattern is a regexp, exact match for names.
+		The search_attr indicates which object's attribute is matched against the pattern: ParsersAttributes::NAME (default),
+		ParsersAttributes::SIGNATURE or ParsersAttributes::COMMENT. */
 		vector<BaseObject *> findObjects(const QString &pattern, vector<ObjectType> types, bool format_obj_names,
-										 bool case_sensitive, bool is_regexp, bool exact_match);
+										 bool case_sensitive, bool is_regexp, bool exact_match, const QString &search_attr=ParsersAttributes::NAME);
 
 		void setLastPosition(const QPoint &pnt);
 		QPoint getLastPosition(void);
@@ -617,8 +721,17 @@ class DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Signal emitted when an object is removed from the model
 		void s_objectRemoved(BaseObject *object);
 
+		/*! \brief Signal emitted by notifyObjectRenamed() when an object of the model is renamed, moved to another schema, has its
+		comment changed or is restored by an operation. For tables and views the signal is also emitted when their children
+		are added, removed or renamed */
+		void s_objectRenamed(BaseObject *object);
+
 		//! \brief Signal emitted when an object is created from a xml code
 		void s_objectLoaded(int progress, QString object_id, unsigned obj_type);
+
+		/*! \brief Signal emitted when the outermost batch is finished summarizing the amount of objects added and removed
+		during it. Receivers that don't need to react to each object can rely only on this signal during batches */
+		void s_batchFinished(unsigned added_cnt, unsigned removed_cnt);
 };
 
 #endif
@@ -24,6 +24,7 @@ Index::Index(void)
 	index_attribs[UNIQUE]=index_attribs[CONCURRENT]=
 			index_attribs[FAST_UPDATE]=index_attribs[BUFFERING]=false;
 	fill_factor=90;
+	storage_params=StorageParameters(OBJ_INDEX);
 	attributes[ParsersAttributes::UNIQUE]=QString();
 	attributes[ParsersAttributes::CONCURRENT]=QString();
 	attributes[ParsersAttributes::TABLE]=QString();
@@ -40,6 +41,8 @@ Index::Index(void)
 	attributes[ParsersAttributes::FAST_UPDATE]=QString();
 	attributes[ParsersAttributes::BUFFERING]=QString();
 	attributes[ParsersAttributes::STORAGE_PARAMS]=QString();
+	attributes[ParsersAttributes::OPTIONS]=QString();
+	attributes[ParsersAttributes::RESET_OPTIONS]=QString();
 }
 
 void Index::setIndexElementsAttribute(unsigned def_type)
@@ -214,6 +217,32 @@ void Index::setFillFactor(unsigned factor)
 	fill_factor=factor;
 }
 
+void Index::setStorageParameter(const QString &name, const QString &value)
+{
+	try
+	{
+		setCodeInvalidated(storage_params.getParameter(name) != value);
+		storage_params.setParameter(name, value);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void Index::setStorageParameters(const QString &params_str)
+{
+	try
+	{
+		storage_params.setParameters(params_str);
+		setCodeInvalidated(true);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
 void Index::setIndexingType(IndexingType idx_type)
 {
 	setCodeInvalidated(indexing_type != idx_type);
@@ -232,6 +261,16 @@ unsigned Index::getFillFactor(void)
 	return(fill_factor);
 }
 
+QString Index::getStorageParameter(const QString &name)
+{
+	return(storage_params.getParameter(name));
+}
+
+StorageParameters Index::getStorageParameters(void)
+{
+	return(storage_params);
+}
+
 bool Index::getIndexAttribute(unsigned attrib_id)
 {
 	if(attrib_id > BUFFERING)
@@ -359,6 +398,11 @@ QString Index::getCodeDefinition(unsigned def_type)
 	else if(def_type==SchemaParser::XML_DEFINITION)
 		attributes[ParsersAttributes::FACTOR]=QString("0");
 
+	attributes[ParsersAttributes::OPTIONS]=storage_params.getCodeDefinition(def_type);
+
+	if(!storage_params.isEmpty())
+		attributes[ParsersAttributes::STORAGE_PARAMS]=ParsersAttributes::_TRUE_;
+
 	/* Case the index doesn't referece some column added by relationship it will be declared
 		inside the parent table construction by the use of 'decl-in-table' schema attribute */
 	if(!isReferRelationshipAddedColumn())
@@ -385,8 +429,15 @@ QString Index::getAlterDefinition(BaseObject *object)
 	try
 	{
 		attribs_map attribs;
+		QString set_params, reset_params;
+
 		attributes[ParsersAttributes::ALTER_CMDS]=BaseObject::getAlterDefinition(object);
 
+		//Clearing the values set by the code definition so only the changed parameters are generated
+		attributes[ParsersAttributes::FACTOR]=attributes[ParsersAttributes::FAST_UPDATE]=
+				attributes[ParsersAttributes::BUFFERING]=attributes[ParsersAttributes::OPTIONS]=
+				attributes[ParsersAttributes::RESET_OPTIONS]=QString();
+
 		if(this->indexing_type==index->indexing_type)
 		{
 			if(this->fill_factor!=index->fill_factor && index->fill_factor >= 10)
@@ -399,6 +450,14 @@ QString Index::getAlterDefinition(BaseObject *object)
 			if(this->indexing_type==IndexingType::gist &&
 					this->index_attribs[BUFFERING] != index->index_attribs[BUFFERING])
 				attribs[ParsersAttributes::BUFFERING]=(index->index_attribs[BUFFERING] ? ParsersAttributes::_TRUE_ : ParsersAttributes::UNSET);
+
+			storage_params.getDifferences(index->storage_params, set_params, reset_params);
+
+			if(!set_params.isEmpty())
+				attribs[ParsersAttributes::OPTIONS]=set_params;
+
+			if(!reset_params.isEmpty())
+				attribs[ParsersAttributes::RESET_OPTIONS]=reset_params;
 		}
 
 		copyAttributes(attribs);
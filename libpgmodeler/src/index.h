@@ -28,6 +28,7 @@
 
 #include "tableobject.h"
 #include "indexelement.h"
+#include "storageparameters.h"
 
 class Index: public TableObject{
 	private:
@@ -46,6 +47,9 @@ class Index: public TableObject{
 		//! \brief Boolean attributes that define some index features  (UNIQUE, CONCURRENT, FAST UPDATE, BUFFERING)
 		bool index_attribs[4];
 
+		//! \brief Access method specific storage parameters not covered by the fill factor and the boolean attributes
+		StorageParameters storage_params;
+
 		//! \brief Formats the elements string used by the SchemaParser
 		void setIndexElementsAttribute(unsigned def_type);
 
@@ -101,6 +105,13 @@ class Index: public TableObject{
 		//! \brief Defines the index fill factor
 		void setFillFactor(unsigned factor);
 
+		/*! \brief Defines the value of a storage parameter (e.g. pages_per_range, gin_pending_list_limit).
+		An empty value removes the parameter */
+		void setStorageParameter(const QString &name, const QString &value);
+
+		//! \brief Replaces the storage parameters by the ones in the string in the form name=value[,name=value...]
+		void setStorageParameters(const QString &params_str);
+
 		//! \brief Gets the index conditional expression
 		QString getPredicate(void);
 
@@ -116,6 +127,9 @@ class Index: public TableObject{
 		//! \brief Returns the index fill factor
 		unsigned getFillFactor(void);
 
+		QString getStorageParameter(const QString &name);
+		StorageParameters getStorageParameters(void);
+
 		//! \brief Returns the SQL / XML definition for the index
 		virtual QString getCodeDefinition(unsigned def_type) final;
 
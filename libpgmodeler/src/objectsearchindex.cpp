@@ -0,0 +1,508 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "objectsearchindex.h"
+
+ObjectSearchIndex::ObjectSearchIndex(void)
+{
+	db_model=nullptr;
+	invalidated=true;
+}
+
+void ObjectSearchIndex::setModel(DatabaseModel *db_model)
+{
+	clear();
+	this->db_model=db_model;
+}
+
+DatabaseModel *ObjectSearchIndex::getModel(void)
+{
+	return(db_model);
+}
+
+void ObjectSearchIndex::clear(void)
+{
+	entries.clear();
+	type_idxs.clear();
+	children.clear();
+	changed_objs.clear();
+	invalidated=true;
+}
+
+void ObjectSearchIndex::invalidate(void)
+{
+	invalidated=true;
+}
+
+QSet<QString> ObjectSearchIndex::getTrigrams(const QString &text)
+{
+	QSet<QString> trigrams;
+
+	for(int i=0; i <= text.size() - TRIGRAM_LEN; i++)
+		trigrams.insert(text.mid(i, TRIGRAM_LEN));
+
+	return(trigrams);
+}
+
+QStringList ObjectSearchIndex::getRequiredLiterals(const QString &pattern, bool is_regexp, bool exact_match)
+{
+	QStringList literals;
+	QString literal;
+	QChar chr;
+	int depth=0, len=pattern.size();
+
+	auto flush_literal=[&](){
+		if(literal.size() >= TRIGRAM_LEN)
+			literals.push_back(literal.toLower());
+
+		literal.clear();
+	};
+
+	//Fixed strings are required as a whole
+	if(!is_regexp && exact_match)
+	{
+		if(pattern.size() >= TRIGRAM_LEN)
+			literals.push_back(pattern.toLower());
+
+		return(literals);
+	}
+
+	for(int i=0; i < len; i++)
+	{
+		chr=pattern.at(i);
+
+		if(!is_regexp)
+		{
+			//Wildcard patterns: only *, ? and [...] break the literal sequences
+			if(chr==QChar('*') || chr==QChar('?') || chr==QChar('\\'))
+				flush_literal();
+			else if(chr==QChar('['))
+			{
+				flush_literal();
+				while(i < len && pattern.at(i)!=QChar(']')) i++;
+			}
+			else
+				literal+=chr;
+
+			continue;
+		}
+
+		//Top level alternations makes all literals optional so no prefiltering can be done
+		if(chr==QChar('|') && depth==0)
+			return(QStringList());
+		else if(chr==QChar('\\'))
+		{
+			i++;
+
+			//Escaped non alphanumeric chars are literals, \w, \d, \1, etc. are character classes or backreferences
+			if(i < len && !pattern.at(i).isLetterOrNumber())
+			{
+				if(depth==0)
+					literal+=pattern.at(i);
+			}
+			else
+				flush_literal();
+		}
+		//The contents of groups are ignored since the group itself can be optional
+		else if(chr==QChar('('))
+		{
+			depth++;
+			flush_literal();
+		}
+		else if(chr==QChar(')'))
+		{
+			depth--;
+			flush_literal();
+		}
+		else if(chr==QChar('['))
+		{
+			flush_literal();
+			i++;
+
+			//Skipping the brackets considering that a ']' right after '[' or '[^' is part of the set
+			if(i < len && pattern.at(i)==QChar('^')) i++;
+			if(i < len && pattern.at(i)==QChar(']')) i++;
+			while(i < len && pattern.at(i)!=QChar(']')) i++;
+		}
+		//Quantifiers that make the previous char optional
+		else if(chr==QChar('*') || chr==QChar('?') || chr==QChar('{'))
+		{
+			literal.chop(1);
+			flush_literal();
+
+			if(chr==QChar('{'))
+				while(i < len && pattern.at(i)!=QChar('}')) i++;
+		}
+		else if(chr==QChar('+') || chr==QChar('.') || chr==QChar('^') || chr==QChar('$'))
+			flush_literal();
+		else if(depth==0)
+			literal+=chr;
+	}
+
+	flush_literal();
+	return(literals);
+}
+
+ObjectSearchIndex::IndexEntry ObjectSearchIndex::createEntry(BaseObject *object)
+{
+	IndexEntry entry;
+	TableObject *tab_obj=dynamic_cast<TableObject *>(object);
+
+	entry.obj_type=object->getObjectType();
+	entry.parent=(tab_obj ? tab_obj->getParentTable() : nullptr);
+
+	//The name entry aggregates all the texts that can be matched as name or signature
+	entry.name=(getSearchText(object, ParsersAttributes::NAME, true, false) + QChar('\n') +
+							object->getName() + QChar('\n') +
+							getSearchText(object, ParsersAttributes::SIGNATURE, true, false) + QChar('\n') +
+							object->getSignature(false)).toLower();
+	entry.comment=object->getComment().toLower();
+
+	return(entry);
+}
+
+void ObjectSearchIndex::indexEntry(BaseObject *object, const IndexEntry &entry)
+{
+	TypeIndex &type_idx=type_idxs[entry.obj_type];
+
+	entries[object]=entry;
+	type_idx.objects.insert(object);
+
+	if(entry.parent)
+		children[entry.parent].insert(object);
+
+	for(auto &trigram : getTrigrams(entry.name))
+		type_idx.names[trigram].insert(object);
+
+	for(auto &trigram : getTrigrams(entry.comment))
+		type_idx.comments[trigram].insert(object);
+}
+
+void ObjectSearchIndex::unindexEntry(BaseObject *object)
+{
+	if(!entries.contains(object))
+		return;
+
+	IndexEntry entry=entries.take(object);
+	TypeIndex &type_idx=type_idxs[entry.obj_type];
+
+	type_idx.objects.remove(object);
+
+	if(entry.parent)
+	{
+		children[entry.parent].remove(object);
+
+		if(children[entry.parent].isEmpty())
+			children.remove(entry.parent);
+	}
+
+	for(auto &trigram : getTrigrams(entry.name))
+	{
+		type_idx.names[trigram].remove(object);
+
+		if(type_idx.names[trigram].isEmpty())
+			type_idx.names.remove(trigram);
+	}
+
+	for(auto &trigram : getTrigrams(entry.comment))
+	{
+		type_idx.comments[trigram].remove(object);
+
+		if(type_idx.comments[trigram].isEmpty())
+			type_idx.comments.remove(trigram);
+	}
+}
+
+void ObjectSearchIndex::updateEntry(BaseObject *object)
+{
+	IndexEntry entry=createEntry(object);
+
+	//Only new objects or the ones that had their texts changed are reindexed
+	if(entries.contains(object))
+	{
+		const IndexEntry &curr_entry=entries[object];
+
+		if(curr_entry.obj_type==entry.obj_type && curr_entry.parent==entry.parent &&
+			 curr_entry.name==entry.name && curr_entry.comment==entry.comment)
+			return;
+
+		unindexEntry(object);
+	}
+
+	indexEntry(object, entry);
+}
+
+void ObjectSearchIndex::reindexObject(BaseObject *object)
+{
+	vector<BaseObject *> objects={ object };
+	BaseTable *base_tab=dynamic_cast<BaseTable *>(object);
+
+	if(base_tab)
+	{
+		vector<BaseObject *> tab_objs=base_tab->getObjects();
+		QSet<BaseObject *> curr_children;
+
+		for(auto child : tab_objs)
+			curr_children.insert(child);
+
+		//The children that left the table are dropped without dereferencing them since they could be destroyed
+		for(auto child : children.value(object))
+		{
+			if(!curr_children.contains(child))
+				unindexEntry(child);
+		}
+
+		objects.insert(objects.end(), tab_objs.begin(), tab_objs.end());
+	}
+
+	for(auto obj : objects)
+		updateEntry(obj);
+}
+
+vector<BaseObject *> ObjectSearchIndex::getModelObjects(void)
+{
+	vector<BaseObject *> objects, *obj_list=nullptr;
+	vector<TableObject *> *tab_objs=nullptr;
+
+	if(!db_model)
+		return(objects);
+
+	objects.push_back(db_model);
+
+	for(auto obj_type : BaseObject::getObjectTypes(false, { OBJ_DATABASE }))
+	{
+		obj_list=db_model->getObjectList(obj_type);
+
+		if(obj_list)
+			objects.insert(objects.end(), obj_list->begin(), obj_list->end());
+	}
+
+	for(auto tab_type : { OBJ_TABLE, OBJ_VIEW })
+	{
+		for(auto object : *db_model->getObjectList(tab_type))
+		{
+			for(auto obj_type : BaseObject::getChildObjectTypes(tab_type))
+			{
+				if(tab_type==OBJ_TABLE)
+					tab_objs=dynamic_cast<Table *>(object)->getObjectList(obj_type);
+				else
+					tab_objs=dynamic_cast<View *>(object)->getObjectList(obj_type);
+
+				objects.insert(objects.end(), tab_objs->begin(), tab_objs->end());
+			}
+		}
+	}
+
+	return(objects);
+}
+
+void ObjectSearchIndex::synchronize(void)
+{
+	QSet<BaseObject *> model_objs;
+	QList<BaseObject *> removed_objs;
+
+	for(auto object : getModelObjects())
+	{
+		model_objs.insert(object);
+		updateEntry(object);
+	}
+
+	//Dropping the objects that aren't in the model anymore (they are never dereferenced)
+	for(auto itr=entries.begin(); itr!=entries.end(); itr++)
+	{
+		if(!model_objs.contains(itr.key()))
+			removed_objs.push_back(itr.key());
+	}
+
+	for(auto object : removed_objs)
+		unindexEntry(object);
+
+	changed_objs.clear();
+	invalidated=false;
+}
+
+void ObjectSearchIndex::addObject(BaseObject *object)
+{
+	//While invalidated the object will be indexed in the next synchronization
+	if(!object || invalidated)
+		return;
+
+	reindexObject(object);
+}
+
+void ObjectSearchIndex::removeObject(BaseObject *object)
+{
+	if(!entries.contains(object))
+		return;
+
+	unindexEntry(object);
+	changed_objs.remove(object);
+
+	for(auto child : children.value(object))
+		unindexEntry(child);
+}
+
+void ObjectSearchIndex::updateObject(BaseObject *object)
+{
+	//Only the objects of the model are indexed so any other object (e.g. operation backups) is ignored
+	if(!invalidated && entries.contains(object))
+		changed_objs.insert(object);
+}
+
+vector<BaseObject *> ObjectSearchIndex::getCandidates(const QString &pattern, const vector<ObjectType> &types, const QString &search_attr,
+																											bool is_regexp, bool exact_match)
+{
+	vector<BaseObject *> candidates;
+	QStringList literals;
+	QList<QString> trigrams;
+	QSet<BaseObject *> objects;
+
+	if(!db_model)
+		return(candidates);
+
+	for(auto object : changed_objs)
+	{
+		//Renaming a schema changes the signatures of all of its objects
+		if(invalidated || entries[object].obj_type==OBJ_SCHEMA)
+		{
+			invalidated=true;
+			break;
+		}
+
+		reindexObject(object);
+	}
+
+	changed_objs.clear();
+
+	if(invalidated)
+		synchronize();
+
+	literals=getRequiredLiterals(pattern, is_regexp, exact_match);
+
+	for(auto &literal : literals)
+		trigrams.append(getTrigrams(literal).toList());
+
+	for(auto obj_type : types)
+	{
+		if(type_idxs.count(obj_type)==0)
+			continue;
+
+		TypeIndex &type_idx=type_idxs[obj_type];
+		QHash<QString, QSet<BaseObject *>> &trigram_idx=(search_attr==ParsersAttributes::COMMENT ? type_idx.comments : type_idx.names);
+
+		if(trigrams.isEmpty())
+			objects=type_idx.objects;
+		else
+		{
+			bool not_found=false, first=true;
+
+			//Starting the intersection from the most selective trigram
+			std::sort(trigrams.begin(), trigrams.end(), [&](const QString &trig1, const QString &trig2){
+				return(trigram_idx.value(trig1).size() < trigram_idx.value(trig2).size());
+			});
+
+			objects.clear();
+
+			for(auto &trigram : trigrams)
+			{
+				if(!trigram_idx.contains(trigram))
+				{
+					not_found=true;
+					break;
+				}
+
+				if(first)
+					objects=trigram_idx[trigram];
+				else
+					objects.intersect(trigram_idx[trigram]);
+
+				first=false;
+
+				if(objects.isEmpty())
+					break;
+			}
+
+			if(not_found)
+				objects.clear();
+		}
+
+		candidates.insert(candidates.end(), objects.begin(), objects.end());
+	}
+
+	return(candidates);
+}
+
+QRegExp ObjectSearchIndex::createSearchRegExp(const QString &pattern, bool case_sensitive, bool is_regexp, bool exact_match)
+{
+	QRegExp regexp;
+
+	regexp.setPattern(pattern);
+	regexp.setCaseSensitivity(case_sensitive ?  Qt::CaseSensitive :  Qt::CaseInsensitive);
+
+	if(is_regexp)
+		regexp.setPatternSyntax(QRegExp::RegExp2);
+	else if(exact_match)
+		regexp.setPatternSyntax(QRegExp::FixedString);
+	else
+		regexp.setPatternSyntax(QRegExp::Wildcard);
+
+	return(regexp);
+}
+
+QString ObjectSearchIndex::getSearchText(BaseObject *object, const QString &search_attr, bool format_obj_names, bool exact_match)
+{
+	QString text;
+
+	if(!object)
+		return(text);
+
+	if(search_attr==ParsersAttributes::COMMENT)
+		text=object->getComment();
+	else if(search_attr==ParsersAttributes::SIGNATURE)
+	{
+		text=object->getSignature(format_obj_names && !exact_match);
+
+		if(format_obj_names && !exact_match)
+			text.remove('"');
+	}
+	//Quotes are removed from the name by default
+	else if(format_obj_names && !exact_match)
+	{
+		TableObject *tab_obj=dynamic_cast<TableObject *>(object);
+
+		if(tab_obj && tab_obj->getParentTable())
+			text=tab_obj->getParentTable()->getName(true);
+
+		text+=object->getName(true, true);
+		text.remove('"');
+	}
+	else
+		text=object->getName();
+
+	return(text);
+}
+
+bool ObjectSearchIndex::matchesObject(BaseObject *object, const QString &pattern, QRegExp &regexp, const QString &search_attr,
+																			bool format_obj_names, bool exact_match)
+{
+	QString text=getSearchText(object, search_attr, format_obj_names, exact_match);
+
+	return((exact_match && pattern==text) ||
+				 (exact_match && regexp.exactMatch(text)) ||
+				 (!exact_match && regexp.indexIn(text) >= 0));
+}
@@ -0,0 +1,147 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler
+\class ObjectSearchIndex
+\brief Implements an inverted trigram index over the names, signatures and comments of all objects of a
+database model. The index is used to reduce the set of objects that need to be matched against a search
+pattern so the final (and expensive) regexp matching is done only over a small group of candidates.
+\note The index holds no ownership over the objects. The owner of the index must notify the objects added, removed and
+renamed through addObject(), removeObject() and updateObject() so the index is kept up to date incrementally. The method
+invalidate() forces a full synchronization with the model in the next call to getCandidates().
+*/
+
+#ifndef OBJECT_SEARCH_INDEX_H
+#define OBJECT_SEARCH_INDEX_H
+
+#include "databasemodel.h"
+#include <QHash>
+#include <QSet>
+#include <QRegExp>
+
+class ObjectSearchIndex {
+	private:
+		//! \brief Stores the lowercased texts used to index an object
+		struct IndexEntry {
+			ObjectType obj_type;
+			QString name, comment;
+
+			//! \brief Parent table/view of the object (only for table children)
+			BaseObject *parent;
+		};
+
+		//! \brief Stores the trigrams of names/signatures and comments of all objects of the same type
+		struct TypeIndex {
+			QSet<BaseObject *> objects;
+			QHash<QString, QSet<BaseObject *>> names, comments;
+		};
+
+		//! \brief Reference database model
+		DatabaseModel *db_model;
+
+		//! \brief Indicates that the index must be synchronized with the model before the next query
+		bool invalidated;
+
+		//! \brief Stores the texts used to index each object. Used to remove/update an object without dereferencing it
+		QHash<BaseObject *, IndexEntry> entries;
+
+		map<ObjectType, TypeIndex> type_idxs;
+
+		//! \brief Indexed children of each table/view. Used to drop the children of a table without dereferencing them
+		QHash<BaseObject *, QSet<BaseObject *>> children;
+
+		//! \brief Indexed objects notified via updateObject() which are reindexed in the next query
+		QSet<BaseObject *> changed_objs;
+
+		//! \brief Returns the set of all trigrams of the provided (lowercased) text
+		static QSet<QString> getTrigrams(const QString &text);
+
+		/*! \brief Extracts from the pattern the literal pieces (lowercased) that must appear in any matching text.
+		An empty list means that no prefiltering can be done and all objects are candidates. */
+		static QStringList getRequiredLiterals(const QString &pattern, bool is_regexp, bool exact_match);
+
+		//! \brief Creates the entry (lowercased texts) for the object
+		static IndexEntry createEntry(BaseObject *object);
+
+		//! \brief Stores the entry of the object in the trigram sets
+		void indexEntry(BaseObject *object, const IndexEntry &entry);
+
+		//! \brief Removes the object (using its stored entry) from the trigram sets
+		void unindexEntry(BaseObject *object);
+
+		//! \brief Reindexes the object only if its texts changed since it was indexed
+		void updateEntry(BaseObject *object);
+
+		/*! \brief Reindexes the object and, in case of tables/views, its current children. The children that
+		aren't in the table anymore are dropped */
+		void reindexObject(BaseObject *object);
+
+		//! \brief Returns all the objects of the model which are searchable (the same set handled by DatabaseModel::findObjects)
+		vector<BaseObject *> getModelObjects(void);
+
+		/*! \brief Synchronizes the index with the model. Only the objects which were created, removed or
+		had their name/signature/comment changed since the last synchronization are (re)indexed */
+		void synchronize(void);
+
+	public:
+		//! \brief Trigram length used by the index. Patterns with literals smaller than this will cause full scans
+		static const int TRIGRAM_LEN=3;
+
+		ObjectSearchIndex(void);
+
+		//! \brief Sets the model to be indexed. The previous index is discarded
+		void setModel(DatabaseModel *db_model);
+		DatabaseModel *getModel(void);
+
+		/*! \brief Indexes a single object (and its children in case of tables/views). Intended to be connected
+		to DatabaseModel::s_objectAdded */
+		void addObject(BaseObject *object);
+
+		/*! \brief Removes a single object from the index. Intended to be connected to DatabaseModel::s_objectRemoved.
+		Children of tables/views are dropped too without dereferencing the removed objects */
+		void removeObject(BaseObject *object);
+
+		/*! \brief Schedules the reindexing of an object (and its children in case of tables/views) for the next query.
+		Intended to be connected to DatabaseModel::s_objectRenamed. Objects not indexed are ignored */
+		void updateObject(BaseObject *object);
+
+		//! \brief Marks the index as outdated forcing a synchronization in the next query
+		void invalidate(void);
+
+		//! \brief Discards the whole index
+		void clear(void);
+
+		/*! \brief Returns the objects of the provided types that may match the pattern. The returned list is a superset of the
+		objects that really match and must be filtered through matchesObject(). The search_attr is one of ParsersAttributes::NAME,
+		ParsersAttributes::SIGNATURE or ParsersAttributes::COMMENT */
+		vector<BaseObject *> getCandidates(const QString &pattern, const vector<ObjectType> &types, const QString &search_attr,
+																			 bool is_regexp, bool exact_match);
+
+		//! \brief Creates the regexp used to match the objects in the same way DatabaseModel::findObjects does
+		static QRegExp createSearchRegExp(const QString &pattern, bool case_sensitive, bool is_regexp, bool exact_match);
+
+		//! \brief Returns the text of the object that is matched against the search pattern
+		static QString getSearchText(BaseObject *object, const QString &search_attr, bool format_obj_names, bool exact_match);
+
+		//! \brief Returns if the object matches the pattern using the regexp created by createSearchRegExp()
+		static bool matchesObject(BaseObject *object, const QString &pattern, QRegExp &regexp, const QString &search_attr,
+															bool format_obj_names, bool exact_match);
+};
+
+#endif
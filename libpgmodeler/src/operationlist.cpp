@@ -574,6 +574,10 @@ void OperationList::undoOperation(void)
 		//if(!this->signalsBlocked())
 		chain_size=getChainSize();
 
+		//Chained operations are executed in a model batch so the relationships are validated only once
+		if(chain_size > 0)
+			model->startBatch();
+
 		do
 		{
 			/* In the undo operation, it is necessary to obtain the object
@@ -616,6 +620,22 @@ void OperationList::undoOperation(void)
 		while(!ignore_chain && isUndoAvailable() &&
 			  operation->getChainType()!=Operation::NO_CHAIN);
 
+		if(chain_size > 0)
+		{
+			try
+			{
+				model->finishBatch();
+			}
+			catch(Exception &e)
+			{
+				if(error.getErrorType()==ERR_CUSTOM)
+				{
+					this->removeOperations();
+					error=e;
+				}
+			}
+		}
+
 		if(error.getErrorType()!=ERR_CUSTOM)
 			throw Exception(ERR_UNDO_REDO_OPR_INV_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__, &error);
 	}
@@ -632,6 +652,9 @@ void OperationList::redoOperation(void)
 
 		chain_size=getChainSize();
 
+		if(chain_size > 0)
+			model->startBatch();
+
 		do
 		{
 			//Gets the current operation
@@ -671,6 +694,22 @@ void OperationList::redoOperation(void)
 		while(!ignore_chain && isRedoAvailable() &&
 			  operation->getChainType()!=Operation::NO_CHAIN);
 
+		if(chain_size > 0)
+		{
+			try
+			{
+				model->finishBatch();
+			}
+			catch(Exception &e)
+			{
+				if(error.getErrorType()==ERR_CUSTOM)
+				{
+					this->removeOperations();
+					error=e;
+				}
+			}
+		}
+
 		if(error.getErrorType()!=ERR_CUSTOM)
 			throw Exception(ERR_UNDO_REDO_OPR_INV_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__, &error);
 	}
@@ -921,6 +960,13 @@ void OperationList::executeOperation(Operation *oper, bool redo)
 					dynamic_cast<Column *>(obj)->getParentTable()->setModified(true);
 			}
 		}
+
+		/* Restoring, inserting or removing a table child changes the names of the table's children and restoring
+		a modified object may revert its name, schema or comment, so the model's listeners are notified */
+		if(parent_tab)
+			model->notifyObjectRenamed(parent_tab);
+		else if(op_type==Operation::OBJECT_MODIFIED || op_type==Operation::OBJECT_MOVED)
+			model->notifyObjectRenamed(object);
 	}
 }
 
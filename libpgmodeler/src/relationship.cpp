@@ -69,6 +69,17 @@ Relationship::Relationship(unsigned rel_type, Table *src_tab,
 							.arg(dst_tab->getName(true))
 							.arg(src_tab->getCopyTable()->getName(true)),
 							ERR_COPY_REL_TAB_DEFINED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		else if(rel_type==RELATIONSHIP_PART && !dst_tab->isPartitioned())
+			throw Exception(Exception::getErrorMessage(ERR_PARTITIONING_REL_NO_PART_TABLE)
+							.arg(src_tab->getName(true))
+							.arg(dst_tab->getName(true)),
+							ERR_PARTITIONING_REL_NO_PART_TABLE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		else if(rel_type==RELATIONSHIP_PART && src_tab->getPartitionedTable() && src_tab->getPartitionedTable()!=dst_tab)
+			throw Exception(Exception::getErrorMessage(ERR_PARTITION_TAB_DEFINED)
+							.arg(src_tab->getName(true))
+							.arg(dst_tab->getName(true))
+							.arg(src_tab->getPartitionedTable()->getName(true)),
+							ERR_PARTITION_TAB_DEFINED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 		copy_options=copy_op;
 		table_relnn=nullptr;
@@ -89,6 +100,8 @@ Relationship::Relationship(unsigned rel_type, Table *src_tab,
 			str_aux=QApplication::translate("Relationship","many_%1_has_many_%2","");
 		else if(rel_type==RELATIONSHIP_GEN)
 			str_aux=QApplication::translate("Relationship","%1_inherits_%2","");
+		else if(rel_type==RELATIONSHIP_PART)
+			str_aux=QApplication::translate("Relationship","%1_is_partition_of_%2","");
 		else
 			str_aux=QApplication::translate("Relationship","%1_copies_%2","");
 
@@ -121,7 +134,7 @@ Relationship::Relationship(unsigned rel_type, Table *src_tab,
 			setNamePattern(DST_COL_PATTERN, SRC_COL_TOKEN + SUFFIX_SEPARATOR + DST_TAB_TOKEN);
 			setNamePattern(PK_COL_PATTERN, QString("id"));
 		}
-		else if(rel_type==RELATIONSHIP_DEP || rel_type==RELATIONSHIP_GEN)
+		else if(rel_type==RELATIONSHIP_DEP || rel_type==RELATIONSHIP_GEN || rel_type==RELATIONSHIP_PART)
 			setNamePattern(PK_PATTERN, DST_TAB_TOKEN + SUFFIX_SEPARATOR + QString("pk"));
 		else
 		{
@@ -230,7 +243,8 @@ void Relationship::setIdentifier(bool value)
 			(src_table==dst_table ||
 			 (rel_type==RELATIONSHIP_NN ||
 			  rel_type==RELATIONSHIP_GEN ||
-			  rel_type==RELATIONSHIP_DEP)))
+			  rel_type==RELATIONSHIP_DEP ||
+			  rel_type==RELATIONSHIP_PART)))
 		throw Exception(ERR_INV_IDENT_RELATIOSHIP,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	identifier=value;
@@ -274,8 +288,9 @@ void Relationship::createSpecialPrimaryKey(void)
 		pk_special->setProtected(true);
 		pk_special->setTablespace(dynamic_cast<Tablespace *>(getReceiverTable()->getTablespace()));
 
-		//For generalization relationships generates the primary key in form of ALTER command
-		pk_special->setDeclaredInTable(this->getRelationshipType()!=RELATIONSHIP_GEN);
+		//For generalization and partitioning relationships generates the primary key in form of ALTER command
+		pk_special->setDeclaredInTable(this->getRelationshipType()!=RELATIONSHIP_GEN &&
+																	 this->getRelationshipType()!=RELATIONSHIP_PART);
 
 		gen_cols=gen_columns;
 		for(auto &attrib : rel_attributes)
@@ -395,25 +410,43 @@ int Relationship::getObjectIndex(TableObject *object)
 
 bool Relationship::isColumnExists(Column *column)
 {
-	vector<Column *>::iterator itr, itr_end;
-	Column *col_aux=nullptr;
-	bool found=false;
-
 	//Raises an error if the column is not allocated
 	if(!column)
 		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	itr=gen_columns.begin();
-	itr_end=gen_columns.end();
+	//The index is discarded whenever the generated columns are replaced or renamed
+	if(gen_col_names.empty())
+	{
+		for(auto &col : gen_columns)
+			gen_col_names.insert(col->getName(), col);
+	}
+
+	/* Since a column always has the same name of itself, searching by the name covers
+	both the column itself and the ones with the same name */
+	return(gen_col_names.contains(column->getName()));
+}
 
-	while(itr!=itr_end && !found)
+QString Relationship::generateUniqueColumnName(Column *column, Table *recv_tab)
+{
+	QString name=column->getName(), aux_name, id=QString::number(column->getObjectId());
+	unsigned counter=1;
+
+	//Quoted names are compared in their formatted form so the generic method is used instead
+	if(name.contains('"'))
+		return(PgModelerNS::generateUniqueName(column, (*recv_tab->getObjectList(OBJ_COLUMN))));
+
+	if((name.size() + id.size()) > BaseObject::OBJECT_NAME_MAX_LENGTH)
 	{
-		col_aux=(*itr);
-		found=(col_aux==column || col_aux->getName()==column->getName());
-		itr++;
+		name.chop(id.size() + 3);
+		name+=QString("_") + id;
 	}
 
-	return(found);
+	aux_name=name;
+
+	while(recv_tab->getColumn(aux_name))
+		aux_name=QString("%1%2").arg(name).arg(counter++);
+
+	return(aux_name);
 }
 
 void Relationship::addObject(TableObject *tab_obj, int obj_idx)
@@ -424,7 +457,8 @@ void Relationship::addObject(TableObject *tab_obj, int obj_idx)
 	/* Raises an error if the user try to add  manually a special primary key on
 		the relationship and the relationship type is not generalization or copy */
 	if((rel_type==RELATIONSHIP_GEN ||
-		rel_type==RELATIONSHIP_DEP) &&
+		rel_type==RELATIONSHIP_DEP ||
+		rel_type==RELATIONSHIP_PART) &&
 			!(tab_obj->isAddedByRelationship() &&
 			  tab_obj->isProtected() &&
 			  tab_obj->getObjectType()==OBJ_CONSTRAINT))
@@ -812,8 +846,8 @@ void Relationship::addColumnsRelGen(void)
 			*parent_tab=nullptr, *aux_tab=nullptr;
 	Column *src_col=nullptr, *dst_col=nullptr,
 			*column=nullptr, *aux_col=nullptr;
-	unsigned src_count, dst_count,
-			i, i1, i2, id_tab,
+	unsigned dst_count,
+			i, i2, id_tab,
 			idx, tab_count;
 	vector<Column *> columns;
 	ObjectType types[2]={OBJ_TABLE, BASE_TABLE};
@@ -831,8 +865,7 @@ void Relationship::addColumnsRelGen(void)
 		src_tab=dynamic_cast<Table *>(src_table);
 		dst_tab=dynamic_cast<Table *>(dst_table);
 
-		//Gets the column count from participant tables
-		src_count=src_tab->getColumnCount();
+		//Gets the column count from the reference table
 		dst_count=dst_tab->getColumnCount();
 		rejected_col_count=0;
 
@@ -856,100 +889,95 @@ void Relationship::addColumnsRelGen(void)
 			/* This flag indicates that the column name is registered
 			in the other table column (duplication). This situation need
 			to be resolved in order to evict the creation of duplicated column
-			on the receiver table */
-			duplic=false;
+			on the receiver table. The column with the same name is retrieved
+			using the name index of the table instead of comparing all columns */
+			src_col=src_tab->getColumn(dst_col->getName());
+			duplic=(src_col!=nullptr);
 
-			for(i1=0; i1 < src_count && !duplic; i1++)
+			//In case of duplication
+			if(duplic)
 			{
-				//Gets the reference (source) column converting its type
-				src_col=src_tab->getColumn(i1);
+				//Converting the type of the reference (source) column
 				src_type=src_col->getType();
 
 				if(src_type==QString("serial")) src_type=QString("integer");
 				else if(src_type==QString("bigserial")) src_type=QString("bigint");
 				else if(dst_type==QString("smallserial")) dst_type=QString("smallint");
 
-				//Check the duplication on the column names
-				duplic=(src_col->getName()==dst_col->getName());
+				/* It is necessary to check if the source column (reference) is of the table itself,
+			if it came from a parent table or a table copy. The same verification is the
+			destination column.
 
-				//In case of duplication
-				if(duplic)
+			The duplicity of columns only generates error when the source column is
+			of the table itself and the target column was not from a parent table
+			of the receiver table in the case of a copy relationship.
+
+			If the source column is of the reference table or coming from a
+			copy relationship and the type of the current relationship is
+			inheritance, the only case in which the duplicity generates error is
+			the type incompatibility of the columns involved, otherwise they are merged. */
+				for(id_tab=0; id_tab < 2; id_tab++)
 				{
-					/* It is necessary to check if the source column (reference) is of the table itself,
-				if it came from a parent table or a table copy. The same verification is the
-				destination column.
-
-				The duplicity of columns only generates error when the source column is
-				of the table itself and the target column was not from a parent table
-				of the receiver table in the case of a copy relationship.
-
-				If the source column is of the reference table or coming from a
-				copy relationship and the type of the current relationship is
-				inheritance, the only case in which the duplicity generates error is
-				the type incompatibility of the columns involved, otherwise they are merged. */
-					for(id_tab=0; id_tab < 2; id_tab++)
+					if(id_tab==0)
 					{
-						if(id_tab==0)
-						{
-							aux_col=src_col;
-							aux_tab=src_tab;
-						}
-						else
-						{
-							aux_col=dst_col;
-							aux_tab=dst_tab;
-						}
+						aux_col=src_col;
+						aux_tab=src_tab;
+					}
+					else
+					{
+						aux_col=dst_col;
+						aux_tab=dst_tab;
+					}
 
-						for(i2=0; i2 < 2; i2++)
+					for(i2=0; i2 < 2; i2++)
+					{
+						//Checking if the column came from a generalization relationship
+						if(types[i2]==OBJ_TABLE)
 						{
-							//Checking if the column came from a generalization relationship
-							if(types[i2]==OBJ_TABLE)
+							tab_count=aux_tab->getObjectCount(OBJ_TABLE);
+							for(idx=0; idx < tab_count; idx++)
 							{
-								tab_count=aux_tab->getObjectCount(OBJ_TABLE);
-								for(idx=0; idx < tab_count; idx++)
-								{
-									parent_tab=dynamic_cast<Table *>(aux_tab->getObject(idx, OBJ_TABLE));
-									cond=(aux_col->getParentTable()==parent_tab &&
-										  aux_col->isAddedByGeneralization());
-								}
-
-							}
-							//Checking if the column came from a copy relationship
-							else
-							{
-								parent_tab=aux_tab->getCopyTable();
-								cond=(parent_tab &&
-									  aux_col->getParentTable()==parent_tab &&
+								parent_tab=dynamic_cast<Table *>(aux_tab->getObject(idx, OBJ_TABLE));
+								cond=(aux_col->getParentTable()==parent_tab &&
 									  aux_col->isAddedByGeneralization());
 							}
 
-							if(id_tab==0)
-								src_flags[i2]=cond;
-							else
-								dst_flags[i2]=cond;
 						}
+						//Checking if the column came from a copy relationship
+						else
+						{
+							parent_tab=aux_tab->getCopyTable();
+							cond=(parent_tab &&
+								  aux_col->getParentTable()==parent_tab &&
+								  aux_col->isAddedByGeneralization());
+						}
+
+						if(id_tab==0)
+							src_flags[i2]=cond;
+						else
+							dst_flags[i2]=cond;
 					}
+				}
 
-					/* Error condition 1: The relationship type is dependency and the source
-				column is from the table itself or it came from a copy table and the
-				destination column is from the destination table or came from a copy table
-				of the destination table itself */
-					if(rel_type==RELATIONSHIP_DEP &&
+				/* Error condition 1: The relationship type is dependency and the source
+			column is from the table itself or it came from a copy table and the
+			destination column is from the destination table or came from a copy table
+			of the destination table itself */
+				if(rel_type==RELATIONSHIP_DEP &&
 
-							((!src_flags[0] && !src_flags[1]) ||
-							 (!src_flags[0] &&  src_flags[1])) &&
+						((!src_flags[0] && !src_flags[1]) ||
+						 (!src_flags[0] &&  src_flags[1])) &&
 
-							((!dst_flags[0] && !dst_flags[1]) ||
-							 (!dst_flags[0] &&  dst_flags[1])))
-					{
-						err_type=ERR_DUPLIC_COLS_COPY_REL;
-					}
-					/* Error condition 2: The relationship type is generalization and the column
-				types is incompatible */
-					else if(rel_type==RELATIONSHIP_GEN &&
-							src_type!=dst_type)
-						err_type=ERR_INCOMP_COLS_INHERIT_REL;
+						((!dst_flags[0] && !dst_flags[1]) ||
+						 (!dst_flags[0] &&  dst_flags[1])))
+				{
+					err_type=ERR_DUPLIC_COLS_COPY_REL;
 				}
+				/* Error condition 2: The relationship type is generalization (or partitioning) and the column
+			types is incompatible */
+				else if((rel_type==RELATIONSHIP_GEN || rel_type==RELATIONSHIP_PART) &&
+						src_type!=dst_type)
+					err_type=ERR_INCOMP_COLS_INHERIT_REL;
 			}
 
 			//In case that no error was detected (ERR_CUSTOM)
@@ -963,7 +991,8 @@ void Relationship::addColumnsRelGen(void)
 
 					(*column)=(*dst_col);
 
-					if(rel_type==RELATIONSHIP_GEN)
+					//Partitions receive the columns of the partitioned table in the same way as inheritance
+					if(rel_type==RELATIONSHIP_GEN || rel_type==RELATIONSHIP_PART)
 					{
 						column->setAddedByGeneralization(true);
 					}
@@ -1003,6 +1032,7 @@ void Relationship::addColumnsRelGen(void)
 			relationship columns will also be inserted directly in the
 			source table, which inherits or copy table columns from target table */
 			gen_columns=columns;
+			gen_col_names.clear();
 			itr=gen_columns.begin();
 			itr_end=gen_columns.end();
 			while(itr!=itr_end)
@@ -1124,6 +1154,14 @@ void Relationship::connectRelationship(void)
 				getReceiverTable()->setCopyTable(dynamic_cast<Table *>(getReferenceTable()));
 				getReceiverTable()->setCopyTableOptions(this->copy_options);
 			}
+			else if(rel_type==RELATIONSHIP_PART)
+			{
+				//Creates the columns on the receiver table following the rules for generalization
+				addColumnsRelGen();
+
+				//The receiver table is attached as a partition of the reference table
+				getReceiverTable()->setPartitionedTable(dynamic_cast<Table *>(getReferenceTable()));
+			}
 			else if(rel_type==RELATIONSHIP_11 ||
 					rel_type==RELATIONSHIP_1N)
 			{
@@ -1426,7 +1464,7 @@ void Relationship::addAttributes(Table *recv_tab)
 			if(column->getParentTable())
 				break;
 
-			column->setName(PgModelerNS::generateUniqueName(column, (*recv_tab->getObjectList(OBJ_COLUMN))));
+			column->setName(generateUniqueColumnName(column, recv_tab));
 			column->setAddedByLinking(true);
 			column->setParentRelationship(this);
 			recv_tab->addColumn(column);
@@ -1476,6 +1514,7 @@ void Relationship::copyColumns(Table *ref_tab, Table *recv_tab, bool not_null, b
 		{
 			column=new Column;
 			gen_columns.push_back(column);
+			gen_col_names.clear();
 
 			//Add the current primary key source column on the list
 			column_aux=pk->getColumn(i, Constraint::SOURCE_COLS);
@@ -1525,7 +1564,7 @@ void Relationship::copyColumns(Table *ref_tab, Table *recv_tab, bool not_null, b
 				column->setType(PgSQLType(QString("smallint")));
 
 			column->setName(name);
-			name=PgModelerNS::generateUniqueName(column, (*recv_tab->getObjectList(OBJ_COLUMN)));
+			name=generateUniqueColumnName(column, recv_tab);
 			column->setName(name);
 
 			if(!prev_name.isEmpty())
@@ -1534,6 +1573,9 @@ void Relationship::copyColumns(Table *ref_tab, Table *recv_tab, bool not_null, b
 				column->setName(name);
 			}
 
+			//The generated column was renamed so its name index is discarded
+			gen_col_names.clear();
+
 			/* If the old name given to the column is different from the current name, the current name
 			of the column will be the old name when the relationship is disconnected and
 			reconnected again, so the column name history is not lost even when the columns
@@ -1555,6 +1597,7 @@ void Relationship::copyColumns(Table *ref_tab, Table *recv_tab, bool not_null, b
 			gen_columns.pop_back();
 		}
 
+		gen_col_names.clear();
 		prev_ref_col_names.clear();
 		pk_columns.clear();
 		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
@@ -1798,6 +1841,7 @@ void Relationship::addColumnsRelNn(void)
 		//For single pk column mode the generated column is added at the end of gen_columns vector
 		if(pk_col)
 			gen_columns.push_back(pk_col);
+			gen_col_names.clear();
 	}
 	catch(Exception &e)
 	{
@@ -1859,10 +1903,11 @@ Table *Relationship::getReceiverTable(void)
 		the columns are always included in the destination table */
 	else if(rel_type==RELATIONSHIP_1N)
 		return(dynamic_cast<Table *>(dst_table));
-	/* For generalization / copy relationships the columns are always added
+	/* For generalization / copy / partitioning relationships the columns are always added
 		in the source table */
 	else if(rel_type==RELATIONSHIP_GEN ||
-			rel_type==RELATIONSHIP_DEP)
+			rel_type==RELATIONSHIP_DEP ||
+			rel_type==RELATIONSHIP_PART)
 		return(dynamic_cast<Table *>(src_table));
 	//For n-n relationships, the columns are added in the table that represents the relationship (table_relnn)
 	else
@@ -1999,7 +2044,7 @@ void Relationship::disconnectRelationship(bool rem_tab_objs)
 			vector<TableObject *>::iterator itr_atrib, itr_atrib_end;
 			TableObject *tab_obj=nullptr;
 
-			if(rel_type==RELATIONSHIP_GEN || rel_type==RELATIONSHIP_DEP)
+			if(rel_type==RELATIONSHIP_GEN || rel_type==RELATIONSHIP_DEP || rel_type==RELATIONSHIP_PART)
 			{
 				table=getReceiverTable();
 
@@ -2023,6 +2068,8 @@ void Relationship::disconnectRelationship(bool rem_tab_objs)
 						ck_constraints.pop_back();
 					}
 				}
+				else if(rel_type==RELATIONSHIP_PART)
+					table->setPartitionedTable(nullptr);
 				else
 					table->setCopyTable(nullptr);
 			}
@@ -2158,6 +2205,7 @@ void Relationship::disconnectRelationship(bool rem_tab_objs)
 			}
 
 			gen_columns.clear();
+			gen_col_names.clear();
 			pk_columns.clear();
 
 			if(table_relnn)
@@ -2306,10 +2354,10 @@ bool Relationship::isInvalidated(void)
 				}
 			}
 		}
-		/* For copy / generalization relationships,
+		/* For copy / generalization / partitioning relationships,
 		 is obtained the number of columns created when connecting it
 		 and comparing with the number of columns of the source table */
-		else if(rel_type==RELATIONSHIP_DEP || rel_type==RELATIONSHIP_GEN)
+		else if(rel_type==RELATIONSHIP_DEP || rel_type==RELATIONSHIP_GEN || rel_type==RELATIONSHIP_PART)
 		{
 			table=getReferenceTable();
 			table1=getReceiverTable();
@@ -2483,6 +2531,7 @@ QString Relationship::getCodeDefinition(unsigned def_type)
 		attributes[ParsersAttributes::TABLE_NAME]=tab_name_relnn;
 		attributes[ParsersAttributes::RELATIONSHIP_GEN]=(rel_type==RELATIONSHIP_GEN ? ParsersAttributes::_TRUE_ : QString());
 		attributes[ParsersAttributes::RELATIONSHIP_DEP]=(rel_type==RELATIONSHIP_DEP ? ParsersAttributes::_TRUE_ : QString());
+		attributes[ParsersAttributes::RELATIONSHIP_PART]=(rel_type==RELATIONSHIP_PART ? ParsersAttributes::_TRUE_ : QString());
 
 		attributes[ParsersAttributes::SRC_COL_PATTERN]=name_patterns[SRC_COL_PATTERN];
 		attributes[ParsersAttributes::DST_COL_PATTERN]=name_patterns[DST_COL_PATTERN];
@@ -2554,6 +2603,7 @@ void Relationship::operator = (Relationship &rel)
 	this->table_relnn=nullptr;
 	this->fk_rel1n=pk_relident=pk_special=nullptr;
 	this->gen_columns.clear();
+	this->gen_col_names.clear();
 	this->copy_options=rel.copy_options;
 	this->name_patterns=rel.name_patterns;
 	this->upd_action=rel.upd_action;
@@ -2562,19 +2612,37 @@ void Relationship::operator = (Relationship &rel)
 	this->single_pk_column=rel.single_pk_column;
 }
 
-QString Relationship::getInheritDefinition(bool undo_inherit)
+QString Relationship::getAlterRelTableDefinition(bool undo_inh_part)
 {
-	if(rel_type!=RELATIONSHIP_GEN)
+	if(rel_type!=RELATIONSHIP_GEN && rel_type!=RELATIONSHIP_PART)
 		return(QString());
 
-	attributes[ParsersAttributes::INHERIT]=(undo_inherit ? ParsersAttributes::UNSET : ParsersAttributes::_TRUE_);
+	attributes[ParsersAttributes::INHERIT]=QString();
+	attributes[ParsersAttributes::ATTACH_PARTITION]=QString();
+	attributes[ParsersAttributes::PARTITION_BOUND_EXPR]=QString();
+	attributes[ParsersAttributes::DEFAULT_PARTITION]=QString();
 	attributes[ParsersAttributes::TABLE]=getReceiverTable()->getName(true);
 	attributes[ParsersAttributes::ANCESTOR_TABLE]=getReferenceTable()->getName(true);
 
+	if(rel_type==RELATIONSHIP_GEN)
+		attributes[ParsersAttributes::INHERIT]=(undo_inh_part ? ParsersAttributes::UNSET : ParsersAttributes::_TRUE_);
+	else
+	{
+		Table *recv_tab=getReceiverTable();
+
+		if(!undo_inh_part && !recv_tab->isDefaultPartition() && recv_tab->getPartitionBoundingExpr().trimmed().isEmpty())
+			throw Exception(Exception::getErrorMessage(ERR_PARTITION_NO_BOUND_EXPR)
+											.arg(recv_tab->getName(true)).arg(getReferenceTable()->getName(true)),
+											ERR_PARTITION_NO_BOUND_EXPR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		attributes[ParsersAttributes::ATTACH_PARTITION]=(undo_inh_part ? ParsersAttributes::UNSET : ParsersAttributes::_TRUE_);
+		attributes[ParsersAttributes::PARTITION_BOUND_EXPR]=getReceiverTable()->getPartitionBoundingExpr();
+		attributes[ParsersAttributes::DEFAULT_PARTITION]=(getReceiverTable()->isDefaultPartition() ? ParsersAttributes::_TRUE_ : QString());
+	}
+
 	return(BaseObject::getAlterDefinition(this->getSchemaName(), attributes));
 }
 
-
 bool Relationship::isReferenceTableMandatory(void)
 {
 	if(rel_type == BaseRelationship::RELATIONSHIP_11 && getReferenceTable() == dst_table && !src_mandatory)
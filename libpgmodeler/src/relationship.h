@@ -206,9 +206,18 @@ class Relationship: public BaseRelationship {
 		src_tab_prev_name,
 		dst_tab_prev_name;
 
+		/*! \brief Stores the generated columns indexed by name (see isColumnExists()). The index is created on the
+		first search and discarded whenever a generated column is added, renamed or the generated columns are replaced */
+		QHash<QString, Column *> gen_col_names;
+
 		//! \brief Indicates if the column exists on the referenced column list
 		bool isColumnExists(Column *column);
 
+		/*! \brief Returns a name for the column that doesn't conflict with the columns of the receiver table.
+		This method follows the same rules of PgModelerNS::generateUniqueName() but the conflicts are checked
+		using the name index of the table instead of scanning the column list for each candidate name */
+		QString generateUniqueColumnName(Column *column, Table *recv_tab);
+
 		//! \brief Executes the column addition for 1-1 relationship
 		void addColumnsRel11(void);
 
@@ -482,7 +491,10 @@ class Relationship: public BaseRelationship {
 		//! \brief Copies the attributes from one relationship to another
 		void operator = (Relationship &rel);
 
-		QString getInheritDefinition(bool undo_inherit);
+		/*! \brief Returns the ALTER TABLE command that (un)sets the inheritance between the tables of generalization
+		relationships or that attaches/detaches the partition in partitioning relationships. For other relationship
+		types an empty string is returned */
+		QString getAlterRelTableDefinition(bool undo_inh_part);
 
 		//! \brief Returns true when the reference table is mandatory in the relationship
 		bool isReferenceTableMandatory(void);
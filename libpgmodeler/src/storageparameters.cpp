@@ -0,0 +1,204 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "storageparameters.h"
+
+StorageParameters::StorageParameters(void)
+{
+	obj_type=OBJ_TABLE;
+}
+
+StorageParameters::StorageParameters(ObjectType obj_type)
+{
+	if(obj_type!=OBJ_TABLE && obj_type!=OBJ_INDEX && obj_type!=OBJ_COLUMN)
+		throw Exception(ERR_OPR_OBJ_INV_TYPE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	this->obj_type=obj_type;
+}
+
+QStringList StorageParameters::getSupportedParameters(ObjectType obj_type)
+{
+	static QStringList autovac_params={
+		QString("autovacuum_enabled"), QString("autovacuum_vacuum_threshold"), QString("autovacuum_vacuum_scale_factor"),
+		QString("autovacuum_vacuum_cost_delay"), QString("autovacuum_vacuum_cost_limit"),
+		QString("autovacuum_freeze_min_age"), QString("autovacuum_freeze_max_age"), QString("autovacuum_freeze_table_age"),
+		QString("autovacuum_multixact_freeze_min_age"), QString("autovacuum_multixact_freeze_max_age"),
+		QString("autovacuum_multixact_freeze_table_age"), QString("log_autovacuum_min_duration") };
+	static QStringList table_params, index_params, column_params;
+
+	if(table_params.isEmpty())
+	{
+		table_params.append({ QString("fillfactor"), QString("parallel_workers"), QString("toast_tuple_target"),
+													QString("user_catalog_table"), QString("autovacuum_analyze_threshold"),
+													QString("autovacuum_analyze_scale_factor") });
+		table_params.append(autovac_params);
+
+		//The TOAST table of the relation accepts the same autovacuum parameters except the analyze related ones
+		for(auto &param : autovac_params)
+			table_params.append(QString("toast.") + param);
+
+		table_params.sort();
+
+		/* The fill factor, fast update and buffering of indexes are handled by the Index class itself
+		so only the remaining access method specific parameters are listed here */
+		index_params={ QString("autosummarize"), QString("deduplicate_items"), QString("gin_pending_list_limit"),
+									 QString("pages_per_range"), QString("vacuum_cleanup_index_scale_factor") };
+
+		column_params={ QString("n_distinct"), QString("n_distinct_inherited") };
+	}
+
+	if(obj_type==OBJ_TABLE)
+		return(table_params);
+	else if(obj_type==OBJ_INDEX)
+		return(index_params);
+	else if(obj_type==OBJ_COLUMN)
+		return(column_params);
+
+	return(QStringList());
+}
+
+bool StorageParameters::isValidValue(const QString &value)
+{
+	return(QRegExp(QString("^[+-]?[a-zA-Z0-9_.]+$")).exactMatch(value));
+}
+
+ObjectType StorageParameters::getObjectType(void)
+{
+	return(obj_type);
+}
+
+bool StorageParameters::isParameterSupported(const QString &name)
+{
+	return(getSupportedParameters(obj_type).contains(name));
+}
+
+void StorageParameters::setParameter(const QString &name, const QString &value)
+{
+	QString param=name.trimmed().toLower(), val=value.trimmed();
+
+	if(!isParameterSupported(param))
+		throw Exception(Exception::getErrorMessage(ERR_ASG_INV_STORAGE_PARAM)
+										.arg(name).arg(BaseObject::getTypeName(obj_type)),
+										ERR_ASG_INV_STORAGE_PARAM,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	if(val.isEmpty())
+		params.erase(param);
+	else
+	{
+		if(!isValidValue(val))
+			throw Exception(Exception::getErrorMessage(ERR_ASG_INV_STORAGE_PARAM_VALUE).arg(value).arg(param),
+											ERR_ASG_INV_STORAGE_PARAM_VALUE,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		params[param]=val;
+	}
+}
+
+void StorageParameters::setParameters(const QString &params_str)
+{
+	QString str=params_str.trimmed();
+	QStringList param;
+	attribs_map prev_params=params;
+
+	if(str.startsWith('{') && str.endsWith('}'))
+		str=str.mid(1, str.length() - 2);
+
+	params.clear();
+
+	try
+	{
+		for(auto &param_str : str.split(',', QString::SkipEmptyParts))
+		{
+			param=param_str.split('=');
+			setParameter(param.at(0), param.size() > 1 ? param.at(1) : QString());
+		}
+	}
+	catch(Exception &e)
+	{
+		params=prev_params;
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+QString StorageParameters::getParameter(const QString &name)
+{
+	if(params.count(name)==0)
+		return(QString());
+
+	return(params[name]);
+}
+
+bool StorageParameters::hasParameter(const QString &name)
+{
+	return(params.count(name)!=0);
+}
+
+attribs_map StorageParameters::getParameters(void)
+{
+	return(params);
+}
+
+void StorageParameters::removeParameters(void)
+{
+	params.clear();
+}
+
+bool StorageParameters::isEmpty(void)
+{
+	return(params.empty());
+}
+
+QString StorageParameters::getCodeDefinition(unsigned def_type)
+{
+	QStringList list;
+	QString fmt=(def_type==SchemaParser::SQL_DEFINITION ? QString("%1 = %2") : QString("%1=%2"));
+
+	for(auto &itr : params)
+		list.push_back(fmt.arg(itr.first).arg(itr.second));
+
+	return(list.join(def_type==SchemaParser::SQL_DEFINITION ? QString(", ") : QString(",")));
+}
+
+void StorageParameters::getDifferences(StorageParameters &params, QString &set_params, QString &reset_params)
+{
+	QStringList set_list, reset_list;
+
+	for(auto &itr : params.params)
+	{
+		if(this->getParameter(itr.first)!=itr.second)
+			set_list.push_back(QString("%1 = %2").arg(itr.first).arg(itr.second));
+	}
+
+	for(auto &itr : this->params)
+	{
+		if(!params.hasParameter(itr.first))
+			reset_list.push_back(itr.first);
+	}
+
+	set_params=set_list.join(QString(", "));
+	reset_params=reset_list.join(QString(", "));
+}
+
+bool StorageParameters::operator == (StorageParameters &params)
+{
+	return(this->params==params.params);
+}
+
+bool StorageParameters::operator != (StorageParameters &params)
+{
+	return(this->params!=params.params);
+}
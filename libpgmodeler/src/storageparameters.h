@@ -0,0 +1,80 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler
+\class StorageParameters
+\brief Auxiliary class that holds the storage/planner parameters of tables and indexes (WITH (...) clause)
+and the attribute options of columns (SET (...) clause). The parameters are validated against the ones
+supported by the object type they belong to.
+*/
+
+#ifndef STORAGE_PARAMETERS_H
+#define STORAGE_PARAMETERS_H
+
+#include "baseobject.h"
+
+class StorageParameters {
+	private:
+		//! \brief Type of the object that owns the parameters (OBJ_TABLE, OBJ_INDEX or OBJ_COLUMN)
+		ObjectType obj_type;
+
+		//! \brief Values of the parameters indexed by their names (kept sorted so the generated code is stable)
+		attribs_map params;
+
+	public:
+		StorageParameters(void);
+		StorageParameters(ObjectType obj_type);
+
+		//! \brief Returns the names of the parameters supported by the specified object type
+		static QStringList getSupportedParameters(ObjectType obj_type);
+
+		//! \brief Returns if the value can be assigned to a parameter (a number, a boolean or a single word)
+		static bool isValidValue(const QString &value);
+
+		ObjectType getObjectType(void);
+
+		bool isParameterSupported(const QString &name);
+
+		/*! \brief Defines the value of a parameter. An empty value removes the parameter.
+		Raises an error if the parameter is not supported by the object type or the value is invalid */
+		void setParameter(const QString &name, const QString &value);
+
+		/*! \brief Replaces all parameters by the ones in the string in the form name=value[,name=value...].
+		The string can be enclosed by braces like text arrays returned by the catalog (e.g. pg_class.reloptions) */
+		void setParameters(const QString &params_str);
+
+		QString getParameter(const QString &name);
+		bool hasParameter(const QString &name);
+		attribs_map getParameters(void);
+		void removeParameters(void);
+		bool isEmpty(void);
+
+		/*! \brief Returns the parameters formatted as name = value[, ...] (SQL) or name=value[,...] (XML).
+		An empty string is returned when there are no parameters */
+		QString getCodeDefinition(unsigned def_type);
+
+		/*! \brief Compares the parameters with the provided ones returning in set_params the parameters (in SQL form) which
+		values must be assigned and in reset_params the names of the ones that must be reset to turn the former into the latter */
+		void getDifferences(StorageParameters &params, QString &set_params, QString &reset_params);
+
+		bool operator == (StorageParameters &params);
+		bool operator != (StorageParameters &params);
+};
+
+#endif
@@ -25,7 +25,8 @@ const QString Table::DATA_LINE_BREAK = QString("%1%2").arg("⸣").arg('\n');
 Table::Table(void) : BaseTable()
 {
 	obj_type=OBJ_TABLE;
-	with_oid=gen_alter_cmds=unlogged=rls_enabled=rls_forced=false;
+	with_oid=gen_alter_cmds=unlogged=rls_enabled=rls_forced=default_partition=false;
+	partitioning_type=BaseType::null;
 	attributes[ParsersAttributes::COLUMNS]=QString();
 	attributes[ParsersAttributes::INH_COLUMNS]=QString();
 	attributes[ParsersAttributes::CONSTRAINTS]=QString();
@@ -41,8 +42,16 @@ Table::Table(void) : BaseTable()
 	attributes[ParsersAttributes::INITIAL_DATA]=QString();
 	attributes[ParsersAttributes::RLS_ENABLED]=QString();
 	attributes[ParsersAttributes::RLS_FORCED]=QString();
-
-	copy_table=nullptr;
+	attributes[ParsersAttributes::PARTITIONING]=QString();
+	attributes[ParsersAttributes::OPTIONS]=QString();
+	attributes[ParsersAttributes::RESET_OPTIONS]=QString();
+	attributes[ParsersAttributes::OPTIONS_CMDS]=QString();
+	attributes[ParsersAttributes::PARTITION_KEY]=QString();
+	attributes[ParsersAttributes::PARTITIONED_TABLE]=QString();
+	attributes[ParsersAttributes::PARTITION_BOUND_EXPR]=QString();
+	attributes[ParsersAttributes::DEFAULT_PARTITION]=QString();
+
+	copy_table=partitioned_table=nullptr;
 	this->setName(trUtf8("new_table").toUtf8());
 }
 
@@ -57,6 +66,14 @@ Table::~Table(void)
 	}
 
 	ancestor_tables.clear();
+
+	//Detaching the table from its partitioned table and the partitions from the table
+	setPartitionedTable(nullptr);
+
+	for(auto &part_tab : partition_tables)
+		part_tab->partitioned_table=nullptr;
+
+	partition_tables.clear();
 }
 
 void Table::setName(const QString &name)
@@ -85,6 +102,38 @@ void Table::setUnlogged(bool value)
 	unlogged=value;
 }
 
+void Table::setStorageParameter(const QString &name, const QString &value)
+{
+	try
+	{
+		setCodeInvalidated(storage_params.getParameter(name) != value);
+		storage_params.setParameter(name, value);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void Table::setStorageParameters(const QString &params_str)
+{
+	try
+	{
+		storage_params.setParameters(params_str);
+		setCodeInvalidated(true);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void Table::removeStorageParameters(void)
+{
+	setCodeInvalidated(!storage_params.isEmpty());
+	storage_params.removeParameters();
+}
+
 void Table::setRLSEnabled(bool value)
 {
 	setCodeInvalidated(rls_enabled != value);
@@ -164,6 +213,30 @@ void Table::setAncestorTableAttribute(void)
 	attributes[ParsersAttributes::ANCESTOR_TABLE]=list.join(',');
 }
 
+void Table::setPartitioningAttributes(unsigned def_type)
+{
+	QStringList keys;
+
+	attributes[ParsersAttributes::PARTITIONING]=~partitioning_type;
+	attributes[ParsersAttributes::PARTITION_KEY]=QString();
+	attributes[ParsersAttributes::PARTITIONED_TABLE]=QString();
+	attributes[ParsersAttributes::PARTITION_BOUND_EXPR]=part_bounding_expr;
+	attributes[ParsersAttributes::DEFAULT_PARTITION]=(default_partition ? ParsersAttributes::_TRUE_ : QString());
+
+	for(auto &part_key : partition_keys)
+		keys.push_back(part_key.getCodeDefinition(def_type));
+
+	if(def_type==SchemaParser::SQL_DEFINITION)
+	{
+		attributes[ParsersAttributes::PARTITION_KEY]=keys.join(QString(", "));
+
+		if(partitioned_table)
+			attributes[ParsersAttributes::PARTITIONED_TABLE]=partitioned_table->getName(true);
+	}
+	else
+		attributes[ParsersAttributes::PARTITION_KEY]=keys.join(QString());
+}
+
 void Table::setRelObjectsIndexesAttribute(void)
 {
 	attribs_map aux_attribs;
@@ -194,7 +267,7 @@ void Table::setRelObjectsIndexesAttribute(void)
 
 void Table::setColumnsAttribute(unsigned def_type)
 {
-	QString str_cols, inh_cols;
+	QString str_cols, inh_cols, options_cmds;
 	unsigned i, count;
 
 	count=columns.size();
@@ -208,7 +281,14 @@ void Table::setColumnsAttribute(unsigned def_type)
 			str_cols+=columns[i]->getCodeDefinition(def_type);
 
 			if(def_type==SchemaParser::SQL_DEFINITION)
+			{
 				setCommentAttribute(columns[i]);
+
+				/* Statistics, storage and attribute options can't be declared in the CREATE TABLE so they are
+				configured right after the table creation. Columns created via ALTER TABLE do this by themselves */
+				if(columns[i]->isDeclaredInTable() && !columns[i]->isSQLDisabled())
+					options_cmds+=columns[i]->getStorageDefinition();
+			}
 		}
 		else if(def_type==SchemaParser::SQL_DEFINITION && columns[i]->isAddedByGeneralization() && !gen_alter_cmds)
 		{
@@ -228,6 +308,8 @@ void Table::setColumnsAttribute(unsigned def_type)
 		attributes[ParsersAttributes::INH_COLUMNS]=inh_cols;
 	}
 
+	attributes[ParsersAttributes::OPTIONS_CMDS]=options_cmds;
+
 	attributes[ParsersAttributes::COLUMNS]=str_cols;
 }
 
@@ -420,6 +502,8 @@ void Table::addObject(BaseObject *obj, int obj_idx)
 							obj_list->push_back(tab_obj);
 					}
 
+					addToNameIndex(tab_obj, *obj_list);
+
 					if(obj_type==OBJ_COLUMN || obj_type==OBJ_CONSTRAINT)
 					{
 						updateAlterCmdsStatus();
@@ -574,6 +658,138 @@ CopyOptions Table::getCopyTableOptions(void)
 	return(copy_op);
 }
 
+void Table::setPartitioningType(PartitioningType part_type)
+{
+	if(part_type==PartitioningType::list && partition_keys.size() > 1)
+		throw Exception(Exception::getErrorMessage(ERR_INV_PARTITION_KEY_COUNT).arg(this->getName(true)),
+										ERR_INV_PARTITION_KEY_COUNT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	setCodeInvalidated(partitioning_type != part_type);
+	partitioning_type=part_type;
+
+	if(partitioning_type==BaseType::null)
+		partition_keys.clear();
+}
+
+PartitioningType Table::getPartitioningType(void)
+{
+	return(partitioning_type);
+}
+
+void Table::addPartitionKeys(vector<PartitionKey> &part_keys)
+{
+	Column *col=nullptr;
+
+	if(partitioning_type==PartitioningType::list && part_keys.size() > 1)
+		throw Exception(Exception::getErrorMessage(ERR_INV_PARTITION_KEY_COUNT).arg(this->getName(true)),
+										ERR_INV_PARTITION_KEY_COUNT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	/* Columns added by relationships are destroyed when the relationships are revalidated
+	so the keys can only reference the columns created by the user in the table itself */
+	for(auto &part_key : part_keys)
+	{
+		col=part_key.getColumn();
+
+		if(col && (col->getParentTable()!=this || col->isAddedByRelationship()))
+			throw Exception(Exception::getErrorMessage(ERR_ASG_INV_COLUMN_PARTITION_KEY)
+											.arg(this->getName(true)).arg(col->getName()),
+											ERR_ASG_INV_COLUMN_PARTITION_KEY,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	partition_keys=part_keys;
+	setCodeInvalidated(true);
+}
+
+void Table::removePartitionKeys(void)
+{
+	partition_keys.clear();
+	setCodeInvalidated(true);
+}
+
+vector<PartitionKey> Table::getPartitionKeys(void)
+{
+	return(partition_keys);
+}
+
+bool Table::isPartitionKeyRefColumn(Column *column)
+{
+	if(!column)
+		return(false);
+
+	for(auto &part_key : partition_keys)
+	{
+		if(part_key.getColumn()==column)
+			return(true);
+	}
+
+	return(false);
+}
+
+void Table::setPartitionBoundingExpr(const QString &part_bound_expr)
+{
+	setCodeInvalidated(part_bounding_expr != part_bound_expr);
+	part_bounding_expr=part_bound_expr;
+}
+
+QString Table::getPartitionBoundingExpr(void)
+{
+	return(part_bounding_expr);
+}
+
+void Table::setDefaultPartition(bool value)
+{
+	setCodeInvalidated(default_partition != value);
+	default_partition=value;
+}
+
+bool Table::isDefaultPartition(void)
+{
+	return(default_partition);
+}
+
+void Table::setPartitionedTable(Table *table)
+{
+	if(partitioned_table==table)
+		return;
+
+	if(partitioned_table)
+	{
+		vector<Table *> &parts=partitioned_table->partition_tables;
+		parts.erase(std::remove(parts.begin(), parts.end(), this), parts.end());
+		partitioned_table->setCodeInvalidated(true);
+	}
+
+	partitioned_table=table;
+
+	if(partitioned_table)
+	{
+		partitioned_table->partition_tables.push_back(this);
+		partitioned_table->setCodeInvalidated(true);
+	}
+
+	setCodeInvalidated(true);
+}
+
+Table *Table::getPartitionedTable(void)
+{
+	return(partitioned_table);
+}
+
+vector<Table *> Table::getPartitionTables(void)
+{
+	return(partition_tables);
+}
+
+bool Table::isPartitioned(void)
+{
+	return(partitioning_type!=BaseType::null);
+}
+
+bool Table::isPartition(void)
+{
+	return(partitioned_table!=nullptr);
+}
+
 void Table::removeObject(BaseObject *obj)
 {
 	try
@@ -663,6 +879,11 @@ void Table::removeObject(unsigned obj_idx, ObjectType obj_type)
 			itr=obj_list->begin() + obj_idx;
 			column=dynamic_cast<Column *>(*itr);
 
+			if(isPartitionKeyRefColumn(column))
+				throw Exception(Exception::getErrorMessage(ERR_REM_PARTITION_KEY_COLUMN)
+												.arg(column->getName()).arg(this->getName(true)),
+												ERR_REM_PARTITION_KEY_COLUMN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
 			//Gets the references to the column before the exclusion
 			getColumnReferences(column, refs, true);
 
@@ -682,6 +903,8 @@ void Table::removeObject(unsigned obj_idx, ObjectType obj_type)
 			column->setParentTable(nullptr);
 			columns.erase(itr);
 		}
+
+		invalidateNameIndex(obj_type);
 	}
 
 	setCodeInvalidated(true);
@@ -870,24 +1093,9 @@ int Table::getObjectIndex(BaseObject *obj)
 		return(-1);
 	else
 	{
-		vector<TableObject *> *obj_list = this->getObjectList(obj->getObjectType());
-		vector<TableObject *>::iterator itr, itr_end;
-		bool found=false;
-
-		itr=obj_list->begin();
-		itr_end=obj_list->end();
-
-		while(itr!=itr_end && !found)
-		{
-			found=((tab_obj->getParentTable()==this && (*itr)==tab_obj) ||
-				   (tab_obj->getName()==(*itr)->getName()));
-			if(!found) itr++;
-		}
-
-		if(found)
-			return(itr-obj_list->begin());
-		else
-			return(-1);
+		/* The object is searched by its name since an object in the list always has the same name of the provided one,
+		this way the first object with the same name is returned as done by the former linear search */
+		return(getObjectIndexByName(tab_obj->getName(), obj->getObjectType(), *getObjectList(obj->getObjectType())));
 	}
 }
 
@@ -912,14 +1120,25 @@ BaseObject *Table::getObject(const QString &name, ObjectType obj_type, int &obj_
 		QString aux_name=name;
 
 		obj_list=getObjectList(obj_type);
-		itr=obj_list->begin();
-		itr_end=obj_list->end();
 
-		while(itr!=itr_end)
+		//Unformatted names are searched using the name index of the type
+		if(!format)
 		{
-			found=((*itr)->getName(format)==aux_name);
-			if(!found) itr++;
-			else break;
+			obj_idx=getObjectIndexByName(aux_name, obj_type, *obj_list);
+			found=(obj_idx >= 0);
+			itr=obj_list->begin() + (found ? obj_idx : obj_list->size());
+		}
+		else
+		{
+			itr=obj_list->begin();
+			itr_end=obj_list->end();
+
+			while(itr!=itr_end)
+			{
+				found=((*itr)->getName(format)==aux_name);
+				if(!found) itr++;
+				else break;
+			}
 		}
 
 		if(found)
@@ -1200,6 +1419,16 @@ bool Table::isUnlogged(void)
 	return(unlogged);
 }
 
+QString Table::getStorageParameter(const QString &name)
+{
+	return(storage_params.getParameter(name));
+}
+
+StorageParameters Table::getStorageParameters(void)
+{
+	return(storage_params);
+}
+
 bool Table::isRLSEnabled(void)
 {
 	return(rls_enabled);
@@ -1439,6 +1668,7 @@ QString Table::getCodeDefinition(unsigned def_type)
 	attributes[ParsersAttributes::UNLOGGED]=(unlogged ? ParsersAttributes::_TRUE_ : QString());
 	attributes[ParsersAttributes::RLS_ENABLED]=(rls_enabled ? ParsersAttributes::_TRUE_ : QString());
 	attributes[ParsersAttributes::RLS_FORCED]=(rls_forced ? ParsersAttributes::_TRUE_ : QString());
+	attributes[ParsersAttributes::OPTIONS]=storage_params.getCodeDefinition(def_type);
 	attributes[ParsersAttributes::COPY_TABLE]=QString();
 	attributes[ParsersAttributes::ANCESTOR_TABLE]=QString();
 	attributes[ParsersAttributes::TAG]=QString();
@@ -1452,9 +1682,19 @@ QString Table::getCodeDefinition(unsigned def_type)
 
 	(copy_table ? copy_table->getName(true) : QString());
 
+	if(def_type==SchemaParser::SQL_DEFINITION && isPartitioned() && partition_keys.empty())
+		throw Exception(Exception::getErrorMessage(ERR_PARTITIONED_TAB_NO_KEYS).arg(this->getName(true)),
+										ERR_PARTITIONED_TAB_NO_KEYS,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	if(def_type==SchemaParser::SQL_DEFINITION && partitioned_table && !default_partition && part_bounding_expr.trimmed().isEmpty())
+		throw Exception(Exception::getErrorMessage(ERR_PARTITION_NO_BOUND_EXPR)
+										.arg(this->getName(true)).arg(partitioned_table->getName(true)),
+										ERR_PARTITION_NO_BOUND_EXPR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
 	setColumnsAttribute(def_type);
 	setConstraintsAttribute(def_type);
 	setAncestorTableAttribute();
+	setPartitioningAttributes(def_type);
 
 	if(def_type==SchemaParser::XML_DEFINITION)
 	{
@@ -1478,6 +1718,11 @@ void Table::operator = (Table &tab)
 	this->with_oid=tab.with_oid;
 	this->col_indexes=tab.col_indexes;
 	this->constr_indexes=tab.constr_indexes;
+	this->partitioning_type=tab.partitioning_type;
+	this->partition_keys=tab.partition_keys;
+	this->part_bounding_expr=tab.part_bounding_expr;
+	this->default_partition=tab.default_partition;
+	this->storage_params=tab.storage_params;
 
 	setGenerateAlterCmds(tab.gen_alter_cmds);
 	setProtected(tab.is_protected);
@@ -1679,10 +1924,15 @@ QString Table::getAlterDefinition(BaseObject *object)
 
 	try
 	{
-		QString alter_def;
+		QString alter_def, set_params, reset_params;
 		attribs_map attribs;
 
 		attribs[ParsersAttributes::OIDS]=QString();
+		attribs[ParsersAttributes::OPTIONS]=QString();
+		attribs[ParsersAttributes::RESET_OPTIONS]=QString();
+		attribs[ParsersAttributes::PARTITIONED_TABLE]=QString();
+		attribs[ParsersAttributes::PARTITION_BOUND_EXPR]=QString();
+		attribs[ParsersAttributes::DEFAULT_PARTITION]=QString();
 		attribs[ParsersAttributes::ALTER_CMDS]=BaseObject::getAlterDefinition(object, true);
 
 		if(this->getName()==tab->getName())
@@ -1700,6 +1950,28 @@ QString Table::getAlterDefinition(BaseObject *object)
 
 			if(this->rls_forced!=tab->rls_forced)
 				attribs[ParsersAttributes::RLS_FORCED]=(tab->rls_forced ? ParsersAttributes::_TRUE_ : ParsersAttributes::UNSET);
+
+			//Storage parameters changes are applied in place (SET/RESET) instead of recreating the table
+			storage_params.getDifferences(tab->storage_params, set_params, reset_params);
+			attribs[ParsersAttributes::OPTIONS]=set_params;
+			attribs[ParsersAttributes::RESET_OPTIONS]=reset_params;
+
+			/* The bound of a partition can't be changed in place so the partition is detached and attached again
+			with the new bound. Changes of the partitioned table itself are handled by the partitioning relationships */
+			if(this->partitioned_table && tab->partitioned_table &&
+				 this->partitioned_table->getName(true)==tab->partitioned_table->getName(true) &&
+				 (this->default_partition!=tab->default_partition ||
+					this->part_bounding_expr.simplified()!=tab->part_bounding_expr.simplified()))
+			{
+				if(!tab->default_partition && tab->part_bounding_expr.trimmed().isEmpty())
+					throw Exception(Exception::getErrorMessage(ERR_PARTITION_NO_BOUND_EXPR)
+													.arg(tab->getName(true)).arg(tab->partitioned_table->getName(true)),
+													ERR_PARTITION_NO_BOUND_EXPR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+				attribs[ParsersAttributes::PARTITIONED_TABLE]=tab->partitioned_table->getName(true);
+				attribs[ParsersAttributes::PARTITION_BOUND_EXPR]=tab->part_bounding_expr;
+				attribs[ParsersAttributes::DEFAULT_PARTITION]=(tab->default_partition ? ParsersAttributes::_TRUE_ : QString());
+			}
 		}
 
 		copyAttributes(attribs);
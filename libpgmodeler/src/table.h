@@ -28,6 +28,7 @@
 #include "basegraphicobject.h"
 #include "basetable.h"
 #include "column.h"
+#include "storageparameters.h"
 #include "constraint.h"
 #include "index.h"
 #include "rule.h"
@@ -36,6 +37,7 @@
 #include "role.h"
 #include "policy.h"
 #include "copyoptions.h"
+#include "partitionkey.h"
 #include <QStringList>
 
 class Table: public BaseTable {
@@ -61,6 +63,22 @@ class Table: public BaseTable {
 		//! \brief Specifies the copy table options
 		CopyOptions copy_op;
 
+		//! \brief Partitioning strategy of the table. When null the table is not partitioned
+		PartitioningType partitioning_type;
+
+		//! \brief Columns/expressions used to route the rows of a partitioned table to its partitions
+		vector<PartitionKey> partition_keys;
+
+		//! \brief Specifies the partitioned table in which this table is attached as a partition
+		Table *partitioned_table;
+
+		//! \brief Stores the partitions attached to this table
+		vector<Table *> partition_tables;
+
+		/*! \brief Partition bound (the values after FOR VALUES) used when the table is
+		attached to a partitioned table, e.g. IN ('a','b') or FROM (1) TO (100) */
+		QString part_bounding_expr;
+
 		//! \brief Indicates if the table accepts OIDs
 		bool with_oid,
 
@@ -75,7 +93,13 @@ class Table: public BaseTable {
 		//! \brief Indicates if the row level security is enabled
 		rls_enabled,
 
-		rls_forced;
+		rls_forced,
+
+		//! \brief Indicates if the table is the default partition (FOR VALUES is replaced by DEFAULT)
+		default_partition;
+
+		//! \brief Storage and autovacuum parameters of the table and its TOAST table (WITH clause)
+		StorageParameters storage_params;
 
 		//! \brief Stores the relationship added column / constraints indexes
 		map<QString, unsigned> col_indexes,	constr_indexes;
@@ -89,6 +113,7 @@ class Table: public BaseTable {
 		void setConstraintsAttribute(unsigned def_type);
 		void setCommentAttribute(TableObject *tab_obj);
 		void setAncestorTableAttribute(void);
+		void setPartitioningAttributes(unsigned def_type);
 		void setRelObjectsIndexesAttribute(void);
 
 	protected:
@@ -104,6 +129,10 @@ class Table: public BaseTable {
 		//! \brief Removes an acestor table using its index
 		void removeAncestorTable(unsigned idx);
 
+		/*! \brief Attaches the table as a partition of the specified partitioned table. A null
+		value detaches the table from its current partitioned table. This method is used by partitioning relationships */
+		void setPartitionedTable(Table *table);
+
 		/*! \brief Updates the "decl_in_table" status for columns/constraints
 		indicating if ALTER commands must be generated or not */
 		void updateAlterCmdsStatus(void);
@@ -133,6 +162,15 @@ class Table: public BaseTable {
 		//! \brief Defines if the table is unlogged
 		void setUnlogged(bool value);
 
+		/*! \brief Defines the value of a storage parameter (e.g. fillfactor, autovacuum_enabled, toast.autovacuum_enabled).
+		An empty value removes the parameter */
+		void setStorageParameter(const QString &name, const QString &value);
+
+		//! \brief Replaces the storage parameters by the ones in the string in the form name=value[,name=value...]
+		void setStorageParameters(const QString &params_str);
+
+		void removeStorageParameters(void);
+
 		//! \brief Defines if the row level security on table is enabled
 		void setRLSEnabled(bool value);
 
@@ -187,6 +225,50 @@ class Table: public BaseTable {
 		//! \brief Get the copy table options
 		CopyOptions getCopyTableOptions(void);
 
+		/*! \brief Defines the partitioning type of the table. Assigning BaseType::null turns the table into
+		an ordinary table removing all the partition keys */
+		void setPartitioningType(PartitioningType part_type);
+
+		//! \brief Returns the partitioning type of the table
+		PartitioningType getPartitioningType(void);
+
+		/*! \brief Replaces the partition keys of the table. Columns referenced by the keys must belong to the table
+		and tables partitioned by LIST accept only one key */
+		void addPartitionKeys(vector<PartitionKey> &part_keys);
+
+		//! \brief Removes all the partition keys of the table
+		void removePartitionKeys(void);
+
+		//! \brief Returns the partition keys of the table
+		vector<PartitionKey> getPartitionKeys(void);
+
+		//! \brief Returns if the specified column is referenced by one of the partition keys
+		bool isPartitionKeyRefColumn(Column *column);
+
+		//! \brief Defines the partition bound expression used when the table is a partition
+		void setPartitionBoundingExpr(const QString &part_bound_expr);
+
+		//! \brief Returns the partition bound expression
+		QString getPartitionBoundingExpr(void);
+
+		//! \brief Defines if the table is the default partition of its partitioned table
+		void setDefaultPartition(bool value);
+
+		//! \brief Returns if the table is the default partition of its partitioned table
+		bool isDefaultPartition(void);
+
+		//! \brief Returns the partitioned table in which the table is attached (nullptr if the table is not a partition)
+		Table *getPartitionedTable(void);
+
+		//! \brief Returns the partitions attached to the table
+		vector<Table *> getPartitionTables(void);
+
+		//! \brief Returns if the table is partitioned (has a partitioning type)
+		bool isPartitioned(void);
+
+		//! \brief Returns if the table is attached as a partition of another table
+		bool isPartition(void);
+
 		/*! \brief Gets a column through its name. The boolean parameter is used
 		 to search columns referencing their old names */
 		Column *getColumn(const QString &name, bool ref_old_name=false);
@@ -323,6 +405,9 @@ class Table: public BaseTable {
 		//! \brief Returns if the table is configured as unlogged
 		bool isUnlogged(void);
 
+		QString getStorageParameter(const QString &name);
+		StorageParameters getStorageParameters(void);
+
 		//! \brief Returns if RLS is enabled on the table
 		bool isRLSEnabled(void);
 
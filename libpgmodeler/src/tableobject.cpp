@@ -35,6 +35,14 @@ BaseTable *TableObject::getParentTable(void)
 	return(parent_table);
 }
 
+void TableObject::setName(const QString &name)
+{
+	BaseObject::setName(name);
+
+	if(parent_table)
+		parent_table->invalidateNameIndex(obj_type);
+}
+
 void TableObject::setAddedByLinking(bool value)
 {
 	add_by_linking=value;
@@ -95,12 +103,27 @@ bool TableObject::isTableObject(ObjectType type)
 
 void TableObject::operator = (TableObject &object)
 {
+	BaseTable *prev_table=this->parent_table;
+
 	*(dynamic_cast<BaseObject *>(this))=dynamic_cast<BaseObject &>(object);
 	this->parent_table=object.parent_table;
 	this->add_by_copy=false;
 	this->add_by_generalization=false;
 	this->add_by_linking=false;
 	this->decl_in_table=object.decl_in_table;
+
+	/* The name is copied without calling setName() (e.g. when an operation is undone),
+	so the name indexes of the involved tables need to be discarded here */
+	invalidateNameIndexes(prev_table);
+}
+
+void TableObject::invalidateNameIndexes(BaseTable *prev_table)
+{
+	if(prev_table)
+		prev_table->invalidateNameIndex(obj_type);
+
+	if(parent_table && parent_table!=prev_table)
+		parent_table->invalidateNameIndex(obj_type);
 }
 
 void TableObject::setCodeInvalidated(bool value)
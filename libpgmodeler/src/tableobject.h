@@ -64,6 +64,10 @@ class TableObject: public BaseObject {
 	types of child objects will ignore it */
 		void setDeclaredInTable(bool value);
 
+		/*! \brief Discards the name indexes of the previous parent table and the current one. Used when the object's
+		attributes are copied directly by the assignment operators instead of using setName() */
+		void invalidateNameIndexes(BaseTable *prev_table);
+
 	public:
 		TableObject(void);
 
@@ -73,6 +77,9 @@ class TableObject: public BaseObject {
 		//! \brief Returns the object parent table
 		BaseTable *getParentTable(void);
 
+		//! \brief Defines the object name discarding the name index of the parent table (see BaseTable::invalidateNameIndex())
+		virtual void setName(const QString &name);
+
 		/*! \brief This method is purely virtual to force the derived classes
 	overload this method. This also makes class TableObject
 	not instantiable */
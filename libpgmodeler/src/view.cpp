@@ -652,6 +652,10 @@ int View::getObjectIndex(const QString &name, ObjectType obj_type)
 		vector<TableObject *> *obj_list=getObjectList(obj_type);
 		bool found=false, format=name.contains('"');
 
+		//Unformatted names are searched using the name index of the type
+		if(!format)
+			return(getObjectIndexByName(name, obj_type, *obj_list));
+
 		itr=obj_list->begin();
 		itr_end=obj_list->end();
 
@@ -704,6 +708,7 @@ void View::addObject(BaseObject *obj, int obj_idx)
 			else
 				obj_list->insert(obj_list->begin() + obj_idx, tab_obj);
 
+			addToNameIndex(tab_obj, *obj_list);
 			setCodeInvalidated(true);
 		}
 		catch(Exception &e)
@@ -767,6 +772,7 @@ void View::removeObject(unsigned obj_idx, ObjectType obj_type)
 	itr=obj_list->begin() + obj_idx;
 	(*itr)->setParentTable(nullptr);
 	obj_list->erase(itr);
+	invalidateNameIndex(obj_type);
 	setCodeInvalidated(true);
 }
 
@@ -953,6 +959,8 @@ void View::removeObjects(void)
 		indexes.back()->setParentTable(nullptr);
 		indexes.pop_back();
 	}
+
+	invalidateNameIndex();
 }
 
 void View::operator = (View &view)
@@ -76,6 +76,8 @@ SOURCES += src/mainwindow.cpp \
 	   src/databaseimporthelper.cpp \
 	   src/databaseimportform.cpp \
 	   src/codecompletionwidget.cpp \
+	   src/codecompletionindex.cpp \
+	   src/codecompletionmodel.cpp \
 		 src/swapobjectsidswidget.cpp \
 		 src/sqltoolwidget.cpp \
 		 src/tagwidget.cpp \
@@ -179,6 +181,8 @@ HEADERS += src/mainwindow.h \
 	   src/databaseimporthelper.h \
 	   src/databaseimportform.h \
 	   src/codecompletionwidget.h \
+	   src/codecompletionindex.h \
+	   src/codecompletionmodel.h \
            src/swapobjectsidswidget.h \
            src/sqltoolwidget.h \
            src/tagwidget.h \
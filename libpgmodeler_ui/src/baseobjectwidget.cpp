@@ -812,7 +812,10 @@ void BaseObjectWidget::finishConfiguration(void)
 			{
 				//If the object is a table object and the parent table is specified, adds it to table
 				if(table && TableObject::isTableObject(obj_type))
+				{
 					table->addObject(this->object);
+					model->notifyObjectRenamed(this->object);
+				}
 				//Adding the object on the relationship, if specified
 				else if(relationship && (obj_type==OBJ_COLUMN || obj_type==OBJ_CONSTRAINT))
 					relationship->addObject(dynamic_cast<TableObject *>(this->object));
@@ -830,6 +833,9 @@ void BaseObjectWidget::finishConfiguration(void)
 					this->object->getCodeDefinition(SchemaParser::XML_DEFINITION);
 				else
 					this->object->getCodeDefinition(SchemaParser::SQL_DEFINITION);
+
+				//The edited attributes (e.g. function parameters) may have changed the signature of the object
+				model->notifyObjectRenamed(this->object);
 			}
 
 			model->getObjectReferences(object, ref_objs);
@@ -0,0 +1,371 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "codecompletionindex.h"
+
+CodeCompletionIndex::CodeCompletionIndex(void)
+{
+	db_model=nullptr;
+	invalidated=true;
+}
+
+CodeCompletionIndex::Candidate CodeCompletionIndex::createCandidate(BaseObject *object)
+{
+	Candidate cand;
+	ObjectType obj_type=object->getObjectType();
+
+	//Formatting the object name according to the object type
+	if(obj_type==OBJ_FUNCTION)
+	{
+		Function *func=dynamic_cast<Function *>(object);
+		Parameter param;
+		QStringList params;
+
+		/* The signature is assembled here since Function::createSignature() replaces the one stored in the function.
+		 Like in the stored signature, output only parameters are not listed */
+		for(unsigned i=0; i < func->getParameterCount(); i++)
+		{
+			param=func->getParameter(i);
+
+			if(param.isVariadic())
+				params.push_back(QString("VARIADIC ") + *param.getType());
+			else if(param.isIn() || !param.isOut())
+				params.push_back(QString("%1%2%3").arg(param.isIn() ? QString("IN ") : QString())
+																					.arg(param.isOut() ? QString("OUT ") : QString())
+																					.arg(*param.getType()));
+		}
+
+		cand.text=QString("%1(%2)").arg(func->getName(false, false)).arg(params.join(','));
+	}
+	else if(obj_type==OBJ_OPERATOR)
+		cand.text=dynamic_cast<Operator *>(object)->getSignature(false);
+	else
+		cand.text=object->getName(false, false);
+
+	cand.key=cand.text.toLower();
+	cand.tooltip=BaseObject::getTypeName(obj_type);
+	cand.icon_name=object->getSchemaName();
+	cand.object=object;
+	cand.kind=MODEL_OBJECT;
+
+	return(cand);
+}
+
+void CodeCompletionIndex::sortCandidates(vector<Candidate> &candidates)
+{
+	std::sort(candidates.begin(), candidates.end(), [](const Candidate &cand1, const Candidate &cand2){
+		return(cand1.key < cand2.key || (cand1.key==cand2.key && cand1.text < cand2.text));
+	});
+}
+
+vector<CodeCompletionIndex::Candidate>::const_iterator CodeCompletionIndex::lowerBound(const vector<Candidate> &candidates, const QString &key)
+{
+	return(std::lower_bound(candidates.begin(), candidates.end(), key, [](const Candidate &cand, const QString &key){
+		return(cand.key < key);
+	}));
+}
+
+void CodeCompletionIndex::matchCandidates(const vector<Candidate> &candidates, const QString &prefix, bool exact_match,
+																					vector<pair<unsigned, const Candidate *>> &result)
+{
+	QString key=prefix.toLower();
+	unsigned rank=0;
+
+	//Since the candidates are sorted by key all the ones starting with the prefix are contiguous
+	for(auto itr=lowerBound(candidates, key); itr!=candidates.end() && itr->key.startsWith(key); itr++)
+	{
+		if(itr->key.size()==key.size())
+			rank=0;
+		else if(exact_match)
+			break;
+		else if(itr->text.startsWith(prefix))
+			rank=1;
+		else
+			rank=2;
+
+		result.push_back({ rank, &(*itr) });
+	}
+}
+
+void CodeCompletionIndex::indexRootObjects(void)
+{
+	vector<ObjectType> types=BaseObject::getObjectTypes(false, { OBJ_TEXTBOX, OBJ_RELATIONSHIP, BASE_RELATIONSHIP });
+	vector<BaseObject *> *obj_list=nullptr;
+
+	root_objects.clear();
+	invalidated=false;
+
+	if(!db_model)
+		return;
+
+	for(auto obj_type : types)
+	{
+		if(obj_type==OBJ_DATABASE)
+			root_objects.push_back(createCandidate(db_model));
+		else
+		{
+			obj_list=db_model->getObjectList(obj_type);
+
+			if(!obj_list)
+				continue;
+
+			for(auto object : *obj_list)
+				root_objects.push_back(createCandidate(object));
+		}
+	}
+
+	sortCandidates(root_objects);
+}
+
+const vector<CodeCompletionIndex::Candidate> &CodeCompletionIndex::getChildIndex(BaseObject *parent)
+{
+	if(child_objects.count(parent)==0)
+	{
+		vector<Candidate> &children=child_objects[parent];
+		vector<BaseObject *> objects;
+
+		if(parent->getObjectType()==OBJ_SCHEMA)
+			objects=db_model->getObjects(parent);
+		else
+			objects=dynamic_cast<BaseTable *>(parent)->getObjects();
+
+		children.reserve(objects.size());
+
+		for(auto object : objects)
+			children.push_back(createCandidate(object));
+
+		sortCandidates(children);
+	}
+
+	return(child_objects[parent]);
+}
+
+void CodeCompletionIndex::setModel(DatabaseModel *db_model)
+{
+	this->db_model=db_model;
+	invalidate();
+}
+
+DatabaseModel *CodeCompletionIndex::getModel(void)
+{
+	return(db_model);
+}
+
+void CodeCompletionIndex::setKeywords(const QStringList &keywords, const QString &tooltip)
+{
+	Candidate cand;
+
+	this->keywords.clear();
+	this->keywords.reserve(keywords.size());
+
+	cand.tooltip=tooltip;
+	cand.icon_name=QString("keyword");
+	cand.object=nullptr;
+	cand.kind=KEYWORD;
+
+	for(auto &keyword : keywords)
+	{
+		cand.text=keyword;
+		cand.key=keyword.toLower();
+		this->keywords.push_back(cand);
+	}
+
+	sortCandidates(this->keywords);
+}
+
+bool CodeCompletionIndex::hasKeywords(void)
+{
+	return(!keywords.empty());
+}
+
+void CodeCompletionIndex::addCustomItem(const QString &name, const QString &tooltip, const QPixmap &icon)
+{
+	Candidate cand;
+	vector<Candidate>::const_iterator itr;
+
+	cand.text=name;
+	cand.key=name.toLower();
+	cand.tooltip=tooltip;
+	cand.icon=icon;
+	cand.object=nullptr;
+	cand.kind=CUSTOM_ITEM;
+
+	//Replacing the item with the same name if it already exists
+	for(itr=lowerBound(custom_items, cand.key); itr!=custom_items.end() && itr->key==cand.key; itr++)
+	{
+		if(itr->text==cand.text)
+		{
+			custom_items.erase(itr);
+			break;
+		}
+	}
+
+	custom_items.insert(lowerBound(custom_items, cand.key), cand);
+}
+
+void CodeCompletionIndex::clearCustomItems(void)
+{
+	custom_items.clear();
+}
+
+void CodeCompletionIndex::addObject(BaseObject *object)
+{
+	ObjectType obj_type;
+	Candidate cand;
+
+	//The object will be indexed anyway when the index is recreated
+	if(!object || invalidated)
+		return;
+
+	obj_type=object->getObjectType();
+
+	if(TableObject::isTableObject(obj_type) || obj_type==OBJ_TEXTBOX ||
+		 obj_type==OBJ_RELATIONSHIP || obj_type==BASE_RELATIONSHIP)
+		return;
+
+	cand=createCandidate(object);
+	root_objects.insert(lowerBound(root_objects, cand.key), cand);
+
+	//The schema of the object (if any) has a new child so its index is recreated on demand
+	if(object->getSchema())
+		child_objects.erase(object->getSchema());
+}
+
+void CodeCompletionIndex::updateObject(BaseObject *object)
+{
+	ObjectType obj_type;
+
+	if(!object)
+		return;
+
+	/* Discarding the children indexes of the object itself and the ones that list it, since a renamed table lists
+	its modified children and an object moved to another schema is still listed in the index of the former one */
+	for(auto itr=child_objects.begin(); itr!=child_objects.end();)
+	{
+		if(itr->first==object || itr->first==object->getSchema() ||
+			 std::find_if(itr->second.begin(), itr->second.end(), [object](const Candidate &cand){ return(cand.object==object); })!=itr->second.end())
+			itr=child_objects.erase(itr);
+		else
+			itr++;
+	}
+
+	obj_type=object->getObjectType();
+
+	if(invalidated || TableObject::isTableObject(obj_type) || obj_type==OBJ_TEXTBOX ||
+		 obj_type==OBJ_RELATIONSHIP || obj_type==BASE_RELATIONSHIP)
+		return;
+
+	//The old name is unknown so the candidate is located by the object and reinserted in the position of the new name
+	for(auto itr=root_objects.begin(); itr!=root_objects.end(); itr++)
+	{
+		if(itr->object==object)
+		{
+			root_objects.erase(itr);
+			break;
+		}
+	}
+
+	Candidate cand=createCandidate(object);
+	root_objects.insert(lowerBound(root_objects, cand.key), cand);
+}
+
+void CodeCompletionIndex::invalidate(void)
+{
+	invalidated=true;
+	root_objects.clear();
+	child_objects.clear();
+}
+
+void CodeCompletionIndex::invalidateChildren(BaseObject *parent)
+{
+	child_objects.erase(parent);
+}
+
+vector<const CodeCompletionIndex::Candidate *> CodeCompletionIndex::getCandidates(const QString &prefix, BaseObject *parent, bool exact_match, bool inc_keywords)
+{
+	vector<pair<unsigned, const Candidate *>> matches;
+	vector<const Candidate *> result;
+
+	if(db_model)
+	{
+		if(parent)
+			matchCandidates(getChildIndex(parent), prefix, exact_match, matches);
+		else
+		{
+			if(invalidated)
+				indexRootObjects();
+
+			matchCandidates(root_objects, prefix, exact_match, matches);
+		}
+	}
+
+	if(inc_keywords)
+	{
+		matchCandidates(keywords, prefix, exact_match, matches);
+		matchCandidates(custom_items, prefix, exact_match, matches);
+	}
+
+	std::sort(matches.begin(), matches.end(), [](const pair<unsigned, const Candidate *> &match1, const pair<unsigned, const Candidate *> &match2){
+		const Candidate *cand1=match1.second, *cand2=match2.second;
+		bool custom1=cand1->kind==CUSTOM_ITEM, custom2=cand2->kind==CUSTOM_ITEM;
+
+		//Custom items are always placed at the beginning of the list
+		if(custom1!=custom2)
+			return(custom1);
+
+		if(match1.first!=match2.first)
+			return(match1.first < match2.first);
+
+		if(cand1->key!=cand2->key)
+			return(cand1->key < cand2->key);
+
+		if(cand1->kind!=cand2->kind)
+			return(cand1->kind < cand2->kind);
+
+		return(cand1->text < cand2->text);
+	});
+
+	result.reserve(matches.size());
+
+	for(auto &match : matches)
+		result.push_back(match.second);
+
+	return(result);
+}
+
+vector<BaseObject *> CodeCompletionIndex::findObjects(const QString &name, const vector<ObjectType> &types)
+{
+	vector<pair<unsigned, const Candidate *>> matches;
+	vector<BaseObject *> objects;
+
+	if(!db_model)
+		return(objects);
+
+	if(invalidated)
+		indexRootObjects();
+
+	matchCandidates(root_objects, name, true, matches);
+
+	for(auto &match : matches)
+	{
+		if(std::find(types.begin(), types.end(), match.second->object->getObjectType())!=types.end())
+			objects.push_back(match.second->object);
+	}
+
+	return(objects);
+}
@@ -0,0 +1,137 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler_ui
+\class CodeCompletionIndex
+\brief Stores the candidates listed by CodeCompletionWidget (custom items/snippets, keywords and model objects) in
+vectors sorted by their lowercased texts so the candidates matching a typed prefix are found through binary search
+instead of matching a regexp against every keyword and object of the model on each keystroke.
+\note The objects are indexed per qualifying level: the root level holds the objects listed when no schema/table is
+selected and the children of schemas and tables are indexed on demand. The index holds no ownership over the objects and
+the pointers returned by getCandidates() are valid only until the next call to a non-const method of this class.
+*/
+
+#ifndef CODE_COMPLETION_INDEX_H
+#define CODE_COMPLETION_INDEX_H
+
+#include "databasemodel.h"
+#include <QPixmap>
+
+class CodeCompletionIndex {
+	public:
+		//! \brief Kinds of candidates. The values also define the order in which equally ranked candidates are listed
+		enum CandidateKind: unsigned {
+			CUSTOM_ITEM,
+			MODEL_OBJECT,
+			KEYWORD
+		};
+
+		struct Candidate {
+			//! \brief Text displayed in the completion list and the lowercased version used as sorting key
+			QString text, key,
+
+			tooltip,
+
+			//! \brief Name of the icon (see PgModelerUiNS::getIconPath) used when no custom icon is set
+			icon_name;
+
+			//! \brief Custom icon (only used by custom items)
+			QPixmap icon;
+
+			//! \brief Object represented by the candidate (null for keywords and custom items)
+			BaseObject *object;
+
+			CandidateKind kind;
+		};
+
+	private:
+		//! \brief Reference database model
+		DatabaseModel *db_model;
+
+		//! \brief Indicates that the root level objects must be reindexed before the next query
+		bool invalidated;
+
+		//! \brief Sorted candidates of each kind
+		vector<Candidate> keywords, custom_items, root_objects;
+
+		//! \brief Sorted children of the schemas and tables/views used as qualifying levels
+		map<BaseObject *, vector<Candidate>> child_objects;
+
+		static Candidate createCandidate(BaseObject *object);
+
+		static void sortCandidates(vector<Candidate> &candidates);
+
+		//! \brief Returns the position of the first candidate which key is not less than the provided one
+		static vector<Candidate>::const_iterator lowerBound(const vector<Candidate> &candidates, const QString &key);
+
+		/*! \brief Appends to the result the candidates which key starts with the (lowercased) prefix or, in case of exact match,
+		is equal to it. Each candidate is paired with its rank (lower values are listed first) */
+		static void matchCandidates(const vector<Candidate> &candidates, const QString &prefix, bool exact_match,
+																vector<pair<unsigned, const Candidate *>> &result);
+
+		//! \brief Indexes the objects listed in the root level (all objects of the model except table children, textboxes and relationships)
+		void indexRootObjects(void);
+
+		//! \brief Returns the index of the children of the specified schema, table or view creating it if needed
+		const vector<Candidate> &getChildIndex(BaseObject *parent);
+
+	public:
+		CodeCompletionIndex(void);
+
+		/*! \brief Sets the model which objects are indexed. The object indexes are always discarded since the objects may have
+		been renamed or had children added since the last configuration */
+		void setModel(DatabaseModel *db_model);
+		DatabaseModel *getModel(void);
+
+		//! \brief Replaces the indexed keywords. The tooltip is shared by all keywords
+		void setKeywords(const QStringList &keywords, const QString &tooltip);
+
+		//! \brief Returns if there are keywords indexed
+		bool hasKeywords(void);
+
+		//! \brief Indexes a custom item. An item with the same name is replaced
+		void addCustomItem(const QString &name, const QString &tooltip, const QPixmap &icon);
+
+		void clearCustomItems(void);
+
+		/*! \brief Indexes a single object in the root level. Intended to be connected to DatabaseModel::s_objectAdded.
+		Objects not listed in the root level are ignored */
+		void addObject(BaseObject *object);
+
+		/*! \brief Reindexes an object renamed or moved to another schema and discards the children index of it and of the
+		schemas listing it. Intended to be connected to DatabaseModel::s_objectRenamed */
+		void updateObject(BaseObject *object);
+
+		//! \brief Discards the object indexes forcing them to be recreated in the next query
+		void invalidate(void);
+
+		//! \brief Discards the children index of a single schema or table/view forcing it to be recreated in the next query
+		void invalidateChildren(BaseObject *parent);
+
+		/*! \brief Returns the ranked candidates matching the prefix. When parent is null the root level objects are listed,
+		otherwise only the children of the specified schema or table/view. Custom items and keywords are listed only when
+		inc_keywords is true, always before the objects in case of custom items. Candidates which text matches exactly the prefix
+		are listed first followed by the ones starting with it in the same letter case and then the remaining ones, alphabetically */
+		vector<const Candidate *> getCandidates(const QString &prefix, BaseObject *parent, bool exact_match, bool inc_keywords);
+
+		//! \brief Returns the root level objects of the provided types which name is equal to the specified one (case insensitive)
+		vector<BaseObject *> findObjects(const QString &name, const vector<ObjectType> &types);
+};
+
+#endif
@@ -0,0 +1,98 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "codecompletionmodel.h"
+#include "pgmodeleruins.h"
+
+CodeCompletionModel::CodeCompletionModel(const QString &empty_text, QObject *parent) : QAbstractListModel(parent)
+{
+	this->empty_text=empty_text;
+}
+
+int CodeCompletionModel::rowCount(const QModelIndex &) const
+{
+	//When there are no candidates a single disabled item is displayed
+	return(candidates.empty() ? 1 : static_cast<int>(candidates.size()));
+}
+
+QVariant CodeCompletionModel::data(const QModelIndex &index, int role) const
+{
+	const CodeCompletionIndex::Candidate *cand=getCandidate(index.row());
+
+	if(!cand)
+	{
+		if(candidates.empty() && index.row()==0 && role==Qt::DisplayRole)
+			return(empty_text);
+
+		return(QVariant(QVariant::Invalid));
+	}
+
+	if(role==Qt::DisplayRole)
+		return(cand->text);
+
+	if(role==Qt::ToolTipRole)
+		return(cand->tooltip);
+
+	if(role==Qt::DecorationRole)
+	{
+		if(!cand->icon.isNull())
+			return(cand->icon);
+
+		if(!icons.contains(cand->icon_name))
+			icons[cand->icon_name]=QPixmap(PgModelerUiNS::getIconPath(cand->icon_name));
+
+		return(icons[cand->icon_name]);
+	}
+
+	return(QVariant(QVariant::Invalid));
+}
+
+Qt::ItemFlags CodeCompletionModel::flags(const QModelIndex &index) const
+{
+	if(!getCandidate(index.row()))
+		return(Qt::NoItemFlags);
+
+	return(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
+}
+
+void CodeCompletionModel::setCandidates(const vector<const CodeCompletionIndex::Candidate *> &candidates)
+{
+	beginResetModel();
+	this->candidates=candidates;
+	endResetModel();
+}
+
+void CodeCompletionModel::clear(void)
+{
+	beginResetModel();
+	candidates.clear();
+	endResetModel();
+}
+
+const CodeCompletionIndex::Candidate *CodeCompletionModel::getCandidate(int row) const
+{
+	if(row < 0 || row >= static_cast<int>(candidates.size()))
+		return(nullptr);
+
+	return(candidates[row]);
+}
+
+int CodeCompletionModel::getCandidateCount(void) const
+{
+	return(static_cast<int>(candidates.size()));
+}
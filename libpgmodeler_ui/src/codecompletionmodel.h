@@ -0,0 +1,66 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libpgmodeler_ui
+\class CodeCompletionModel
+\brief Implements a list model over the candidates returned by CodeCompletionIndex. Item texts, icons and tooltips
+are produced only when requested by the view so only the visible rows are rendered no matter the amount of candidates.
+\note The model references the candidates stored in the index so it must be cleared (or refilled) before the index changes.
+*/
+
+#ifndef CODE_COMPLETION_MODEL_H
+#define CODE_COMPLETION_MODEL_H
+
+#include <QAbstractListModel>
+#include <QHash>
+#include "codecompletionindex.h"
+
+class CodeCompletionModel: public QAbstractListModel {
+	private:
+		Q_OBJECT
+
+		vector<const CodeCompletionIndex::Candidate *> candidates;
+
+		//! \brief Text of the disabled item displayed when there are no candidates
+		QString empty_text;
+
+		//! \brief Stores the icons already loaded (by name) avoiding to read them again for each rendered row
+		mutable QHash<QString, QPixmap> icons;
+
+	public:
+		CodeCompletionModel(const QString &empty_text, QObject *parent = 0);
+
+		virtual int rowCount(const QModelIndex & = QModelIndex()) const;
+		virtual QVariant data(const QModelIndex &index, int role) const;
+		virtual Qt::ItemFlags flags(const QModelIndex &index) const;
+
+		//! \brief Replaces the listed candidates
+		void setCandidates(const vector<const CodeCompletionIndex::Candidate *> &candidates);
+
+		//! \brief Removes all the listed candidates
+		void clear(void);
+
+		//! \brief Returns the candidate at the specified row or null if the row is invalid
+		const CodeCompletionIndex::Candidate *getCandidate(int row) const;
+
+		//! \brief Returns the amount of listed candidates (the item displayed when the list is empty isn't counted)
+		int getCandidateCount(void) const;
+};
+
+#endif
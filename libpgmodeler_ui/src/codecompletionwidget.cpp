@@ -32,10 +32,17 @@ CodeCompletionWidget::CodeCompletionWidget(QPlainTextEdit *code_field_txt, bool
 	completion_wgt=new QWidget(this);
 	completion_wgt->setWindowFlags(Qt::Popup);
 
-	name_list=new QListWidget(completion_wgt);
+	name_list_mdl=new CodeCompletionModel(trUtf8("(no items found.)"), this);
+
+	name_list=new QListView(completion_wgt);
 	name_list->setSpacing(2);
 	name_list->setIconSize(QSize(16,16));
-	name_list->setSortingEnabled(false);
+
+	//Uniform item sizes avoid the view to query the size of every candidate so only the visible rows are rendered
+	name_list->setUniformItemSizes(true);
+	name_list->setSelectionMode(QAbstractItemView::SingleSelection);
+	name_list->setEditTriggers(QAbstractItemView::NoEditTriggers);
+	name_list->setModel(name_list_mdl);
 
 	persistent_chk=new QCheckBox(completion_wgt);
 	persistent_chk->setText(trUtf8("Make &persistent"));
@@ -57,8 +64,8 @@ CodeCompletionWidget::CodeCompletionWidget(QPlainTextEdit *code_field_txt, bool
 	db_model=nullptr;
 	setQualifyingLevel(nullptr);
 
-	connect(name_list, SIGNAL(itemDoubleClicked(QListWidgetItem*)), this, SLOT(selectItem(void)));
-	connect(name_list, SIGNAL(currentRowChanged(int)), this, SLOT(showItemTooltip(void)));
+	connect(name_list, SIGNAL(doubleClicked(QModelIndex)), this, SLOT(selectItem(void)));
+	connect(name_list->selectionModel(), SIGNAL(currentRowChanged(QModelIndex,QModelIndex)), this, SLOT(showItemTooltip(void)));
 
 	connect(&popup_timer, &QTimer::timeout, [&](){
 		if(qualifying_level < 2)
@@ -85,6 +92,43 @@ void CodeCompletionWidget::handleSelectedWord(QString word)
 	}
 }
 
+void CodeCompletionWidget::handleObjectAddition(BaseObject *object)
+{
+	if(sender()!=db_model)
+		return;
+
+	//The listed candidates reference the index so they are discarded before it changes
+	name_list_mdl->clear();
+
+	//During batches the index is recreated only once in the next query after the batch finishes
+	if(db_model->isBatchRunning())
+		completion_idx.invalidate();
+	else
+		completion_idx.addObject(object);
+}
+
+void CodeCompletionWidget::handleObjectRenaming(BaseObject *object)
+{
+	if(sender()!=db_model)
+		return;
+
+	name_list_mdl->clear();
+
+	if(db_model->isBatchRunning())
+		completion_idx.invalidate();
+	else
+		completion_idx.updateObject(object);
+}
+
+void CodeCompletionWidget::invalidateIndex(void)
+{
+	if(sender()!=db_model)
+		return;
+
+	name_list_mdl->clear();
+	completion_idx.invalidate();
+}
+
 bool CodeCompletionWidget::eventFilter(QObject *object, QEvent *event)
 {
 	QKeyEvent *k_event=dynamic_cast<QKeyEvent *>(event);
@@ -196,27 +240,36 @@ void CodeCompletionWidget::configureCompletion(DatabaseModel *db_model, SyntaxHi
 {
 	map<QString, attribs_map> confs=GeneralConfigWidget::getConfigurationParams();
 
-	name_list->clear();
+	name_list_mdl->clear();
 	word.clear();
 	setQualifyingLevel(nullptr);
 	auto_triggered=false;
 	this->db_model=db_model;
+	completion_idx.setModel(db_model);
+
+	if(db_model)
+	{
+		connect(db_model, SIGNAL(s_objectAdded(BaseObject*)), this, SLOT(handleObjectAddition(BaseObject*)), Qt::UniqueConnection);
+		connect(db_model, SIGNAL(s_objectRenamed(BaseObject*)), this, SLOT(handleObjectRenaming(BaseObject*)), Qt::UniqueConnection);
+		connect(db_model, SIGNAL(s_objectRemoved(BaseObject*)), this, SLOT(invalidateIndex(void)), Qt::UniqueConnection);
+		connect(db_model, SIGNAL(s_batchFinished(unsigned,unsigned)), this, SLOT(invalidateIndex(void)), Qt::UniqueConnection);
+	}
 
 	if(confs[ParsersAttributes::CONFIGURATION][ParsersAttributes::CODE_COMPLETION]==ParsersAttributes::_TRUE_)
 	{
 		code_field_txt->installEventFilter(this);
 		name_list->installEventFilter(this);
 
-		if(syntax_hl && keywords.isEmpty())
+		if(syntax_hl && !completion_idx.hasKeywords())
 		{
 			//Get the keywords from the highlighter
 			vector<QRegExp> exprs=syntax_hl->getExpressions(keywords_grp);
+			QStringList keywords;
 
-			while(!exprs.empty())
-			{
-				keywords.push_front(exprs.back().pattern());
-				exprs.pop_back();
-			}
+			for(auto &expr : exprs)
+				keywords.push_back(expr.pattern());
+
+			completion_idx.setKeywords(keywords, trUtf8("SQL Keyword"));
 
 			completion_trigger=syntax_hl->getCompletionTrigger();
 		}
@@ -242,9 +295,8 @@ void CodeCompletionWidget::insertCustomItem(const QString &name, const QString &
 {
 	if(!name.isEmpty())
 	{
-		QString item_name=name.simplified();
-		custom_items[item_name]=icon;
-		custom_items_tips[item_name]=tooltip;
+		name_list_mdl->clear();
+		completion_idx.addCustomItem(name.simplified(), tooltip, icon);
 	}
 }
 
@@ -264,46 +316,8 @@ void CodeCompletionWidget::insertCustomItems(const QStringList &names, const QSt
 
 void CodeCompletionWidget::clearCustomItems(void)
 {
-	custom_items.clear();
-}
-
-void CodeCompletionWidget::populateNameList(vector<BaseObject *> &objects, QString filter)
-{
-	QListWidgetItem *item=nullptr;
-	QString obj_name;
-	ObjectType obj_type;
-	QRegExp regexp(filter.remove('"') + QString("*"), Qt::CaseInsensitive, QRegExp::Wildcard);
-
-	name_list->clear();
-
-	for(unsigned i=0; i < objects.size(); i++)
-	{
-		obj_type=objects[i]->getObjectType();
-		obj_name.clear();
-
-		//Formatting the object name according to the object type
-		if(obj_type==OBJ_FUNCTION)
-		{
-			dynamic_cast<Function *>(objects[i])->createSignature(false);
-			obj_name=dynamic_cast<Function *>(objects[i])->getSignature();
-		}
-		else if(obj_type==OBJ_OPERATOR)
-			obj_name=dynamic_cast<Operator *>(objects[i])->getSignature(false);
-		else
-			obj_name+=objects[i]->getName(false, false);
-
-		//The object will be inserted if its name matches the filter or there is no filter set
-		if(filter.isEmpty() || regexp.exactMatch(obj_name))
-		{
-			item=new QListWidgetItem(QPixmap(PgModelerUiNS::getIconPath(objects[i]->getSchemaName())), obj_name);
-			item->setToolTip(QString("%1 (%2)").arg(objects[i]->getName(true)).arg(objects[i]->getTypeName()));
-			item->setData(Qt::UserRole, QVariant::fromValue<void *>(objects[i]));
-			item->setToolTip(BaseObject::getTypeName(obj_type));
-			name_list->addItem(item);
-		}
-	}
-
-	name_list->sortItems();
+	name_list_mdl->clear();
+	completion_idx.clearCustomItems();
 }
 
 void CodeCompletionWidget::show(void)
@@ -333,6 +347,14 @@ void CodeCompletionWidget::setQualifyingLevel(BaseObject *obj)
 	}
 	else
 	{
+		/* Entering a level with a different object recreates its children index since children may have
+		been added or renamed (e.g. columns in the table being edited) since the last time it was listed */
+		if(sel_objects[qualifying_level]!=obj && qualifying_level < 2)
+		{
+			name_list_mdl->clear();
+			completion_idx.invalidateChildren(obj);
+		}
+
 		sel_objects[qualifying_level]=obj;
 		lvl_cur=code_field_txt->textCursor();
 	}
@@ -340,14 +362,11 @@ void CodeCompletionWidget::setQualifyingLevel(BaseObject *obj)
 
 void CodeCompletionWidget::updateList(void)
 {
-	QListWidgetItem *item=nullptr;
-	QString pattern;
-	QStringList list;
 	vector<BaseObject *> objects;
-	vector<ObjectType> types=BaseObject::getObjectTypes(false, 	{ OBJ_TEXTBOX, OBJ_RELATIONSHIP, BASE_RELATIONSHIP });
+	BaseObject *parent=nullptr;
 	QTextCursor tc;
 
-	name_list->clear();
+	name_list_mdl->clear();
 	word.clear();
 	new_txt_cur=tc=code_field_txt->textCursor();
 
@@ -373,7 +392,7 @@ void CodeCompletionWidget::updateList(void)
 			word.remove(completion_trigger);
 			word.remove('"');
 
-			objects=db_model->findObjects(word, { OBJ_SCHEMA, OBJ_TABLE, OBJ_VIEW }, false, false, false, true);
+			objects=completion_idx.findObjects(word, { OBJ_SCHEMA, OBJ_TABLE, OBJ_VIEW });
 
 			if(objects.size()==1)
 				setQualifyingLevel(objects[0]);
@@ -382,109 +401,35 @@ void CodeCompletionWidget::updateList(void)
 		code_field_txt->setTextCursor(prev_txt_cur);
 	}
 
-	if(!word.isEmpty() && !auto_triggered)
-		pattern=QString("(^") + word.simplified() + QString(")");
-	else if(auto_triggered)
-		pattern=word;
-
-	if(db_model)
+	//Negative qualifying level means that user called the completion before a space (empty word) so all the objects are listed
+	if(db_model && qualifying_level >= 0)
 	{
-		//Negative qualifying level means that user called the completion before a space (empty word)
-		if(qualifying_level < 0)
-			//The default behavior for this is to search all the objects on the model
-			objects=db_model->findObjects(pattern, types, false, false, !auto_triggered, auto_triggered);
-		else
-		{
-			QString left_word;
-
-			//Searching objects according to qualifying level.
-			tc=code_field_txt->textCursor();
-			tc.movePosition(QTextCursor::WordLeft, QTextCursor::KeepAnchor);
-
-			/* Retrieving the word at the left in order to compare it to the object's name at the current qualifying level,
-		 if the word does not matches the object then children objects will not be retrieved */
-			if(tc.selectedText().contains('\"'))
-			{
-				tc.movePosition(QTextCursor::WordLeft, QTextCursor::KeepAnchor);
-				left_word=tc.selectedText();
-				left_word.remove('"');
-			}
-			else
-				left_word=tc.selectedText();
-
-			//Level 0 indicates that user selected a schema, so all objects of the schema are retrieved
-			if(qualifying_level==0 /*&& left_word==sel_objects[qualifying_level]->getName()*/)
-				objects=db_model->getObjects(sel_objects[qualifying_level]);
-
-			/* Level 1 indicates that user selected a table or view, so all child objects are retrieved.
-		 If the current level is 1 and the table/view name isn't present then the children will not be listed */
-			else if(qualifying_level==1 /*&& left_word==sel_objects[qualifying_level]->getName()*/)
-				objects=dynamic_cast<BaseTable *>(sel_objects[qualifying_level])->getObjects();
-
-			/* If the current qualifying level and current word does retrieve any object as a fallback
-		 we try to find any object in the model and reset the qualifying level */
-			else
-			{
-				objects=db_model->findObjects(pattern, types, false, false, !auto_triggered, auto_triggered);
-				setQualifyingLevel(nullptr);
-			}
+		/* Level 0 indicates that user selected a schema so its objects are listed. Level 1 indicates that user
+		selected a table or view so its children are listed. */
+		if(qualifying_level < 2)
+			parent=sel_objects[qualifying_level];
 
-			/* If the typed word is equal to the current level object's name clear the order in order
-			to avoid listing the same object */
-			if(qualifying_level >=0 && word==sel_objects[qualifying_level]->getName())
-				word.clear();
-		}
+		/* If the current qualifying level doesn't have children as a fallback
+		we list all the objects in the model and reset the qualifying level */
+		else
+			setQualifyingLevel(nullptr);
 
-		populateNameList(objects, word);
+		/* If the typed word is equal to the current level object's name clear the order in order
+		to avoid listing the same object */
+		if(qualifying_level >=0 && word==sel_objects[qualifying_level]->getName())
+			word.clear();
 	}
 
-	/* List the keywords if the qualifying level is negative or the
-	completion wasn't triggered using the special char */
-	if(qualifying_level < 0 && !auto_triggered)
-	{
-		QRegExp regexp(pattern, Qt::CaseInsensitive);
-
-		list=keywords.filter(regexp);
-		for(int i=0; i < list.size(); i++)
-		{
-			item=new QListWidgetItem(QPixmap(PgModelerUiNS::getIconPath("keyword")), list[i]);
-			item->setToolTip(trUtf8("SQL Keyword"));
-			name_list->addItem(item);
-		}
-
-		name_list->sortItems();
-
-		//If there are custom items, they wiill be placed at the very beggining of the list
-		if(!custom_items.empty())
-		{
-			QStringList list;
-			int row=0;
-			QListWidgetItem *item=nullptr;
-
-			for(auto &itr : custom_items)
-			{
-				if(itr.first.contains(regexp))
-					list.push_back(itr.first);
-			}
-
-			list.sort();
-			for(auto &item_name : list)
-			{
-				item=new QListWidgetItem(custom_items[item_name], item_name);
-				item->setToolTip(custom_items_tips[item_name]);
-				name_list->insertItem(row++, item);
-			}
-		}
-	}
+	/* When triggered by the special char without a qualifying level only the objects with the exact typed name are listed.
+	The keywords and custom items are listed if the qualifying level is negative or the completion wasn't triggered using the special char */
+	name_list_mdl->setCandidates(completion_idx.getCandidates(word.simplified(), parent,
+																													 !parent && auto_triggered,
+																													 qualifying_level < 0 && !auto_triggered));
 
-	if(name_list->count()==0)
-	{
-		name_list->addItem(trUtf8("(no items found.)"));
-		name_list->item(0)->setFlags(Qt::NoItemFlags);
+	if(name_list_mdl->getCandidateCount()==0)
 		QToolTip::hideText();
-	}
 	else
-		name_list->setItemSelected(name_list->item(0), true);
+		name_list->setCurrentIndex(name_list_mdl->index(0));
 
 	//Sets the list position right below of text cursor
 	completion_wgt->move(code_field_txt->mapToGlobal(code_field_txt->cursorRect().topLeft() + QPoint(0,20)));
@@ -493,21 +438,22 @@ void CodeCompletionWidget::updateList(void)
 
 void CodeCompletionWidget::selectItem(void)
 {
-	if(!name_list->selectedItems().isEmpty())
+	QModelIndexList sel_idxs=name_list->selectionModel()->selectedIndexes();
+	const CodeCompletionIndex::Candidate *cand=(sel_idxs.isEmpty() ? nullptr : name_list_mdl->getCandidate(sel_idxs.at(0).row()));
+
+	if(cand)
 	{
-		QListWidgetItem *item=name_list->selectedItems().at(0);
-		BaseObject *object=nullptr;
+		//The candidate data is copied since the candidate can be discarded while the text is inserted
+		QString cand_text=cand->text;
+		BaseObject *object=cand->object;
 		QTextCursor tc;
 
 		if(qualifying_level < 0)
 			code_field_txt->setTextCursor(new_txt_cur);
 
-		//If the selected item is a object (data not null)
-		if(!item->data(Qt::UserRole).isNull())
+		//If the selected item is a object
+		if(object)
 		{
-			//Retrieve the object
-			object=reinterpret_cast<BaseObject *>(item->data(Qt::UserRole).value<void *>());
-
 			/* Move the cursor to the start of the word because all the chars will be replaced
 			with the object name */
 			prev_txt_cur.movePosition(QTextCursor::StartOfWord, QTextCursor::KeepAnchor);
@@ -543,11 +489,11 @@ void CodeCompletionWidget::selectItem(void)
 		}
 		else
 		{
-			code_field_txt->insertPlainText(item->text() + QString(" "));
+			code_field_txt->insertPlainText(cand_text + QString(" "));
 			setQualifyingLevel(nullptr);
 		}
 
-		emit s_wordSelected(item->text());
+		emit s_wordSelected(cand_text);
 	}
 	else
 		setQualifyingLevel(nullptr);
@@ -561,12 +507,12 @@ void CodeCompletionWidget::selectItem(void)
 
 void CodeCompletionWidget::showItemTooltip(void)
 {
-	QListWidgetItem *item=name_list->currentItem();
+	QModelIndex index=name_list->currentIndex();
 
-	if(item)
+	if(index.isValid())
 	{
 		QPoint pos=name_list->mapToGlobal(QPoint(name_list->width(), name_list->geometry().top()));
-		QToolTip::showText(pos, item->toolTip());
+		QToolTip::showText(pos, index.data(Qt::ToolTipRole).toString());
 	}
 }
 
@@ -29,6 +29,7 @@ the syntax highlighter installed on it.
 #include <QWidget>
 #include "syntaxhighlighter.h"
 #include "databasemodel.h"
+#include "codecompletionmodel.h"
 
 class CodeCompletionWidget: public QWidget
 {
@@ -46,12 +47,15 @@ class CodeCompletionWidget: public QWidget
 		//! \brief Input field that is associated with the code completion
 		QPlainTextEdit *code_field_txt;
 		
-		//! \brief This widget stores the list of completion items
-		QListWidget *name_list;
+		//! \brief This widget displays the list of completion items
+		QListView *name_list;
 		
-		/*! \brief Stores the keywords retrieved from the syntax highlighter.
-		These key words are listed whenever the user call the completion */
-		QStringList keywords;
+		//! \brief Model that holds the candidates listed in name_list
+		CodeCompletionModel *name_list_mdl;
+		
+		/*! \brief Stores the keywords retrieved from the syntax highlighter, the custom items and the model objects
+		sorted by name so the candidates matching the typed word are retrieved without scanning the whole model */
+		CodeCompletionIndex completion_idx;
 		
 		/*! \brief This cursor object is configured to use as a replacer when the user
 		selects an item on the completion list */
@@ -87,20 +91,12 @@ class CodeCompletionWidget: public QWidget
 		//! \brief Store the objects selected for each qualifying level
 		vector<BaseObject *> sel_objects;
 		
-		map<QString, QPixmap> custom_items;
-		
-		attribs_map custom_items_tips;
-		
 		//! \brief Puts the selected object name on the current cursor position.
 		void insertObjectName(BaseObject *obj);
 		
 		//! \brief Filters the necessary events to trigger the completion as well to control/select items
 		bool eventFilter(QObject *object, QEvent *event);
 		
-		/*! \brief Insert the objects of the vector into the name listing. The filter parameter is used to
-		insert only the object which names matches the filter */
-		void populateNameList(vector<BaseObject *> &objects, QString filter=QString());
-		
 		//! \brief Configures the current qualifying level according to the passed object
 		void setQualifyingLevel(BaseObject *obj);
 		
@@ -145,6 +141,16 @@ class CodeCompletionWidget: public QWidget
 
 	private slots:
 		void handleSelectedWord(QString word);
+		
+		//! \brief Indexes the object added to the model (see DatabaseModel::s_objectAdded)
+		void handleObjectAddition(BaseObject *object);
+
+		/*! \brief Reindexes the object renamed, moved to another schema or, in case of tables/views, which children
+		changed (see DatabaseModel::s_objectRenamed) */
+		void handleObjectRenaming(BaseObject *object);
+		
+		//! \brief Discards the indexed model objects after removals and batch operations
+		void invalidateIndex(void);
 };
 
 #endif
@@ -22,31 +22,18 @@ ConfigurationForm::ConfigurationForm(QWidget *parent, Qt::WindowFlags f) : QDial
 {
 	setupUi(this);
 
-	general_conf=new GeneralConfigWidget(this);
-	appearance_conf=new AppearanceConfigWidget(this);
-	connections_conf=new ConnectionsConfigWidget(this);
-	relationships_conf=new RelationshipConfigWidget(this);
-	snippets_conf=new SnippetsConfigWidget(this);
-	plugins_conf=new PluginsConfigWidget(this);
+	conf_wgts.resize(PLUGINS_CONF_WGT + 1, nullptr);
 
-	QWidgetList wgt_list={ general_conf, relationships_conf,
-						   appearance_conf, connections_conf,
-						   snippets_conf, plugins_conf};
-
-	for(int i=GENERAL_CONF_WGT; i <= PLUGINS_CONF_WGT; i++)
-		confs_stw->addWidget(wgt_list[i]);
-
-	connect(icons_lst, SIGNAL(currentRowChanged(int)), confs_stw, SLOT(setCurrentIndex(int)));
+	connect(icons_lst, SIGNAL(currentRowChanged(int)), this, SLOT(showConfigurationWidget(int)));
 	connect(cancel_btn, SIGNAL(clicked(void)), this, SLOT(reject(void)));
 	connect(apply_btn, SIGNAL(clicked(void)), this, SLOT(applyConfiguration(void)));
 	connect(defaults_btn, SIGNAL(clicked(void)), this, SLOT(restoreDefaults(void)));
-
-	icons_lst->setCurrentRow(GENERAL_CONF_WGT);
 }
 
 ConfigurationForm::~ConfigurationForm(void)
 {
-	connections_conf->destroyConnections();
+	if(conf_wgts[CONNECTIONS_CONF_WGT])
+		dynamic_cast<ConnectionsConfigWidget *>(conf_wgts[CONNECTIONS_CONF_WGT])->destroyConnections();
 }
 
 void ConfigurationForm::hideEvent(QHideEvent *)
@@ -56,7 +43,24 @@ void ConfigurationForm::hideEvent(QHideEvent *)
 
 void ConfigurationForm::showEvent(QShowEvent *)
 {
-	snippets_conf->snippet_txt->updateLineNumbers();
+	if(icons_lst->currentRow() < 0)
+		icons_lst->setCurrentRow(GENERAL_CONF_WGT);
+
+	if(conf_wgts[SNIPPETS_CONF_WGT])
+		dynamic_cast<SnippetsConfigWidget *>(conf_wgts[SNIPPETS_CONF_WGT])->snippet_txt->updateLineNumbers();
+}
+
+void ConfigurationForm::showConfigurationWidget(int idx)
+{
+	BaseConfigWidget *conf_wgt=getConfigurationWidget(idx);
+
+	if(!conf_wgt)
+		return;
+
+	confs_stw->setCurrentWidget(conf_wgt);
+
+	if(idx==SNIPPETS_CONF_WGT)
+		dynamic_cast<SnippetsConfigWidget *>(conf_wgt)->snippet_txt->updateLineNumbers();
 }
 
 void ConfigurationForm::reject(void)
@@ -65,14 +69,13 @@ void ConfigurationForm::reject(void)
 	{
 		if(sender()==cancel_btn)
 		{
-			QWidgetList wgt_list={ appearance_conf, connections_conf, snippets_conf };
 			BaseConfigWidget *conf_wgt=nullptr;
 
-			for(QWidget *wgt : wgt_list)
+			for(int i : { APPEARANCE_CONF_WGT, CONNECTIONS_CONF_WGT, SNIPPETS_CONF_WGT })
 			{
-				conf_wgt=qobject_cast<BaseConfigWidget *>(wgt);
+				conf_wgt=conf_wgts[i];
 
-				if(conf_wgt->isConfigurationChanged())
+				if(conf_wgt && conf_wgt->isConfigurationChanged())
 					conf_wgt->loadConfiguration();
 			}
 		}
@@ -89,49 +92,64 @@ void ConfigurationForm::applyConfiguration(void)
 
 	for(int i=GENERAL_CONF_WGT; i <= SNIPPETS_CONF_WGT; i++)
 	{
-		conf_wgt=qobject_cast<BaseConfigWidget *>(confs_stw->widget(i));
+		conf_wgt=conf_wgts[i];
 
-		if(conf_wgt->isConfigurationChanged())
+		if(conf_wgt && conf_wgt->isConfigurationChanged())
 			conf_wgt->saveConfiguration();
 	}
 
-	general_conf->applyConfiguration();
-	relationships_conf->applyConfiguration();
+	getConfigurationWidget(GENERAL_CONF_WGT)->applyConfiguration();
+	getConfigurationWidget(RELATIONSHIPS_CONF_WGT)->applyConfiguration();
 	QDialog::accept();
 }
 
-void ConfigurationForm::loadConfiguration(void)
+void ConfigurationForm::loadConfigurationWidget(int wgt_id)
 {
 	BaseConfigWidget *config_wgt = nullptr;
 
-	for(int i=GENERAL_CONF_WGT; i <= PLUGINS_CONF_WGT; i++)
+	try
 	{
-		try
+		config_wgt = conf_wgts[wgt_id];
+		config_wgt->loadConfiguration();
+	}
+	catch(Exception &e)
+	{
+		Messagebox msg_box;
+
+		if(e.getErrorType()==ERR_PLUGINS_NOT_LOADED)
 		{
-			config_wgt = qobject_cast<BaseConfigWidget *>(confs_stw->widget(i));
-			config_wgt->loadConfiguration();
+			msg_box.show(e);
 		}
-		catch(Exception &e)
+		else
 		{
-			Messagebox msg_box;
-
-			if(e.getErrorType()==ERR_PLUGINS_NOT_LOADED)
-			{
-				msg_box.show(e);
-			}
-			else
-			{
-				Exception ex = Exception(Exception::getErrorMessage(ERR_CONFIG_NOT_LOADED).arg(e.getExtraInfo()),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
-				msg_box.show(ex, QString("%1 %2").arg(ex.getErrorMessage()).arg(trUtf8("In some cases restore the default settings related to it may solve the problem. Would like to do that?")),
-										 Messagebox::ALERT_ICON, Messagebox::YES_NO_BUTTONS, trUtf8("Restore"), QString(), QString(), PgModelerUiNS::getIconPath("atualizar"));
+			Exception ex = Exception(Exception::getErrorMessage(ERR_CONFIG_NOT_LOADED).arg(e.getExtraInfo()),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+			msg_box.show(ex, QString("%1 %2").arg(ex.getErrorMessage()).arg(trUtf8("In some cases restore the default settings related to it may solve the problem. Would like to do that?")),
+									 Messagebox::ALERT_ICON, Messagebox::YES_NO_BUTTONS, trUtf8("Restore"), QString(), QString(), PgModelerUiNS::getIconPath("atualizar"));
 
-				if(msg_box.result() == QDialog::Accepted)
-					config_wgt->restoreDefaults();
-			}
+			if(msg_box.result() == QDialog::Accepted)
+				config_wgt->restoreDefaults();
 		}
 	}
 }
 
+void ConfigurationForm::loadConfiguration(void)
+{
+	for(int i=GENERAL_CONF_WGT; i <= PLUGINS_CONF_WGT; i++)
+	{
+		if(conf_wgts[i])
+			loadConfigurationWidget(i);
+		else if(i==GENERAL_CONF_WGT || i==RELATIONSHIPS_CONF_WGT)
+			getConfigurationWidget(i);
+	}
+}
+
+void ConfigurationForm::loadDeferredConfiguration(void)
+{
+	getConfigurationWidget(CONNECTIONS_CONF_WGT);
+	getConfigurationWidget(SNIPPETS_CONF_WGT);
+	getConfigurationWidget(PLUGINS_CONF_WGT);
+}
+
 void ConfigurationForm::restoreDefaults(void)
 {
 	Messagebox msg_box;
@@ -145,9 +163,27 @@ void ConfigurationForm::restoreDefaults(void)
 
 BaseConfigWidget *ConfigurationForm::getConfigurationWidget(unsigned idx)
 {
-	if(idx >= static_cast<unsigned>(confs_stw->count()))
+	if(idx >= conf_wgts.size())
 		return(nullptr);
-	else
-		return(qobject_cast<BaseConfigWidget *>(confs_stw->widget(static_cast<unsigned>(idx))));
-}
 
+	if(!conf_wgts[idx])
+	{
+		if(idx==GENERAL_CONF_WGT)
+			conf_wgts[idx]=new GeneralConfigWidget(this);
+		else if(idx==RELATIONSHIPS_CONF_WGT)
+			conf_wgts[idx]=new RelationshipConfigWidget(this);
+		else if(idx==APPEARANCE_CONF_WGT)
+			conf_wgts[idx]=new AppearanceConfigWidget(this);
+		else if(idx==CONNECTIONS_CONF_WGT)
+			conf_wgts[idx]=new ConnectionsConfigWidget(this);
+		else if(idx==SNIPPETS_CONF_WGT)
+			conf_wgts[idx]=new SnippetsConfigWidget(this);
+		else
+			conf_wgts[idx]=new PluginsConfigWidget(this);
+
+		confs_stw->addWidget(conf_wgts[idx]);
+		loadConfigurationWidget(idx);
+	}
+
+	return(conf_wgts[idx]);
+}
@@ -37,16 +37,16 @@ class ConfigurationForm: public QDialog, public Ui::ConfigurationForm {
 	private:
 		Q_OBJECT
 		
-		GeneralConfigWidget *general_conf;
-		AppearanceConfigWidget *appearance_conf;
-		ConnectionsConfigWidget *connections_conf;
-		RelationshipConfigWidget *relationships_conf;
-		SnippetsConfigWidget *snippets_conf;
-		PluginsConfigWidget *plugins_conf;
+		//! \brief Configuration widgets indexed by the *_CONF_WGT constants. Null entries are the widgets not created yet
+		vector<BaseConfigWidget *> conf_wgts;
 		
 		void hideEvent(QHideEvent *);
 		void showEvent(QShowEvent *);
 		
+		/*! \brief Loads the configuration of a single widget. In case of errors the user is asked to restore the
+		default settings of the widget (except for plugins errors which are only displayed) */
+		void loadConfigurationWidget(int wgt_id);
+		
 	public:
 		static const int	GENERAL_CONF_WGT=0,
 		RELATIONSHIPS_CONF_WGT=1,
@@ -58,15 +58,26 @@ class ConfigurationForm: public QDialog, public Ui::ConfigurationForm {
 		ConfigurationForm(QWidget * parent = 0, Qt::WindowFlags f = 0);
 		~ConfigurationForm(void);
 		
+		/*! \brief Returns the configuration widget with the provided index. Widgets are created and have their configuration loaded
+		only on the first request, this way the settings not needed at startup are only loaded when the widget is displayed */
 		BaseConfigWidget *getConfigurationWidget(unsigned idx);
 		
+		/*! \brief Loads the configurations that aren't needed to display the main window (connections, snippets and plugins).
+		This method is called after the main window is displayed in order to speed up the startup */
+		void loadDeferredConfiguration(void);
+		
 	public slots:
 		void applyConfiguration(void);
+		/*! \brief Loads the configurations needed by the main window (general and relationships) and reloads the ones of the widgets
+		already created. The objects style (appearance settings) is loaded when the first scene is created (see ObjectsScene) */
 		void loadConfiguration(void);
 		void reject(void);
 		
 	private slots:
 		void restoreDefaults(void);
+		
+		//! \brief Displays the configuration widget with the provided index creating it if needed
+		void showConfigurationWidget(int idx);
 };
 
 #endif
@@ -553,6 +553,7 @@ void DatabaseExplorerWidget::formatSequenceAttribs(attribs_map &attribs)
 		Connection conn=connection;
 		ResultSet res;
 
+		conn.setPooled(true);
 		conn.connect();
 		conn.executeDMLCommand(QString("SELECT last_value FROM \"%1\".\"%2\"").arg(sch_name).arg(BaseObject::formatName(attribs[ParsersAttributes::NAME])), res);
 
@@ -944,7 +945,7 @@ void DatabaseExplorerWidget::listObjects(void)
 		curr_root = objects_trw->topLevelItem(0);
 		objects_trw->takeTopLevelItem(0);
 		root->setText(0, connection.getConnectionId(true));
-		root->setIcon(0, QPixmap(PgModelerUiNS::getIconPath("server")));
+		root->setIcon(0, PgModelerUiNS::getIcon("server"));
 		root->setData(DatabaseImportForm::OBJECT_ID, Qt::UserRole, -1);
 		root->setData(DatabaseImportForm::OBJECT_TYPE, Qt::UserRole, BASE_OBJECT);
 		root->setData(DatabaseImportForm::OBJECT_SOURCE, Qt::UserRole, trUtf8("-- Source code unavailable for this kind of object --"));
@@ -977,12 +978,21 @@ void DatabaseExplorerWidget::configureImportHelper(void)
 
 	catalog.closeConnection();
 	catalog.setFilter(Catalog::LIST_ALL_OBJS);
+
+	/* Objects properties are cached until the next refresh (the only moment the cache is discarded)
+	so browsing the same items again doesn't reach the server */
+	catalog.setResultCacheEnabled(true);
+	catalog.invalidateResultCache();
 	catalog.setConnection(connection);
 }
 
 void DatabaseExplorerWidget::handleObject(QTreeWidgetItem *item, int)
 {
-	if(item->data(DatabaseImportForm::OBJECT_OTHER_DATA, Qt::UserRole).toInt() < 0)
+	if(item->data(DatabaseImportForm::OBJECT_OTHER_DATA, Qt::UserRole).toInt() == DatabaseImportForm::NEXT_PAGE_ITEM)
+	{
+		loadNextObjectsPage(item);
+	}
+	else if(item->data(DatabaseImportForm::OBJECT_OTHER_DATA, Qt::UserRole).toInt() == DatabaseImportForm::DUMMY_ITEM)
 	{
 		updateItem(item->parent());
 	}
@@ -1328,7 +1338,7 @@ void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item)
 {
 	if(item && item->data(DatabaseImportForm::OBJECT_ID, Qt::UserRole).toInt() >= 0)
 	{
-		QTreeWidgetItem *root=nullptr, *parent=nullptr, *aux_item=nullptr;
+		QTreeWidgetItem *root=nullptr, *parent=nullptr;
 		ObjectType obj_type=static_cast<ObjectType>(item->data(DatabaseImportForm::OBJECT_TYPE, Qt::UserRole).toUInt());
 		unsigned obj_id=static_cast<ObjectType>(item->data(DatabaseImportForm::OBJECT_ID, Qt::UserRole).toUInt());
 		QString sch_name, tab_name;
@@ -1384,14 +1394,7 @@ void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item)
 
 			//Creating dummy items for schemas and tables
 			if(obj_type==OBJ_SCHEMA || obj_type==OBJ_TABLE || obj_type==OBJ_VIEW)
-			{
-				for(auto &item : gen_items)
-				{
-					aux_item=new QTreeWidgetItem(item);
-					aux_item->setText(0, QString("..."));
-					aux_item->setData(DatabaseImportForm::OBJECT_OTHER_DATA, Qt::UserRole, QVariant::fromValue<int>(-1));
-				}
-			}
+				DatabaseImportForm::createDummyItems(gen_items);
 
 			import_helper.closeConnection();
 			objects_trw->sortItems(sort_column, Qt::AscendingOrder);
@@ -1411,6 +1414,19 @@ void DatabaseExplorerWidget::updateItem(QTreeWidgetItem *item)
 	}
 }
 
+void DatabaseExplorerWidget::loadNextObjectsPage(QTreeWidgetItem *item)
+{
+	try
+	{
+		//The objects of the next page were already retrieved so there's no need to query the catalog again
+		DatabaseImportForm::createDummyItems(DatabaseImportForm::loadNextObjectsPage(import_helper, objects_trw, item));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+	}
+}
+
 void DatabaseExplorerWidget::loadObjectProperties(bool force_reload)
 {
 	try
@@ -1430,6 +1446,10 @@ void DatabaseExplorerWidget::loadObjectProperties(bool force_reload)
 			if(orig_attribs.empty() || force_reload)
 			{
 				QApplication::setOverrideCursor(Qt::WaitCursor);
+
+				if(force_reload)
+					catalog.invalidateResultCache();
+
 				catalog.setConnection(connection);
 
 				//Loading the server properties
@@ -1940,6 +1960,11 @@ void DatabaseExplorerWidget::dropDatabase(void)
 		try
 		{
 			Connection conn=Connection(connection.getConnectionParams());
+
+			//Idle pooled connections to the database would prevent it from being dropped
+			catalog.closeConnection();
+			ConnectionPool::clear(connection.getPoolKey());
+
 			conn.setConnectionParam(Connection::PARAM_DB_NAME, default_db);
 			conn.connect();
 			conn.executeDDLCommand(QString("DROP DATABASE \"%1\";").arg(dbname));
@@ -139,6 +139,9 @@ class DatabaseExplorerWidget: public QWidget, public Ui::DatabaseExplorerWidget
 
 		//! \brief Updates the selected tree item
 		void updateItem(QTreeWidgetItem *item);
+
+		//! \brief Creates the next page of objects held by the provided "next page" item
+		void loadNextObjectsPage(QTreeWidgetItem *item);
 		
 		//! \brief Generate the SQL code for the specified object appending the permissions code for it as well
 		QString getObjectSource(BaseObject *object, DatabaseModel *dbmodel);
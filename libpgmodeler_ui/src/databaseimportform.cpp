@@ -55,6 +55,9 @@ DatabaseImportForm::DatabaseImportForm(QWidget *parent, Qt::WindowFlags f) : QDi
 
 	settings_tbw->setTabEnabled(1, false);
 
+	filter_timer.setSingleShot(true);
+	filter_timer.setInterval(500);
+
 	objs_parent_wgt->setEnabled(false);
 
 	connect(close_btn, SIGNAL(clicked(bool)), this, SLOT(close(void)));
@@ -69,6 +72,10 @@ DatabaseImportForm::DatabaseImportForm(QWidget *parent, Qt::WindowFlags f) : QDi
 	connect(select_all_tb, SIGNAL(clicked(bool)), this, SLOT(setItemsCheckState(void)));
 	connect(clear_all_tb, SIGNAL(clicked(bool)), this, SLOT(setItemsCheckState(void)));
 	connect(filter_edt, SIGNAL(textChanged(QString)), this, SLOT(filterObjects(void)));
+	connect(filter_edt, SIGNAL(textChanged(QString)), &filter_timer, SLOT(start(void)));
+	connect(&filter_timer, SIGNAL(timeout(void)), this, SLOT(loadFilteredItems(void)));
+	connect(db_objects_tw, SIGNAL(itemExpanded(QTreeWidgetItem*)), this, SLOT(loadChildItems(QTreeWidgetItem*)));
+	connect(db_objects_tw, SIGNAL(itemDoubleClicked(QTreeWidgetItem*,int)), this, SLOT(loadNextObjectsPage(QTreeWidgetItem*,int)));
 	connect(import_btn, SIGNAL(clicked(bool)), this, SLOT(importDatabase(void)));
 	connect(cancel_btn, SIGNAL(clicked(bool)), this, SLOT(cancelImport(void)));
 
@@ -202,6 +209,7 @@ void DatabaseImportForm::importDatabase(void)
 		settings_tbw->setTabEnabled(1, true);
 		settings_tbw->setCurrentIndex(1);
 
+		loadCheckedChildItems();
 		getCheckedItems(obj_oids, col_oids);
 		obj_oids[OBJ_DATABASE].push_back(database_cmb->itemData(database_cmb->currentIndex()).value<unsigned>());
 
@@ -217,6 +225,7 @@ void DatabaseImportForm::importDatabase(void)
 										debug_mode_chk->isChecked(), rand_rel_color_chk->isChecked(), true);
 
 		import_helper->setSelectedOIDs(model_wgt->getDatabaseModel(), obj_oids, col_oids);
+		import_helper->setImportThreads(QThread::idealThreadCount());
 		import_thread->start();
 		cancel_btn->setEnabled(true);
 		import_btn->setEnabled(false);
@@ -277,8 +286,24 @@ void DatabaseImportForm::getCheckedItems(map<ObjectType, vector<unsigned>> &obj_
 
 	while(*itr)
 	{
+		//The objects not listed yet in a checked "next page" item are selected as well
+		if((*itr)->checkState(0)==Qt::Checked && (*itr)->data(OBJECT_OTHER_DATA, Qt::UserRole).toInt()==NEXT_PAGE_ITEM)
+		{
+			obj_type=static_cast<ObjectType>((*itr)->data(OBJECT_TYPE, Qt::UserRole).value<unsigned>());
+
+			for(auto &obj : (*itr)->data(OBJECT_ATTRIBS, Qt::UserRole).toList())
+			{
+				if(obj_type!=OBJ_COLUMN)
+					obj_oids[obj_type].push_back(obj.value<attribs_map>()[ParsersAttributes::OID].toUInt());
+				else
+				{
+					tab_oid=(*itr)->parent()->parent()->data(OBJECT_ID, Qt::UserRole).value<unsigned>();
+					col_oids[tab_oid].push_back(obj.value<attribs_map>()[ParsersAttributes::OID].toUInt());
+				}
+			}
+		}
 		//If the item is checked and its OID is valid
-		if((*itr)->checkState(0)==Qt::Checked && (*itr)->data(OBJECT_ID, Qt::UserRole).value<unsigned>() > 0)
+		else if((*itr)->checkState(0)==Qt::Checked && (*itr)->data(OBJECT_ID, Qt::UserRole).value<unsigned>() > 0)
 		{
 			obj_type=static_cast<ObjectType>((*itr)->data(OBJECT_TYPE, Qt::UserRole).value<unsigned>());
 
@@ -318,8 +343,8 @@ void DatabaseImportForm::listObjects(void)
 											resolve_deps_chk->isChecked(), ignore_errors_chk->isChecked(),
 											debug_mode_chk->isChecked(), rand_rel_color_chk->isChecked(), true);
 
-			//List the objects using the static helper method
-			DatabaseImportForm::listObjects(*import_helper, db_objects_tw, true, true, false);
+			//List the objects using the static helper method (schemas' children are retrieved on demand)
+			DatabaseImportForm::listObjects(*import_helper, db_objects_tw, true, true, false, true);
 		}
 
 		//Enable the control buttons only when objects were retrieved
@@ -419,6 +444,122 @@ void DatabaseImportForm::filterObjects(void)
 																		(by_oid_chk->isChecked() ? OBJECT_ID : 0), false);
 }
 
+void DatabaseImportForm::loadFilteredItems(void)
+{
+	QString pattern=filter_edt->text();
+
+	if(pattern.isEmpty() || by_oid_chk->isChecked() || !import_helper || db_objects_tw->topLevelItemCount()==0)
+		return;
+
+	try
+	{
+		QTreeWidgetItemIterator itr(db_objects_tw);
+		vector<QTreeWidgetItem *> sch_items;
+		attribs_map schemas;
+		bool loaded=false;
+
+		//Gathering the schemas which children were not retrieved yet
+		while(*itr)
+		{
+			if((*itr)->data(OBJECT_TYPE, Qt::UserRole).toUInt()==OBJ_SCHEMA &&
+				 (*itr)->childCount()==1 && (*itr)->child(0)->data(OBJECT_OTHER_DATA, Qt::UserRole).toInt()==DUMMY_ITEM)
+				sch_items.push_back(*itr);
+
+			++itr;
+		}
+
+		if(sch_items.empty())
+			return;
+
+		QApplication::setOverrideCursor(Qt::WaitCursor);
+
+		/* Querying at once the schemas containing objects which names start with the pattern
+		in order to load only the deferred schemas having matching objects */
+		schemas=import_helper->getObjectsSchemas(BaseObject::getChildObjectTypes(OBJ_SCHEMA),
+																						 {{ParsersAttributes::FILTER_TABLE_TYPES, ParsersAttributes::_TRUE_},
+																							{ParsersAttributes::NAME_FILTER, pattern}});
+
+		for(auto &sch_item : sch_items)
+		{
+			if(schemas.count(QString::number(sch_item->data(OBJECT_ID, Qt::UserRole).value<unsigned>())))
+				loaded|=DatabaseImportForm::loadChildItems(*import_helper, db_objects_tw, sch_item, true, true);
+		}
+
+		QApplication::restoreOverrideCursor();
+
+		if(loaded)
+			filterObjects();
+	}
+	catch(Exception &e)
+	{
+		QApplication::restoreOverrideCursor();
+		Messagebox msg_box;
+		msg_box.show(e);
+	}
+}
+
+void DatabaseImportForm::loadChildItems(QTreeWidgetItem *item)
+{
+	try
+	{
+		QApplication::setOverrideCursor(Qt::WaitCursor);
+		DatabaseImportForm::loadChildItems(*import_helper, db_objects_tw, item, true, true);
+		QApplication::restoreOverrideCursor();
+	}
+	catch(Exception &e)
+	{
+		QApplication::restoreOverrideCursor();
+		Messagebox msg_box;
+		msg_box.show(e);
+	}
+}
+
+void DatabaseImportForm::loadNextObjectsPage(QTreeWidgetItem *item, int)
+{
+	try
+	{
+		if(item->data(OBJECT_OTHER_DATA, Qt::UserRole).toInt()==NEXT_PAGE_ITEM)
+		{
+			QApplication::setOverrideCursor(Qt::WaitCursor);
+			createDummyItems(DatabaseImportForm::loadNextObjectsPage(*import_helper, db_objects_tw, item, true));
+			QApplication::restoreOverrideCursor();
+		}
+	}
+	catch(Exception &e)
+	{
+		QApplication::restoreOverrideCursor();
+		Messagebox msg_box;
+		msg_box.show(e);
+	}
+}
+
+void DatabaseImportForm::loadCheckedChildItems(void)
+{
+	bool loaded=false;
+
+	/* Loading the children of the checked items level by level since the
+	retrieval of a schema's children creates new deferred tables and views */
+	do
+	{
+		QTreeWidgetItemIterator itr(db_objects_tw);
+		vector<QTreeWidgetItem *> items;
+
+		while(*itr)
+		{
+			if((*itr)->checkState(0)==Qt::Checked && (*itr)->childCount()==1 &&
+				 (*itr)->child(0)->data(OBJECT_OTHER_DATA, Qt::UserRole).toInt()==DUMMY_ITEM)
+				items.push_back(*itr);
+
+			++itr;
+		}
+
+		loaded=false;
+		for(auto &item : items)
+			loaded|=DatabaseImportForm::loadChildItems(*import_helper, db_objects_tw, item, true, true);
+	}
+	while(loaded);
+}
+
 void DatabaseImportForm::filterObjects(QTreeWidget *tree_wgt, const QString &pattern, int search_column, bool sel_single_leaf)
 {
 	if(!tree_wgt)
@@ -556,7 +697,18 @@ void DatabaseImportForm::finishImport(const QString &msg)
 		model_wgt->setUpdatesEnabled(true);
 
 		if(!create_model)
+		{
+			DatabaseModel *db_model=model_wgt->getDatabaseModel();
+
 			model_wgt->getOperationList()->removeOperations();
+
+			//The imported children (indexes, triggers, etc) may have been added to tables and views that already existed
+			for(auto &tab : *db_model->getObjectList(OBJ_TABLE))
+				db_model->notifyObjectRenamed(tab);
+
+			for(auto &view : *db_model->getObjectList(OBJ_VIEW))
+				db_model->notifyObjectRenamed(view);
+		}
 	}
 }
 
@@ -635,7 +787,7 @@ void DatabaseImportForm::listObjects(DatabaseImportHelper &import_helper, QTreeW
 	{
 		if(tree_wgt)
 		{
-			QTreeWidgetItem *db_item=nullptr, *item=nullptr;
+			QTreeWidgetItem *db_item=nullptr;
 			vector<QTreeWidgetItem *> sch_items, tab_items;
 			float inc=0, inc1=0, aux_prog=0;
 
@@ -657,7 +809,7 @@ void DatabaseImportForm::listObjects(DatabaseImportHelper &import_helper, QTreeW
 				//Creating database item
 				db_item=new QTreeWidgetItem;
 				db_item->setText(0, import_helper.getCurrentDatabase());
-				db_item->setIcon(0, QPixmap(PgModelerUiNS::getIconPath(OBJ_DATABASE)));
+				db_item->setIcon(0, PgModelerUiNS::getIcon(OBJ_DATABASE));
 				attribs=catalog.getObjectsAttributes(OBJ_DATABASE, QString(), QString(), {}, {{ParsersAttributes::NAME, import_helper.getCurrentDatabase()}});
 
 				db_item->setData(OBJECT_ID, Qt::UserRole, attribs[0].at(ParsersAttributes::OID).toUInt());
@@ -673,15 +825,7 @@ void DatabaseImportForm::listObjects(DatabaseImportHelper &import_helper, QTreeW
 																											checkable_items, disable_empty_grps, db_item);
 
 			if(create_dummy_item)
-			{
-				while(!sch_items.empty())
-				{
-					item=new QTreeWidgetItem(sch_items.back());
-					item->setText(0, QString("..."));
-					item->setData(OBJECT_OTHER_DATA, Qt::UserRole, QVariant::fromValue<int>(-1));
-					sch_items.pop_back();
-				}
-			}
+				createDummyItems(sch_items);
 			else
 			{
 				ObjectType obj_type = BASE_OBJECT;
@@ -742,21 +886,19 @@ void DatabaseImportForm::listObjects(DatabaseImportHelper &import_helper, QTreeW
 vector<QTreeWidgetItem *> DatabaseImportForm::updateObjectsTree(DatabaseImportHelper &import_helper, QTreeWidget *tree_wgt, vector<ObjectType> types, bool checkable_items,
 																																bool disable_empty_grps, QTreeWidgetItem *root, const QString &schema, const QString &table, unsigned sort_by)
 {
-	vector<QTreeWidgetItem *> items_vect;
+	vector<QTreeWidgetItem *> items_vect, page_items;
 
 	if(tree_wgt)
 	{
-		QTreeWidgetItem *group=nullptr, *item=nullptr;
+		QTreeWidgetItem *group=nullptr;
 		QFont grp_fnt=tree_wgt->font();
 		attribs_map extra_attribs={{ParsersAttributes::FILTER_TABLE_TYPES, ParsersAttributes::_TRUE_}};
-		QString tooltip=QString("OID: %1"), name, label;
 		bool child_checked=false;
 		vector<attribs_map> objects_vect;
 		map<ObjectType, QTreeWidgetItem *> gen_groups;
+		map<ObjectType, QVariantList> grp_objects;
 		ObjectType obj_type;
 		QList<QTreeWidgetItem*> groups_list;
-		unsigned oid=0;
-		int start=-1, end=-1;
 
 		grp_fnt.setItalic(true);
 		tree_wgt->blockSignals(true);
@@ -769,7 +911,7 @@ vector<QTreeWidgetItem *> DatabaseImportForm::updateObjectsTree(DatabaseImportHe
 			{
 				//Create a group item for the current type
 				group=new QTreeWidgetItem(root);
-				group->setIcon(0, QPixmap(PgModelerUiNS::getIconPath(BaseObject::getSchemaName(grp_type) + QString("_grp"))));
+				group->setIcon(0, PgModelerUiNS::getIcon(BaseObject::getSchemaName(grp_type) + QString("_grp")));
 				group->setFont(0, grp_fnt);
 
 				//Group items does contains a zero valued id to indicate that is not a valide object
@@ -785,84 +927,23 @@ vector<QTreeWidgetItem *> DatabaseImportForm::updateObjectsTree(DatabaseImportHe
 
 			objects_vect=import_helper.getObjects(types, schema, table, extra_attribs);
 
+			//Separating the retrieved objects by type so each group receives its own set of items
 			for(attribs_map &attribs : objects_vect)
 			{
 				obj_type=static_cast<ObjectType>(attribs[ParsersAttributes::OBJECT_TYPE].toUInt());
-				group=gen_groups[obj_type];
-				group->setData(OBJECT_COUNT, Qt::UserRole,
-											 group->data(OBJECT_COUNT, Qt::UserRole).toUInt() + 1);
-
-				//Creates individual items for each object of the current type
-				oid=attribs[ParsersAttributes::OID].toUInt();
-
-				attribs[ParsersAttributes::NAME].remove(QRegExp(QString("( )(without)( time zone)")));
-				label=name=attribs[ParsersAttributes::NAME];
-
-				//Removing the trailing type string from op. families or op. classes names
-				if(obj_type==OBJ_OPFAMILY || obj_type==OBJ_OPCLASS)
-				{
-					start=name.indexOf(QChar('['));
-					end=name.lastIndexOf(QChar(']'));
-					name.remove(start, (end-start)+1);
-					name=name.trimmed();
-				}
-
-				item=new QTreeWidgetItem(group);
-				item->setIcon(0, QPixmap(PgModelerUiNS::getIconPath(obj_type)));
-				item->setText(0, label);
-				item->setText(OBJECT_ID, attribs[ParsersAttributes::OID].rightJustified(10, '0'));
-				item->setData(OBJECT_ID, Qt::UserRole, attribs[ParsersAttributes::OID].toUInt());
-				item->setData(OBJECT_NAME, Qt::UserRole, name);
-
-				if(checkable_items)
-				{
-					if((oid > import_helper.getLastSystemOID()) ||
-						 (obj_type==OBJ_SCHEMA && name==QString("public")) ||
-						 (obj_type==OBJ_COLUMN && root && root->data(0, Qt::UserRole).toUInt() > import_helper.getLastSystemOID()))
-					{
-						item->setCheckState(0, Qt::Checked);
-						child_checked=true;
-					}
-					else
-						item->setCheckState(0, Qt::Unchecked);
-
-					//Disabling items that refers to PostgreSQL's built-in data types
-					if(obj_type==OBJ_TYPE && oid <= import_helper.getLastSystemOID())
-					{
-						item->setDisabled(true);
-						item->setToolTip(0, trUtf8("This is a PostgreSQL built-in data type and cannot be imported."));
-					}
-					//Disabling items that refers to pgModeler's built-in system objects
-					else if((obj_type==OBJ_TABLESPACE && (name==QString("pg_default") || name==QString("pg_global"))) ||
-									(obj_type==OBJ_ROLE && (name==QString("postgres"))) ||
-									(obj_type==OBJ_SCHEMA && (name==QString("pg_catalog") || name==QString("public"))) ||
-									(obj_type==OBJ_LANGUAGE && (name==~LanguageType(LanguageType::c) ||
-																							name==~LanguageType(LanguageType::sql) ||
-																							name==~LanguageType(LanguageType::plpgsql))))
-					{
-						item->setFont(0, grp_fnt);
-						item->setForeground(0, BaseObjectView::getFontStyle(ParsersAttributes::PROT_COLUMN).foreground());
-						item->setToolTip(0, trUtf8("This is a pgModeler's built-in object. It will be ignored if checked by user."));
-					}
-				}
-
-				//Stores the object's OID as the first data of the item
-				item->setData(OBJECT_ID, Qt::UserRole, oid);
-
-				if(!item->toolTip(0).isEmpty())
-					item->setToolTip(0,item->toolTip(0) + QString("\n") + tooltip.arg(oid));
-				else
-					item->setToolTip(0,tooltip.arg(oid));
+				grp_objects[obj_type].push_back(QVariant::fromValue<attribs_map>(attribs));
+			}
 
-				//Stores the object's type as the second data of the item
-				item->setData(OBJECT_TYPE, Qt::UserRole, obj_type);
+			objects_vect.clear();
 
-				//Stores the schema and the table's name of the object
-				item->setData(OBJECT_SCHEMA, Qt::UserRole, schema);
-				item->setData(OBJECT_TABLE, Qt::UserRole, table);
+			for(ObjectType grp_type : types)
+			{
+				group=gen_groups[grp_type];
+				group->setData(OBJECT_COUNT, Qt::UserRole, grp_objects[grp_type].size());
 
-				if(obj_type==OBJ_SCHEMA || obj_type == OBJ_TABLE || obj_type == OBJ_VIEW)
-					items_vect.push_back(item);
+				//Creates only the first page of items, the remaining ones are created on demand
+				page_items=createObjectItems(import_helper, tree_wgt, group, grp_objects[grp_type], checkable_items, child_checked);
+				items_vect.insert(items_vect.end(), page_items.begin(), page_items.end());
 			}
 
 			//Updating the object count in each group
@@ -884,13 +965,258 @@ vector<QTreeWidgetItem *> DatabaseImportForm::updateObjectsTree(DatabaseImportHe
 			tree_wgt->addTopLevelItems(groups_list);
 			//tree_wgt->setSortingEnabled(true);
 			tree_wgt->sortItems(sort_by, Qt::AscendingOrder);
+
+			//Keeping the "next page" items at the bottom of their groups after sorting
+			for(auto &grp : groups_list)
+			{
+				for(int i=0; i < grp->childCount(); i++)
+				{
+					if(grp->child(i)->data(OBJECT_OTHER_DATA, Qt::UserRole).toInt() == NEXT_PAGE_ITEM)
+					{
+						grp->addChild(grp->takeChild(i));
+						break;
+					}
+				}
+			}
+
 			tree_wgt->setUpdatesEnabled(true);
 			tree_wgt->blockSignals(false);
 		}
 		catch(Exception &e)
 		{
+			tree_wgt->setUpdatesEnabled(true);
+			tree_wgt->blockSignals(false);
 			throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 		}
 	}
 	return(items_vect);
 }
+
+vector<QTreeWidgetItem *> DatabaseImportForm::createObjectItems(DatabaseImportHelper &import_helper, QTreeWidget *tree_wgt, QTreeWidgetItem *group,
+																																QVariantList &objects, bool checkable_items, bool &child_checked)
+{
+	vector<QTreeWidgetItem *> items_vect;
+	QTreeWidgetItem *item=nullptr, *page_item=nullptr;
+	QFont grp_fnt=tree_wgt->font();
+	ObjectType obj_type;
+	attribs_map attribs;
+	int count=0, max_count=qMin(objects.size(), static_cast<int>(OBJECTS_PAGE_SIZE));
+
+	grp_fnt.setItalic(true);
+
+	for(count=0; count < max_count; count++)
+	{
+		attribs=objects[count].value<attribs_map>();
+		item=createObjectItem(import_helper, attribs, group, checkable_items, grp_fnt);
+		obj_type=static_cast<ObjectType>(item->data(OBJECT_TYPE, Qt::UserRole).toUInt());
+
+		if(checkable_items && item->checkState(0)==Qt::Checked)
+			child_checked=true;
+
+		if(obj_type==OBJ_SCHEMA || obj_type == OBJ_TABLE || obj_type == OBJ_VIEW)
+			items_vect.push_back(item);
+	}
+
+	objects.erase(objects.begin(), objects.begin() + max_count);
+
+	//Storing the remaining objects in the "next page" item
+	if(!objects.isEmpty())
+	{
+		page_item=new QTreeWidgetItem(group);
+		page_item->setIcon(0, PgModelerUiNS::getIcon("moreactions"));
+		page_item->setFont(0, grp_fnt);
+		page_item->setText(0, trUtf8("Show next %1 object(s) of %2 remaining...")
+											 .arg(qMin(objects.size(), static_cast<int>(OBJECTS_PAGE_SIZE))).arg(objects.size()));
+		page_item->setToolTip(0, trUtf8("Double-click (or click in database explorer) to list more objects"));
+		page_item->setData(OBJECT_ID, Qt::UserRole, 0);
+		page_item->setData(OBJECT_TYPE, Qt::UserRole, group->data(OBJECT_TYPE, Qt::UserRole));
+		page_item->setData(OBJECT_OTHER_DATA, Qt::UserRole, QVariant::fromValue<int>(NEXT_PAGE_ITEM));
+		page_item->setData(OBJECT_ATTRIBS, Qt::UserRole, objects);
+
+		if(checkable_items)
+			page_item->setCheckState(0, child_checked ? Qt::Checked : Qt::Unchecked);
+	}
+
+	return(items_vect);
+}
+
+QTreeWidgetItem *DatabaseImportForm::createObjectItem(DatabaseImportHelper &import_helper, attribs_map &attribs, QTreeWidgetItem *group,
+																											bool checkable_items, const QFont &grp_fnt)
+{
+	static const QRegExp tz_regexp=QRegExp(QString("( )(without)( time zone)"));
+	static const QString tooltip=QString("OID: %1");
+	QTreeWidgetItem *item=nullptr, *root=group->parent();
+	ObjectType obj_type=static_cast<ObjectType>(attribs[ParsersAttributes::OBJECT_TYPE].toUInt());
+	unsigned oid=attribs[ParsersAttributes::OID].toUInt();
+	QString name, label;
+	int start=-1, end=-1;
+
+	attribs[ParsersAttributes::NAME].remove(tz_regexp);
+	label=name=attribs[ParsersAttributes::NAME];
+
+	//Removing the trailing type string from op. families or op. classes names
+	if(obj_type==OBJ_OPFAMILY || obj_type==OBJ_OPCLASS)
+	{
+		start=name.indexOf(QChar('['));
+		end=name.lastIndexOf(QChar(']'));
+		name.remove(start, (end-start)+1);
+		name=name.trimmed();
+	}
+
+	//Creates individual items for each object of the current type
+	item=new QTreeWidgetItem(group);
+	item->setIcon(0, PgModelerUiNS::getIcon(obj_type));
+	item->setText(0, label);
+	item->setText(OBJECT_ID, attribs[ParsersAttributes::OID].rightJustified(10, '0'));
+	item->setData(OBJECT_NAME, Qt::UserRole, name);
+
+	if(checkable_items)
+	{
+		if((oid > import_helper.getLastSystemOID()) ||
+			 (obj_type==OBJ_SCHEMA && name==QString("public")) ||
+			 (obj_type==OBJ_COLUMN && root && root->data(0, Qt::UserRole).toUInt() > import_helper.getLastSystemOID()))
+			item->setCheckState(0, Qt::Checked);
+		else
+			item->setCheckState(0, Qt::Unchecked);
+
+		//Disabling items that refers to PostgreSQL's built-in data types
+		if(obj_type==OBJ_TYPE && oid <= import_helper.getLastSystemOID())
+		{
+			item->setDisabled(true);
+			item->setToolTip(0, trUtf8("This is a PostgreSQL built-in data type and cannot be imported."));
+		}
+		//Disabling items that refers to pgModeler's built-in system objects
+		else if((obj_type==OBJ_TABLESPACE && (name==QString("pg_default") || name==QString("pg_global"))) ||
+						(obj_type==OBJ_ROLE && (name==QString("postgres"))) ||
+						(obj_type==OBJ_SCHEMA && (name==QString("pg_catalog") || name==QString("public"))) ||
+						(obj_type==OBJ_LANGUAGE && (name==~LanguageType(LanguageType::c) ||
+																				name==~LanguageType(LanguageType::sql) ||
+																				name==~LanguageType(LanguageType::plpgsql))))
+		{
+			item->setFont(0, grp_fnt);
+			item->setForeground(0, BaseObjectView::getFontStyle(ParsersAttributes::PROT_COLUMN).foreground());
+			item->setToolTip(0, trUtf8("This is a pgModeler's built-in object. It will be ignored if checked by user."));
+		}
+	}
+
+	//Stores the object's OID as the first data of the item
+	item->setData(OBJECT_ID, Qt::UserRole, oid);
+
+	if(!item->toolTip(0).isEmpty())
+		item->setToolTip(0,item->toolTip(0) + QString("\n") + tooltip.arg(oid));
+	else
+		item->setToolTip(0,tooltip.arg(oid));
+
+	//Stores the object's type as the second data of the item
+	item->setData(OBJECT_TYPE, Qt::UserRole, obj_type);
+
+	//Stores the schema and the table's name of the object
+	item->setData(OBJECT_SCHEMA, Qt::UserRole, group->data(OBJECT_SCHEMA, Qt::UserRole));
+	item->setData(OBJECT_TABLE, Qt::UserRole, group->data(OBJECT_TABLE, Qt::UserRole));
+
+	return(item);
+}
+
+vector<QTreeWidgetItem *> DatabaseImportForm::loadNextObjectsPage(DatabaseImportHelper &import_helper, QTreeWidget *tree_wgt, QTreeWidgetItem *page_item, bool checkable_items)
+{
+	vector<QTreeWidgetItem *> items_vect;
+
+	if(!tree_wgt || !page_item)
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	if(page_item->data(OBJECT_OTHER_DATA, Qt::UserRole).toInt() == NEXT_PAGE_ITEM && page_item->parent())
+	{
+		QTreeWidgetItem *group=page_item->parent();
+		QVariantList objects=page_item->data(OBJECT_ATTRIBS, Qt::UserRole).toList();
+		Qt::CheckState chk_state=page_item->checkState(0);
+		bool child_checked=false;
+		int first_idx=group->childCount() - 1;
+
+		tree_wgt->blockSignals(true);
+		tree_wgt->setUpdatesEnabled(false);
+
+		//The current "next page" item is replaced by the one created (if any) with the remaining objects
+		delete(page_item);
+		items_vect=createObjectItems(import_helper, tree_wgt, group, objects, checkable_items, child_checked);
+
+		//The new items follow the check state of the "next page" item that originated them
+		if(checkable_items && chk_state==Qt::Unchecked)
+		{
+			for(int i=first_idx; i < group->childCount(); i++)
+				group->child(i)->setCheckState(0, Qt::Unchecked);
+		}
+
+		tree_wgt->setUpdatesEnabled(true);
+		tree_wgt->blockSignals(false);
+	}
+
+	return(items_vect);
+}
+
+void DatabaseImportForm::createDummyItems(const vector<QTreeWidgetItem *> &items)
+{
+	QTreeWidgetItem *item=nullptr;
+
+	for(auto &parent : items)
+	{
+		item=new QTreeWidgetItem(parent);
+		item->setText(0, QString("..."));
+		item->setData(OBJECT_OTHER_DATA, Qt::UserRole, QVariant::fromValue<int>(DUMMY_ITEM));
+	}
+}
+
+bool DatabaseImportForm::loadChildItems(DatabaseImportHelper &import_helper, QTreeWidget *tree_wgt, QTreeWidgetItem *item,
+																				bool checkable_items, bool disable_empty_grps, unsigned sort_by)
+{
+	if(!tree_wgt || !item)
+		throw Exception(ERR_OPR_NOT_ALOC_OBJECT ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	ObjectType obj_type=static_cast<ObjectType>(item->data(OBJECT_TYPE, Qt::UserRole).toUInt());
+
+	if((obj_type!=OBJ_SCHEMA && obj_type!=OBJ_TABLE && obj_type!=OBJ_VIEW) ||
+		 item->childCount()!=1 || item->child(0)->data(OBJECT_OTHER_DATA, Qt::UserRole).toInt()!=DUMMY_ITEM)
+		return(false);
+
+	try
+	{
+		vector<QTreeWidgetItem *> items;
+		QString sch_name, tab_name;
+		Qt::CheckState chk_state=(checkable_items ? item->checkState(0) : Qt::Unchecked);
+
+		if(obj_type==OBJ_SCHEMA)
+			sch_name=item->data(OBJECT_NAME, Qt::UserRole).toString();
+		else
+		{
+			sch_name=item->data(OBJECT_SCHEMA, Qt::UserRole).toString();
+			tab_name=item->data(OBJECT_NAME, Qt::UserRole).toString();
+		}
+
+		delete(item->takeChild(0));
+		items=updateObjectsTree(import_helper, tree_wgt, BaseObject::getChildObjectTypes(obj_type),
+														checkable_items, disable_empty_grps, item, sch_name, tab_name, sort_by);
+		createDummyItems(items);
+
+		//Unchecked parents propagate their state to the newly created groups and objects
+		if(checkable_items && chk_state==Qt::Unchecked)
+		{
+			QTreeWidgetItem *group=nullptr;
+
+			tree_wgt->blockSignals(true);
+			for(int grp_idx=0; grp_idx < item->childCount(); grp_idx++)
+			{
+				group=item->child(grp_idx);
+				group->setCheckState(0, Qt::Unchecked);
+
+				for(int i=0; i < group->childCount(); i++)
+					group->child(i)->setCheckState(0, Qt::Unchecked);
+			}
+			tree_wgt->blockSignals(false);
+		}
+
+		return(true);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
@@ -52,6 +52,9 @@ class DatabaseImportForm: public QDialog, public Ui::DatabaseImportForm {
 		
 		//! \brief Thead that controls the database import helper
 		QThread *import_thread;
+
+		//! \brief Timer used to delay the server side filtering of the objects until the user stops typing
+		QTimer filter_timer;
 		
 		/*! \brief Toggles the checked state for the specified item. This method recursively
 		changes the check state for the children items */
@@ -78,6 +81,20 @@ class DatabaseImportForm: public QDialog, public Ui::DatabaseImportForm {
 		//! \brief Destroys both import thread and helper
 		void destroyThread(void);
 
+		/*! \brief Retrieves the children of the schema/table/view items which loading was deferred (the ones containing
+		a dummy child item). Only checked items are loaded so all objects selected by the user are listed in the tree */
+		void loadCheckedChildItems(void);
+
+		/*! \brief Creates the item that represents the object described by the attributes as child of the provided group.
+		The parameter 'grp_fnt' is the font used to highlight the pgModeler's built-in objects */
+		static QTreeWidgetItem *createObjectItem(DatabaseImportHelper &import_helper, attribs_map &attribs, QTreeWidgetItem *group,
+																						 bool checkable_items, const QFont &grp_fnt);
+
+		/*! \brief Creates in the provided group at most OBJECTS_PAGE_SIZE items from the list of pending objects. The remaining
+		objects are stored in a "next page" item so they can be created on demand. Returns the created schema/table/view items */
+		static vector<QTreeWidgetItem *> createObjectItems(DatabaseImportHelper &import_helper, QTreeWidget *tree_wgt, QTreeWidgetItem *group,
+																											 QVariantList &objects, bool checkable_items, bool &child_checked);
+
 	public:
 		//! \brief Constants used to access the tree widget items data
 		static const unsigned OBJECT_ID=1,
@@ -89,6 +106,13 @@ class DatabaseImportForm: public QDialog, public Ui::DatabaseImportForm {
 		OBJECT_OTHER_DATA=7, //General purpose usage
 		OBJECT_COUNT=8,
 		OBJECT_SOURCE=9; //Only for gropus
+
+		//! \brief Values stored in OBJECT_OTHER_DATA to identify the placeholder items
+		static const int DUMMY_ITEM=-1, //Item that represents the children of a schema/table/view not retrieved yet
+		NEXT_PAGE_ITEM=-2; //Item that holds the objects of a group not created yet (see OBJECTS_PAGE_SIZE)
+
+		//! \brief Maximum amount of object items created at once in each group of the objects tree
+		static const unsigned OBJECTS_PAGE_SIZE=1000;
 		
 		DatabaseImportForm(QWidget * parent = 0, Qt::WindowFlags f = 0);
 		~DatabaseImportForm(void);
@@ -121,6 +145,21 @@ class DatabaseImportForm: public QDialog, public Ui::DatabaseImportForm {
 																											 bool checkable_items=false, bool disable_empty_grps=true, QTreeWidgetItem *root=nullptr,
 																											 const QString &schema=QString(), const QString &table=QString(), unsigned sort_by = 0);
 
+		/*! \brief Creates the next page of object items from the objects held by the provided "next page" item (see NEXT_PAGE_ITEM).
+		The "next page" item is destroyed when there are no more objects to be created. Returns the created schema/table/view items
+		so the caller can create the dummy items for them */
+		static vector<QTreeWidgetItem *> loadNextObjectsPage(DatabaseImportHelper &import_helper, QTreeWidget *tree_wgt, QTreeWidgetItem *page_item,
+																												 bool checkable_items=false);
+
+		/*! \brief Creates a dummy item (see DUMMY_ITEM) for each provided item. These dummy items indicate that the children
+		objects of schemas, tables and views must be retrieved only when the parent item is expanded */
+		static void createDummyItems(const vector<QTreeWidgetItem *> &items);
+
+		/*! \brief Retrieves the children of a schema/table/view item which contains a dummy item replacing the dummy by the
+		groups of objects. Returns true when the children were retrieved and false when they were already listed. */
+		static bool loadChildItems(DatabaseImportHelper &import_helper, QTreeWidget *tree_wgt, QTreeWidgetItem *item,
+															 bool checkable_items=false, bool disable_empty_grps=true, unsigned sort_by = 0);
+
 	private slots:
 		void importDatabase(void);
 		void listObjects(void);
@@ -131,6 +170,16 @@ class DatabaseImportForm: public QDialog, public Ui::DatabaseImportForm {
 		void handleImportFinished(Exception e);
 		void captureThreadError(Exception e);
 		void filterObjects(void);
+
+		/*! \brief Retrieves the children of the deferred schemas which contains objects matching the filter. This method
+		uses a server side name filter so only the schemas with at least one matching object are loaded */
+		void loadFilteredItems(void);
+
+		//! \brief Retrieves the children of the expanded schema/table/view item when they were not listed yet
+		void loadChildItems(QTreeWidgetItem *item);
+
+		//! \brief Creates the next page of objects when the "next page" item is activated
+		void loadNextObjectsPage(QTreeWidgetItem *item, int);
 		
 		//! \brief Toggles the check state for the specified item
 		void setItemCheckState(QTreeWidgetItem *item,int);
@@ -17,19 +17,23 @@
 */
 
 #include "databaseimporthelper.h"
-
-const QString DatabaseImportHelper::UNKNOWN_OBJECT_OID_XML=QString("\t<!--[ unknown object OID=%1 ]-->\n");
+#include "connectionpool.h"
+#include "tracer.h"
+#include <atomic>
+#include <functional>
 
 DatabaseImportHelper::DatabaseImportHelper(QObject *parent) : QObject(parent)
 {
 	random_device rand_seed;
 	rand_num_engine.seed(rand_seed());
 
-	import_canceled=ignore_errors=import_sys_objs=import_ext_objs=rand_rel_colors=update_fk_rels=false;
+	import_canceled=false;
+	ignore_errors=import_sys_objs=import_ext_objs=rand_rel_colors=update_fk_rels=false;
 	auto_resolve_deps=true;
 	import_filter=Catalog::LIST_ALL_OBJS | Catalog::EXCL_EXTENSION_OBJS | Catalog::EXCL_SYSTEM_OBJS;
-	xmlparser=nullptr;
+	import_threads=0;
 	dbmodel=nullptr;
+	connection.setPooled(true);
 }
 
 void DatabaseImportHelper::setConnection(Connection &conn)
@@ -41,7 +45,7 @@ void DatabaseImportHelper::setConnection(Connection &conn)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -60,7 +64,7 @@ void DatabaseImportHelper::setCurrentDatabase(const QString &dbname)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -70,7 +74,6 @@ void DatabaseImportHelper::setSelectedOIDs(DatabaseModel *db_model, const map<Ob
 		throw Exception(ERR_ASG_NOT_ALOC_OBJECT ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	dbmodel=db_model;
-	xmlparser=dbmodel->getXMLParser();
 	object_oids.insert(obj_oids.begin(), obj_oids.end());
 	column_oids.insert(col_oids.begin(), col_oids.end());
 
@@ -85,6 +88,7 @@ void DatabaseImportHelper::setSelectedOIDs(DatabaseModel *db_model, const map<Ob
 
 	user_objs.clear();
 	system_objs.clear();
+	obj_names.clear();
 }
 
 void DatabaseImportHelper::setImportOptions(bool import_sys_objs, bool import_ext_objs, bool auto_resolve_deps, bool ignore_errors, bool debug_mode, bool rand_rel_colors, bool update_rels)
@@ -109,6 +113,24 @@ void DatabaseImportHelper::setImportOptions(bool import_sys_objs, bool import_ex
 		import_filter=Catalog::LIST_ALL_OBJS | Catalog::EXCL_BUILTIN_ARRAY_TYPES | Catalog::EXCL_EXTENSION_OBJS | Catalog::EXCL_SYSTEM_OBJS;
 }
 
+void DatabaseImportHelper::setImportThreads(unsigned thread_cnt)
+{
+	import_threads=thread_cnt;
+}
+
+unsigned DatabaseImportHelper::getImportThreads(void)
+{
+	return(import_threads);
+}
+
+unsigned DatabaseImportHelper::getWorkerCount(void)
+{
+	/* The calling thread uses the connection already held by the main catalog instance so each extra worker
+	needs one of the connections that are still free in the pool (other imports/diffs may be holding the rest) */
+	unsigned free_conns=ConnectionPool::getFreeConnections(connection.getPoolKey());
+	return(std::max<unsigned>(1, std::min<unsigned>(import_threads, free_conns + 1)));
+}
+
 unsigned DatabaseImportHelper::getLastSystemOID(void)
 {
 	return(catalog.getLastSysObjectOID());
@@ -133,7 +155,7 @@ attribs_map DatabaseImportHelper::getObjects(ObjectType obj_type, const QString
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -146,7 +168,20 @@ vector<attribs_map> DatabaseImportHelper::getObjects(vector<ObjectType> obj_type
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+}
+
+attribs_map DatabaseImportHelper::getObjectsSchemas(vector<ObjectType> obj_types, attribs_map extra_attribs)
+{
+	try
+	{
+		catalog.setFilter(import_filter);
+		return(catalog.getObjectsSchemas(obj_types, extra_attribs));
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -226,6 +261,71 @@ void DatabaseImportHelper::retrieveUserObjects(void)
 	i=0;
 	catalog.setFilter(import_filter);
 
+	if(getWorkerCount() > 1)
+	{
+		vector<RetrievalTask> tasks;
+		map<ObjectType, vector<unsigned>> glb_oids, pending_oids;
+		map<ObjectType, set<unsigned>> sch_oids;
+
+		/* The objects are retrieved per schema so each worker queries a disjoint set of objects and the schemas
+		are spread among the connections. The objects that don't belong to schemas are retrieved by a single task */
+		for(auto &itr : object_oids)
+		{
+			if(BaseObject::acceptsSchema(itr.first) || TableObject::isTableObject(itr.first))
+				sch_oids[itr.first].insert(itr.second.begin(), itr.second.end());
+			else
+				glb_oids[itr.first]=itr.second;
+		}
+
+		if(!glb_oids.empty())
+			tasks.push_back(RetrievalTask(QString(), QString(), glb_oids));
+
+		if(!sch_oids.empty())
+		{
+			for(auto &itr : catalog.getObjectsNames(OBJ_SCHEMA))
+				tasks.push_back(RetrievalTask(itr.second));
+		}
+
+		runRetrievalTasks(tasks, trUtf8("Retrieving objects... `%1'"), sch_oids);
+
+		//Objects selected in schemas not listed by the current filter are retrieved directly by their oids
+		for(auto &itr : sch_oids)
+		{
+			for(auto &oid : itr.second)
+			{
+				if(!import_canceled && user_objs.count(oid)==0)
+					pending_oids[itr.first].push_back(oid);
+			}
+		}
+
+		tasks.clear();
+
+		if(!pending_oids.empty())
+		{
+			tasks.push_back(RetrievalTask(QString(), QString(), pending_oids));
+			runRetrievalTasks(tasks, trUtf8("Retrieving objects... `%1'"), {});
+			tasks.clear();
+		}
+
+		/* The columns are retrieved once the tables are known. The tasks are ordered by schema so the
+		tables of the same schema tends to be retrieved at the same time by the workers */
+		for(auto &itr : column_oids)
+		{
+			names=resolveObjectName(itr.first).split(".");
+
+			if(names.size() > 1)
+				tasks.push_back(RetrievalTask(names[0], names[1], {{ OBJ_COLUMN, itr.second }}));
+		}
+
+		std::stable_sort(tasks.begin(), tasks.end(), [](const RetrievalTask &task1, const RetrievalTask &task2){
+			return(task1.sch_name < task2.sch_name);
+		});
+
+		runRetrievalTasks(tasks, trUtf8("Retrieving objects... `%1'"), {});
+		resolveObjectNames();
+		return;
+	}
+
 	//Retrieving selected database level objects and table children objects (except columns)
 	while(oid_itr!=object_oids.end() && !import_canceled)
 	{
@@ -267,6 +367,212 @@ void DatabaseImportHelper::retrieveUserObjects(void)
 	}
 }
 
+void DatabaseImportHelper::runRetrievalTasks(vector<RetrievalTask> &tasks, const QString &progress_msg, const map<ObjectType, set<unsigned>> &sch_oids)
+{
+	unsigned worker_cnt=std::min<unsigned>(getWorkerCount(), tasks.size());
+	std::atomic<unsigned> next_task(0), done_tasks(0);
+	vector<Catalog *> catalogs;
+	vector<std::thread> workers;
+	vector<Exception> worker_errors;
+	vector<ObjectType> sch_types;
+	QString db_name=getCurrentDatabase();
+
+	for(auto &itr : sch_oids)
+		sch_types.push_back(itr.first);
+
+	auto run_tasks=[&](Catalog &cat, bool emit_progress)
+	{
+		unsigned task_idx=0, oid=0;
+		ObjectType obj_type;
+		vector<attribs_map> objects;
+		map<ObjectType, vector<unsigned>> task_oids;
+		map<ObjectType, set<unsigned>>::const_iterator sch_itr;
+
+		try
+		{
+			while(!import_canceled && (task_idx=next_task++) < tasks.size())
+			{
+				RetrievalTask &task=tasks[task_idx];
+
+				//Only the calling thread notifies the progress to avoid flooding the receiver with signals
+				if(emit_progress)
+				{
+					if(!task.tab_name.isEmpty())
+						emit s_progressUpdated((done_tasks/static_cast<float>(tasks.size()))*100,
+																	 progress_msg.arg(QString("%1.%2").arg(task.sch_name).arg(task.tab_name)), OBJ_TABLE);
+					else
+						emit s_progressUpdated((done_tasks/static_cast<float>(tasks.size()))*100,
+																	 progress_msg.arg(task.sch_name.isEmpty() ? db_name : task.sch_name),
+																	 task.sch_name.isEmpty() ? OBJ_DATABASE : OBJ_SCHEMA);
+				}
+
+				task_oids=task.oids;
+
+				//The selected objects of the schema are determined by listing all the objects in it with a single query
+				if(!task.sch_name.isEmpty() && task.tab_name.isEmpty() && !sch_types.empty())
+				{
+					for(auto &attribs : cat.getObjectsNames(sch_types, task.sch_name))
+					{
+						obj_type=static_cast<ObjectType>(attribs[ParsersAttributes::OBJECT_TYPE].toUInt());
+						oid=attribs[ParsersAttributes::OID].toUInt();
+						sch_itr=sch_oids.find(obj_type);
+
+						if(sch_itr!=sch_oids.end() && sch_itr->second.count(oid))
+							task_oids[obj_type].push_back(oid);
+					}
+				}
+
+				for(auto &itr : task_oids)
+				{
+					if(import_canceled)
+						break;
+
+					//Only columns need the schema and table names since the other objects are retrieved by their oids
+					if(itr.first==OBJ_COLUMN)
+						objects=cat.getObjectsAttributes(OBJ_COLUMN, task.sch_name, task.tab_name, itr.second);
+					else
+						objects=cat.getObjectsAttributes(itr.first, QString(), QString(), itr.second);
+
+					QMutexLocker locker(&merge_mutex);
+
+					for(auto &attribs : objects)
+					{
+						oid=attribs.at(ParsersAttributes::OID).toUInt();
+
+						if(itr.first==OBJ_COLUMN)
+							columns[attribs.at(ParsersAttributes::TABLE).toUInt()][oid]=attribs;
+						else
+							user_objs[oid]=attribs;
+					}
+				}
+
+				done_tasks++;
+			}
+		}
+		catch(Exception &e)
+		{
+			QMutexLocker locker(&merge_mutex);
+
+			//Stops the other workers since the import will be aborted anyway
+			next_task=tasks.size();
+			worker_errors.push_back(Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__));
+		}
+	};
+
+	if(tasks.empty())
+		return;
+
+	try
+	{
+		/* The catalog copies are created before starting the threads because copying reads the main catalog
+		and connects to the server, each copy acquiring its own connection from the pool */
+		for(unsigned i=1; i < worker_cnt; i++)
+			catalogs.push_back(new Catalog(catalog));
+	}
+	catch(Exception &e)
+	{
+		for(auto &cat : catalogs)
+			delete(cat);
+
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	for(auto &cat : catalogs)
+		workers.push_back(std::thread(run_tasks, std::ref(*cat), false));
+
+	run_tasks(catalog, true);
+
+	for(auto &worker : workers)
+		worker.join();
+
+	//Destroying the copies gives back their connections to the pool
+	for(auto &cat : catalogs)
+		delete(cat);
+
+	if(!worker_errors.empty())
+	{
+		Exception &e=worker_errors.front();
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+}
+
+void DatabaseImportHelper::resolveObjectNames(void)
+{
+	vector<unsigned> oids;
+	vector<QString> names;
+	vector<std::thread> workers;
+	unsigned worker_cnt=getWorkerCount();
+
+	auto resolve_names=[&](unsigned first_idx)
+	{
+		for(unsigned idx=first_idx; idx < oids.size() && !import_canceled; idx+=worker_cnt)
+			names[idx]=resolveObjectName(oids[idx]);
+	};
+
+	emit s_progressUpdated(100, trUtf8("Resolving objects names..."), BASE_OBJECT);
+
+	for(auto &itr : system_objs)
+		oids.push_back(itr.first);
+
+	for(auto &itr : user_objs)
+		oids.push_back(itr.first);
+
+	/* The attributes maps are not changed at this point so they can be read by all workers at the same time,
+	each worker writing only to its own positions of the names vector */
+	names.resize(oids.size());
+
+	for(unsigned i=1; i < worker_cnt; i++)
+		workers.push_back(std::thread(resolve_names, i));
+
+	resolve_names(0);
+
+	for(auto &worker : workers)
+		worker.join();
+
+	for(unsigned i=0; i < oids.size() && !import_canceled; i++)
+		obj_names[oids[i]]=names[i];
+}
+
+QString DatabaseImportHelper::resolveObjectName(unsigned oid) const
+{
+	map<unsigned, attribs_map>::const_iterator obj_itr;
+	attribs_map::const_iterator attr_itr;
+	QString obj_name, sch_oid;
+	ObjectType obj_type=BASE_OBJECT;
+
+	obj_itr=system_objs.find(oid);
+
+	if(obj_itr==system_objs.end())
+	{
+		obj_itr=user_objs.find(oid);
+
+		if(obj_itr==user_objs.end())
+			return(QString());
+	}
+
+	const attribs_map &obj_attr=obj_itr->second;
+
+	if((attr_itr=obj_attr.find(ParsersAttributes::NAME))!=obj_attr.end())
+		obj_name=attr_itr->second;
+
+	if((attr_itr=obj_attr.find(ParsersAttributes::OBJECT_TYPE))!=obj_attr.end())
+		obj_type=static_cast<ObjectType>(attr_itr->second.toUInt());
+
+	if((attr_itr=obj_attr.find(ParsersAttributes::SCHEMA))!=obj_attr.end())
+		sch_oid=attr_itr->second;
+
+	//If the object accepts an schema retrieve the schema name too
+	if(BaseObject::acceptsSchema(obj_type) && sch_oid.toUInt() > 0)
+	{
+		QString sch_name=resolveObjectName(sch_oid.toUInt());
+
+		if(!sch_name.isEmpty())
+			obj_name.prepend(sch_name + QString("."));
+	}
+
+	return(obj_name);
+}
+
 void DatabaseImportHelper::retrieveTableColumns(const QString &sch_name, const QString &tab_name, vector<unsigned> col_ids)
 {
 	try
@@ -285,7 +591,7 @@ void DatabaseImportHelper::retrieveTableColumns(const QString &sch_name, const Q
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -346,6 +652,7 @@ void DatabaseImportHelper::createObjects(void)
 		 which determines an unrecoverable errors, e.g., objects that references
 		 system objects and this ones was not imported */
 			prev_size=not_created_objs.size();
+			TRACE_SAMPLE(QString("import.recreated objects"), prev_size);
 
 			progress=0;
 			oids=not_created_objs;
@@ -375,7 +682,7 @@ void DatabaseImportHelper::createObjects(void)
 				{
 					//In case of some error store the oid and the error in separated lists
 					not_created_objs.push_back(*itr);
-					aux_errors.push_back(Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e, dumpObjectAttributes(attribs)));
+					aux_errors.push_back(Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, dumpObjectAttributes(attribs)));
 				}
 
 				progress=(i/static_cast<float>(not_created_objs.size())) * 100;
@@ -436,9 +743,9 @@ void DatabaseImportHelper::createConstraints(void)
 		catch(Exception &e)
 		{
 			if(ignore_errors)
-				errors.push_back(Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e, dumpObjectAttributes(attribs)));
+				errors.push_back(Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, dumpObjectAttributes(attribs)));
 			else
-				throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+				throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		}
 
 		progress=(i/static_cast<float>(constr_creation_order.size())) * 100;
@@ -498,9 +805,9 @@ void DatabaseImportHelper::createPermissions(void)
 	catch(Exception &e)
 	{
 		if(ignore_errors)
-			errors.push_back(Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e, dumpObjectAttributes(attribs)));
+			errors.push_back(Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, dumpObjectAttributes(attribs)));
 		else
-			throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+			throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -536,12 +843,14 @@ void DatabaseImportHelper::updateFKRelationships(void)
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
 void DatabaseImportHelper::importDatabase(void)
 {
+	TRACE_SCOPE("import", "importDatabase");
+
 	try
 	{
 		if(!dbmodel)
@@ -639,10 +948,10 @@ void DatabaseImportHelper::importDatabase(void)
 		/* When running in a separated thread (other than the main application thread)
 		redirects the error in form of signal */
 		if(this->thread() && this->thread()!=qApp->thread())
-			emit s_importAborted(Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, e.getExtraInfo()));
+			emit s_importAborted(Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, e.getExtraInfo()));
 		else
 			//Redirects any error to the user
-			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, e.getExtraInfo());
+			throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, e.getExtraInfo());
 	}
 }
 
@@ -673,18 +982,20 @@ void DatabaseImportHelper::createObject(attribs_map &attribs)
 			if(TableObject::isTableObject(obj_type))
 				attribs[ParsersAttributes::DECL_IN_TABLE]=QString();
 
+			/* The objects are created directly from the attributes record (see DatabaseModel::create*(attribs_map &))
+			 so the references to owner, tablespace and schema are stored only by name and the comment is kept as raw text.
+			 Their nested parts (columns, parameters, elements, etc) are built here and assigned after the object creation */
+			QString ref_attribs[]={ ParsersAttributes::OWNER, ParsersAttributes::TABLESPACE, ParsersAttributes::SCHEMA };
+			ObjectType ref_types[]={ OBJ_ROLE, OBJ_TABLESPACE, OBJ_SCHEMA };
+
 			//System objects will have the sql disabled by default
 			attribs[ParsersAttributes::SQL_DISABLED]=(catalog.isSystemObject(oid) || catalog.isExtensionObject(oid) ? ParsersAttributes::_TRUE_ : QString());
-			attribs[ParsersAttributes::COMMENT]=getComment(attribs);
-
-			if(attribs.count(ParsersAttributes::OWNER))
-				attribs[ParsersAttributes::OWNER]=getDependencyObject(attribs[ParsersAttributes::OWNER], OBJ_ROLE, false, auto_resolve_deps);
 
-			if(attribs.count(ParsersAttributes::TABLESPACE))
-				attribs[ParsersAttributes::TABLESPACE]=getDependencyObject(attribs[ParsersAttributes::TABLESPACE], OBJ_TABLESPACE, false, auto_resolve_deps);
-
-			if(attribs.count(ParsersAttributes::SCHEMA))
-				attribs[ParsersAttributes::SCHEMA]=getDependencyObject(attribs[ParsersAttributes::SCHEMA], OBJ_SCHEMA, false, auto_resolve_deps);
+			for(unsigned i=0; i < 3; i++)
+			{
+				if(attribs.count(ref_attribs[i]))
+					attribs[ref_attribs[i]]=getDependencyObject(attribs[ref_attribs[i]], ref_types[i], false, auto_resolve_deps);
+			}
 
 			/* Due to the object recreation mechanism there are some situations when pgModeler fails to recreate
 			them due to the duplication of permissions. So, to avoid this problem we need to check if the OID of the
@@ -738,38 +1049,21 @@ void DatabaseImportHelper::createObject(attribs_map &attribs)
 			/* Register the object oid on the list of created objects to avoid creating it again
 				 on recursive object creation. (see getDependencyObject()) */
 			created_objs.push_back(oid);
+			TRACE_COUNTER("import", QString("created %1").arg(BaseObject::getSchemaName(obj_type)), 1);
 		}
 	}
 	catch(Exception &e)
 	{
-		throw Exception(Exception::getErrorMessage(ERR_OBJECT_NOT_IMPORTED)
-										.arg(obj_name).arg(BaseObject::getTypeName(obj_type)).arg(attribs[ParsersAttributes::OID]),
-										ERR_OBJECT_NOT_IMPORTED,__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, dumpObjectAttributes(attribs));
+		TRACE_COUNTER("import", QString("failed objects"), 1);
+		throw Exception(ERR_OBJECT_NOT_IMPORTED, { obj_name, BaseObject::getTypeName(obj_type), attribs[ParsersAttributes::OID] },__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, dumpObjectAttributes(attribs));
 	}
 }
 
-QString DatabaseImportHelper::getComment(attribs_map &attribs)
+QString DatabaseImportHelper::getDependencyObject(const QString &oid, ObjectType obj_type, bool use_signature, bool recursive_dep_res, attribs_map extra_attribs)
 {
 	try
 	{
-		QString xml_def;
-
-		if(!attribs[ParsersAttributes::COMMENT].isEmpty())
-			xml_def=schparser.getCodeDefinition(ParsersAttributes::COMMENT, attribs, SchemaParser::XML_DEFINITION);
-
-		return(xml_def);
-	}
-	catch(Exception &e)
-	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
-	}
-}
-
-QString DatabaseImportHelper::getDependencyObject(const QString &oid, ObjectType obj_type, bool use_signature, bool recursive_dep_res, bool generate_xml, attribs_map extra_attribs)
-{
-	try
-	{
-		QString xml_def;
+		QString obj_name;
 		unsigned obj_oid=oid.toUInt();
 
 		if(obj_oid > 0)
@@ -803,10 +1097,9 @@ QString DatabaseImportHelper::getDependencyObject(const QString &oid, ObjectType
 				}
 			}
 
+			//Unknown objects (without attributes) are simply ignored when creating the object from the record
 			if(!obj_attr.empty())
 			{
-				QString obj_name;
-
 				while(itr!=extra_attribs.end())
 				{
 					obj_attr[itr->first]=itr->second;
@@ -819,59 +1112,15 @@ QString DatabaseImportHelper::getDependencyObject(const QString &oid, ObjectType
 						obj_type!=OBJ_DATABASE && dbmodel->getObjectIndex(obj_attr[ParsersAttributes::NAME], obj_type) < 0)
 					createObject(obj_attr);
 
-				if(use_signature)
-					obj_name=obj_attr[ParsersAttributes::SIGNATURE]=getObjectName(oid, true);
-				else
-					obj_name=obj_attr[ParsersAttributes::NAME]=getObjectName(oid);
-
-				if(generate_xml)
-				{
-					obj_attr[ParsersAttributes::REDUCED_FORM]=ParsersAttributes::_TRUE_;
-					schparser.ignoreUnkownAttributes(true);
-					xml_def=schparser.getCodeDefinition(BaseObject::getSchemaName(obj_type), obj_attr, SchemaParser::XML_DEFINITION);
-					schparser.ignoreUnkownAttributes(false);
-				}
-				else
-					xml_def=obj_name;
+				obj_name=getObjectName(oid, use_signature);
 			}
-			else
-				/* If the object oid is valid but there is no attribute set to it creates a xml definition
-					 containing an alert indicating that the object is unknown */
-				xml_def=QString(UNKNOWN_OBJECT_OID_XML).arg(oid);
-		}
-
-		return(xml_def);
-	}
-	catch(Exception &e)
-	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
-	}
-}
-
-void DatabaseImportHelper::loadObjectXML(ObjectType obj_type, attribs_map &attribs)
-{
-	QString xml_buf;
-
-	try
-	{
-		schparser.ignoreUnkownAttributes(true);
-		xml_buf=schparser.getCodeDefinition(BaseObject::getSchemaName(obj_type), attribs, SchemaParser::XML_DEFINITION);
-
-		schparser.ignoreUnkownAttributes(false);
-		xmlparser->restartParser();
-
-		if(debug_mode)
-		{
-			QTextStream ts(stdout);
-			ts << QString("<!-- XML code: %1 (OID: %2) -->").arg(attribs[ParsersAttributes::NAME]).arg(attribs[ParsersAttributes::OID]) << endl;
-			ts << xml_buf << endl;
 		}
 
-		xmlparser->loadXMLBuffer(xml_buf);
+		return(obj_name);
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xml_buf);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -887,6 +1136,7 @@ void DatabaseImportHelper::resetImportParameters(void)
 	creation_order.clear();
 	seq_tab_swap.clear();
 	columns.clear();
+	obj_names.clear();
 	system_objs.clear();
 	created_objs.clear();
 	errors.clear();
@@ -920,14 +1170,13 @@ void DatabaseImportHelper::createTablespace(attribs_map &attribs)
 
 	try
 	{
-		loadObjectXML(OBJ_TABLESPACE, attribs);
-		tabspc=dbmodel->createTablespace();
+		tabspc=dbmodel->createTablespace(attribs);
 		dbmodel->addObject(tabspc);
 	}
 	catch(Exception &e)
 	{
 		if(tabspc) delete(tabspc);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -942,16 +1191,14 @@ void DatabaseImportHelper::createSchema(attribs_map &attribs)
 		attribs[ParsersAttributes::FILL_COLOR]=QColor(dist(rand_num_engine),
 													  dist(rand_num_engine),
 													  dist(rand_num_engine)).name();
-		loadObjectXML(OBJ_SCHEMA, attribs);
 
-		schema=dbmodel->createSchema();
+		schema=dbmodel->createSchema(attribs);
 		dbmodel->addObject(schema);
 	}
 	catch(Exception &e)
 	{
 		if(schema) delete(schema);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -968,15 +1215,13 @@ void DatabaseImportHelper::createRole(attribs_map &attribs)
 		for(unsigned i=0; i < 3; i++)
 			attribs[role_types[i]]=getObjectNames(attribs[role_types[i]]).join(',');
 
-		loadObjectXML(OBJ_ROLE, attribs);
-		role=dbmodel->createRole();
+		role=dbmodel->createRole(attribs);
 		dbmodel->addObject(role);
 	}
 	catch(Exception &e)
 	{
 		if(role) delete(role);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -984,13 +1229,24 @@ void DatabaseImportHelper::createDomain(attribs_map &attribs)
 {
 	Domain *dom=nullptr;
 	QStringList constraints, constr_attrs;
-	attribs_map aux_attribs;
 	QString expr;
 
 	try
 	{
+		PgSQLType dom_type=PgSQLType::parseString(getType(attribs[ParsersAttributes::TYPE]));
+
+		//The type's modifiers are retrieved separately from the type's name
+		if(!attribs[ParsersAttributes::LENGTH].isEmpty())
+			dom_type.setLength(attribs[ParsersAttributes::LENGTH].toUInt());
+
+		if(!attribs[ParsersAttributes::PRECISION].isEmpty())
+			dom_type.setPrecision(attribs[ParsersAttributes::PRECISION].toInt());
+
+		attribs[ParsersAttributes::COLLATION]=getDependencyObject(attribs[ParsersAttributes::COLLATION], OBJ_COLLATION);
+		dom=dbmodel->createDomain(attribs);
+		dom->setType(dom_type);
+
 		constraints = Catalog::parseArrayValues(attribs[ParsersAttributes::CONSTRAINTS]);
-		attribs[ParsersAttributes::CONSTRAINTS].clear();
 
 		for(auto constr : constraints)
 		{
@@ -998,27 +1254,18 @@ void DatabaseImportHelper::createDomain(attribs_map &attribs)
 			constr.remove(constr.length() - 1, 1);
 			constr_attrs = constr.split(QChar(':'));
 
-			aux_attribs[ParsersAttributes::NAME] = constr_attrs.at(0);
-
 			expr = constr_attrs.at(1);
 			expr.remove(0,1);
 			expr.remove(expr.length() - 1,1);
-			aux_attribs[ParsersAttributes::EXPRESSION] = expr;
-
-			attribs[ParsersAttributes::CONSTRAINTS]+= schparser.getCodeDefinition(ParsersAttributes::DOM_CONSTRAINT, aux_attribs, SchemaParser::XML_DEFINITION);
+			dom->addCheckConstraint(constr_attrs.at(0), expr);
 		}
 
-		attribs[ParsersAttributes::TYPE]=getType(attribs[ParsersAttributes::TYPE], true, attribs);
-		attribs[ParsersAttributes::COLLATION]=getDependencyObject(attribs[ParsersAttributes::COLLATION], OBJ_COLLATION);
-		loadObjectXML(OBJ_DOMAIN, attribs);
-		dom=dbmodel->createDomain();
 		dbmodel->addDomain(dom);
 	}
 	catch(Exception &e)
 	{
 		if(dom) delete(dom);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1028,15 +1275,13 @@ void DatabaseImportHelper::createExtension(attribs_map &attribs)
 
 	try
 	{
-		loadObjectXML(OBJ_EXTENSION, attribs);
-		ext=dbmodel->createExtension();
+		ext=dbmodel->createExtension(attribs);
 		dbmodel->addExtension(ext);
 	}
 	catch(Exception &e)
 	{
 		if(ext) delete(ext);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1046,13 +1291,13 @@ void DatabaseImportHelper::createFunction(attribs_map &attribs)
 	Parameter param;
 	PgSQLType type;
 	unsigned dim=0;
-	QStringList param_types, param_names, param_modes, param_def_vals, param_xmls;
+	QStringList param_types, param_names, param_modes, param_def_vals;
 	QString param_tmpl_name=QString("_param%1");
-	vector<Parameter> parameters;
+	vector<Parameter> parameters, ret_table_cols;
 
 	try
 	{
-		param_types=getTypes(attribs[ParsersAttributes::ARG_TYPES], false);
+		param_types=getTypes(attribs[ParsersAttributes::ARG_TYPES]);
 		param_names=Catalog::parseArrayValues(attribs[ParsersAttributes::ARG_NAMES]);
 		param_modes=Catalog::parseArrayValues(attribs[ParsersAttributes::ARG_MODES]);
 		param_def_vals=Catalog::parseDefaultValues(attribs[ParsersAttributes::ARG_DEFAULTS]);
@@ -1103,7 +1348,7 @@ void DatabaseImportHelper::createFunction(attribs_map &attribs)
 
 			//If the mode is 't' indicates that the current parameter will be used as a return table colum
 			if(!param_modes.isEmpty() && param_modes[i]==QString("t"))
-				attribs[ParsersAttributes::RETURN_TABLE]+=param.getCodeDefinition(SchemaParser::XML_DEFINITION);
+				ret_table_cols.push_back(param);
 			else
 				parameters.push_back(param);
 		}
@@ -1117,20 +1362,15 @@ void DatabaseImportHelper::createFunction(attribs_map &attribs)
 
 			while(ritr != ritr_end)
 			{
-				param = *ritr;
-				ritr++;
-
 				//Setting the default value for the current paramenter. OUT parameter doesn't receive default values.
-				if(!param_def_vals.isEmpty() && (!param.isOut() || (param.isIn() && param.isOut())))
+				if(!param_def_vals.isEmpty() && (!ritr->isOut() || (ritr->isIn() && ritr->isOut())))
 				{
-					param.setDefaultValue(param_def_vals.back());
+					ritr->setDefaultValue(param_def_vals.back());
 					param_def_vals.pop_back();
 				}
 
-				param_xmls.push_front(param.getCodeDefinition(SchemaParser::XML_DEFINITION));
+				ritr++;
 			}
-
-			attribs[ParsersAttributes::PARAMETERS]+=param_xmls.join(QChar('\n'));
 		}
 
 		//Case the function's language is C the symbol is the 'definition' attribute
@@ -1140,31 +1380,38 @@ void DatabaseImportHelper::createFunction(attribs_map &attribs)
 			attribs[ParsersAttributes::DEFINITION]=QString();
 		}
 
-		//Get the language reference code
+		//Get the language name
 		attribs[ParsersAttributes::LANGUAGE]=getDependencyObject(attribs[ParsersAttributes::LANGUAGE], OBJ_LANGUAGE);
 
 		//Get the return type if there is no return table configured
-		if(attribs[ParsersAttributes::RETURN_TABLE].isEmpty())
+		if(!ret_table_cols.empty())
+			attribs[ParsersAttributes::RETURN_TYPE].clear();
+		else
 		{
 			/* If the function is to be used as a user-defined data type support functions
 				 the return type will be renamed to "any" (see rules on Type::setFunction()) */
 			if(attribs[ParsersAttributes::REF_TYPE]==ParsersAttributes::INPUT_FUNC ||
 					attribs[ParsersAttributes::REF_TYPE]==ParsersAttributes::RECV_FUNC ||
 					attribs[ParsersAttributes::REF_TYPE]==ParsersAttributes::CANONICAL_FUNC)
-				attribs[ParsersAttributes::RETURN_TYPE]=PgSQLType(QString("\"any\"")).getCodeDefinition(SchemaParser::XML_DEFINITION);
+				attribs[ParsersAttributes::RETURN_TYPE]=QString("\"any\"");
 			else
-				attribs[ParsersAttributes::RETURN_TYPE]=getType(attribs[ParsersAttributes::RETURN_TYPE], true);
+				attribs[ParsersAttributes::RETURN_TYPE]=getType(attribs[ParsersAttributes::RETURN_TYPE]);
 		}
 
-		loadObjectXML(OBJ_FUNCTION, attribs);
-		func=dbmodel->createFunction();
+		func=dbmodel->createFunction(attribs);
+
+		for(auto &col : ret_table_cols)
+			func->addReturnedTableColumn(col.getName(), col.getType());
+
+		for(auto &func_param : parameters)
+			func->addParameter(func_param);
+
 		dbmodel->addFunction(func);
 	}
 	catch(Exception &e)
 	{
 		if(func) delete(func);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1188,20 +1435,18 @@ void DatabaseImportHelper::createLanguage(attribs_map &attribs)
 				 function is defined after the language pgModeler will raise errors so in order to continue
 				 the import these fuctions are simply ignored */
 			if(func_oid < lang_oid)
-				attribs[func_types[i]]=getDependencyObject(attribs[func_types[i]], OBJ_FUNCTION, true , true, true, {{ParsersAttributes::REF_TYPE, func_types[i]}});
+				attribs[func_types[i]]=getDependencyObject(attribs[func_types[i]], OBJ_FUNCTION, true);
 			else
 				attribs[func_types[i]]=QString();
 		}
 
-		loadObjectXML(OBJ_LANGUAGE, attribs);
-		lang=dbmodel->createLanguage();
+		lang=dbmodel->createLanguage(attribs);
 		dbmodel->addLanguage(lang);
 	}
 	catch(Exception &e)
 	{
 		if(lang) delete(lang);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1211,15 +1456,13 @@ void DatabaseImportHelper::createOperatorFamily(attribs_map &attribs)
 
 	try
 	{
-		loadObjectXML(OBJ_OPFAMILY, attribs);
-		opfam=dbmodel->createOperatorFamily();
+		opfam=dbmodel->createOperatorFamily(attribs);
 		dbmodel->addOperatorFamily(opfam);
 	}
 	catch(Exception &e)
 	{
 		if(opfam) delete(opfam);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1229,79 +1472,68 @@ void DatabaseImportHelper::createOperatorClass(attribs_map &attribs)
 
 	try
 	{
-		attribs_map elem_attr;
-		vector<attribs_map> elems;
+		OperatorClassElement elem;
 		QStringList array_vals, list;
+		QString fam_name;
+		BaseObject *family=nullptr;
 
 		attribs[ParsersAttributes::FAMILY]=getObjectName(attribs[ParsersAttributes::FAMILY], true);
-		attribs[ParsersAttributes::TYPE]=getType(attribs[ParsersAttributes::TYPE], true, attribs);
+		attribs[ParsersAttributes::TYPE]=getType(attribs[ParsersAttributes::TYPE]);
+		opclass=dbmodel->createOperatorClass(attribs);
 
-		//Generating attributes for STORAGE elements
+		//Creating the STORAGE element
 		if(attribs[ParsersAttributes::STORAGE]!=QString("0"))
 		{
-			elem_attr[ParsersAttributes::STORAGE]=ParsersAttributes::_TRUE_;
-			elem_attr[ParsersAttributes::DEFINITION]=getType(attribs[ParsersAttributes::STORAGE], true);
-			elems.push_back(elem_attr);
+			elem=OperatorClassElement();
+			elem.setStorage(PgSQLType::parseString(getType(attribs[ParsersAttributes::STORAGE])));
+			opclass->addElement(elem);
 		}
 		else if(attribs[ParsersAttributes::FUNCTION].isEmpty() &&
 				attribs[ParsersAttributes::OPERATOR].isEmpty())
 		{
-			elem_attr[ParsersAttributes::STORAGE]=ParsersAttributes::_TRUE_;
-			elem_attr[ParsersAttributes::DEFINITION]=attribs[ParsersAttributes::TYPE];
-			elems.push_back(elem_attr);
+			elem=OperatorClassElement();
+			elem.setStorage(opclass->getDataType());
+			opclass->addElement(elem);
 		}
 
-		//Generating attributes for FUNCTION elements
-		if(!attribs[ParsersAttributes::FUNCTION].isEmpty())
-		{
-			elem_attr.clear();
-			elem_attr[ParsersAttributes::FUNCTION]=ParsersAttributes::_TRUE_;
-			array_vals=Catalog::parseArrayValues(attribs[ParsersAttributes::FUNCTION]);
+		//Creating the FUNCTION elements
+		array_vals=Catalog::parseArrayValues(attribs[ParsersAttributes::FUNCTION]);
 
-			for(int i=0; i < array_vals.size(); i++)
-			{
-				list=array_vals[i].split(':');
-				elem_attr[ParsersAttributes::STRATEGY_NUM]=list[0];
-				elem_attr[ParsersAttributes::DEFINITION]=getDependencyObject(list[1], OBJ_FUNCTION, true);
-				elems.push_back(elem_attr);
-			}
+		for(int i=0; i < array_vals.size(); i++)
+		{
+			list=array_vals[i].split(':');
+			elem=OperatorClassElement();
+			elem.setFunction(dynamic_cast<Function *>(dbmodel->getObject(getDependencyObject(list[1], OBJ_FUNCTION, true), OBJ_FUNCTION)),
+											 list[0].toUInt());
+			opclass->addElement(elem);
 		}
 
-		//Generating attributes for OPERATOR elements
-		if(!attribs[ParsersAttributes::OPERATOR].isEmpty())
+		//Creating the OPERATOR elements
+		array_vals=Catalog::parseArrayValues(attribs[ParsersAttributes::OPERATOR]);
+
+		for(int i=0; i < array_vals.size(); i++)
 		{
-			elem_attr.clear();
-			elem_attr[ParsersAttributes::OPERATOR]=ParsersAttributes::_TRUE_;
-			array_vals=Catalog::parseArrayValues(attribs[ParsersAttributes::OPERATOR]);
+			list=array_vals[i].split(':');
+			elem=OperatorClassElement();
+			elem.setOperator(dynamic_cast<Operator *>(dbmodel->getObject(getDependencyObject(list[1], OBJ_OPERATOR, true), OBJ_OPERATOR)),
+											 list[0].toUInt());
 
-			for(int i=0; i < array_vals.size(); i++)
-			{
-				list=array_vals[i].split(':');
-				elem_attr[ParsersAttributes::DEFINITION]="";
-				elem_attr[ParsersAttributes::STRATEGY_NUM]=list[0];
-				elem_attr[ParsersAttributes::DEFINITION]+=getDependencyObject(list[1], OBJ_OPERATOR, true);
-				elem_attr[ParsersAttributes::DEFINITION]+=getDependencyObject(list[2], OBJ_OPFAMILY, true);
-				elems.push_back(elem_attr);
-			}
-		}
+			fam_name=getDependencyObject(list[2], OBJ_OPFAMILY, true);
+			family=dbmodel->getObject(fam_name, OBJ_OPFAMILY);
 
-		//Generating the complete XML code for operator class elements
-		for(unsigned i=0; i < elems.size(); i++)
-		{
-			schparser.ignoreUnkownAttributes(true);
-			attribs[ParsersAttributes::ELEMENTS]+=schparser.getCodeDefinition(ParsersAttributes::ELEMENT, elems[i], SchemaParser::XML_DEFINITION);
-			schparser.ignoreUnkownAttributes(false);
+			if(!family && !fam_name.isEmpty())
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { opclass->getName(), opclass->getTypeName(), fam_name, BaseObject::getTypeName(OBJ_OPFAMILY) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			elem.setOperatorFamily(dynamic_cast<OperatorFamily *>(family));
+			opclass->addElement(elem);
 		}
 
-		loadObjectXML(OBJ_OPCLASS, attribs);
-		opclass=dbmodel->createOperatorClass();
 		dbmodel->addOperatorClass(opclass);
 	}
 	catch(Exception &e)
 	{
 		if(opclass) delete(opclass);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1311,11 +1543,7 @@ void DatabaseImportHelper::createOperator(attribs_map &attribs)
 
 	try
 	{
-		int pos;
-		QRegExp regexp;
-		QString op_signature,
-
-				func_types[]={ ParsersAttributes::OPERATOR_FUNC,
+		QString func_types[]={ ParsersAttributes::OPERATOR_FUNC,
 							   ParsersAttributes::RESTRICTION_FUNC,
 							   ParsersAttributes::JOIN_FUNC },
 
@@ -1326,41 +1554,32 @@ void DatabaseImportHelper::createOperator(attribs_map &attribs)
 							   ParsersAttributes::NEGATOR_OP };
 
 		for(unsigned i=0; i < 3; i++)
-			attribs[func_types[i]]=getDependencyObject(attribs[func_types[i]], OBJ_FUNCTION, true, true, true, {{ParsersAttributes::REF_TYPE, func_types[i]}});
+			attribs[func_types[i]]=getDependencyObject(attribs[func_types[i]], OBJ_FUNCTION, true);
 
 		for(unsigned i=0; i < 2; i++)
-			attribs[arg_types[i]]=getType(attribs[arg_types[i]], true, {{ParsersAttributes::REF_TYPE, arg_types[i]}});
+			attribs[arg_types[i]]=getType(attribs[arg_types[i]]);
 
-		regexp.setPattern(ParsersAttributes::SIGNATURE + QString("(=)(\")"));
 		for(unsigned i=0; i < 2; i++)
 		{
-			attribs[op_types[i]]=getDependencyObject(attribs[op_types[i]], OBJ_OPERATOR, true, false, true, {{ParsersAttributes::REF_TYPE, op_types[i]}});
-
-			if(!attribs[op_types[i]].isEmpty())
-			{
-				/* Extracting the operator's signature to check if it was previouly created:
-					Defining a operator as ++(A,B) and it's commutator as *++(B,A) PostgreSQL will automatically
-					create on the second operator a commutator reference to ++(A,B). But to pgModeler only the first
-					reference is valid, so the extracted signature is used to check if the commutator was previously
-					created in order to avoid reference errors */
-				pos=regexp.indexIn(attribs[op_types[i]]) + regexp.matchedLength();
-				op_signature=attribs[op_types[i]].mid(pos, (attribs[op_types[i]].indexOf('"',pos) - pos));
-
-				//If the operator is not defined clear up the reference to it
-				if(dbmodel->getObjectIndex(op_signature, OBJ_OPERATOR) < 0)
-					attribs[op_types[i]].clear();
-			}
+			attribs[op_types[i]]=getDependencyObject(attribs[op_types[i]], OBJ_OPERATOR, true, false);
+
+			/* Checking if the operator's commutator/negator was previouly created:
+				Defining a operator as ++(A,B) and it's commutator as *++(B,A) PostgreSQL will automatically
+				create on the second operator a commutator reference to ++(A,B). But to pgModeler only the first
+				reference is valid, so if the operator is not defined the reference to it is cleared up in order
+				to avoid reference errors */
+			if(!attribs[op_types[i]].isEmpty() &&
+				 dbmodel->getObjectIndex(attribs[op_types[i]], OBJ_OPERATOR) < 0)
+				attribs[op_types[i]].clear();
 		}
 
-		loadObjectXML(OBJ_OPERATOR, attribs);
-		oper=dbmodel->createOperator();
+		oper=dbmodel->createOperator(attribs);
 		dbmodel->addOperator(oper);
 	}
 	catch(Exception &e)
 	{
 		if(oper) delete(oper);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1370,15 +1589,13 @@ void DatabaseImportHelper::createCollation(attribs_map &attribs)
 
 	try
 	{
-		loadObjectXML(OBJ_COLLATION, attribs);
-		coll=dbmodel->createCollation();
+		coll=dbmodel->createCollation(attribs);
 		dbmodel->addCollation(coll);
 	}
 	catch(Exception &e)
 	{
 		if(coll) delete(coll);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1389,17 +1606,15 @@ void DatabaseImportHelper::createCast(attribs_map &attribs)
 	try
 	{
 		attribs[ParsersAttributes::FUNCTION]=getDependencyObject(attribs[ParsersAttributes::FUNCTION], OBJ_FUNCTION, true);
-		attribs[ParsersAttributes::SOURCE_TYPE]=getType(attribs[ParsersAttributes::SOURCE_TYPE], true);
-		attribs[ParsersAttributes::DEST_TYPE]=getType(attribs[ParsersAttributes::DEST_TYPE], true);
-		loadObjectXML(OBJ_CAST, attribs);
-		cast=dbmodel->createCast();
+		attribs[ParsersAttributes::SOURCE_TYPE]=getType(attribs[ParsersAttributes::SOURCE_TYPE]);
+		attribs[ParsersAttributes::DEST_TYPE]=getType(attribs[ParsersAttributes::DEST_TYPE]);
+		cast=dbmodel->createCast(attribs);
 		dbmodel->addCast(cast);
 	}
 	catch(Exception &e)
 	{
 		if(cast) delete(cast);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1410,15 +1625,13 @@ void DatabaseImportHelper::createConversion(attribs_map &attribs)
 	try
 	{
 		attribs[ParsersAttributes::FUNCTION]=getDependencyObject(attribs[ParsersAttributes::FUNCTION], OBJ_FUNCTION, true, auto_resolve_deps);
-		loadObjectXML(OBJ_CONVERSION, attribs);
-		conv=dbmodel->createConversion();
+		conv=dbmodel->createConversion(attribs);
 		dbmodel->addConversion(conv);
 	}
 	catch(Exception &e)
 	{
 		if(conv) delete(conv);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1444,18 +1657,14 @@ void DatabaseImportHelper::createSequence(attribs_map &attribs)
 		{
 			Table *tab = nullptr;
 			QString col_name, tab_name;
-			attribs_map pos_attrib={
-				{ ParsersAttributes::X_POS, QString("0") },
-				{ ParsersAttributes::Y_POS, QString("0") }};
 
 			if(attribs[ParsersAttributes::OID].toUInt() > owner_col[0].toUInt())
 				seq_tab_swap[attribs[ParsersAttributes::OID]]=owner_col[0];
 
 			/* Get the table and the owner column instances so the sequence code can be disabled if the
 				column is an identity one */
-			tab_name = getDependencyObject(owner_col[0], OBJ_TABLE, true, auto_resolve_deps, false,
-			{{ ParsersAttributes::POSITION,
-				 schparser.getCodeDefinition(ParsersAttributes::POSITION, pos_attrib, SchemaParser::XML_DEFINITION)}});
+			tab_name = getDependencyObject(owner_col[0], OBJ_TABLE, true, auto_resolve_deps,
+			{{ ParsersAttributes::X_POS, QString("0") }, { ParsersAttributes::Y_POS, QString("0") }});
 
 			col_name=getColumnName(owner_col[0], owner_col[1]);
 			tab = dbmodel->getTable(tab_name);
@@ -1467,8 +1676,10 @@ void DatabaseImportHelper::createSequence(attribs_map &attribs)
 		for(int i=0; i < seq_attribs.size(); i++)
 			attribs[attr[i]]=seq_attribs[i];
 
-		loadObjectXML(OBJ_SEQUENCE, attribs);
-		seq=dbmodel->createSequence();
+		//The catalog returns a null cycle attribute for non cyclic sequences
+		attribs[ParsersAttributes::CYCLE]=(!attribs[ParsersAttributes::CYCLE].isEmpty() ? ParsersAttributes::_TRUE_ : QString());
+
+		seq=dbmodel->createSequence(attribs);
 		dbmodel->addSequence(seq);
 
 		//Disable the sequence's SQL when the owner column is identity
@@ -1482,8 +1693,7 @@ void DatabaseImportHelper::createSequence(attribs_map &attribs)
 	catch(Exception &e)
 	{
 		if(seq) delete(seq);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1493,29 +1703,22 @@ void DatabaseImportHelper::createAggregate(attribs_map &attribs)
 
 	try
 	{
-		QStringList types;
 		QString func_types[]={ ParsersAttributes::TRANSITION_FUNC,
 													 ParsersAttributes::FINAL_FUNC },
 				sch_name;
 
 		for(unsigned i=0; i < 2; i++)
-			attribs[func_types[i]]=getDependencyObject(attribs[func_types[i]], OBJ_FUNCTION, true, auto_resolve_deps, true, {{ParsersAttributes::REF_TYPE, func_types[i]}});
-
-		types=getTypes(attribs[ParsersAttributes::TYPES], true);
-		attribs[ParsersAttributes::TYPES]=QString();
+			attribs[func_types[i]]=getDependencyObject(attribs[func_types[i]], OBJ_FUNCTION, true, auto_resolve_deps);
 
-		if(!types.isEmpty())
-		{
-			for(int i=0; i < types.size(); i++)
-				attribs[ParsersAttributes::TYPES]+=types[i];
-		}
+		attribs[ParsersAttributes::TYPES]=getTypes(attribs[ParsersAttributes::TYPES]).join(',');
+		attribs[ParsersAttributes::STATE_TYPE]=getType(attribs[ParsersAttributes::STATE_TYPE]);
 
-		attribs[ParsersAttributes::STATE_TYPE]=getType(attribs[ParsersAttributes::STATE_TYPE], true,
-		{{ParsersAttributes::REF_TYPE, ParsersAttributes::STATE_TYPE}});
-		attribs[ParsersAttributes::SORT_OP]=getDependencyObject(attribs[ParsersAttributes::SORT_OP], OBJ_OPERATOR, true);
+		/* The sort operator is only resolved as a dependency and not assigned to the aggregate
+		 since the aggregate's XML definition can't hold it yet */
+		getDependencyObject(attribs[ParsersAttributes::SORT_OP], OBJ_OPERATOR, true);
+		attribs[ParsersAttributes::SORT_OP]=QString();
 
-		loadObjectXML(OBJ_AGGREGATE, attribs);
-		agg=dbmodel->createAggregate();
+		agg=dbmodel->createAggregate(attribs);
 		dbmodel->addAggregate(agg);
 
 		/* Removing the schema name from the aggregate name.
@@ -1529,8 +1732,7 @@ void DatabaseImportHelper::createAggregate(attribs_map &attribs)
 	catch(Exception &e)
 	{
 		if(agg) delete(agg);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1540,20 +1742,22 @@ void DatabaseImportHelper::createType(attribs_map &attribs)
 
 	try
 	{
-		attribs[attribs[ParsersAttributes::CONFIGURATION]]=ParsersAttributes::_TRUE_;
+		vector<TypeAttribute> type_attribs;
 
-		if(!attribs[ParsersAttributes::ENUM_TYPE].isEmpty())
+		//The collation is used only by range types (see below)
+		attribs[ParsersAttributes::COLLATION]=QString();
+
+		if(attribs[ParsersAttributes::CONFIGURATION]==ParsersAttributes::ENUM_TYPE)
 		{
 			attribs[ParsersAttributes::ENUMERATIONS]=Catalog::parseArrayValues(attribs[ParsersAttributes::ENUMERATIONS]).join(',');
 			attribs[ParsersAttributes::ENUMERATIONS].remove('"');
 		}
-		else if(!attribs[ParsersAttributes::COMPOSITE_TYPE].isEmpty())
+		else if(attribs[ParsersAttributes::CONFIGURATION]==ParsersAttributes::COMPOSITE_TYPE)
 		{
 			QStringList comp_attribs, values;
 			TypeAttribute type_attrib;
 
 			comp_attribs=Catalog::parseArrayValues(attribs[ParsersAttributes::TYPE_ATTRIBUTE]);
-			attribs[ParsersAttributes::TYPE_ATTRIBUTE]=QString();
 
 			for(int i=0; i < comp_attribs.size(); i++)
 			{
@@ -1561,18 +1765,19 @@ void DatabaseImportHelper::createType(attribs_map &attribs)
 
 				if(values.size() >= 2)
 				{
+					type_attrib=TypeAttribute();
 					type_attrib.setName(values[0].remove('"'));
 					type_attrib.setType(PgSQLType::parseString(values[1].remove('\\')));
 					type_attrib.setCollation(dbmodel->getObject(getObjectName(values[2].remove('"')),	OBJ_COLLATION));
-					attribs[ParsersAttributes::TYPE_ATTRIBUTE]+=type_attrib.getCodeDefinition(SchemaParser::XML_DEFINITION);
+					type_attribs.push_back(type_attrib);
 				}
 			}
 		}
-		else if(!attribs[ParsersAttributes::RANGE_TYPE].isEmpty())
+		else if(attribs[ParsersAttributes::CONFIGURATION]==ParsersAttributes::RANGE_TYPE)
 		{
 			QStringList range_attr=Catalog::parseArrayValues(attribs[ParsersAttributes::RANGE_ATTRIBS]);
 
-			attribs[ParsersAttributes::SUBTYPE]=getType(range_attr[0], true);
+			attribs[ParsersAttributes::SUBTYPE]=getType(range_attr[0]);
 			attribs[ParsersAttributes::COLLATION]=getDependencyObject(range_attr[1], OBJ_COLLATION, true);
 			attribs[ParsersAttributes::OP_CLASS]=getDependencyObject(range_attr[2], OBJ_OPCLASS, true);
 			attribs[ParsersAttributes::CANONICAL_FUNC]=getDependencyObject(range_attr[3], OBJ_FUNCTION, true);
@@ -1590,15 +1795,17 @@ void DatabaseImportHelper::createType(attribs_map &attribs)
 								   ParsersAttributes::ANALYZE_FUNC };
 			unsigned i, count=sizeof(func_types)/sizeof(QString);
 
-			attribs[ParsersAttributes::ELEMENT]=getType(attribs[ParsersAttributes::ELEMENT], false);
+			attribs[ParsersAttributes::ELEMENT]=getType(attribs[ParsersAttributes::ELEMENT]);
 
-			/* Workaround: if importing a datatype that is part of an extension we avoid the importing of
-			 * its supporting functions (since they will not be necessary here because the type will be sql-disabled)*/
-			if(!catalog.isExtensionObject(attribs[ParsersAttributes::OID].toUInt()))
+			for(i=0; i < count; i++)
 			{
-				for(i=0; i < count; i++)
+				/* Workaround: if importing a datatype that is part of an extension we avoid the importing of
+				 * its supporting functions (since they will not be necessary here because the type will be sql-disabled)*/
+				if(catalog.isExtensionObject(attribs[ParsersAttributes::OID].toUInt()))
+					attribs[func_types[i]]=QString();
+				else
 				{
-					attribs[func_types[i]]=getDependencyObject(attribs[func_types[i]], OBJ_FUNCTION, true, true, true, {{ParsersAttributes::REF_TYPE, func_types[i]}});
+					attribs[func_types[i]]=getDependencyObject(attribs[func_types[i]], OBJ_FUNCTION, true, true);
 
 					/* Since pgModeler requires that type functions refers to the constructing type as "any"
 						 it's necessary to replace the function parameter types names */
@@ -1607,49 +1814,39 @@ void DatabaseImportHelper::createType(attribs_map &attribs)
 			}
 		}
 
-		loadObjectXML(OBJ_TYPE, attribs);
-		type=dbmodel->createType();
+		type=dbmodel->createType(attribs);
+
+		for(auto &type_attrib : type_attribs)
+			type->addAttribute(type_attrib);
+
 		dbmodel->addType(type);
 	}
 	catch(Exception &e)
 	{
 		if(type) delete(type);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
 void DatabaseImportHelper::createTable(attribs_map &attribs)
 {
 	Table *table=nullptr;
+	Column *column=nullptr;
 
 	try
 	{
 		unsigned tab_oid=attribs[ParsersAttributes::OID].toUInt(), type_oid=0, col_idx=0;
 		bool is_type_registered=false;
-		Column col;
 		vector<unsigned> inh_cols;
-		QString type_def, unknown_obj_xml, type_name, def_val;
+		vector<attribs_map> col_records;
+		attribs_map col_attribs;
+		PgSQLType col_type;
+		QString type_def, type_name, def_val, coll_name, part_bound_expr;
 		map<unsigned, attribs_map>::iterator itr, itr1, itr_end;
-		attribs_map pos_attrib={
-			{ ParsersAttributes::X_POS, QString("0") },
-			{ ParsersAttributes::Y_POS, QString("0") }};
-
-		attribs[ParsersAttributes::COLUMNS]=QString();
-		attribs[ParsersAttributes::POSITION]=schparser.getCodeDefinition(ParsersAttributes::POSITION, pos_attrib, SchemaParser::XML_DEFINITION);
 
 		//Retrieving columns if they were not retrieved yet
 		if(columns[attribs[ParsersAttributes::OID].toUInt()].empty() && auto_resolve_deps)
-		{
-			/* Since the schema name sometimes comes in form os <schema name="public"/> tag
-		 it is needed extract only the name from before retrieve the columns of the table */
-			QString sch_name=attribs[ParsersAttributes::SCHEMA];
-			sch_name.replace(QRegExp(QString("(\\t)*(<)(schema)( )+(name)( )*(=)")), QString());
-			sch_name.replace(QRegExp(QString("(/)(>)(\n)*")), QString());
-			sch_name.replace('"', QString());
-			sch_name=sch_name.trimmed();
-			retrieveTableColumns(sch_name, attribs[ParsersAttributes::NAME]);
-		}
+			retrieveTableColumns(attribs[ParsersAttributes::SCHEMA], attribs[ParsersAttributes::NAME]);
 
 		itr=itr1=columns[attribs[ParsersAttributes::OID].toUInt()].begin();
 		itr_end=columns[attribs[ParsersAttributes::OID].toUInt()].end();
@@ -1664,7 +1861,8 @@ void DatabaseImportHelper::createTable(attribs_map &attribs)
 			if(itr->second[ParsersAttributes::INHERITED]==ParsersAttributes::_TRUE_)
 				inh_cols.push_back(col_idx);
 
-			col.setName(itr->second[ParsersAttributes::NAME]);
+			col_attribs.clear();
+			col_attribs[ParsersAttributes::NAME]=itr->second[ParsersAttributes::NAME];
 			type_oid=itr->second[ParsersAttributes::TYPE_OID].toUInt();
 
 			/* If the type has an entry on the types map and its OID is greater than system object oids,
@@ -1691,22 +1889,24 @@ void DatabaseImportHelper::createTable(attribs_map &attribs)
 			if(auto_resolve_deps && !is_type_registered && !type_name.contains(QString("[]")))
 			{
 				type_def=getDependencyObject(itr->second[ParsersAttributes::TYPE_OID], OBJ_TYPE);
-				unknown_obj_xml=UNKNOWN_OBJECT_OID_XML.arg(type_oid);
 
 				/* If the type still doesn't exists means that the column maybe is referencing a domain
 		  this way pgModeler will try to retrieve the mentionend object */
-				if(type_def==unknown_obj_xml)
+				if(type_def.isEmpty())
 					type_def=getDependencyObject(itr->second[ParsersAttributes::TYPE_OID], OBJ_DOMAIN);
 			}
 
-			col.setIdentityType(BaseType::null);
-			col.setType(PgSQLType::parseString(type_name));
-			col.setNotNull(!itr->second[ParsersAttributes::NOT_NULL].isEmpty());
-			col.setComment(itr->second[ParsersAttributes::COMMENT]);
+			col_type=PgSQLType::parseString(type_name);
+			col_attribs[ParsersAttributes::TYPE]=type_name;
+			col_attribs[ParsersAttributes::NOT_NULL]=(!itr->second[ParsersAttributes::NOT_NULL].isEmpty() ? ParsersAttributes::_TRUE_ : QString());
+			col_attribs[ParsersAttributes::COMMENT]=itr->second[ParsersAttributes::COMMENT];
+			col_attribs[ParsersAttributes::STATISTICS]=itr->second[ParsersAttributes::STATISTICS];
+			col_attribs[ParsersAttributes::STORAGE]=itr->second[ParsersAttributes::STORAGE];
+			col_attribs[ParsersAttributes::OPTIONS]=parseStorageParameters(itr->second[ParsersAttributes::OPTIONS], OBJ_COLUMN);
 
 			//Overriding the default value if the column is identity
 			if(!itr->second[ParsersAttributes::IDENTITY_TYPE].isEmpty())
-				col.setIdentityType(itr->second[ParsersAttributes::IDENTITY_TYPE]);
+				col_attribs[ParsersAttributes::IDENTITY_TYPE]=itr->second[ParsersAttributes::IDENTITY_TYPE];
 			else
 			{
 				/* Removing extra/forced type casting in the retrieved default value.
@@ -1729,27 +1929,55 @@ void DatabaseImportHelper::createTable(attribs_map &attribs)
 					QStringList values = def_val.split(QString("::"));
 
 					if(values.size() > 1 &&
-						 ((~col.getType() == values[1]) ||
-							(~col.getType() == QString("char") && values[1] == QString("bpchar")) ||
-							(col.getType().isUserType() && (~col.getType()).endsWith(values[1]))))
+						 ((~col_type == values[1]) ||
+							(~col_type == QString("char") && values[1] == QString("bpchar")) ||
+							(col_type.isUserType() && (~col_type).endsWith(values[1]))))
 						def_val=values[0];
 				}
 
-				col.setDefaultValue(def_val);
+				col_attribs[ParsersAttributes::DEFAULT_VALUE]=def_val;
 			}
 
 			//Checking if the collation used by the column exists, if not it'll be created when auto_resolve_deps is checked
 			if(auto_resolve_deps && !itr->second[ParsersAttributes::COLLATION].isEmpty())
 				getDependencyObject(itr->second[ParsersAttributes::COLLATION], OBJ_COLLATION);
 
-			col.setCollation(dbmodel->getObject(getObjectName(itr->second[ParsersAttributes::COLLATION]),OBJ_COLLATION));
-			attribs[ParsersAttributes::COLUMNS]+=col.getCodeDefinition(SchemaParser::XML_DEFINITION);
+			//Collations not present in the model are ignored
+			coll_name=getObjectName(itr->second[ParsersAttributes::COLLATION]);
+			if(dbmodel->getObject(coll_name, OBJ_COLLATION))
+				col_attribs[ParsersAttributes::COLLATION]=coll_name;
+
+			col_records.push_back(col_attribs);
 			itr++;
 			col_idx++;
 		}
 
-		loadObjectXML(OBJ_TABLE, attribs);
-		table=dbmodel->createTable();
+		/* The bound of a partition is retrieved in the form "FOR VALUES ..." or "DEFAULT" but only the
+		values specification is stored in the table since the rest is generated by the code definition */
+		part_bound_expr=attribs[ParsersAttributes::PARTITION_BOUND_EXPR].trimmed();
+
+		if(part_bound_expr.compare(QString("DEFAULT"), Qt::CaseInsensitive)==0)
+		{
+			attribs[ParsersAttributes::DEFAULT_PARTITION]=ParsersAttributes::_TRUE_;
+			part_bound_expr.clear();
+		}
+		else
+			part_bound_expr.remove(QRegExp(QString("^FOR\\s+VALUES\\s+"), Qt::CaseInsensitive));
+
+		attribs[ParsersAttributes::OPTIONS]=parseStorageParameters(attribs[ParsersAttributes::OPTIONS], OBJ_TABLE);
+		table=dbmodel->createTable(attribs);
+
+		for(auto &col_rec : col_records)
+		{
+			column=dbmodel->createColumn(col_rec);
+			table->addObject(column);
+			column=nullptr;
+		}
+
+		table->setPartitionBoundingExpr(part_bound_expr);
+
+		if(table->isPartitioned())
+			createPartitionKeys(table, attribs, inh_cols);
 
 		for(unsigned col_idx : inh_cols)
 			inherited_cols.push_back(table->getColumn(col_idx));
@@ -1758,12 +1986,170 @@ void DatabaseImportHelper::createTable(attribs_map &attribs)
 	}
 	catch(Exception &e)
 	{
+		if(column) delete(column);
 		if(table) delete(table);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
+QString DatabaseImportHelper::parseStorageParameters(const QString &array_val, ObjectType obj_type)
+{
+	QStringList params, supported=StorageParameters::getSupportedParameters(obj_type);
+
+	for(auto &param : Catalog::parseArrayValues(array_val))
+	{
+		//Parameters unknown to pgModeler (e.g. introduced by newer server versions) are discarded
+		if(supported.contains(param.section('=', 0, 0)) && StorageParameters::isValidValue(param.section('=', 1)))
+			params.push_back(param);
+	}
+
+	return(params.join(','));
+}
+
+void DatabaseImportHelper::createPartitionKeys(Table *table, attribs_map &attribs, const vector<unsigned> &inh_cols)
+{
+	vector<PartitionKey> part_keys;
+	PartitionKey part_key;
+	QStringList elements, opclasses, collations;
+	QString part_key_def=attribs[ParsersAttributes::PARTITION_KEY], key_list, elem, key_expr, rest, coll_name, opc_name;
+	Column *col=nullptr;
+	Collation *coll=nullptr;
+	OperatorClass *opclass=nullptr;
+	int start=part_key_def.indexOf('('), depth=0, pos=0, i=0;
+	QChar quote;
+	bool has_collate=false;
+
+	/* Returns the position right after the token starting at the position "from". A token is an identifier (quoted or not and
+	optionally schema-qualified), a function call or a parenthesized expression. Quoted strings inside parenthesis are skipped */
+	auto skipToken=[](const QString &str, int from) -> int {
+		int idx=from, level=0;
+		QChar quote_chr;
+
+		while(idx < str.size())
+		{
+			QChar chr=str[idx];
+
+			if(!quote_chr.isNull())
+			{
+				if(chr==quote_chr)
+					quote_chr=QChar();
+			}
+			else if(chr=='"' || chr=='\'')
+				quote_chr=chr;
+			else if(chr=='(')
+				level++;
+			else if(chr==')')
+			{
+				level--;
+
+				if(level==0)
+				{
+					idx++;
+					break;
+				}
+			}
+			else if(level==0 && !chr.isLetterOrNumber() && chr!='_' && chr!='$' && chr!='.')
+				break;
+
+			idx++;
+		}
+
+		return(idx);
+	};
+
+	if(start < 0)
+		return;
+
+	//Removing the partitioning strategy and the outer parenthesis, e.g., RANGE (a, (lower(b))) -> a, (lower(b))
+	key_list=part_key_def.mid(start + 1, part_key_def.lastIndexOf(')') - start - 1);
+
+	//Splitting the elements only on the commas that are not inside parenthesis or quoted identifiers/strings
+	for(QChar chr : key_list)
+	{
+		if(!quote.isNull())
+		{
+			if(chr==quote)
+				quote=QChar();
+		}
+		else if(chr=='"' || chr=='\'')
+			quote=chr;
+		else if(chr=='(')
+			depth++;
+		else if(chr==')')
+			depth--;
+
+		if(quote.isNull() && depth==0 && chr==',')
+		{
+			elements.push_back(elem.trimmed());
+			elem.clear();
+		}
+		else
+			elem+=chr;
+	}
+
+	if(!elem.trimmed().isEmpty())
+		elements.push_back(elem.trimmed());
+
+	//The operator classes and collations are resolved through their oids (pg_partitioned_table.partclass/partcollation)
+	opclasses=Catalog::parseArrayValues(attribs[ParsersAttributes::OP_CLASSES]);
+	collations=Catalog::parseArrayValues(attribs[ParsersAttributes::COLLATIONS]);
+
+	for(auto &key_elem : elements)
+	{
+		part_key=PartitionKey();
+
+		/* Each element has the form: key [COLLATE collation] [opclass], where key is a column name,
+		a function call or a parenthesized expression, e.g., (lower(b)) COLLATE "C" text_pattern_ops */
+		pos=skipToken(key_elem, 0);
+		key_expr=key_elem.left(pos).trimmed();
+		rest=key_elem.mid(pos).trimmed();
+		has_collate=rest.startsWith(QString("COLLATE "), Qt::CaseInsensitive);
+
+		if(has_collate)
+		{
+			rest=rest.mid(QString("COLLATE ").length()).trimmed();
+			rest=rest.mid(skipToken(rest, 0)).trimmed();
+		}
+
+		col=nullptr;
+		if(!key_expr.contains('(') && !key_expr.contains('.'))
+			col=table->getColumn(key_expr.startsWith('"') ? key_expr.mid(1, key_expr.length() - 2).replace(QString("\"\""), QString("\"")) : key_expr);
+
+		/* Inherited columns are destroyed and recreated by the partitioning relationship (see destroyDetachedColumns())
+		so keys on them are imported as expressions which produce the same partitioning */
+		if(col && std::find(inh_cols.begin(), inh_cols.end(), static_cast<unsigned>(table->getObjectIndex(col)))==inh_cols.end())
+			part_key.setColumn(col);
+		else if(key_expr.startsWith('(') && key_expr.endsWith(')'))
+			part_key.setExpression(key_expr.mid(1, key_expr.length() - 2));
+		else
+			part_key.setExpression(key_expr);
+
+		//The collation and operator class are assigned only when they are explicitly declared in the key definition
+		if(has_collate && i < collations.size() && collations[i]!=QString("0"))
+		{
+			coll_name=getDependencyObject(collations[i], OBJ_COLLATION, false, true);
+			coll=dynamic_cast<Collation *>(dbmodel->getObject(coll_name, OBJ_COLLATION));
+
+			if(coll)
+				part_key.setCollation(coll);
+		}
+
+		if(!rest.isEmpty() && i < opclasses.size() && opclasses[i]!=QString("0"))
+		{
+			opc_name=getDependencyObject(opclasses[i], OBJ_OPCLASS, true, true);
+			opclass=dynamic_cast<OperatorClass *>(dbmodel->getObject(opc_name, OBJ_OPCLASS));
+
+			if(opclass)
+				part_key.setOperatorClass(opclass);
+		}
+
+		part_keys.push_back(part_key);
+		i++;
+	}
+
+	table->addPartitionKeys(part_keys);
+}
+
 void DatabaseImportHelper::createView(attribs_map &attribs)
 {
 	View *view=nullptr;
@@ -1771,17 +2157,14 @@ void DatabaseImportHelper::createView(attribs_map &attribs)
 
 	try
 	{
-		attribs_map pos_attrib={{ ParsersAttributes::X_POS, QString("0") },
-								{ ParsersAttributes::Y_POS, QString("0") }};
+		//Only materialized views are stored in a tablespace
+		if(attribs[ParsersAttributes::MATERIALIZED]!=ParsersAttributes::_TRUE_)
+			attribs[ParsersAttributes::TABLESPACE]=QString();
 
-		attribs[ParsersAttributes::POSITION]=schparser.getCodeDefinition(ParsersAttributes::POSITION, pos_attrib, SchemaParser::XML_DEFINITION);
+		view=dbmodel->createView(attribs);
 
 		ref=Reference(attribs[ParsersAttributes::DEFINITION], QString());
-		ref.setDefinitionExpression(true);
-		attribs[ParsersAttributes::REFERENCES]=ref.getXMLDefinition();
-
-		loadObjectXML(OBJ_VIEW, attribs);
-		view=dbmodel->createView();
+		view->addReference(ref, Reference::SQL_VIEW_DEFINITION);
 		dbmodel->addView(view);
 
 		retrieveTableColumns(view->getSchema()->getName(), view->getName());
@@ -1789,8 +2172,7 @@ void DatabaseImportHelper::createView(attribs_map &attribs)
 	catch(Exception &e)
 	{
 		if(view) delete(view);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1801,6 +2183,7 @@ void DatabaseImportHelper::createRule(attribs_map &attribs)
 	int start=-1;
 	QRegExp cond_regexp(QString("(WHERE)(.)+(DO)"));
 	ObjectType table_type=OBJ_TABLE;
+	BaseTable *table=nullptr;
 
 	try
 	{
@@ -1816,21 +2199,25 @@ void DatabaseImportHelper::createRule(attribs_map &attribs)
 		if(attribs[ParsersAttributes::TABLE_TYPE]==BaseObject::getSchemaName(OBJ_VIEW))
 			table_type=OBJ_VIEW;
 
-		attribs[ParsersAttributes::TABLE]=getDependencyObject(attribs[ParsersAttributes::TABLE], table_type, true, auto_resolve_deps, false);
+		attribs[ParsersAttributes::TABLE]=getDependencyObject(attribs[ParsersAttributes::TABLE], table_type, true, auto_resolve_deps);
 
-		loadObjectXML(OBJ_RULE, attribs);
-		rule=dbmodel->createRule();
+		rule=dbmodel->createRule(attribs);
+		table=rule->getParentTable();
+		table->addObject(rule);
+		table->setModified(true);
 	}
 	catch(Exception &e)
 	{
 		if(rule) delete(rule);
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
 void DatabaseImportHelper::createTrigger(attribs_map &attribs)
 {
+	Trigger *trigger=nullptr;
+	BaseTable *table=nullptr;
+
 	try
 	{
 		ObjectType table_type=OBJ_TABLE;
@@ -1838,17 +2225,19 @@ void DatabaseImportHelper::createTrigger(attribs_map &attribs)
 		if(attribs[ParsersAttributes::TABLE_TYPE]==BaseObject::getSchemaName(OBJ_VIEW))
 			table_type=OBJ_VIEW;
 
-		attribs[ParsersAttributes::TABLE]=getDependencyObject(attribs[ParsersAttributes::TABLE], table_type, true, auto_resolve_deps, false);
+		attribs[ParsersAttributes::TABLE]=getDependencyObject(attribs[ParsersAttributes::TABLE], table_type, true, auto_resolve_deps);
 		attribs[ParsersAttributes::TRIGGER_FUNC]=getDependencyObject(attribs[ParsersAttributes::TRIGGER_FUNC], OBJ_FUNCTION, true, true);
 		attribs[ParsersAttributes::ARGUMENTS]=Catalog::parseArrayValues(attribs[ParsersAttributes::ARGUMENTS].remove(QString(",\"\""))).join(',');
 
-		loadObjectXML(OBJ_TRIGGER, attribs);
-		dbmodel->createTrigger();
+		trigger=dbmodel->createTrigger(attribs);
+		table=trigger->getParentTable();
+		table->addObject(trigger);
+		table->setModified(true);
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		if(trigger) delete(trigger);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1897,10 +2286,13 @@ QStringList DatabaseImportHelper::parseIndexExpressions(const QString &expr)
 
 void DatabaseImportHelper::createIndex(attribs_map &attribs)
 {
+	Index *index=nullptr;
+
 	try
 	{
 		QStringList cols, opclasses, collations, exprs;
 		IndexElement elem;
+		vector<IndexElement> elems;
 		BaseTable *parent_tab=nullptr;
 		Collation *coll=nullptr;
 		OperatorClass *opclass=nullptr;
@@ -1908,19 +2300,31 @@ void DatabaseImportHelper::createIndex(attribs_map &attribs)
 		int i;
 
 		attribs[ParsersAttributes::FACTOR]=QString("90");
-		tab_name=getDependencyObject(attribs[ParsersAttributes::TABLE], OBJ_TABLE, true, auto_resolve_deps, false);
+
+		//The parameters handled by dedicated attributes of the index are extracted from the other storage parameters
+		for(auto &param : Catalog::parseArrayValues(attribs[ParsersAttributes::OPTIONS]))
+		{
+			QString name=param.section('=', 0, 0), value=param.section('=', 1).toLower();
+
+			if(name==QString("fillfactor"))
+				attribs[ParsersAttributes::FACTOR]=value;
+			else if(name==QString("fastupdate"))
+				attribs[ParsersAttributes::FAST_UPDATE]=(value==QString("on") || value==QString("true") ? ParsersAttributes::_TRUE_ : QString());
+			else if(name==QString("buffering"))
+				attribs[ParsersAttributes::BUFFERING]=(value==QString("on") ? ParsersAttributes::_TRUE_ : QString());
+		}
+
+		attribs[ParsersAttributes::OPTIONS]=parseStorageParameters(attribs[ParsersAttributes::OPTIONS], OBJ_INDEX);
+		tab_name=getDependencyObject(attribs[ParsersAttributes::TABLE], OBJ_TABLE, true, auto_resolve_deps);
 		parent_tab=dynamic_cast<BaseTable *>(dbmodel->getObject(tab_name, OBJ_TABLE));
 
 		if(!parent_tab)
 		{
-			tab_name=getDependencyObject(attribs[ParsersAttributes::TABLE], OBJ_VIEW, true, auto_resolve_deps, false);
+			tab_name=getDependencyObject(attribs[ParsersAttributes::TABLE], OBJ_VIEW, true, auto_resolve_deps);
 			parent_tab=dynamic_cast<BaseTable *>(dbmodel->getObject(tab_name, OBJ_VIEW));
 
 			if(!parent_tab)
-				throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
-												.arg(attribs[ParsersAttributes::NAME]).arg(BaseObject::getTypeName(OBJ_INDEX))
-												.arg(tab_name).arg(BaseObject::getTypeName(OBJ_TABLE)),
-												ERR_REF_OBJ_INEXISTS_MODEL ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL, { attribs[ParsersAttributes::NAME], BaseObject::getTypeName(OBJ_INDEX), tab_name, BaseObject::getTypeName(OBJ_TABLE) },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		}
 
 		cols=Catalog::parseArrayValues(attribs[ParsersAttributes::COLUMNS]);
@@ -1947,7 +2351,7 @@ void DatabaseImportHelper::createIndex(attribs_map &attribs)
 
 			if(i < collations.size() && collations[i]!=QString("0"))
 			{
-				coll_name=getDependencyObject(collations[i], OBJ_COLLATION, false, true, false);
+				coll_name=getDependencyObject(collations[i], OBJ_COLLATION, false, true);
 				coll=dynamic_cast<Collation *>(dbmodel->getObject(coll_name, OBJ_COLLATION));
 
 				//Even if the collation exists we'll ignore it when it is the "pg_catalog.default"
@@ -1958,7 +2362,7 @@ void DatabaseImportHelper::createIndex(attribs_map &attribs)
 
 			if(i < opclasses.size() && opclasses[i]!=QString("0"))
 			{
-				opc_name=getDependencyObject(opclasses[i], OBJ_OPCLASS, true, true, false);
+				opc_name=getDependencyObject(opclasses[i], OBJ_OPCLASS, true, true);
 				opclass=dynamic_cast<OperatorClass *>(dbmodel->getObject(opc_name, OBJ_OPCLASS));
 
 				if(opclass)
@@ -1966,17 +2370,20 @@ void DatabaseImportHelper::createIndex(attribs_map &attribs)
 			}
 
 			if(elem.getColumn() || !elem.getExpression().isEmpty())
-				attribs[ParsersAttributes::ELEMENTS]+=elem.getCodeDefinition(SchemaParser::XML_DEFINITION);
+				elems.push_back(elem);
 		}
 
 		attribs[ParsersAttributes::TABLE]=tab_name;
-		loadObjectXML(OBJ_INDEX, attribs);
-		dbmodel->createIndex();
+		index=dbmodel->createIndex(attribs);
+		index->addIndexElements(elems);
+
+		parent_tab->addObject(index);
+		parent_tab->setModified(true);
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		if(index) delete(index);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -1989,7 +2396,9 @@ void DatabaseImportHelper::createConstraint(attribs_map &attribs)
 		QString table_oid=attribs[ParsersAttributes::TABLE],
 				ref_tab_oid=attribs[ParsersAttributes::REF_TABLE],
 				tab_name;
-		Table *table=nullptr;
+		QStringList src_cols, dst_cols;
+		vector<ExcludeElement> elems;
+		Table *table=nullptr, *ref_table=nullptr;
 
 		//If the table oid is 0 indicates that the constraint is part of a data type like domains
 		if(!table_oid.isEmpty() && table_oid!=QString("0"))
@@ -1997,12 +2406,11 @@ void DatabaseImportHelper::createConstraint(attribs_map &attribs)
 			QStringList factor=Catalog::parseArrayValues(attribs[ParsersAttributes::FACTOR]);
 
 			//Retrieving the table is it was not imported yet and auto_resolve_deps is true
-			tab_name=getDependencyObject(table_oid, OBJ_TABLE, true, auto_resolve_deps, false);
+			tab_name=getDependencyObject(table_oid, OBJ_TABLE, true, auto_resolve_deps);
 
 			if(!factor.isEmpty() && factor[0].startsWith(QString("fillfactor=")))
 				attribs[ParsersAttributes::FACTOR]=factor[0].remove(QString("fillfactor="));
 
-			attribs[attribs[ParsersAttributes::TYPE]]=ParsersAttributes::_TRUE_;
 			table=dynamic_cast<Table *>(dbmodel->getObject(tab_name, OBJ_TABLE));
 
 			if(attribs[ParsersAttributes::TYPE]==ParsersAttributes::EX_CONSTR)
@@ -2013,7 +2421,6 @@ void DatabaseImportHelper::createConstraint(attribs_map &attribs)
 				OperatorClass *opclass=nullptr;
 				Operator *oper=nullptr;
 
-				attribs[ParsersAttributes::SRC_COLUMNS]=QString();
 				attribs[ParsersAttributes::EXPRESSION]=attribs[ParsersAttributes::CONDITION];
 
 				cols=Catalog::parseArrayValues(attribs[ParsersAttributes::COLUMNS]);
@@ -2044,7 +2451,7 @@ void DatabaseImportHelper::createConstraint(attribs_map &attribs)
 
 					if(i < opclasses.size() && opclasses[i]!=QString("0"))
 					{
-						opc_name=getDependencyObject(opclasses[i], OBJ_OPCLASS, true, true, false);
+						opc_name=getDependencyObject(opclasses[i], OBJ_OPCLASS, true, true);
 						opclass=dynamic_cast<OperatorClass *>(dbmodel->getObject(opc_name, OBJ_OPCLASS));
 
 						if(opclass)
@@ -2053,14 +2460,14 @@ void DatabaseImportHelper::createConstraint(attribs_map &attribs)
 
 					if(i < opers.size() && opers[i]!=QString("0"))
 					{
-						op_name=getDependencyObject(opers[i], OBJ_OPERATOR, true, true, false);
+						op_name=getDependencyObject(opers[i], OBJ_OPERATOR, true, true);
 						oper=dynamic_cast<Operator *>(dbmodel->getObject(op_name, OBJ_OPERATOR));
 
 						if(oper)
 							elem.setOperator(oper);
 					}
 
-					attribs[ParsersAttributes::ELEMENTS]+=elem.getCodeDefinition(SchemaParser::XML_DEFINITION);
+					elems.push_back(elem);
 				}
 			}
 			else
@@ -2069,64 +2476,77 @@ void DatabaseImportHelper::createConstraint(attribs_map &attribs)
 				if(attribs[ParsersAttributes::TYPE]==ParsersAttributes::FK_CONSTR)
 					attribs[ParsersAttributes::TABLESPACE]=QString();
 
-				attribs[ParsersAttributes::SRC_COLUMNS]=getColumnNames(attribs[ParsersAttributes::TABLE], attribs[ParsersAttributes::SRC_COLUMNS]).join(',');
+				src_cols=getColumnNames(attribs[ParsersAttributes::TABLE], attribs[ParsersAttributes::SRC_COLUMNS]);
 			}
 
-			attribs[ParsersAttributes::REF_TABLE]=getDependencyObject(ref_tab_oid, OBJ_TABLE, false, true, false);
-			attribs[ParsersAttributes::DST_COLUMNS]=getColumnNames(ref_tab_oid, attribs[ParsersAttributes::DST_COLUMNS]).join(',');
+			attribs[ParsersAttributes::REF_TABLE]=getDependencyObject(ref_tab_oid, OBJ_TABLE, false, true);
+			dst_cols=getColumnNames(ref_tab_oid, attribs[ParsersAttributes::DST_COLUMNS]);
 			attribs[ParsersAttributes::TABLE]=tab_name;
 
-			loadObjectXML(OBJ_CONSTRAINT, attribs);
-			constr=dbmodel->createConstraint(nullptr);
+			constr=dbmodel->createConstraint(attribs, nullptr);
+			ref_table=dynamic_cast<Table *>(constr->getReferencedTable());
+
+			for(auto &col_name : src_cols)
+				constr->addColumn(table->getColumn(col_name), Constraint::SOURCE_COLS);
 
-			if(table &&  constr->getConstraintType()==ConstraintType::primary_key)
+			for(auto &col_name : dst_cols)
 			{
-				table->addConstraint(constr);
-				table->setModified(true);
+				if(ref_table)
+					constr->addColumn(ref_table->getColumn(col_name), Constraint::REFERENCED_COLS);
 			}
+
+			constr->addExcludeElements(elems);
+			table->addConstraint(constr);
+			table->setModified(true);
+			constr=nullptr;
 		}
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		if(constr) delete(constr);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
 void DatabaseImportHelper::createPolicy(attribs_map &attribs)
 {
+	Policy *policy=nullptr;
+	BaseTable *table=nullptr;
+
 	try
 	{
-		attribs[ParsersAttributes::TABLE]=getDependencyObject(attribs[ParsersAttributes::TABLE], OBJ_TABLE, true, auto_resolve_deps, false);
+		attribs[ParsersAttributes::TABLE]=getDependencyObject(attribs[ParsersAttributes::TABLE], OBJ_TABLE, true, auto_resolve_deps);
 		attribs[ParsersAttributes::ROLES]=getObjectNames(attribs[ParsersAttributes::ROLES]).join(',');
-		loadObjectXML(OBJ_POLICY, attribs);
-		dbmodel->createPolicy();
+
+		policy=dbmodel->createPolicy(attribs);
+		table=policy->getParentTable();
+		table->addObject(policy);
+		table->setModified(true);
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		if(policy) delete(policy);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
 void DatabaseImportHelper::createEventTrigger(attribs_map &attribs)
 {
+	EventTrigger *event_trig=nullptr;
+
 	try
 	{
 		attribs[ParsersAttributes::FUNCTION]=getDependencyObject(attribs[ParsersAttributes::FUNCTION], OBJ_FUNCTION, true, true);
-		attribs[ParsersAttributes::FILTER]=QString("\t<%1 %2=\"%3\" %4=\"%5\"/>\n")
-										   .arg(ParsersAttributes::FILTER)
-										   .arg(ParsersAttributes::VARIABLE).arg(ParsersAttributes::TAG.toUpper())
-										   .arg(ParsersAttributes::VALUES)
-										   .arg(Catalog::parseArrayValues(attribs[ParsersAttributes::VALUES].remove('"')).join(','));
+		attribs[ParsersAttributes::VARIABLE]=ParsersAttributes::TAG.toUpper();
+		attribs[ParsersAttributes::VALUES]=Catalog::parseArrayValues(attribs[ParsersAttributes::VALUES].remove('"')).join(',');
 
-		loadObjectXML(OBJ_EVENT_TRIGGER, attribs);
-		dbmodel->addEventTrigger(dbmodel->createEventTrigger());
+		event_trig=dbmodel->createEventTrigger(attribs);
+		dbmodel->addEventTrigger(event_trig);
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		if(event_trig) delete(event_trig);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2225,9 +2645,9 @@ void DatabaseImportHelper::createPermission(attribs_map &attribs)
 						if(perm) delete(perm);
 
 						if(ignore_errors)
-							errors.push_back(Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e, dumpObjectAttributes(attribs)));
+							errors.push_back(Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__, dumpObjectAttributes(attribs)));
 						else
-							throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+							throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 					}
 				}
 			}
@@ -2252,7 +2672,7 @@ void DatabaseImportHelper::createTableInheritances(void)
 			if(ignore_errors)
 				errors.push_back(e);
 			else
-				throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+				throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		}
 	}
 }
@@ -2290,7 +2710,7 @@ void DatabaseImportHelper::destroyDetachedColumns(void)
 				if(ignore_errors)
 					errors.push_back(e);
 				else
-					throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+					throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 			}
 		}
 	}
@@ -2384,13 +2804,14 @@ void DatabaseImportHelper::__createTableInheritances(void)
 					}
 
 					if(!parent_tab)
-						throw Exception(Exception::getErrorMessage(ERR_INV_INH_PARENT_TAB_NOT_FOUND).arg(child_tab->getSignature()).arg(inh_list.front()),
-										ERR_INV_INH_PARENT_TAB_NOT_FOUND,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+						throw Exception(ERR_INV_INH_PARENT_TAB_NOT_FOUND, { child_tab->getSignature(), inh_list.front() },__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 					inh_list.pop_front();
 
-					//Create the inheritance relationship
-					rel=new Relationship(Relationship::RELATIONSHIP_GEN, child_tab, parent_tab);
+					/* Create the inheritance relationship. Partitions have the partitioned table as the only entry
+					in pg_inherits so in that case a partitioning relationship is created instead */
+					rel=new Relationship(!child_tab->getPartitionBoundingExpr().isEmpty() || child_tab->isDefaultPartition() ?
+																 Relationship::RELATIONSHIP_PART : Relationship::RELATIONSHIP_GEN, child_tab, parent_tab);
 					rel->setName(PgModelerNS::generateUniqueName(rel, (*dbmodel->getObjectList(OBJ_RELATIONSHIP))));
 
 					dbmodel->addRelationship(rel);
@@ -2403,7 +2824,7 @@ void DatabaseImportHelper::__createTableInheritances(void)
 					if(ignore_errors)
 						errors.push_back(e);
 					else
-						throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+						throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 				}
 			}
 		}
@@ -2415,13 +2836,11 @@ void DatabaseImportHelper::configureDatabase(attribs_map &attribs)
 	try
 	{
 		attribs[ParsersAttributes::APPEND_AT_EOD]=QString();
-		loadObjectXML(OBJ_DATABASE, attribs);
 		dbmodel->configureDatabase(attribs);
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),
-						__PRETTY_FUNCTION__,__FILE__,__LINE__, &e, xmlparser->getXMLBuffer());
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
@@ -2431,6 +2850,8 @@ QString DatabaseImportHelper::getObjectName(const QString &oid, bool signature_f
 
 	if(obj_oid==0)
 		return(QString());
+	else if(!signature_form && obj_names.count(obj_oid))
+		return(obj_names[obj_oid]);
 	else
 	{
 		attribs_map obj_attr;
@@ -2456,6 +2877,10 @@ QString DatabaseImportHelper::getObjectName(const QString &oid, bool signature_f
 			if(!sch_name.isEmpty())
 				obj_name.prepend(sch_name + QString("."));
 
+			//Storing the plain name so the next calls for the same object are simple lookups
+			if(!signature_form)
+				obj_names[obj_oid]=obj_name;
+
 			//Formatting the name in form of signature (only for functions and operators)
 			if(signature_form && (obj_type==OBJ_FUNCTION || obj_type==OBJ_OPERATOR || obj_type==OBJ_AGGREGATE || obj_type==OBJ_OPFAMILY || obj_type==OBJ_OPCLASS))
 			{
@@ -2463,7 +2888,7 @@ QString DatabaseImportHelper::getObjectName(const QString &oid, bool signature_f
 
 				if(obj_type==OBJ_FUNCTION)
 				{
-					QStringList arg_types=getTypes(obj_attr[ParsersAttributes::ARG_TYPES], false),
+					QStringList arg_types=getTypes(obj_attr[ParsersAttributes::ARG_TYPES]),
 							arg_modes=Catalog::parseArrayValues(obj_attr[ParsersAttributes::ARG_MODES]);
 
 					for(int i=0; i < arg_types.size(); i++)
@@ -2483,7 +2908,7 @@ QString DatabaseImportHelper::getObjectName(const QString &oid, bool signature_f
 				}
 				else if(obj_type==OBJ_AGGREGATE)
 				{
-					QStringList params=getTypes(obj_attr[ParsersAttributes::TYPES], false);
+					QStringList params=getTypes(obj_attr[ParsersAttributes::TYPES]);
 
 					if(params.isEmpty())
 						params.push_back(QString("*"));
@@ -2491,12 +2916,12 @@ QString DatabaseImportHelper::getObjectName(const QString &oid, bool signature_f
 				else if(obj_type==OBJ_OPERATOR)
 				{
 					if(obj_attr[ParsersAttributes::LEFT_TYPE].toUInt() > 0)
-						params.push_back(getType(obj_attr[ParsersAttributes::LEFT_TYPE], false));
+						params.push_back(getType(obj_attr[ParsersAttributes::LEFT_TYPE]));
 					else
 						params.push_back(QString("NONE"));
 
 					if(obj_attr[ParsersAttributes::RIGHT_TYPE].toUInt() > 0)
-						params.push_back(getType(obj_attr[ParsersAttributes::RIGHT_TYPE], false));
+						params.push_back(getType(obj_attr[ParsersAttributes::RIGHT_TYPE]));
 					else
 						params.push_back(QString("NONE"));
 				}
@@ -2568,14 +2993,14 @@ QStringList DatabaseImportHelper::getColumnNames(const QString &tab_oid_str, con
 	return(col_names);
 }
 
-QString DatabaseImportHelper::getType(const QString &oid_str, bool generate_xml, attribs_map extra_attribs)
+QString DatabaseImportHelper::getType(const QString &oid_str)
 {
 	try
 	{
 		attribs_map type_attr;
-		QString xml_def, sch_name, obj_name, aux_name;
+		QString sch_name, obj_name, aux_name;
 		unsigned type_oid=oid_str.toUInt(), elem_tp_oid = 0,
-				dimension=0, object_id=type_attr[ParsersAttributes::OBJECT_ID].toUInt();
+				object_id=type_attr[ParsersAttributes::OBJECT_ID].toUInt();
 		bool is_derivated_from_obj = false;
 
 		if(type_oid > 0)
@@ -2583,18 +3008,12 @@ QString DatabaseImportHelper::getType(const QString &oid_str, bool generate_xml,
 			if(types.count(type_oid))
 				type_attr=types[type_oid];
 
-			//Special treatment for array types. Removes the [] descriptor when generating XML code for the type
+			//Special treatment for array types. The element type is created instead of the array one (see below)
 			if(!type_attr.empty() && type_attr[ParsersAttributes::CATEGORY]==QString("A") &&
 					type_attr[ParsersAttributes::NAME].contains(QString("[]")))
 			{
 				obj_name=type_attr[ParsersAttributes::NAME];
 				elem_tp_oid=type_attr[ParsersAttributes::ELEMENT].toUInt();
-
-				if(generate_xml)
-				{
-					dimension=type_attr[ParsersAttributes::NAME].count(QString("[]"));
-					obj_name.remove(QString("[]"));
-				}
 			}
 			else
 				obj_name=type_attr[ParsersAttributes::NAME];
@@ -2616,7 +3035,7 @@ QString DatabaseImportHelper::getType(const QString &oid_str, bool generate_xml,
 					obj_type=OBJ_SEQUENCE;
 
 				is_derivated_from_obj = true;
-				getDependencyObject(type_attr[ParsersAttributes::OBJECT_ID], obj_type, true, true, false);
+				getDependencyObject(type_attr[ParsersAttributes::OBJECT_ID], obj_type, true, true);
 			}
 
 			/* Removing the optional modifier "without time zone" from date/time types.
@@ -2650,33 +3069,22 @@ QString DatabaseImportHelper::getType(const QString &oid_str, bool generate_xml,
 					createObject(types[elem_tp_oid]);
 			}
 
-			if(generate_xml)
-			{
-				extra_attribs[ParsersAttributes::NAME]=obj_name;
-				extra_attribs[ParsersAttributes::DIMENSION]=(dimension > 0 ? QString::number(dimension) : QString());
-
-				schparser.ignoreUnkownAttributes(true);
-				xml_def=schparser.getCodeDefinition(ParsersAttributes::PGSQL_BASE_TYPE, extra_attribs, SchemaParser::XML_DEFINITION);
-				schparser.ignoreUnkownAttributes(false);
-			}
-			else
-				return(obj_name);
 		}
 
-		return(xml_def);
+		return(obj_name);
 	}
 	catch(Exception &e)
 	{
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	}
 }
 
-QStringList DatabaseImportHelper::getTypes(const QString &oid_vect, bool generate_xml)
+QStringList DatabaseImportHelper::getTypes(const QString &oid_vect)
 {
 	QStringList list=Catalog::parseArrayValues(oid_vect);
 
 	for(int i=0; i < list.size(); i++)
-		list[i]=getType(list[i], generate_xml);
+		list[i]=getType(list[i]);
 
 	return(list);
 }
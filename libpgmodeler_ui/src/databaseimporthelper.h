@@ -27,9 +27,12 @@
 
 #include <QObject>
 #include <QThread>
+#include <QMutex>
 #include "catalog.h"
 #include "modelwidget.h"
 #include <random>
+#include <thread>
+#include <atomic>
 
 class DatabaseImportHelper: public QObject {
 	private:
@@ -38,7 +41,23 @@ class DatabaseImportHelper: public QObject {
 		//! \brief Random number generator engine used to generate random colors for imported schemas
 		default_random_engine rand_num_engine;
 		
-		static const QString UNKNOWN_OBJECT_OID_XML;
+		/*! \brief Describes a catalog retrieval executed by one of the worker threads in parallel import mode. Schema tasks
+		(only the schema name set) retrieve the selected objects of a whole schema, column tasks (schema and table names set)
+		retrieve the columns of a table and the task with no names retrieves the objects that don't belong to schemas */
+		struct RetrievalTask {
+			QString sch_name, tab_name;
+
+			/*! \brief Oids of the objects (or column ids) retrieved by the task per type. Schema tasks have no oids assigned
+			since they are determined by the worker listing the objects of the schema */
+			map<ObjectType, vector<unsigned>> oids;
+
+			RetrievalTask(const QString &sch_name=QString(), const QString &tab_name=QString(), const map<ObjectType, vector<unsigned>> &oids={})
+			{
+				this->sch_name=sch_name;
+				this->tab_name=tab_name;
+				this->oids=oids;
+			}
+		};
 		
 		/*! \brief File handle to log the import process. This file is opened for writing only when
 		the 'ignore_errors' is true */
@@ -54,13 +73,21 @@ class DatabaseImportHelper: public QObject {
 		Connection connection;
 		
 		//! \brief Stores the current configured catalog filter
-		unsigned import_filter;
-		
-		//! \brief Indicates that import was canceled by user (only on thread mode)
-		bool import_canceled,
+		unsigned import_filter,
+
+		/*! \brief Amount of threads (each one with its own pooled connection) used to retrieve the objects from
+		catalog and to resolve their names. Values lower than 2 makes the import run sequentially */
+		import_threads;
+
+		//! \brief Guards the attributes maps while they are filled by the worker threads
+		QMutex merge_mutex;
 		
+		/*! \brief Indicates that import was canceled by user (only on thread mode). This flag is set by the
+		main thread and read by the retrieval workers so it needs to be atomic */
+		std::atomic<bool> import_canceled;
+
 		//! \brief Indicates that import must ignore any error generated during the import
-		ignore_errors,
+		bool ignore_errors,
 		
 		//! \brief Enables the import of system objects (under pg_catalog / information_schema)
 		import_sys_objs,
@@ -107,6 +134,10 @@ class DatabaseImportHelper: public QObject {
 		
 		//! \brief Stores all selected columns attributes
 		map<unsigned, map<unsigned, attribs_map>> columns;
+
+		/*! \brief Stores the schema qualified names of the retrieved objects (see getObjectName()). This map is
+		filled by the worker threads in parallel mode or on demand in sequential mode */
+		map<unsigned, QString> obj_names;
 		
 		//! \brief Stores the oids of all objects that has permissions to be created
 		vector<unsigned> obj_perms;
@@ -126,10 +157,6 @@ class DatabaseImportHelper: public QObject {
 		//! \brief Reference for the database model instance of the model widget
 		DatabaseModel *dbmodel;
 		
-		XMLParser *xmlparser;
-		
-		SchemaParser schparser;
-		
 		void configureDatabase(attribs_map &attribs);
 		void createObject(attribs_map &attribs);
 		void createTablespace(attribs_map &attribs);
@@ -157,6 +184,16 @@ class DatabaseImportHelper: public QObject {
 		void createPolicy(attribs_map &attribs);
 		void createPermission(attribs_map &attribs);
 		void createEventTrigger(attribs_map &attribs);
+		/*! \brief Configures the partition keys of the table from the definition returned by pg_get_partkeydef().
+		Elements that don't match one of the table's own (not inherited) columns are imported as expressions. The explicit
+		collations and operator classes of the keys are resolved from the oids in the collations and opclasses attributes */
+		void createPartitionKeys(Table *table, attribs_map &attribs, const vector<unsigned> &inh_cols);
+
+		/*! \brief Converts the storage parameters array retrieved from catalog (reloptions/attoptions) to the
+		form name=value[,name=value...]. Parameters not supported by the object type are discarded */
+		QString parseStorageParameters(const QString &array_val, ObjectType obj_type);
+
+		//! \brief Creates the generalization and partitioning relationships between the imported tables
 		void __createTableInheritances(void);
 		void createTableInheritances(void);
 		void destroyDetachedColumns(void);
@@ -179,25 +216,18 @@ class DatabaseImportHelper: public QObject {
 		of getColumnName() but returns a list instead of single result */
 		QStringList getColumnNames(const QString &tab_oid_str, const QString &col_id_vect, bool prepend_tab_name=false);
 		
-		/*! \brief Returns the name for the type represented by a oid. If the boolean parameter is true then
-		the method will return the xml defintion for the type instead of the name */
-		QString getType(const QString &oid, bool generate_xml, attribs_map extra_attribs=attribs_map());
+		//! \brief Returns the name for the type represented by a oid
+		QString getType(const QString &oid);
 		
-		//! \brief Returns the type names or xml code for the specified oid vector
-		QStringList getTypes(const QString &oid_vect, bool generate_xml);
+		//! \brief Returns the type names for the specified oid vector
+		QStringList getTypes(const QString &oid_vect);
 		
-		/*! \brief Returns the xml definition for the specified oid. If the boolean param 'use_signature' is true then the method will
-		return the xml definition with signature attribute instead of name. If the param 'recursive_dep_res' is true the method will
-		create a dependency if it's attributes exists but it doesn't exists on the model yet (note: this is different from auto_resolve_deps attribute) */
+		/*! \brief Returns the name of the object represented by the oid to be used in the records passed to DatabaseModel::create*(attribs_map &).
+		If the boolean param 'use_signature' is true then the method will return the signature instead of name. If the param 'recursive_dep_res' is true
+		the method will create a dependency if it's attributes exists but it doesn't exists on the model yet (note: this is different from auto_resolve_deps attribute).
+		The extra attributes are merged into the dependency's attributes before creating it. An empty string is returned when the object is unknown */
 		QString getDependencyObject(const QString &oid, ObjectType dep_type, bool use_signature=false,
-									bool recursive_dep_res=true, bool generate_xml=true, attribs_map extra_attribs=attribs_map());
-		
-		//! \brief Returns the xml defintion for the object's comment
-		QString getComment(attribs_map &attribs);
-		
-		/*! \brief Loads the xml parser buffer with the xml schema file relative to the object type
-		using the specified set of attributes */
-		void loadObjectXML(ObjectType obj_type, attribs_map &attribs);
+									bool recursive_dep_res=true, attribs_map extra_attribs=attribs_map());
 		
 		//! \brief Clears the vectors and maps used in the import process
 		void resetImportParameters(void);
@@ -225,6 +255,12 @@ class DatabaseImportHelper: public QObject {
 		//! \brief Defines the selected object to be imported. This method always expect filled maps. Hint: use the method Catalog::getObjectOIDs()
 		void setSelectedOIDs(DatabaseModel *db_model, const map<ObjectType, vector<unsigned>> &obj_oids, const map<unsigned, vector<unsigned>> &col_oids);
 		
+		/*! \brief Defines the amount of threads used to retrieve the objects from catalog. Objects are retrieved in chunks
+		and table columns are partitioned by schema, each thread running the queries over its own pooled connection.
+		The creation of objects in the model is always serialized. Zero or one disables the parallel mode */
+		void setImportThreads(unsigned thread_cnt);
+		unsigned getImportThreads(void);
+
 		//! \brief Configures the import parameters
 		void setImportOptions(bool import_sys_objs, bool import_ext_objs, bool auto_resolve_deps, bool ignore_errors, bool debug_mode, bool rand_rel_colors, bool update_fk_rels);
 		
@@ -257,9 +293,31 @@ class DatabaseImportHelper: public QObject {
 				before assign the connection to this class. */
 		vector<attribs_map> getObjects(vector<ObjectType> obj_type, const QString &schema=QString(), const QString &table=QString(), attribs_map extra_attribs=attribs_map());
 
+		/*! \brief Returns the oids (keys) and names (values) of the schemas containing objects of the specified types
+		using a single catalog query (see Catalog::getObjectsSchemas()) */
+		attribs_map getObjectsSchemas(vector<ObjectType> obj_types, attribs_map extra_attribs=attribs_map());
+
 		void retrieveSystemObjects(void);
 		void retrieveUserObjects(void);
 		void retrieveTableColumns(const QString &sch_name, const QString &tab_name, vector<unsigned> col_ids={});
+
+		/*! \brief Returns the amount of worker threads that can be used considering the connections currently free
+		in the pool used by the import, so the workers never wait for connections held by other tasks */
+		unsigned getWorkerCount(void);
+
+		/*! \brief Runs the retrieval tasks in the worker threads. Each worker uses its own copy of the catalog (thus, its own
+		pooled connection) and merges the results in the attributes maps. The calling thread also runs tasks and is the only
+		one that emits progress signals. The selected oids of the objects that belong to schemas are used by the schema tasks
+		to filter the listed objects. The first error raised by a worker is rethrown after all threads finish */
+		void runRetrievalTasks(vector<RetrievalTask> &tasks, const QString &progress_msg, const map<ObjectType, set<unsigned>> &sch_oids);
+
+		/*! \brief Resolves the schema qualified names of all retrieved objects in the worker threads, storing them in obj_names.
+		This way the creation step (which is serialized since it changes the model) only needs to perform lookups */
+		void resolveObjectNames(void);
+
+		/*! \brief Returns the schema qualified name of the object without changing any member of the class.
+		This is the thread safe version of getObjectName() used by the worker threads */
+		QString resolveObjectName(unsigned oid) const;
 		void createObjects(void);
 		void createConstraints(void);
 		void createPermissions(void);
@@ -111,6 +111,9 @@ DataManipulationForm::DataManipulationForm(QWidget * parent, Qt::WindowFlags f):
 	connect(table_cmb, SIGNAL(currentIndexChanged(int)), this, SLOT(listColumns()));
 	connect(table_cmb, SIGNAL(currentIndexChanged(int)), this, SLOT(retrieveData()));
 	connect(refresh_tb, SIGNAL(clicked()), this, SLOT(retrieveData()));
+	connect(&data_query, SIGNAL(s_commandFinished()), this, SLOT(handleDataRetrieved()));
+	connect(&data_query, SIGNAL(s_commandFailed(Exception)), this, SLOT(handleRetrievalFailed(Exception)));
+	connect(&data_query, SIGNAL(s_commandCancelled()), this, SLOT(handleRetrievalCancelled()));
 	connect(add_ord_col_tb, SIGNAL(clicked()), this, SLOT(addColumnToList()));
 	connect(ord_columns_lst, SIGNAL(itemDoubleClicked(QListWidgetItem*)), this, SLOT(removeColumnFromList()));
 	connect(ord_columns_lst, SIGNAL(itemPressed(QListWidgetItem*)), this, SLOT(changeOrderMode(QListWidgetItem*)));
@@ -306,9 +309,6 @@ void DataManipulationForm::retrieveData(void)
 		return;
 
 	Messagebox msg_box;
-	Catalog catalog;
-	Connection conn_sql=Connection(tmpl_conn_params),
-			conn_cat=Connection(tmpl_conn_params);
 
 	try
 	{
@@ -322,7 +322,7 @@ void DataManipulationForm::retrieveData(void)
 		}
 
 		QString query=QString("SELECT * FROM \"%1\".\"%2\"").arg(schema_cmb->currentText()).arg(table_cmb->currentText());
-		ResultSet res;
+		Connection data_conn=Connection(tmpl_conn_params);
 		unsigned limit=limit_spb->value();
 
 		//Building the where clause
@@ -350,10 +350,31 @@ void DataManipulationForm::retrieveData(void)
 			query+=QString(" LIMIT %1").arg(limit);
 
 		QApplication::setOverrideCursor(Qt::WaitCursor);
+		data_conn.setPooled(true);
 
+		/* The command runs asynchronously and the grid is filled in handleDataRetrieved().
+		A previous retrieval still running is aborted in the server before starting the new one */
+		data_query.cancel(true);
+		data_query.setConnection(data_conn);
+		data_query.execute(query);
+	}
+	catch(Exception &e)
+	{
+		QApplication::restoreOverrideCursor();
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void DataManipulationForm::handleDataRetrieved(void)
+{
+	Catalog catalog;
+	Connection conn_cat=Connection(tmpl_conn_params);
+	ResultSet res;
+
+	try
+	{
+		data_query.getResultSet(res);
 		catalog.setConnection(conn_cat);
-		conn_sql.connect();
-		conn_sql.executeDMLCommand(query, res);
 
 		retrievePKColumns(schema_cmb->currentText(), table_cmb->currentText());
 		retrieveFKColumns(schema_cmb->currentText(), table_cmb->currentText());
@@ -382,7 +403,6 @@ void DataManipulationForm::retrieveData(void)
 			csv_load_tb->setChecked(false);
 		}
 
-		conn_sql.close();
 		catalog.closeConnection();
 
 		QApplication::restoreOverrideCursor();
@@ -400,13 +420,27 @@ void DataManipulationForm::retrieveData(void)
 	}
 	catch(Exception &e)
 	{
+		Messagebox msg_box;
+
 		QApplication::restoreOverrideCursor();
-		conn_sql.close();
 		catalog.closeConnection();
-		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		msg_box.show(e);
 	}
 }
 
+void DataManipulationForm::handleRetrievalFailed(Exception e)
+{
+	Messagebox msg_box;
+
+	QApplication::restoreOverrideCursor();
+	msg_box.show(e);
+}
+
+void DataManipulationForm::handleRetrievalCancelled(void)
+{
+	QApplication::restoreOverrideCursor();
+}
+
 void DataManipulationForm::disableControlButtons(void)
 {
 	refresh_tb->setEnabled(schema_cmb->currentIndex() > 0 && table_cmb->currentIndex() > 0);
@@ -30,6 +30,7 @@
 #include "syntaxhighlighter.h"
 #include "codecompletionwidget.h"
 #include "csvloadwidget.h"
+#include "asyncquery.h"
 
 class DataManipulationForm: public QDialog, public Ui::DataManipulationForm {
 	private:
@@ -75,6 +76,9 @@ class DataManipulationForm: public QDialog, public Ui::DataManipulationForm {
 
 		//! \brief Stores the fk informations about referencing tables
 		ref_fk_infos;
+
+		//! \brief Runs the data retrieval command without blocking the form (see retrieveData())
+		AsyncQuery data_query;
 		
 		//! \brief Fills a combobox with the names of objects retrieved from catalog
 		void listObjects(QComboBox *combo, vector<ObjectType> obj_types, const QString &schema=QString());
@@ -125,6 +129,15 @@ class DataManipulationForm: public QDialog, public Ui::DataManipulationForm {
 		
 		//! \brief Retrieve the data for the current table filtering the data as configured on the advanced tab
 		void retrieveData(void);
+
+		//! \brief Fills the results grid with the data returned by the command started in retrieveData()
+		void handleDataRetrieved(void);
+
+		//! \brief Shows the error raised by the command started in retrieveData()
+		void handleRetrievalFailed(Exception e);
+
+		//! \brief Restores the cursor when a pending data retrieval is cancelled
+		void handleRetrievalCancelled(void);
 		
 		//! \brief Disable the buttons used to handle data
 		void disableControlButtons(void);
@@ -30,6 +30,7 @@ ElementsWidget::ElementsWidget(QWidget *parent) : QWidget(parent)
 		elem_expr_hl->loadConfiguration(GlobalAttributes::SQL_HIGHLIGHT_CONF_PATH);
 
 		parent_obj=nullptr;
+		handle_part_keys=false;
 		elements_tab=new ObjectsTableWidget(ObjectsTableWidget::ALL_BUTTONS ^ ObjectsTableWidget::DUPLICATE_BUTTON, true, this);
 		op_class_sel=new ObjectSelectorWidget(OBJ_OPCLASS, true, this);
 		collation_sel=new ObjectSelectorWidget(OBJ_COLLATION, true, this);
@@ -161,10 +162,43 @@ void ElementsWidget::setAttributes(DatabaseModel *model, BaseObject *parent_obj,
 	elements_tab->blockSignals(false);
 }
 
+void ElementsWidget::setAttributes(DatabaseModel *model, Table *table, vector<PartitionKey> &part_keys)
+{
+	setAttributes(model, table);
+	handle_part_keys=true;
+	collation_sel->setVisible(true);
+	collation_lbl->setVisible(true);
+
+	//Partition keys don't accept sorting options
+	sorting_chk->setChecked(false);
+	sorting_chk->setVisible(false);
+	ascending_rb->setVisible(false);
+	descending_rb->setVisible(false);
+	nulls_first_chk->setVisible(false);
+
+	elements_tab->setColumnCount(4);
+	elements_tab->setHeaderLabel(trUtf8("Collation"), 2);
+	elements_tab->setHeaderIcon(QPixmap(PgModelerUiNS::getIconPath("collation")),2);
+	elements_tab->blockSignals(true);
+
+	for(unsigned i=0; i < part_keys.size(); i++)
+	{
+		elements_tab->addRow();
+		showElementData(part_keys[i], i);
+	}
+
+	elements_tab->blockSignals(false);
+}
+
 void ElementsWidget::clear(void)
 {
+	handle_part_keys=false;
 	column_cmb->clear();
 	sorting_chk->setEnabled(true);
+	sorting_chk->setVisible(true);
+	ascending_rb->setVisible(true);
+	descending_rb->setVisible(true);
+	nulls_first_chk->setVisible(true);
 
 	elements_tab->blockSignals(true);
 	elements_tab->removeRows();
@@ -232,10 +266,16 @@ void ElementsWidget::showElementData(ExcludeElement elem, int elem_idx)
 	showElementData(&elem, elem_idx);
 }
 
+void ElementsWidget::showElementData(PartitionKey elem, int elem_idx)
+{
+	showElementData(&elem, elem_idx);
+}
+
 void ElementsWidget::showElementData(Element *elem, int elem_idx)
 {
 	IndexElement *idxelem = dynamic_cast<IndexElement *>(elem);
 	ExcludeElement *excelem = dynamic_cast<ExcludeElement *>(elem);
+	PartitionKey *partkey = dynamic_cast<PartitionKey *>(elem);
 
 	if(elem->getColumn())
 	{
@@ -253,12 +293,17 @@ void ElementsWidget::showElementData(Element *elem, int elem_idx)
 		elements_tab->setCellText(idxelem->getCollation()->getName(true), elem_idx, 2);
 	else if(excelem && excelem->getOperator())
 		elements_tab->setCellText(excelem->getOperator()->getSignature(true), elem_idx, 2);
+	else if(partkey && partkey->getCollation())
+		elements_tab->setCellText(partkey->getCollation()->getName(true), elem_idx, 2);
 
 	elements_tab->clearCellText(elem_idx, 3);
 	if(elem->getOperatorClass())
 		elements_tab->setCellText(elem->getOperatorClass()->getName(true), elem_idx, 3);
 
-	if(elem->isSortingEnabled())
+	//Partition keys have no sorting columns (see setAttributes())
+	if(partkey)
+		elements_tab->setRowData(QVariant::fromValue<PartitionKey>(*partkey), elem_idx);
+	else if(elem->isSortingEnabled())
 	{
 		if(elem->getSortingAttribute(IndexElement::ASC_ORDER))
 			elements_tab->setCellText(ascending_rb->text(), elem_idx, 4);
@@ -276,10 +321,10 @@ void ElementsWidget::showElementData(Element *elem, int elem_idx)
 		elements_tab->clearCellText(elem_idx, 5);
 	}
 
-	if(dynamic_cast<IndexElement *>(elem))
-		elements_tab->setRowData(QVariant::fromValue<IndexElement>(*dynamic_cast<IndexElement *>(elem)), elem_idx);
-	else
-		elements_tab->setRowData(QVariant::fromValue<ExcludeElement>(*dynamic_cast<ExcludeElement *>(elem)), elem_idx);
+	if(idxelem)
+		elements_tab->setRowData(QVariant::fromValue<IndexElement>(*idxelem), elem_idx);
+	else if(excelem)
+		elements_tab->setRowData(QVariant::fromValue<ExcludeElement>(*excelem), elem_idx);
 }
 
 void ElementsWidget::handleElement(int elem_idx)
@@ -289,19 +334,26 @@ void ElementsWidget::handleElement(int elem_idx)
 	{
 		IndexElement idxelem;
 		ExcludeElement excelem;
+		PartitionKey partkey;
+		Element *elem = nullptr;
 
 		/* Selects the correct element based upon the visibility of operator
 			 selector (available only for ExcludeElement) */
-		Element *elem = (operator_sel->isVisible() ?
-							 dynamic_cast<Element *>(&excelem) :
-							 dynamic_cast<Element *>(&idxelem));
+		if(handle_part_keys)
+			elem = &partkey;
+		else if(operator_sel->isVisible())
+			elem = &excelem;
+		else
+			elem = &idxelem;
 
 		elem->setSortingEnabled(sorting_chk->isChecked());
 		elem->setSortingAttribute(IndexElement::NULLS_FIRST, nulls_first_chk->isChecked());
 		elem->setSortingAttribute(IndexElement::ASC_ORDER, ascending_rb->isChecked());
 		elem->setOperatorClass(dynamic_cast<OperatorClass *>(op_class_sel->getSelectedObject()));
 
-		if(collation_sel->isVisible())
+		if(handle_part_keys)
+			partkey.setCollation(dynamic_cast<Collation *>(collation_sel->getSelectedObject()));
+		else if(collation_sel->isVisible())
 			idxelem.setCollation(dynamic_cast<Collation *>(collation_sel->getSelectedObject()));
 
 		if(operator_sel->isVisible())
@@ -316,7 +368,7 @@ void ElementsWidget::handleElement(int elem_idx)
 
 		elem_expr_txt->clear();
 		ascending_rb->setChecked(true);
-		sorting_chk->setChecked(true);
+		sorting_chk->setChecked(!handle_part_keys);
 		op_class_sel->clearSelector();
 		operator_sel->clearSelector();
 		collation_sel->clearSelector();
@@ -333,6 +385,7 @@ void ElementsWidget::editElement(int elem_idx)
 	Element *elem = nullptr;
 	IndexElement idxelem;
 	ExcludeElement excelem;
+	PartitionKey partkey;
 	QVariant data = elements_tab->getRowData(elem_idx);
 
 	//If the data is an IndexElement
@@ -341,6 +394,11 @@ void ElementsWidget::editElement(int elem_idx)
 		idxelem = data.value<IndexElement>();
 		elem = &idxelem;
 	}
+	else if(data.canConvert<PartitionKey>())
+	{
+		partkey = data.value<PartitionKey>();
+		elem = &partkey;
+	}
 	else
 	{
 		excelem = data.value<ExcludeElement>();
@@ -367,8 +425,10 @@ void ElementsWidget::editElement(int elem_idx)
 	sorting_chk->setChecked(elem->isSortingEnabled());
 	op_class_sel->setSelectedObject(elem->getOperatorClass());
 
-	//Specific for IndexElement
-	if(collation_sel->isVisible())
+	//Specific for IndexElement and PartitionKey
+	if(handle_part_keys)
+		collation_sel->setSelectedObject(partkey.getCollation());
+	else if(collation_sel->isVisible())
 		collation_sel->setSelectedObject(idxelem.getCollation());
 
 	//Specific for ExcludeElement
@@ -433,3 +493,14 @@ void ElementsWidget::getElements(vector<ExcludeElement> &elems)
 	}
 }
 
+void ElementsWidget::getElements(vector<PartitionKey> &part_keys)
+{
+	part_keys.clear();
+
+	for(unsigned i=0; i < elements_tab->getRowCount(); i++)
+	{
+		//Confirming if the data on elements table is PartitionKey
+		if(elements_tab->getRowData(i).canConvert<PartitionKey>())
+			part_keys.push_back(elements_tab->getRowData(i).value<PartitionKey>());
+	}
+}
@@ -19,7 +19,7 @@
 /**
 \ingroup libpgmodeler_ui
 \class ElementWidget
-\brief Implements the operations to create/edit constraints (exclude) and indexes elements via form.
+\brief Implements the operations to create/edit constraints (exclude), indexes elements and partition keys via form.
 */
 
 #ifndef ELEMENT_WIDGET_H
@@ -31,11 +31,12 @@
 #include "objectselectorwidget.h"
 #include "baseobjectwidget.h"
 
-/* Declaring the IndexElement and ExcludeElement class as a Qt metatype in order to permit
+/* Declaring the IndexElement, ExcludeElement and PartitionKey class as a Qt metatype in order to permit
 	 that instances of the class be used as data of QVariant and QMetaType */
 #include <QMetaType>
 Q_DECLARE_METATYPE(IndexElement)
 Q_DECLARE_METATYPE(ExcludeElement)
+Q_DECLARE_METATYPE(PartitionKey)
 
 class ElementsWidget: public QWidget, public Ui::ElementsWidget {
 	private:
@@ -57,30 +58,40 @@ class ElementsWidget: public QWidget, public Ui::ElementsWidget {
 		
 		//! \brief Operator selector (only for exclude elements)
 		*operator_sel;
-		
-		//! \brief Updates the column combobox with the existent columns on parent table
-		void updateColumnsCombo(void);
+
+		//! \brief Indicates that the widget is handling partition keys (no sorting options are available)
+		bool handle_part_keys;
 		
 		//! \brief Shows the element data on the elements table at the specified line
 		void showElementData(Element *elem, int elem_idx);
 		void showElementData(IndexElement elem, int elem_idx);
 		void showElementData(ExcludeElement elem, int elem_idx);
+		void showElementData(PartitionKey elem, int elem_idx);
 		void setAttributes(DatabaseModel *model, BaseObject *parent_obj);
 		
 	public:
 		ElementsWidget(QWidget *parent = 0);
+
+		//! \brief Updates the column combobox with the existent columns on parent table
+		void updateColumnsCombo(void);
 		
 		//! \brief Enables the widget to handle index elements
 		void setAttributes(DatabaseModel *model, BaseTable *table, vector<IndexElement> &elems);
 		
 		//! \brief Enables the widget to handle exclude constraint elements
 		void setAttributes(DatabaseModel *model, BaseObject *parent_obj, vector<ExcludeElement> &elems);
+
+		//! \brief Enables the widget to handle partition keys
+		void setAttributes(DatabaseModel *model, Table *table, vector<PartitionKey> &part_keys);
 		
 		//! \brief Copy the current elements into the list
 		void getElements(vector<IndexElement> &elems);
 		
 		//! \brief Copy the current elements into the list
 		void getElements(vector<ExcludeElement> &elems);
+
+		//! \brief Copy the current partition keys into the list
+		void getElements(vector<PartitionKey> &part_keys);
 		
 	public slots:
 		void clear(void);
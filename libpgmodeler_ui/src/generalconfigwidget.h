@@ -54,6 +54,10 @@ class GeneralConfigWidget: public BaseConfigWidget, public Ui::GeneralConfigWidg
 
 		static map<QString, attribs_map> config_params;
 
+		/*! \brief Indicates that the tracing was started by the settings (enable-tracing). Tracing started
+		via command line (--trace-file) is never stopped when the setting is disabled */
+		static bool tracing_by_settings;
+
 		static const unsigned UNIT_MILIMETERS=0,
 		UNIT_POINT=1,
 		UNIT_INCHS=2,
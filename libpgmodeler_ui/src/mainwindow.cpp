@@ -21,6 +21,7 @@
 #include "bugreportform.h"
 #include "metadatahandlingform.h"
 #include "sqlexecutionwidget.h"
+#include "tracer.h"
 
 bool MainWindow::confirm_validation=true;
 
@@ -31,11 +32,13 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 	map<QString, attribs_map >confs;
 	map<QString, attribs_map >::iterator itr, itr_end;
 	attribs_map attribs;
-	PluginsConfigWidget *plugins_conf_wgt=nullptr;
 	QGridLayout *grid=nullptr;
 
 	pending_op=NO_PENDING_OPER;
+	first_paint_done=false;
 	central_wgt=nullptr;
+	about_wgt=nullptr;
+	donate_wgt=nullptr;
 
 	canvas_info_wgt = new SceneInfoWidget(this);
 	QHBoxLayout *hbox = new QHBoxLayout(canvas_info_parent);
@@ -49,6 +52,8 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 	arrange_menu.addAction(trUtf8("Grid"), this, SLOT(arrangeObjects()));
 	arrange_menu.addAction(trUtf8("Hierarchical"), this, SLOT(arrangeObjects()));
 	arrange_menu.addAction(trUtf8("Scattered"), this, SLOT(arrangeObjects()));
+	arrange_menu.addAction(trUtf8("Layered"), this, SLOT(arrangeObjects()));
+	arrange_menu.addAction(trUtf8("Force-directed"), this, SLOT(arrangeObjects()));
 
 	try
 	{
@@ -72,15 +77,16 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 		grid->setSpacing(0);
 		grid->addWidget(sql_tool_wgt, 0, 0);
 		views_stw->widget(MANAGE_VIEW)->setLayout(grid);
+		TRACE_PHASE("startup", QString("main window widgets"));
 
 		configuration_form=new ConfigurationForm(nullptr, Qt::WindowTitleHint | Qt::WindowMinMaxButtonsHint | Qt::WindowCloseButtonHint);
 		PgModelerUiNS::resizeDialog(configuration_form);
+		//The other configuration widgets are created when needed (see ConfigurationForm::getConfigurationWidget())
 		configuration_form->loadConfiguration();
+		TRACE_PHASE("startup", QString("configuration files"));
 
-		plugins_conf_wgt=dynamic_cast<PluginsConfigWidget *>(configuration_form->getConfigurationWidget(ConfigurationForm::PLUGINS_CONF_WGT));
-		plugins_conf_wgt->installPluginsActions(nullptr, plugins_menu, this, SLOT(executePlugin(void)));
-		plugins_menu->setEnabled(!plugins_menu->isEmpty());
-		action_plugins->setEnabled(!plugins_menu->isEmpty());
+		plugins_menu->setEnabled(false);
+		action_plugins->setEnabled(false);
 		action_plugins->setMenu(plugins_menu);
 
 		action_other_actions->setMenu(&more_actions_menu);
@@ -146,8 +152,6 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 		control_tb->addAction(action_about);
 		control_tb->addAction(action_update_found);
 
-		about_wgt=new AboutWidget(this);
-		donate_wgt=new DonateWidget(this);
 		restoration_form=new ModelRestorationForm(nullptr, Qt::Dialog | Qt::WindowTitleHint | Qt::WindowMinMaxButtonsHint | Qt::WindowCloseButtonHint);
 
 #ifdef NO_UPDATE_CHECK
@@ -162,6 +166,7 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 		overview_wgt=new ModelOverviewWidget;
 		model_valid_wgt=new ModelValidationWidget;
 		obj_finder_wgt=new ObjectFinderWidget;
+		TRACE_PHASE("startup", QString("dock widgets"));
 	}
 	catch(Exception &e)
 	{
@@ -182,10 +187,7 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 #endif
 
 	connect(action_about,SIGNAL(toggled(bool)),this,SLOT(toggleAboutWidget(bool)));
-	connect(about_wgt, SIGNAL(s_visibilityChanged(bool)), action_about, SLOT(setChecked(bool)));
-
 	connect(action_donate, SIGNAL(toggled(bool)),this,SLOT(toggleDonateWidget(bool)));
-	connect(donate_wgt, SIGNAL(s_visibilityChanged(bool)), action_donate, SLOT(setChecked(bool)));
 
 	connect(action_restore_session,SIGNAL(triggered(bool)),this,SLOT(restoreLastSession()));
 	connect(action_exit,SIGNAL(triggered(bool)),this,SLOT(close()));
@@ -257,8 +259,6 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 	obj_finder_parent->setVisible(false);
 	model_valid_parent->setVisible(false);
 	bg_saving_wgt->setVisible(false);
-	about_wgt->setVisible(false);
-	donate_wgt->setVisible(false);
 
 	models_tbw_parent->lower();
 	central_wgt->lower();
@@ -338,15 +338,17 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 	GeneralConfigWidget *conf_wgt=dynamic_cast<GeneralConfigWidget *>(configuration_form->getConfigurationWidget(ConfigurationForm::GENERAL_CONF_WGT));
 	confs=conf_wgt->getConfigurationParams();
 
-	//If a previous session was restored save the temp models
-	updateConnections();
 	updateRecentModelsMenu();
-	configureSamplesMenu();
 	applyConfigurations();
+	TRACE_PHASE("startup", QString("configurations applied"));
 
 	//Temporary models are saved every two minutes
 	tmpmodel_save_timer.setInterval(120000);
 
+	//Idle pooled connections are checked every minute
+	connect(&conn_pool_timer, &QTimer::timeout, [](){ ConnectionPool::evictIdleConnections(); });
+	conn_pool_timer.start(60000);
+
 	QList<QAction *> actions=general_tb->actions();
 	QToolButton *btn=nullptr;
 	QFont font;
@@ -393,12 +395,6 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 			act->setToolTip(act->toolTip() + QString(" (%1)").arg(act->shortcut().toString()));
 	}
 
-	try
-	{
-		SQLExecutionWidget::loadSQLHistory();
-	}
-	catch(Exception &){}
-
 #ifndef Q_OS_MAC
 	//Restoring the canvas grid options
 	action_show_grid->setChecked(confs[ParsersAttributes::CONFIGURATION][ParsersAttributes::SHOW_CANVAS_GRID]==ParsersAttributes::_TRUE_);
@@ -442,6 +438,8 @@ MainWindow::MainWindow(QWidget *parent, Qt::WindowFlags flags) : QMainWindow(par
 #warning "DEMO VERSION: demonstration version startup alert."
 	QTimer::singleShot(5000, this, SLOT(showDemoVersionWarning()));
 #endif
+
+	TRACE_PHASE("startup", QString("main window setup"));
 }
 
 MainWindow::~MainWindow(void)
@@ -451,6 +449,10 @@ MainWindow::~MainWindow(void)
 	delete(restoration_form);
 	delete(overview_wgt);
 	delete(configuration_form);
+
+	//Closing the pooled connections so the server doesn't log them as abruptly terminated
+	conn_pool_timer.stop();
+	ConnectionPool::clear();
 }
 
 void MainWindow::restoreTemporaryModels(void)
@@ -588,6 +590,18 @@ void MainWindow::resizeEvent(QResizeEvent *)
 	action_update_found->setChecked(false);
 }
 
+void MainWindow::paintEvent(QPaintEvent *event)
+{
+	QMainWindow::paintEvent(event);
+
+	//The deferred subsystems are queued so they are only loaded after the children widgets are painted too
+	if(!first_paint_done)
+	{
+		first_paint_done=true;
+		QTimer::singleShot(0, this, SLOT(loadDeferredSubsystems()));
+	}
+}
+
 void MainWindow::closeEvent(QCloseEvent *event)
 {
 	//pgModeler will not close when the validation thread is still running
@@ -1744,6 +1758,15 @@ void MainWindow::toggleUpdateNotifier(bool show)
 
 void MainWindow::toggleAboutWidget(bool show)
 {
+	if(!about_wgt)
+	{
+		if(!show)
+			return;
+
+		about_wgt=new AboutWidget(this);
+		connect(about_wgt, SIGNAL(s_visibilityChanged(bool)), action_about, SLOT(setChecked(bool)));
+	}
+
 	if(show)
 	{
 		setFloatingWidgetPos(about_wgt, qobject_cast<QAction *>(sender()), control_tb, false);
@@ -1756,6 +1779,15 @@ void MainWindow::toggleAboutWidget(bool show)
 
 void MainWindow::toggleDonateWidget(bool show)
 {
+	if(!donate_wgt)
+	{
+		if(!show)
+			return;
+
+		donate_wgt=new DonateWidget(this);
+		connect(donate_wgt, SIGNAL(s_visibilityChanged(bool)), action_donate, SLOT(setChecked(bool)));
+	}
+
 	if(show)
 	{
 		setFloatingWidgetPos(donate_wgt, qobject_cast<QAction *>(sender()), control_tb, false);
@@ -2009,6 +2041,23 @@ void MainWindow::arrangeObjects(void)
 	if(!current_model)
 		return;
 
+	//The layout engine arrangements are registered in the operation history so they don't need confirmation
+	if(sender() == arrange_menu.actions().at(3) || sender() == arrange_menu.actions().at(4))
+	{
+		try
+		{
+			current_model->rearrangeTables(sender() == arrange_menu.actions().at(3) ?
+																		 LayoutEngine::LAYERED_LAYOUT : LayoutEngine::FORCE_DIRECTED_LAYOUT);
+		}
+		catch(Exception &e)
+		{
+			Messagebox msg_box;
+			msg_box.show(e);
+		}
+
+		return;
+	}
+
 	Messagebox msgbox;
 	msgbox.show(trUtf8("Rearrange objects over the canvas is an irreversible operation! Would like to proceed?"), Messagebox::CONFIRM_ICON, Messagebox::YES_NO_BUTTONS);
 
@@ -2043,3 +2092,29 @@ void MainWindow::toggleCompactView(void)
 
 	QApplication::restoreOverrideCursor();
 }
+
+void MainWindow::loadDeferredSubsystems(void)
+{
+	PluginsConfigWidget *plugins_conf_wgt=nullptr;
+
+	TRACE_PHASE("startup", QString("first paint"));
+
+	configuration_form->loadDeferredConfiguration();
+	TRACE_PHASE("startup", QString("snippets and plugins"));
+
+	plugins_conf_wgt=dynamic_cast<PluginsConfigWidget *>(configuration_form->getConfigurationWidget(ConfigurationForm::PLUGINS_CONF_WGT));
+	plugins_conf_wgt->installPluginsActions(nullptr, plugins_menu, this, SLOT(executePlugin(void)));
+	plugins_menu->setEnabled(!plugins_menu->isEmpty());
+	action_plugins->setEnabled(!plugins_menu->isEmpty());
+
+	configureSamplesMenu();
+
+	try
+	{
+		SQLExecutionWidget::loadSQLHistory();
+	}
+	catch(Exception &){}
+
+	updateConnections();
+	TRACE_PHASE("startup", QString("deferred subsystems"));
+}
@@ -75,6 +75,10 @@ class MainWindow: public QMainWindow, public Ui::MainWindow {
 
 		unsigned pending_op;
 
+		//! \brief Indicates that the main window was already painted and the deferred subsystems were scheduled to load
+		bool first_paint_done;
+
+		//! \brief About and donate widgets are only created the first time they are displayed
 		AboutWidget *about_wgt;
 
 		DonateWidget *donate_wgt;
@@ -92,7 +96,10 @@ class MainWindow: public QMainWindow, public Ui::MainWindow {
 		QThread tmpmodel_thread;
 
 		//! \brief Timer used for auto saving the model and temporary model.
-		QTimer model_save_timer,	tmpmodel_save_timer;
+		QTimer model_save_timer,	tmpmodel_save_timer,
+
+		//! \brief Timer used to close the pooled database connections that are idle for too long
+		conn_pool_timer;
 
 		//! \brief Model overview widget
 		ModelOverviewWidget *overview_wgt;
@@ -152,6 +159,9 @@ class MainWindow: public QMainWindow, public Ui::MainWindow {
 
 		void resizeEvent(QResizeEvent *);
 
+		//! \brief QMainWindow::paintEvent() overload: Schedules the loading of the deferred subsystems after the first paint
+		void paintEvent(QPaintEvent *event);
+
 		//! \brief Set the postion of a floating widget based upon an action at a tool bar
 		void setFloatingWidgetPos(QWidget *widget, QAction *act, QToolBar *toolbar, bool map_to_window);
 
@@ -294,6 +304,10 @@ class MainWindow: public QMainWindow, public Ui::MainWindow {
 		void restoreTemporaryModels(void);
 		void arrangeObjects(void);
 		void toggleCompactView(void);
+
+		/*! \brief Loads the subsystems that aren't needed to display the main window (snippets, plugins, samples menu,
+		SQL history and connections listing). This slot is queued by the first paint event so it runs once the paint is done */
+		void loadDeferredSubsystems(void);
 };
 
 #endif
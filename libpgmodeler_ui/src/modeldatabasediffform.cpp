@@ -97,6 +97,9 @@ ModelDatabaseDiffForm::ModelDatabaseDiffForm(QWidget *parent, Qt::WindowFlags f)
 		ignore_error_codes_ht=new HintTextWidget(ignore_extra_errors_hint, this);
 		ignore_error_codes_ht->setText(ignore_error_codes_chk->statusTip());
 
+		low_lock_ht=new HintTextWidget(low_lock_hint, this);
+		low_lock_ht->setText(low_lock_chk->statusTip());
+
 		sqlcode_hl=new SyntaxHighlighter(sqlcode_txt);
 		sqlcode_hl->loadConfiguration(GlobalAttributes::SQL_HIGHLIGHT_CONF_PATH);
 
@@ -118,6 +121,7 @@ ModelDatabaseDiffForm::ModelDatabaseDiffForm(QWidget *parent, Qt::WindowFlags f)
 		connect(file_edt, SIGNAL(textChanged(QString)), this, SLOT(enableDiffMode()));
 		connect(force_recreation_chk, SIGNAL(toggled(bool)), recreate_unmod_chk, SLOT(setEnabled(bool)));
 		connect(dont_drop_missing_objs_chk, SIGNAL(toggled(bool)), drop_missing_cols_constr_chk, SLOT(setEnabled(bool)));
+		connect(low_lock_chk, SIGNAL(toggled(bool)), low_lock_wgt, SLOT(setEnabled(bool)));
 		connect(create_tb, SIGNAL(toggled(bool)), this, SLOT(filterDiffInfos()));
 		connect(drop_tb, SIGNAL(toggled(bool)), this, SLOT(filterDiffInfos()));
 		connect(alter_tb, SIGNAL(toggled(bool)), this, SLOT(filterDiffInfos()));
@@ -486,6 +490,7 @@ void ModelDatabaseDiffForm::importDatabase(unsigned thread_id)
 		import_hlp->setCurrentDatabase(db_cmb->currentText());
 		import_hlp->setImportOptions(import_sys_objs_chk->isChecked(), import_ext_objs_chk->isChecked(), true,
 										ignore_errors_chk->isChecked(), false, false, false);
+		import_hlp->setImportThreads(QThread::idealThreadCount());
 		thread->start();
 	}
 	catch(Exception &e)
@@ -520,6 +525,8 @@ void ModelDatabaseDiffForm::diffModels(void)
 	diff_helper->setDiffOption(ModelsDiffHelper::OPT_PRESERVE_DB_NAME, preserve_db_name_chk->isChecked());
 	diff_helper->setDiffOption(ModelsDiffHelper::OPT_DONT_DROP_MISSING_OBJS, dont_drop_missing_objs_chk->isChecked());
 	diff_helper->setDiffOption(ModelsDiffHelper::OPT_DROP_MISSING_COLS_CONSTR, drop_missing_cols_constr_chk->isChecked());
+	diff_helper->setDiffOption(ModelsDiffHelper::OPT_LOW_LOCK_MODE, low_lock_chk->isChecked());
+	diff_helper->setLowLockTimeouts(lock_timeout_sb->value(), stmt_timeout_sb->value());
 
 	diff_helper->setModels(source_model, imported_model);
 
@@ -1,5 +1,6 @@
 #include "modelexporthelper.h"
 #include <QSvgGenerator>
+#include "tracer.h"
 
 ModelExportHelper::ModelExportHelper(QObject *parent) : QObject(parent)
 {
@@ -44,6 +45,27 @@ void ModelExportHelper::handleSQLError(Exception &e, const QString &sql_cmd, boo
 		errors.push_back(e);
 }
 
+bool ModelExportHelper::isTransactionControlCommand(const QString &sql_cmd)
+{
+	static const QRegExp tx_cmd_regexp(QString("^(BEGIN|START|COMMIT|END|ROLLBACK|ABORT|SAVEPOINT|RELEASE|PREPARE( )+TRANSACTION)\\b"),
+																		 Qt::CaseInsensitive);
+
+	return(tx_cmd_regexp.indexIn(sql_cmd.trimmed()) >= 0);
+}
+
+void ModelExportHelper::rollbackTransaction(Connection &conn)
+{
+	try
+	{
+		if(conn.isStablished() && conn.isInTransaction())
+			conn.executeDDLCommand(QString("ROLLBACK"));
+	}
+	catch(Exception &)
+	{
+		//Errors are ignored here since the connection is closed anyway rolling back the transaction
+	}
+}
+
 void ModelExportHelper::setIgnoredErrors(const QStringList &err_codes)
 {
 	QRegExp valid_code = QRegExp("([a-z]|[A-Z]|[0-9])+");
@@ -61,6 +83,8 @@ void ModelExportHelper::setIgnoredErrors(const QStringList &err_codes)
 
 void ModelExportHelper::exportToSQL(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver)
 {
+	TRACE_SCOPE("export", "exportToSQL");
+
 	if(!db_model)
 		throw Exception(ERR_ASG_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
@@ -90,13 +114,15 @@ void ModelExportHelper::exportToSQL(DatabaseModel *db_model, const QString &file
 
 void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename, double zoom, bool show_grid, bool show_delim, bool page_by_page, QGraphicsView *viewp)
 {
+	TRACE_SCOPE("export", "exportToPNG");
+
 	if(!scene)
 		throw Exception(ERR_ASG_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	try
 	{
 		QPixmap pix;
-		bool shw_grd, shw_dlm, align_objs;
+		bool shw_grd, shw_dlm, align_objs, simplified_view=false;
 		QGraphicsView *view=nullptr;
 		QRect retv;
 		QPolygon pol;
@@ -122,6 +148,10 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 		//Sets the options passed by the user
 		ObjectsScene::setGridOptions(show_grid, false, show_delim);
 
+		//The objects are exported in full detail regardless the zoom factor
+		simplified_view=scene->isSimplifiedView();
+		scene->setSimplifiedView(false);
+
 		if(page_by_page)
 		{
 			QPrinter::Orientation orient;
@@ -212,6 +242,7 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 			{
 				//Restoring the scene settings before throw error
 				ObjectsScene::setGridOptions(shw_grd, align_objs, shw_dlm);
+				scene->setSimplifiedView(simplified_view);
 				scene->update();
 
 				throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(file),
@@ -221,6 +252,7 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 
 		//Restoring the scene settings
 		ObjectsScene::setGridOptions(shw_grd, align_objs, shw_dlm);
+		scene->setSimplifiedView(simplified_view);
 		scene->update();
 
 		if(!export_canceled)
@@ -242,10 +274,12 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 
 void ModelExportHelper::exportToSVG(ObjectsScene *scene, const QString &filename, bool show_grid, bool show_delim)
 {
+	TRACE_SCOPE("export", "exportToSVG");
+
 	if(!scene)
 		throw Exception(ERR_ASG_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	bool shw_dlm=false, shw_grd=false, align_objs=false;
+	bool shw_dlm=false, shw_grd=false, align_objs=false, simplified_view=scene->isSimplifiedView();
 	QSvgGenerator svg_gen;
 	QRectF scene_rect=scene->itemsBoundingRect(true);
 	QFileInfo fi(filename);
@@ -256,6 +290,10 @@ void ModelExportHelper::exportToSVG(ObjectsScene *scene, const QString &filename
 
 	//Disabling grid and delimiters
 	ObjectsScene::setGridOptions(show_grid, false, show_delim);
+
+	//Exporting the objects in full detail and as vector graphics
+	scene->setSimplifiedView(false);
+	scene->setItemsCacheEnabled(false);
 	scene->update();
 
 	emit s_progressUpdated(0, trUtf8("Exporting model to SVG file."));
@@ -270,6 +308,8 @@ void ModelExportHelper::exportToSVG(ObjectsScene *scene, const QString &filename
 
 	//Restoring the scene settings
 	ObjectsScene::setGridOptions(shw_grd, align_objs, shw_dlm);
+	scene->setItemsCacheEnabled(true);
+	scene->setSimplifiedView(simplified_view);
 	scene->update();
 
 	if(!fi.exists() || !fi.isWritable() || !fi.isReadable())
@@ -310,6 +350,8 @@ void ModelExportHelper::exportToSVG(ObjectsScene *scene, const QString &filename
 
 void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, const QString &pgsql_ver, bool ignore_dup, bool drop_db, bool drop_objs, bool simulate, bool use_tmp_names)
 {
+	TRACE_SCOPE("export", "exportToDBMS");
+
 	int type_id = 0, pos = -1;
 	QString  version, sql_cmd, buf, sql_cmd_comment;
 	Connection new_db_conn;
@@ -392,6 +434,12 @@ void ModelExportHelper::exportToDBMS(DatabaseModel *db_model, Connection conn, c
 
 			try
 			{
+				Connection db_conn=Connection(conn.getConnectionParams());
+
+				//Idle pooled connections to the database would prevent it from being dropped
+				db_conn.setConnectionParam(Connection::PARAM_DB_NAME, db_model->getName());
+				ConnectionPool::clear(db_conn.getPoolKey());
+
 				sql_cmd = QString("DROP DATABASE IF EXISTS %1;").arg(db_model->getName(true));
 				conn.executeDDLCommand(sql_cmd);
 			}
@@ -757,37 +805,23 @@ bool ModelExportHelper::isDuplicationError(const QString &error_code)
 
 void ModelExportHelper::exportBufferToDBMS(const QString &buffer, Connection &conn, bool drop_objs)
 {
+	TRACE_SCOPE("export", "exportBufferToDBMS");
+
 	Connection aux_conn;
-	QString sql_buf=buffer, sql_cmd, aux_cmd, lin, msg,
-			obj_name, obj_tp_name, tab_name, orig_conn_db_name,
-			alter_tab=QString("ALTER TABLE");
+	QString sql_cmd, msg, orig_conn_db_name;
 	vector<QString> db_sql_cmds;
-	QTextStream ts;
-	ObjectType obj_type=BASE_OBJECT;
-	bool ddl_tk_found=false, is_create=false, is_drop=false;
-	unsigned aux_prog=0, curr_size=0, buf_size=sql_buf.size(),
+	SQLStatementSplitter splitter(buffer);
+	SQLStatementSplitter::Statement stmt;
+	unsigned aux_prog=0, buf_size=buffer.size(),
 			factor=(db_name.isEmpty() ? 70 : 90);
-	int pos=0, pos1=0, comm_cnt=0;
-
-	//Regexp used to extract the object being created
-	QRegExp obj_reg(QString("(CREATE|DROP|ALTER)(.)+(\n)")),
-			tab_obj_reg(QString("^(%1)(.)+(ADD|DROP)( )(COLUMN|CONSTRAINT)( )*").arg(alter_tab)),
-			drop_reg(QString("^((\\-\\-)+( )*)+(DROP)(.)+")),
-			drop_tab_obj_reg(QString("^((\\-\\-)+( )*)+(%1)(.)+(DROP)(.)+").arg(alter_tab)),
-			reg_aux;
-
-	vector<ObjectType> obj_types={ OBJ_ROLE, OBJ_FUNCTION, OBJ_TRIGGER, OBJ_INDEX, OBJ_POLICY,
-								   OBJ_RULE,	OBJ_TABLE, OBJ_VIEW, OBJ_DOMAIN,
-								   OBJ_SCHEMA,	OBJ_AGGREGATE, OBJ_OPFAMILY,
-								   OBJ_OPCLASS, OBJ_OPERATOR,  OBJ_SEQUENCE,
-								   OBJ_CONVERSION, OBJ_CAST,	OBJ_LANGUAGE,
-								   OBJ_COLLATION, OBJ_EXTENSION, OBJ_TYPE,
-								   OBJ_EVENT_TRIGGER, OBJ_DATABASE };
-
+	bool use_savepoints=(ignore_dup || !ignored_errors.isEmpty()), in_savepoint=false;
 
 	/* Extract each SQL command from the buffer and execute them separately. This is done
-   to permit the user, in case of error, identify what object is wrongly configured. */
-	ts.setString(&sql_buf);
+	to permit the user, in case of error, identify what object is wrongly configured.
+
+	If the drop objects option is checked the commented DROP commands (DROP [OBJECT] or
+	ALTER TABLE...DROP) generated for the enabled objects are extracted as well */
+	splitter.setCommentedDropsEnabled(drop_objs);
 
 	if(!conn.isStablished())
 	{
@@ -799,209 +833,88 @@ void ModelExportHelper::exportBufferToDBMS(const QString &buffer, Connection &co
 		conn.connect();
 	}
 
-	while(!ts.atEnd() && !export_canceled)
+	while(!export_canceled && splitter.next(stmt))
 	{
 		try
 		{
-			//Cleanup single line comments
-			lin=ts.readLine();
-			curr_size+=lin.size();
-			aux_prog=progress + ((curr_size/static_cast<float>(buf_size)) * factor);
-
-			/* If the simulation mode is off and the drop objects option is checked,
-		 check if the current line matches one of the accepted drop commands
-		 (DROP [OBJECT] or ALTER TABLE...DROP) */
-			if(drop_objs && (drop_reg.exactMatch(lin) || drop_tab_obj_reg.exactMatch(lin)))
-			{
-				comm_cnt=lin.count(QString("--"));
-				lin=lin.remove(QString("--")).trimmed();
+			in_savepoint=false;
+			sql_cmd=splitter.getStatement(stmt);
+			aux_prog=progress + ((splitter.getPosition()/static_cast<float>(buf_size)) * factor);
 
-				/* If the count of comment indicators (--) is 1 indicates that the DDL of the
-		   object related to the DROP is enabled, so the DROP is executed otherwise ignored */
-				if(comm_cnt==1)
-				{
-					sql_cmd=lin + QString("\n");
-					ddl_tk_found=true;
-				}
+			if(stmt.cmd_type!=SQLStatementSplitter::CMD_OTHER)
+			{
+				if(stmt.cmd_type==SQLStatementSplitter::CMD_CREATE)
+					msg=trUtf8("Creating object `%1' (%2)");
+				else if(stmt.cmd_type==SQLStatementSplitter::CMD_DROP)
+					msg=trUtf8("Dropping object `%1' (%2)");
+				else
+					msg=trUtf8("Changing object `%1' (%2)");
+
+				emit s_progressUpdated(aux_prog, msg.arg(stmt.obj_name).arg(BaseObject::getTypeName(stmt.obj_type)), stmt.obj_type, sql_cmd);
 			}
 			else
 			{
-				ddl_tk_found=(lin.indexOf(ParsersAttributes::DDL_END_TOKEN) >= 0);
-				lin.remove(QRegExp(QString("^(--)+(.)+$")));
-
-				//If the line isn't empty after cleanup it will be included on sql command
-				if(!lin.isEmpty())
-					sql_cmd += lin + QString("\n");
+				//General commands like grant, revoke or set aren't explicitly shown
+				emit s_progressUpdated(aux_prog, trUtf8("Running auxiliary command."), BASE_OBJECT, sql_cmd);
 			}
 
-			//If the ddl end token is found
-			if(ddl_tk_found || (!sql_cmd.isEmpty() && ts.atEnd()))
+			//Commands related to the database itself are executed at the end using the original connection
+			if(stmt.obj_type==OBJ_DATABASE)
+				db_sql_cmds.push_back(sql_cmd);
+			else
 			{
-				//Checking if the command is a column or constraint creation via ALTER TABLE
-				aux_cmd=sql_cmd;
-				pos=tab_obj_reg.indexIn(aux_cmd);
-
-				if(pos >= 0)
-				{
-					aux_cmd.remove('"');
-					aux_cmd.remove(QString("IF EXISTS "));
-					obj_type=(aux_cmd.contains(QString("COLUMN")) ? OBJ_COLUMN : OBJ_CONSTRAINT);
-					reg_aux=QRegExp(QString("(COLUMN|CONSTRAINT)( )+"));
-
-					//Extracting the table name
-					pos=aux_cmd.indexOf(alter_tab) + alter_tab.size();
-					pos1=aux_cmd.indexOf(QString("ADD"));
-
-					if(pos1 < 0)
-					{
-						pos1=aux_cmd.indexOf(QString("DROP"));
-						is_drop=true;
-					}
-
-					tab_name=aux_cmd.mid(pos, pos1 - pos).simplified();
-
-					//Extracting the child object name (column | constraint) the one between
-					pos=reg_aux.indexIn(aux_cmd, pos1);
-					pos+=reg_aux.matchedLength();
-
-					pos1=aux_cmd.indexOf(" ", pos);
-					obj_name=aux_cmd.mid(pos, pos1 - pos).simplified();
-
-					//Creating a fully qualified name for the object (schema.table.name)
-					obj_name=tab_name + QString(".") + obj_name;
-
-					if(is_drop)
-						msg=trUtf8("Dropping object `%1' (%2)").arg(obj_name).arg(BaseObject::getTypeName(obj_type));
-					else
-						msg=trUtf8("Creating object `%1' (%2)").arg(obj_name).arg(BaseObject::getTypeName(obj_type));
-
-					emit s_progressUpdated(aux_prog, msg, obj_type, sql_cmd);
-					is_drop=false;
-				}
-				//Check if the regex matches the sql command
-				else if(obj_reg.exactMatch(sql_cmd))
-				{
-					//Get the fisrt line of the sql command, that contains the CREATE/DROP/ALTER ... statement
-					lin=sql_cmd.mid(0, sql_cmd.indexOf('\n'));
-
-					for(ObjectType obj_tp : obj_types)
-					{
-						if(export_canceled) break;
-
-						obj_type=obj_tp;
+				/* Inside a transaction block (e.g. diffs generated in low-lock mode) an error aborts the whole transaction,
+				so when errors can be ignored each command runs under a savepoint that is rolled back in case of error */
+				in_savepoint=use_savepoints && conn.isInTransaction() && !isTransactionControlCommand(sql_cmd);
 
-						//Appeding special tokens when the object is an index or view
-						if(lin.startsWith(QString("CREATE")) || lin.startsWith(QString("ALTER")))
-						{
-							if(obj_tp==OBJ_INDEX)
-							{
-								lin.remove(QString("UNIQUE"));
-								lin.remove(QString("CONCURRENTLY"));
-							}
-							else if(obj_tp==OBJ_VIEW)
-							{
-								lin.remove(QString("MATERIALIZED"));
-								lin.remove(QString("RECURSIVE"));
-							}
-							else if(obj_tp==OBJ_TABLE)
-							{
-								lin.remove(QString("UNLOGGED"));
-							}
-							else if(obj_tp==OBJ_FUNCTION)
-							{
-								lin.remove(QString("OR REPLACE"));
-							}
-						}
-						else if(lin.startsWith(QString("DROP")))
-						{
-							lin.remove(QString("IF EXISTS"));
-							lin.remove(QString("MATERIALIZED"));
-						}
-
-						lin=lin.simplified();
+				if(in_savepoint)
+					conn.executeDDLCommand(QString("SAVEPOINT pgmodeler_export"));
 
-						//Check if the keyword for the current object exists on string
-						reg_aux.setPattern(QString("(CREATE|DROP|ALTER)( )(%1)").arg(BaseObject::getSQLName(obj_tp)));
-						pos=reg_aux.indexIn(lin);
-
-						if(pos >= 0)
-						{
-							is_create=lin.startsWith(QString("CREATE"));
-							is_drop=(!is_create && lin.startsWith(QString("DROP")));
-
-							//Extracts from the line the string starting with the object's name
-							lin=lin.mid(reg_aux.matchedLength(), sql_cmd.indexOf('\n')).simplified();
-							lin.remove('"');
-
-							if(obj_tp!=OBJ_CAST)
-							{
-								int spc_idx=lin.indexOf(' ');
-								obj_name=lin.mid(0, (spc_idx >= 0 ? spc_idx + 1 : lin.size()));
-
-								if(obj_tp!=OBJ_FUNCTION)
-								{
-									obj_name=obj_name.remove('(').simplified();
-									obj_name=obj_name.remove(')').simplified();
-								}
-							}
-							else
-							{
-								obj_name=QString("cast") + lin.replace(QString(" AS "),QString(","));
-							}
-
-							//Stores the object type name
-							obj_tp_name=BaseObject::getTypeName(obj_tp);
-							obj_name.remove(';');
-
-							if(is_create)
-								msg=trUtf8("Creating object `%1' (%2)").arg(obj_name).arg(obj_tp_name);
-							else if(is_drop)
-								msg=trUtf8("Dropping object `%1' (%2)").arg(obj_name).arg(obj_tp_name);
-							else
-								msg=trUtf8("Changing object `%1' (%2)").arg(obj_name).arg(obj_tp_name);
+				conn.executeDDLCommand(sql_cmd);
 
-							break;
-						}
-					}
+				if(in_savepoint)
+					conn.executeDDLCommand(QString("RELEASE SAVEPOINT pgmodeler_export"));
+			}
+		}
+		catch(Exception &e)
+		{
+			try
+			{
+				if(in_savepoint)
+					conn.executeDDLCommand(QString("ROLLBACK TO SAVEPOINT pgmodeler_export"));
 
-					emit s_progressUpdated(aux_prog, msg, obj_type, sql_cmd);
-					is_create=is_drop=false;
-					msg.clear();
-				}
-				else if(!sql_cmd.trimmed().isEmpty())
-				{
-					//General commands like grant, revoke or set aren't explicitly shown
-					emit s_progressUpdated(aux_prog, trUtf8("Running auxiliary command."), BASE_OBJECT, sql_cmd);
-				}
+				handleSQLError(e, sql_cmd, ignore_dup);
+			}
+			catch(Exception &aux_e)
+			{
+				//The pending transaction block is discarded so the connection is left in a usable state
+				rollbackTransaction(conn);
+				throw Exception(aux_e.getErrorMessage(),aux_e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&aux_e);
+			}
+		}
+	}
 
-				//Executes the extracted SQL command
-				if(!sql_cmd.isEmpty())
-				{
-					if(obj_type!=OBJ_DATABASE)
-						conn.executeDDLCommand(sql_cmd);
-					else
-						db_sql_cmds.push_back(sql_cmd);
-				}
+	if(export_canceled)
+		rollbackTransaction(conn);
 
-				sql_cmd.clear();
-				ddl_tk_found=false;
-			}
+	if(!export_canceled && !db_sql_cmds.empty())
+	{
+		try
+		{
+			conn.close();
+			aux_conn=conn;
+			aux_conn.setConnectionParam(Connection::PARAM_DB_NAME, orig_conn_db_name);
+			aux_conn.connect();
 
-			if(ts.atEnd() && !db_sql_cmds.empty())
+			for(QString cmd : db_sql_cmds)
 			{
-				conn.close();
-				aux_conn=conn;
-				aux_conn.setConnectionParam(Connection::PARAM_DB_NAME, orig_conn_db_name);
-				aux_conn.connect();
-				for(QString cmd : db_sql_cmds)
-					aux_conn.executeDDLCommand(cmd);
+				sql_cmd=cmd;
+				aux_conn.executeDDLCommand(cmd);
 			}
 		}
 		catch(Exception &e)
 		{
-			if(ddl_tk_found) ddl_tk_found=false;
 			handleSQLError(e, sql_cmd, ignore_dup);
-			sql_cmd.clear();
 		}
 	}
 
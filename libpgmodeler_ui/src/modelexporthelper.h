@@ -27,6 +27,7 @@
 
 #include "modelwidget.h"
 #include "connection.h"
+#include "sqlstatementsplitter.h"
 
 class ModelExportHelper: public QObject {
 	private:
@@ -115,7 +116,9 @@ class ModelExportHelper: public QObject {
 		//! \brief Restore the original name of the database, roles and tablespaces
 		void restoreObjectNames(void);
 
-		//! \brief Exports the contents of the buffer to a previously opened connection
+		/*! \brief Exports the contents of the buffer to a previously opened connection. The buffer may contain transaction
+		blocks mixed with commands that must run outside of them (e.g. CREATE INDEX CONCURRENTLY). In case of errors
+		the pending transaction block is rolled back */
 		void exportBufferToDBMS(const QString &buffer, Connection &conn, bool drop_objs=false);
 
 		//! \brief Returns if the error code is one of the treated by the export process as object duplication error
@@ -134,6 +137,12 @@ class ModelExportHelper: public QObject {
 		3) abort the export by immediatelly redirecting the error to the user */
 		void handleSQLError(Exception &e, const QString &sql_cmd, bool ignore_dup);
 
+		//! \brief Returns if the command starts, finishes or controls a transaction block (BEGIN, COMMIT, SAVEPOINT, etc)
+		static bool isTransactionControlCommand(const QString &sql_cmd);
+
+		//! \brief Rolls back the transaction block pending in the connection (if any) ignoring errors
+		static void rollbackTransaction(Connection &conn);
+
 	public:
 		ModelExportHelper(QObject *parent = 0);
 
@@ -300,6 +300,8 @@ QTreeWidgetItem *ModelObjectsWidget::createItemForObject(BaseObject *object, QTr
 			str_aux=QString("dep");
 		else if(rel_type==BaseRelationship::RELATIONSHIP_GEN)
 			str_aux=QString("gen");
+		else if(rel_type==BaseRelationship::RELATIONSHIP_PART)
+			str_aux=QString("part");
 	}
 	else if(obj_type==OBJ_CONSTRAINT)
 	{
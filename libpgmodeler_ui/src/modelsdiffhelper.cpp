@@ -19,6 +19,7 @@
 #include "modelsdiffhelper.h"
 #include <QThread>
 #include "pgmodelerns.h"
+#include "tracer.h"
 
 ModelsDiffHelper::ModelsDiffHelper(void)
 {
@@ -37,6 +38,10 @@ ModelsDiffHelper::ModelsDiffHelper(void)
 	diff_opts[OPT_PRESERVE_DB_NAME]=true;
 	diff_opts[OPT_DONT_DROP_MISSING_OBJS]=false;
 	diff_opts[OPT_DROP_MISSING_COLS_CONSTR]=false;
+	diff_opts[OPT_LOW_LOCK_MODE]=false;
+
+	lock_timeout=DEFAULT_LOCK_TIMEOUT;
+	stmt_timeout=DEFAULT_STMT_TIMEOUT;
 }
 
 ModelsDiffHelper::~ModelsDiffHelper(void)
@@ -46,7 +51,7 @@ ModelsDiffHelper::~ModelsDiffHelper(void)
 
 void ModelsDiffHelper::setDiffOption(unsigned opt_id, bool value)
 {
-	if(opt_id > OPT_DROP_MISSING_COLS_CONSTR)
+	if(opt_id > OPT_LOW_LOCK_MODE)
 		throw Exception(ERR_REF_ELEM_INV_INDEX,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	if(opt_id == OPT_DROP_MISSING_COLS_CONSTR)
@@ -55,6 +60,12 @@ void ModelsDiffHelper::setDiffOption(unsigned opt_id, bool value)
 		diff_opts[opt_id]=value;
 }
 
+void ModelsDiffHelper::setLowLockTimeouts(unsigned lock_timeout, unsigned stmt_timeout)
+{
+	this->lock_timeout=lock_timeout;
+	this->stmt_timeout=stmt_timeout;
+}
+
 void ModelsDiffHelper::setPgSQLVersion(const QString pgsql_ver)
 {
 	this->pgsql_version=pgsql_ver;
@@ -89,6 +100,8 @@ unsigned ModelsDiffHelper::getDiffTypeCount(unsigned diff_type)
 
 void ModelsDiffHelper::diffModels(void)
 {
+	TRACE_SCOPE("diff", "diffModels");
+
 	try
 	{
 		if(!source_model || !imported_model)
@@ -99,6 +112,10 @@ void ModelsDiffHelper::diffModels(void)
 		//Second, we will check the objects to be created or modified
 		diffModels(ObjectsDiffInfo::CREATE_OBJECT);
 
+		TRACE_COUNTER("diff", QString("create"), diffs_counter[ObjectsDiffInfo::CREATE_OBJECT]);
+		TRACE_COUNTER("diff", QString("alter"), diffs_counter[ObjectsDiffInfo::ALTER_OBJECT]);
+		TRACE_COUNTER("diff", QString("drop"), diffs_counter[ObjectsDiffInfo::DROP_OBJECT]);
+
 		if(diff_canceled)
 			emit s_diffCanceled();
 		else
@@ -197,6 +214,8 @@ void ModelsDiffHelper::diffTables(Table *src_table, Table *imp_table, unsigned d
 
 void ModelsDiffHelper::diffModels(unsigned diff_type)
 {
+	TRACE_SCOPE("diff", diff_type==ObjectsDiffInfo::DROP_OBJECT ? "diffModels (drop)" : "diffModels (create/alter)");
+
 	if(diff_canceled)
 		return;
 
@@ -248,6 +267,7 @@ void ModelsDiffHelper::diffModels(unsigned diff_type)
 				emit s_progressUpdated(prog + ((idx/static_cast<float>(obj_order.size())) * factor),
 									   trUtf8("Processing object `%1' (%2)...").arg(object->getSignature()).arg(object->getTypeName()),
 									   object->getObjectType());
+				TRACE_COUNTER("diff", QString("compared objects"), 1);
 
 				//Processing objects that are not database, table child object (they are processed further)
 				if(obj_type!=OBJ_DATABASE && !TableObject::isTableObject(obj_type))
@@ -264,7 +284,7 @@ void ModelsDiffHelper::diffModels(unsigned diff_type)
 							   !diff_opts[OPT_KEEP_OBJ_PERMS]))))
 						generateDiffInfo(diff_type, object);
 
-					//Processing relationship (in this case only generalization ones are considered)
+					//Processing relationship (in this case only generalization and partitioning ones are considered)
 					else if(obj_type==OBJ_RELATIONSHIP)
 					{
 						Table *ref_tab=nullptr, *rec_tab=nullptr;
@@ -272,7 +292,8 @@ void ModelsDiffHelper::diffModels(unsigned diff_type)
 
 						rec_tab=aux_model->getTable(rel->getReceiverTable()->getName(true));
 
-						if(rel->getRelationshipType()==BaseRelationship::RELATIONSHIP_GEN)
+						if(rel->getRelationshipType()==BaseRelationship::RELATIONSHIP_GEN ||
+							 rel->getRelationshipType()==BaseRelationship::RELATIONSHIP_PART)
 						{
 							ref_tab=aux_model->getTable(rel->getReferenceTable()->getName(true));
 
@@ -316,8 +337,15 @@ void ModelsDiffHelper::diffModels(unsigned diff_type)
 								  ParsersAttributes::APPENDED_SQL,
 								  ParsersAttributes::PREPENDED_SQL });
 
+							//Tables which partitioning changed are recreated since there's no ALTER form to change it
+							if(obj_type==OBJ_TABLE &&
+								 isPartitioningChanged(dynamic_cast<Table *>(object), dynamic_cast<Table *>(aux_object)))
+							{
+								recreatePartitionedTable(dynamic_cast<Table *>(object), dynamic_cast<Table *>(aux_object));
+								objs_differs=xml_differs=false;
+							}
 							//If a difference was detected between the objects
-							if(objs_differs || xml_differs)
+							else if(objs_differs || xml_differs)
 							{
 								generateDiffInfo(ObjectsDiffInfo::ALTER_OBJECT, object, aux_object);
 
@@ -445,6 +473,83 @@ BaseObject *ModelsDiffHelper::getRelNNTable(const QString &obj_name, DatabaseMod
 	return(tab);
 }
 
+bool ModelsDiffHelper::isPartitioningChanged(Table *table, Table *aux_table)
+{
+	vector<PartitionKey> keys, aux_keys;
+	PartitioningType part_type, aux_part_type;
+
+	if(!table || !aux_table)
+		return(false);
+
+	part_type=table->getPartitioningType();
+	aux_part_type=aux_table->getPartitioningType();
+
+	if(part_type!=aux_part_type)
+		return(true);
+
+	keys=table->getPartitionKeys();
+	aux_keys=aux_table->getPartitionKeys();
+
+	if(keys.size()!=aux_keys.size())
+		return(true);
+
+	for(unsigned i=0; i < keys.size(); i++)
+	{
+		if(keys[i].getCodeDefinition(SchemaParser::SQL_DEFINITION)!=aux_keys[i].getCodeDefinition(SchemaParser::SQL_DEFINITION))
+			return(true);
+	}
+
+	return(false);
+}
+
+void ModelsDiffHelper::recreatePartitionedTable(Table *table, Table *aux_table)
+{
+	BaseRelationship *rel=nullptr;
+	Table *aux_part_tab=nullptr;
+	Constraint *constr=nullptr;
+
+	if(!table || !aux_table)
+		return;
+
+	//Detaching all the current partitions so they survive the drop of the partitioned table
+	for(auto &part_tab : aux_table->getPartitionTables())
+	{
+		rel=imported_model->getRelationship(part_tab, aux_table);
+
+		if(rel)
+			generateDiffInfo(ObjectsDiffInfo::DROP_OBJECT, rel);
+	}
+
+	generateDiffInfo(ObjectsDiffInfo::DROP_OBJECT, aux_table);
+	generateDiffInfo(ObjectsDiffInfo::CREATE_OBJECT, table);
+
+	/* Attaching the partitions that already exist in the database to the new table. The ones
+	that don't exist are created as partitions of the table by their own CREATE TABLE commands */
+	for(auto &part_tab : table->getPartitionTables())
+	{
+		aux_part_tab=imported_model->getTable(part_tab->getName(true));
+		rel=source_model->getRelationship(part_tab, table);
+
+		if(aux_part_tab && rel)
+			generateDiffInfo(ObjectsDiffInfo::CREATE_OBJECT, rel);
+	}
+
+	//Recreating the child objects which code is not generated together with the table's code
+	for(auto &obj_type : { OBJ_INDEX, OBJ_TRIGGER, OBJ_RULE, OBJ_POLICY, OBJ_CONSTRAINT })
+	{
+		for(auto &tab_obj : *table->getObjectList(obj_type))
+		{
+			constr=dynamic_cast<Constraint *>(tab_obj);
+
+			if(tab_obj->isSQLDisabled() ||
+				 (constr && constr->getConstraintType()!=ConstraintType::foreign_key))
+				continue;
+
+			generateDiffInfo(ObjectsDiffInfo::CREATE_OBJECT, tab_obj);
+		}
+	}
+}
+
 void ModelsDiffHelper::generateDiffInfo(unsigned diff_type, BaseObject *object, BaseObject *old_object)
 {
 	try
@@ -598,6 +703,8 @@ bool ModelsDiffHelper::isDiffInfoExists(unsigned diff_type, BaseObject *object,
 
 void ModelsDiffHelper::processDiffInfos(void)
 {
+	TRACE_SCOPE("diff", "processDiffInfos");
+
 	BaseObject *object=nullptr;
 	Relationship *rel=nullptr;
 	map<unsigned, QString> drop_objs, create_objs, alter_objs, truncate_tabs, create_fks, create_constrs;
@@ -622,6 +729,11 @@ void ModelsDiffHelper::processDiffInfos(void)
 		//Overriding the global PostgreSQL version so the diff code can match the destination server version
 		BaseObject::setPgSQLVersion(pgsql_version);
 
+		concurr_drops.clear();
+		concurr_creates.clear();
+		enum_alters.clear();
+		validate_cmds.clear();
+
 		if(!diff_infos.empty())
 			emit s_progressUpdated(0, trUtf8("Processing diff infos..."));
 
@@ -687,10 +799,11 @@ void ModelsDiffHelper::processDiffInfos(void)
 			//Generating the DROP commands
 			if(diff_type==ObjectsDiffInfo::DROP_OBJECT)
 			{
-				if(rel && rel->getRelationshipType()==BaseRelationship::RELATIONSHIP_GEN)
+				if(rel && (rel->getRelationshipType()==BaseRelationship::RELATIONSHIP_GEN ||
+									 rel->getRelationshipType()==BaseRelationship::RELATIONSHIP_PART))
 				{
-					//Undoing inheritances
-					no_inherit_def+=rel->getInheritDefinition(true);
+					//Undoing inheritances / detaching partitions
+					no_inherit_def+=rel->getAlterRelTableDefinition(true);
 				}
 				else if(obj_type==OBJ_PERMISSION)
 					//Unsetting permissions
@@ -699,7 +812,7 @@ void ModelsDiffHelper::processDiffInfos(void)
 				{
 					//Ordinary drop commands for any object except columns
 					if(obj_type!=OBJ_COLUMN)
-						drop_objs[object->getObjectId()]=getCodeDefinition(object, true);
+						storeCodeDefinition(object, true, drop_objs);
 					else
 					{
 						/* Special case for columns: due to cases like inheritance there is the
@@ -713,10 +826,11 @@ void ModelsDiffHelper::processDiffInfos(void)
 			//Generating the CREATE commands
 			else if(diff_type==ObjectsDiffInfo::CREATE_OBJECT)
 			{
-				if(rel && rel->getRelationshipType()==BaseRelationship::RELATIONSHIP_GEN)
+				if(rel && (rel->getRelationshipType()==BaseRelationship::RELATIONSHIP_GEN ||
+									 rel->getRelationshipType()==BaseRelationship::RELATIONSHIP_PART))
 				{
-					//Creating inheritances
-					inherit_def+=rel->getInheritDefinition(false);
+					//Creating inheritances / attaching partitions
+					inherit_def+=rel->getAlterRelTableDefinition(false);
 				}
 				else if(obj_type==OBJ_PERMISSION)
 					//Setting permissions
@@ -728,13 +842,13 @@ void ModelsDiffHelper::processDiffInfos(void)
 					if(object->getObjectType()==OBJ_CONSTRAINT)
 					{
 						if(dynamic_cast<Constraint *>(object)->getConstraintType()==ConstraintType::foreign_key)
-							create_fks[object->getObjectId()]=getCodeDefinition(object, false);
+							storeCodeDefinition(object, false, create_fks);
 						else
-							create_constrs[object->getObjectId()]=getCodeDefinition(object, false);
+							storeCodeDefinition(object, false, create_constrs);
 					}
 					else
 					{
-						create_objs[object->getObjectId()]=getCodeDefinition(object, false);
+						storeCodeDefinition(object, false, create_objs);
 
 						if(obj_type==OBJ_SCHEMA)
 							sch_names.push_back(object->getName(true));
@@ -755,7 +869,7 @@ void ModelsDiffHelper::processDiffInfos(void)
 
 					//Generating the drop for the object's reference
 					for(auto &obj : drop_vect)
-						drop_objs[obj->getObjectId()]=getCodeDefinition(obj, true);
+						storeCodeDefinition(obj, true, drop_objs);
 
 					//Generating the create for the object's reference
 					for(auto &obj : create_vect)
@@ -768,12 +882,12 @@ void ModelsDiffHelper::processDiffInfos(void)
 							if(obj->getObjectType()==OBJ_CONSTRAINT)
 							{
 								if(dynamic_cast<Constraint *>(obj)->getConstraintType()==ConstraintType::foreign_key)
-									create_fks[obj->getObjectId()]=getCodeDefinition(obj, false);
+									storeCodeDefinition(obj, false, create_fks);
 								else
-									create_constrs[obj->getObjectId()]=getCodeDefinition(obj, false);
+									storeCodeDefinition(obj, false, create_constrs);
 							}
 							else
-								create_objs[obj->getObjectId()]=getCodeDefinition(obj, false);
+								storeCodeDefinition(obj, false, create_objs);
 						}
 					}
 
@@ -790,7 +904,13 @@ void ModelsDiffHelper::processDiffInfos(void)
 
 					if(!alter_def.isEmpty())
 					{
-						alter_objs[object->getObjectId()]=alter_def;
+						/* In low-lock mode the changes on enumerations are done before the transaction block since
+						new values can't be added inside a transaction block (prior to PostgreSQL 12) */
+						if(diff_opts[OPT_LOW_LOCK_MODE] && obj_type==OBJ_TYPE &&
+							 dynamic_cast<Type *>(object)->getConfiguration()==Type::ENUMERATION_TYPE)
+							enum_alters[object->getObjectId()]=alter_def;
+						else
+							alter_objs[object->getObjectId()]=alter_def;
 
 						/* If the object is a column checks if the types of the columns are differents,
 							generating a TRUNCATE TABLE for the parent table */
@@ -833,13 +953,16 @@ void ModelsDiffHelper::processDiffInfos(void)
 
 		if(!drop_objs.empty() || !create_objs.empty() || !alter_objs.empty() ||
 			 !create_fks.empty() || !create_constrs.empty() || !inherit_def.isEmpty() ||
-			 !no_inherit_def.isEmpty() || !set_perms.isEmpty() || !col_drop_def.isEmpty())
+			 !no_inherit_def.isEmpty() || !set_perms.isEmpty() || !col_drop_def.isEmpty() ||
+			 !concurr_drops.empty() || !concurr_creates.empty() || !enum_alters.empty())
 		{
-			unsigned create_objs_count=create_objs.size() + create_constrs.size() + create_fks.size();
+			unsigned create_objs_count=create_objs.size() + create_constrs.size() + create_fks.size() + concurr_creates.size(),
+					drop_objs_count=drop_objs.size() + concurr_drops.size(),
+					alter_objs_count=alter_objs.size() + enum_alters.size();
 			bool has_diffs=false;
 
 			sch_names.removeDuplicates();
-			has_diffs=(create_objs_count!=0 || alter_objs.size()!=0 || drop_objs.size()!=0);
+			has_diffs=(create_objs_count!=0 || alter_objs_count!=0 || drop_objs_count!=0);
 
 			//Attributes used on the diff schema file
 			attribs[ParsersAttributes::HAS_CHANGES]=ParsersAttributes::_TRUE_;
@@ -848,9 +971,9 @@ void ModelsDiffHelper::processDiffInfos(void)
 			attribs[ParsersAttributes::DATABASE]=imported_model->getName();
 			attribs[ParsersAttributes::DATE]=QDateTime::currentDateTime().toString("yyyy-MM-dd hh:mm:ss");
 			attribs[ParsersAttributes::CONNECTION]=imported_model->getName();
-			attribs[ParsersAttributes::CHANGE]=QString::number(alter_objs.size());
+			attribs[ParsersAttributes::CHANGE]=QString::number(alter_objs_count);
 			attribs[ParsersAttributes::CREATE]=QString::number(create_objs_count);
-			attribs[ParsersAttributes::DROP]=QString::number(drop_objs.size());
+			attribs[ParsersAttributes::DROP]=QString::number(drop_objs_count);
 			attribs[ParsersAttributes::TRUNCATE]=QString::number(truncate_tabs.size());
 			attribs[ParsersAttributes::ALTER_CMDS]=QString();
 			attribs[ParsersAttributes::DROP_CMDS]=QString();
@@ -862,6 +985,12 @@ void ModelsDiffHelper::processDiffInfos(void)
 			attribs[ParsersAttributes::SET_PERMS]=set_perms;
 			attribs[ParsersAttributes::FUNCTION]=(has_diffs && source_model->getObjectCount(OBJ_FUNCTION)!=0 ? ParsersAttributes::_TRUE_ : QString());
 			attribs[ParsersAttributes::SEARCH_PATH]=(has_diffs ? sch_names.join(',') : QString());
+			attribs[ParsersAttributes::LOW_LOCK]=(diff_opts[OPT_LOW_LOCK_MODE] ? ParsersAttributes::_TRUE_ : QString());
+			attribs[ParsersAttributes::LOCK_TIMEOUT]=(lock_timeout!=0 ? QString::number(lock_timeout) : QString());
+			attribs[ParsersAttributes::STMT_TIMEOUT]=(stmt_timeout!=0 ? QString::number(stmt_timeout) : QString());
+			attribs[ParsersAttributes::PRE_TRANSACT_CMDS]=QString();
+			attribs[ParsersAttributes::POST_TRANSACT_CMDS]=QString();
+			attribs[ParsersAttributes::VALIDATE_CMDS]=QString();
 
 			ritr=drop_objs.rbegin();
 			ritr_end=drop_objs.rend();
@@ -894,6 +1023,18 @@ void ModelsDiffHelper::processDiffInfos(void)
 			for(auto &itr : alter_objs)
 				attribs[ParsersAttributes::ALTER_CMDS]+=itr.second;
 
+			for(auto &itr : enum_alters)
+				attribs[ParsersAttributes::PRE_TRANSACT_CMDS]+=itr.second;
+
+			for(ritr=concurr_drops.rbegin(); ritr!=concurr_drops.rend(); ritr++)
+				attribs[ParsersAttributes::PRE_TRANSACT_CMDS]+=ritr->second;
+
+			for(auto &itr : concurr_creates)
+				attribs[ParsersAttributes::POST_TRANSACT_CMDS]+=itr.second;
+
+			for(auto &itr : validate_cmds)
+				attribs[ParsersAttributes::VALIDATE_CMDS]+=itr.second;
+
 			//Generating the whole diff buffer
 			schparser.setPgSQLVersion(pgsql_version);
 			diff_def=schparser.getCodeDefinition(GlobalAttributes::SCHEMAS_ROOT_DIR + GlobalAttributes::DIR_SEPARATOR +
@@ -960,6 +1101,105 @@ QString ModelsDiffHelper::getCodeDefinition(BaseObject *object, bool drop_cmd)
 	}
 }
 
+bool ModelsDiffHelper::isLowLockApplicable(BaseObject *object, bool drop_cmd)
+{
+	TableObject *tab_obj=dynamic_cast<TableObject *>(object);
+	Constraint *constr=dynamic_cast<Constraint *>(object);
+	Table *table=nullptr;
+	unsigned tab_diff_type=(drop_cmd ? ObjectsDiffInfo::DROP_OBJECT : ObjectsDiffInfo::CREATE_OBJECT);
+
+	//Concurrent index commands and NOT VALID check constraints are available only from PostgreSQL 9.2
+	if(!diff_opts[OPT_LOW_LOCK_MODE] || !tab_obj ||
+		 pgsql_version.toFloat() < PgSQLVersions::PGSQL_VERSION_92.toFloat())
+		return(false);
+
+	if(constr)
+	{
+		if(drop_cmd ||
+			 (constr->getConstraintType()!=ConstraintType::foreign_key &&
+				constr->getConstraintType()!=ConstraintType::check))
+			return(false);
+	}
+	else if(tab_obj->getObjectType()!=OBJ_INDEX)
+		return(false);
+
+	//PostgreSQL doesn't support concurrent indexes nor NOT VALID foreign keys on partitioned tables
+	table=dynamic_cast<Table *>(tab_obj->getParentTable());
+
+	if(!table || table->isPartitioned())
+		return(false);
+
+	//Tables created or dropped by the diff itself aren't accessed by other sessions so the ordinary commands are used
+	for(auto &diff : diff_infos)
+	{
+		if(diff.getDiffType()==tab_diff_type && diff.getObject()==table)
+			return(false);
+	}
+
+	return(true);
+}
+
+void ModelsDiffHelper::storeCodeDefinition(BaseObject *object, bool drop_cmd, map<unsigned, QString> &buffer)
+{
+	unsigned obj_id=object->getObjectId();
+
+	if(!isLowLockApplicable(object, drop_cmd))
+	{
+		buffer[obj_id]=getCodeDefinition(object, drop_cmd);
+		return;
+	}
+
+	if(object->getObjectType()==OBJ_INDEX)
+	{
+		Index *index=dynamic_cast<Index *>(object);
+		bool concurrent=index->getIndexAttribute(Index::CONCURRENT);
+
+		try
+		{
+			if(drop_cmd)
+			{
+				/* The drop script only generates DROP INDEX CONCURRENTLY when both attributes below are set, so
+				the ordinary drop commands of the index (e.g. in model export) are never affected by this mode.
+				The cascade option is not used since PostgreSQL doesn't accept it on concurrent drops */
+				index->setAttribute(ParsersAttributes::CONCURRENT, ParsersAttributes::_TRUE_);
+				index->setAttribute(ParsersAttributes::LOW_LOCK, ParsersAttributes::_TRUE_);
+				concurr_drops[obj_id]=index->getDropDefinition(false);
+				index->setAttribute(ParsersAttributes::LOW_LOCK, QString());
+			}
+			else
+			{
+				//The index is temporarily configured as concurrent so the CREATE command is generated with CONCURRENTLY
+				index->setIndexAttribute(Index::CONCURRENT, true);
+				concurr_creates[obj_id]=getCodeDefinition(index, false);
+				index->setIndexAttribute(Index::CONCURRENT, concurrent);
+			}
+		}
+		catch(Exception &e)
+		{
+			index->setAttribute(ParsersAttributes::LOW_LOCK, QString());
+			index->setIndexAttribute(Index::CONCURRENT, concurrent);
+			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		}
+	}
+	else
+	{
+		Constraint *constr=dynamic_cast<Constraint *>(object);
+
+		try
+		{
+			constr->setNotValid(true);
+			buffer[obj_id]=getCodeDefinition(constr, false);
+			constr->setNotValid(false);
+			validate_cmds[obj_id]=constr->getValidateDefinition();
+		}
+		catch(Exception &e)
+		{
+			constr->setNotValid(false);
+			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+		}
+	}
+}
+
 void ModelsDiffHelper::destroyTempObjects(void)
 {
 	BaseObject *tmp_obj=nullptr;
@@ -43,7 +43,11 @@ class ModelsDiffHelper: public QObject {
 		bool diff_canceled,
 
 		//!brief Diff options. See OPT_??? constants
-		diff_opts[10];
+		diff_opts[11];
+
+		/*! \brief Timeouts (in miliseconds) used to guard the statements in low-lock mode (see OPT_LOW_LOCK_MODE).
+		A zero value disables the respective guard */
+		unsigned lock_timeout, stmt_timeout;
 
 		//! \brief Stores the count of objects to be dropped, changed or created
 		unsigned diffs_counter[4];
@@ -60,6 +64,13 @@ class ModelsDiffHelper: public QObject {
 		//! \brief Stores all temporary objects created during the diff process
 		vector<BaseObject *> tmp_objects;
 
+		/*! \brief Commands generated in low-lock mode that can't run inside the transaction block: indexes
+		dropped / created concurrently and enumerations that receive new values */
+		map<unsigned, QString> concurr_drops, concurr_creates, enum_alters,
+
+		//! \brief Commands that validate the constraints created as NOT VALID in low-lock mode
+		validate_cmds;
+
 		/*! note The parameter diff_type in any methods below is one of the values in
 		ObjectsDiffInfo::CREATE_OBJECT|ALTER_OBJECT|DROP_OBJECT */
 
@@ -93,11 +104,29 @@ class ModelsDiffHelper: public QObject {
 		will be generated otherwise a CREATE is generated. */
 		QString getCodeDefinition(BaseObject *object, bool drop_cmd);
 
+		/*! \brief Returns if the low-lock commands can be used to drop (drop_cmd = true) or create the object. Only indexes,
+		foreign keys and check constraints of existing and non partitioned tables are handled in low-lock mode */
+		bool isLowLockApplicable(BaseObject *object, bool drop_cmd);
+
+		/*! \brief Stores the DROP or CREATE command of the object in the provided buffer. In low-lock mode indexes are
+		stored in the non-transactional buffers and constraints are created as NOT VALID having the validation command stored apart */
+		void storeCodeDefinition(BaseObject *object, bool drop_cmd, map<unsigned, QString> &buffer);
+
 		//! \brief Destroy the temporary objects and clears the diff info list
 		void destroyTempObjects(void);
 
 		BaseObject *getRelNNTable(const QString &obj_name, DatabaseModel *model);
 
+		/*! \brief Returns if the partitioning strategy or the partition keys of the tables differ. These settings
+		can't be changed through ALTER TABLE so the table must be recreated */
+		bool isPartitioningChanged(Table *table, Table *aux_table);
+
+		/*! \brief Generates the infos to recreate a table which partitioning changed. The partitions of the table in the
+		database are detached before the table is dropped (otherwise they would be dropped with it) and the ones that exist in
+		both models are attached again to the new table. The child objects not declared in the table's code (indexes, triggers,
+		rules, policies and foreign keys) are recreated as well */
+		void recreatePartitionedTable(Table *table, Table *aux_table);
+
 	public:
 		static const unsigned OPT_KEEP_CLUSTER_OBJS=0,
 
@@ -133,7 +162,16 @@ class ModelsDiffHelper: public QObject {
 		/*! \brief Indicates to generate and execute commands to drop missing columns and constraints. For instance, if user
 		try to diff a partial model against the original database and the OPT_DONT_DROP_MISSING_OBJS is set, DROP commands will not be generated,
 		except for columns and constraints. This option is only considered in the process when OPT_DONT_DROP_MISSING_OBJS is enabled. */
-		OPT_DROP_MISSING_COLS_CONSTR=9;
+		OPT_DROP_MISSING_COLS_CONSTR=9,
+
+		/*! \brief Generates commands that avoid long lasting heavy locks on existing tables: indexes are created and dropped
+		concurrently outside the transaction block that holds the other commands, foreign keys and check constraints are
+		created as NOT VALID and validated later, and every statement is guarded by lock_timeout and statement_timeout */
+		OPT_LOW_LOCK_MODE=10;
+
+		//! \brief Default timeouts (in miliseconds) used in low-lock mode
+		static const unsigned DEFAULT_LOCK_TIMEOUT=5000,
+		DEFAULT_STMT_TIMEOUT=60000;
 
 		ModelsDiffHelper(void);
 		~ModelsDiffHelper(void);
@@ -146,6 +184,11 @@ class ModelsDiffHelper: public QObject {
 		//! \brief Toggles a diff option throught the OPT_xxx constants
 		void setDiffOption(unsigned opt_id, bool value);
 
+		/*! \brief Configures the lock_timeout and statement_timeout (in miliseconds) used in low-lock mode. A zero value disables the guard.
+		The statement timeout is applied only to the commands inside the transaction block since concurrent index creation
+		and constraint validation are expected to take a while without blocking other sessions */
+		void setLowLockTimeouts(unsigned lock_timeout, unsigned stmt_timeout);
+
 		//! \brief Configures the PostgreSQL version used in the diff generation
 		void setPgSQLVersion(const QString pgsql_ver);
 
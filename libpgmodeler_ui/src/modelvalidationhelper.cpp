@@ -17,13 +17,14 @@
 */
 
 #include "modelvalidationhelper.h"
+#include "tracer.h"
 
 ModelValidationHelper::ModelValidationHelper(void)
 {
 	warn_count=error_count=progress=0;
 	db_model=nullptr;
 	conn=nullptr;
-	valid_canceled=fix_mode=use_tmp_names=false;
+	valid_canceled=fix_mode=use_tmp_names=idx_analysis=false;
 
 	export_thread=new QThread;
 	export_helper.moveToThread(export_thread);
@@ -52,7 +53,13 @@ void ModelValidationHelper::generateValidationInfo(unsigned val_type, BaseObject
 	{
 		//Configures a validation info
 		ValidationInfo info=ValidationInfo(val_type, object, refs);
-		error_count++;
+
+		//Performance advices are counted as warnings since they don't invalidate the model
+		if(info.isPerformanceAdvice())
+			warn_count++;
+		else
+			error_count++;
+
 		val_infos.push_back(info);
 
 		if(val_type==ValidationInfo::BROKEN_REL_CONFIG)
@@ -63,6 +70,300 @@ void ModelValidationHelper::generateValidationInfo(unsigned val_type, BaseObject
 	}
 }
 
+QString ModelValidationHelper::getElementKey(IndexElement &elem)
+{
+	QString key=(elem.getColumn() ? elem.getColumn()->getName() : QString("(%1)").arg(elem.getExpression().simplified()));
+
+	if(elem.getOperatorClass())
+		key+=QString(" ") + elem.getOperatorClass()->getSignature();
+
+	if(elem.getCollation())
+		key+=QString(" COLLATE ") + elem.getCollation()->getSignature();
+
+	if(elem.isSortingEnabled())
+	{
+		if(!elem.getSortingAttribute(Element::ASC_ORDER))
+			key+=QString(" DESC");
+
+		if(elem.getSortingAttribute(Element::NULLS_FIRST))
+			key+=QString(" NULLS FIRST");
+	}
+
+	return(key);
+}
+
+vector<vector<Column *>> ModelValidationHelper::getIndexedColumns(Table *table)
+{
+	vector<vector<Column *>> idx_cols;
+	vector<Column *> cols;
+	Index *index=nullptr;
+	Constraint *constr=nullptr;
+	unsigned i, i1, count;
+
+	for(i=0; i < table->getIndexCount(); i++)
+	{
+		index=table->getIndex(i);
+
+		if(index->isSQLDisabled() || !index->getPredicate().isEmpty())
+			continue;
+
+		cols.clear();
+
+		for(auto &elem : index->getIndexElements())
+		{
+			if(!elem.getColumn())
+				break;
+
+			cols.push_back(elem.getColumn());
+		}
+
+		if(!cols.empty())
+			idx_cols.push_back(cols);
+	}
+
+	for(i=0; i < table->getConstraintCount(); i++)
+	{
+		constr=table->getConstraint(i);
+
+		if(constr->isSQLDisabled() ||
+			 (constr->getConstraintType()!=ConstraintType::primary_key &&
+				constr->getConstraintType()!=ConstraintType::unique))
+			continue;
+
+		cols.clear();
+		count=constr->getColumnCount(Constraint::SOURCE_COLS);
+
+		for(i1=0; i1 < count; i1++)
+			cols.push_back(constr->getColumn(i1, Constraint::SOURCE_COLS));
+
+		if(!cols.empty())
+			idx_cols.push_back(cols);
+	}
+
+	return(idx_cols);
+}
+
+bool ModelValidationHelper::isColumnsIndexed(const vector<Column *> &cols, const vector<vector<Column *>> &idx_cols)
+{
+	for(auto &lead_cols : idx_cols)
+	{
+		//The index can be used when its first n columns are the n provided columns, in any order
+		if(lead_cols.size() >= cols.size() &&
+			 std::is_permutation(cols.begin(), cols.end(), lead_cols.begin()))
+			return(true);
+	}
+
+	return(false);
+}
+
+bool ModelValidationHelper::isColumnReferenced(const QString &expr, Column *column)
+{
+	QString name=column->getName();
+
+	if(expr.isEmpty())
+		return(false);
+
+	//Quoted identifiers are case sensitive while the unquoted ones are folded to lower case by the server
+	if(expr.contains(QString("\"%1\"").arg(name)))
+		return(true);
+
+	return(name==name.toLower() &&
+				 expr.contains(QRegExp(QString("(^|[^\\w\"])%1($|[^\\w\"(])").arg(QRegExp::escape(name)), Qt::CaseInsensitive)));
+}
+
+void ModelValidationHelper::analyzeIndexCoverage(Table *table)
+{
+	vector<vector<Column *>> idx_cols=getIndexedColumns(table);
+	vector<Column *> cols;
+	vector<BaseObject *> refs;
+	Constraint *constr=nullptr;
+	Index *index=nullptr, *aux_index=nullptr;
+	BaseObject *redundant_to=nullptr;
+	QStringList keys, aux_keys;
+	unsigned i, i1, count;
+
+	//Foreign keys without an index having the fk columns as leading columns (seq scans on cascades/referenced rows locking)
+	for(i=0; i < table->getConstraintCount() && !valid_canceled; i++)
+	{
+		constr=table->getConstraint(i);
+
+		if(constr->isSQLDisabled() || constr->getConstraintType()!=ConstraintType::foreign_key)
+			continue;
+
+		cols.clear();
+		count=constr->getColumnCount(Constraint::SOURCE_COLS);
+
+		for(i1=0; i1 < count; i1++)
+			cols.push_back(constr->getColumn(i1, Constraint::SOURCE_COLS));
+
+		if(!cols.empty() && !isColumnsIndexed(cols, idx_cols))
+			generateValidationInfo(ValidationInfo::MISSING_FK_INDEX, constr, { constr->getReferencedTable() });
+	}
+
+	/* Redundant indexes: non unique indexes which elements are the leading elements of another index
+	using the same indexing method (or of a primary/unique key in case of btree indexes) */
+	for(i=0; i < table->getIndexCount() && !valid_canceled; i++)
+	{
+		index=table->getIndex(i);
+
+		if(index->isSQLDisabled() || index->isProtected() ||
+			 index->getIndexAttribute(Index::UNIQUE) || !index->getPredicate().isEmpty())
+			continue;
+
+		keys.clear();
+		redundant_to=nullptr;
+
+		for(auto &elem : index->getIndexElements())
+			keys.push_back(getElementKey(elem));
+
+		for(i1=0; i1 < table->getIndexCount() && !redundant_to; i1++)
+		{
+			aux_index=table->getIndex(i1);
+
+			if(aux_index==index || aux_index->isSQLDisabled() || !aux_index->getPredicate().isEmpty() ||
+				 aux_index->getIndexingType()!=index->getIndexingType())
+				continue;
+
+			aux_keys.clear();
+
+			for(auto &elem : aux_index->getIndexElements())
+				aux_keys.push_back(getElementKey(elem));
+
+			//Between two identical non unique indexes only the last one is reported
+			if(aux_keys==keys && !aux_index->getIndexAttribute(Index::UNIQUE) && i1 > i)
+				continue;
+
+			if(aux_keys.size() >= keys.size() && aux_keys.mid(0, keys.size())==keys)
+				redundant_to=aux_index;
+		}
+
+		if(!redundant_to && index->getIndexingType()==IndexingType::btree)
+		{
+			for(i1=0; i1 < table->getConstraintCount() && !redundant_to; i1++)
+			{
+				constr=table->getConstraint(i1);
+
+				if(constr->isSQLDisabled() ||
+					 (constr->getConstraintType()!=ConstraintType::primary_key &&
+						constr->getConstraintType()!=ConstraintType::unique))
+					continue;
+
+				aux_keys.clear();
+				count=constr->getColumnCount(Constraint::SOURCE_COLS);
+
+				for(unsigned col_idx=0; col_idx < count; col_idx++)
+					aux_keys.push_back(constr->getColumn(col_idx, Constraint::SOURCE_COLS)->getName());
+
+				if(aux_keys.size() >= keys.size() && aux_keys.mid(0, keys.size())==keys)
+					redundant_to=constr;
+			}
+		}
+
+		if(redundant_to)
+			generateValidationInfo(ValidationInfo::REDUNDANT_INDEX, index, { redundant_to });
+	}
+
+	//Columns used in policies and rules expressions that are not the leading column of an index
+	for(auto &col_obj : *table->getObjectList(OBJ_COLUMN))
+	{
+		Column *col=dynamic_cast<Column *>(col_obj);
+
+		if(valid_canceled || isColumnsIndexed({ col }, idx_cols))
+			continue;
+
+		refs.clear();
+
+		for(i=0; i < table->getPolicyCount(); i++)
+		{
+			Policy *policy=table->getPolicy(i);
+
+			if(!policy->isSQLDisabled() &&
+				 (isColumnReferenced(policy->getUsingExpression(), col) ||
+					isColumnReferenced(policy->getCheckExpression(), col)))
+				refs.push_back(policy);
+		}
+
+		for(i=0; i < table->getRuleCount(); i++)
+		{
+			Rule *rule=table->getRule(i);
+
+			if(!rule->isSQLDisabled() && isColumnReferenced(rule->getConditionalExpression(), col))
+				refs.push_back(rule);
+		}
+
+		if(!refs.empty())
+			generateValidationInfo(ValidationInfo::UNINDEXED_EXPR_COLUMN, col, refs);
+	}
+}
+
+void ModelValidationHelper::createCoveringIndex(Table *table, const vector<Column *> &cols, const QString &name)
+{
+	Index *index=nullptr;
+	Table *aux_tab=nullptr;
+	Constraint *constr=nullptr;
+	BaseObject *schema=table->getSchema();
+	QStringList rel_names;
+	QString idx_name=name.left(BaseObject::OBJECT_NAME_MAX_LENGTH);
+	unsigned suffix=1;
+
+	try
+	{
+		/* Indexes share the namespace of the relations in the schema, so the name must not conflict with the tables,
+		views, sequences and the indexes and index based constraints (primary key, unique, exclude) of any table in it */
+		for(auto &obj_type : { OBJ_TABLE, OBJ_VIEW, OBJ_SEQUENCE })
+		{
+			for(auto &object : *db_model->getObjectList(obj_type))
+			{
+				if(object->getSchema()!=schema)
+					continue;
+
+				rel_names.push_back(object->getName());
+
+				if(obj_type!=OBJ_TABLE)
+					continue;
+
+				aux_tab=dynamic_cast<Table *>(object);
+
+				for(auto &tab_obj : *aux_tab->getObjectList(OBJ_INDEX))
+					rel_names.push_back(tab_obj->getName());
+
+				for(auto &tab_obj : *aux_tab->getObjectList(OBJ_CONSTRAINT))
+				{
+					constr=dynamic_cast<Constraint *>(tab_obj);
+
+					if(constr->getConstraintType()==ConstraintType::primary_key ||
+						 constr->getConstraintType()==ConstraintType::unique ||
+						 constr->getConstraintType()==ConstraintType::exclude)
+						rel_names.push_back(constr->getName());
+				}
+			}
+		}
+
+		//Generates a new name until no relation of the schema uses it
+		while(rel_names.contains(idx_name))
+		{
+			idx_name=QString("%1_%2").arg(name.left(BaseObject::OBJECT_NAME_MAX_LENGTH - 4)).arg(suffix);
+			suffix++;
+		}
+
+		index=new Index;
+		index->setName(idx_name);
+		index->setIndexingType(IndexingType::btree);
+
+		for(auto &col : cols)
+			index->addIndexElement(col, nullptr, nullptr, false, false, false);
+
+		table->addObject(index);
+		emit s_objectIdChanged(table);
+		emit s_objectRenamed(table);
+	}
+	catch(Exception &e)
+	{
+		if(index) delete(index);
+		throw Exception(e.getErrorMessage(), e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
 void  ModelValidationHelper::resolveConflict(ValidationInfo &info)
 {
 	try
@@ -162,6 +463,7 @@ void  ModelValidationHelper::resolveConflict(ValidationInfo &info)
 
 				//Renames the object
 				obj->setName(new_name);
+				emit s_objectRenamed(obj);
 			}
 
 			//Renaming the referrer objects
@@ -186,6 +488,7 @@ void  ModelValidationHelper::resolveConflict(ValidationInfo &info)
 
 					//Renames the referrer object
 					refs.back()->setName(new_name);
+					emit s_objectRenamed(refs.back());
 				}
 
 				refs.pop_back();
@@ -198,6 +501,33 @@ void  ModelValidationHelper::resolveConflict(ValidationInfo &info)
 			extension->setName(QString("postgis"));
 			db_model->addExtension(extension);
 		}
+		//Creating an index having the foreign key columns as leading columns
+		else if(info.getValidationType()==ValidationInfo::MISSING_FK_INDEX)
+		{
+			Constraint *constr=dynamic_cast<Constraint *>(info.getObject());
+			vector<Column *> cols;
+			unsigned count=constr->getColumnCount(Constraint::SOURCE_COLS);
+
+			for(unsigned i=0; i < count; i++)
+				cols.push_back(constr->getColumn(i, Constraint::SOURCE_COLS));
+
+			createCoveringIndex(dynamic_cast<Table *>(constr->getParentTable()), cols, QString("%1_idx").arg(constr->getName()));
+		}
+		/* Redundant indexes have their SQL disabled instead of being destroyed so the fix can be reverted
+		and the index is not removed while it can still be referenced by the operation history */
+		else if(info.getValidationType()==ValidationInfo::REDUNDANT_INDEX)
+		{
+			info.getObject()->setSQLDisabled(true);
+			emit s_objectIdChanged(dynamic_cast<TableObject *>(info.getObject())->getParentTable());
+		}
+		//Creating an index for the column used in policies/rules expressions
+		else if(info.getValidationType()==ValidationInfo::UNINDEXED_EXPR_COLUMN)
+		{
+			Column *col=dynamic_cast<Column *>(info.getObject());
+			Table *table=dynamic_cast<Table *>(col->getParentTable());
+
+			createCoveringIndex(table, { col }, QString("%1_%2_idx").arg(table->getName()).arg(col->getName()));
+		}
 	}
 	catch(Exception &e)
 	{
@@ -220,6 +550,11 @@ unsigned ModelValidationHelper::getErrorCount(void)
 	return(error_count);
 }
 
+bool ModelValidationHelper::hasPendingFixes(void)
+{
+	return(!val_infos.empty());
+}
+
 void ModelValidationHelper::redirectExportProgress(int prog, QString msg, ObjectType obj_type, QString cmd, bool is_code_gen)
 {
 	if(!export_thread->isRunning())
@@ -230,7 +565,7 @@ void ModelValidationHelper::redirectExportProgress(int prog, QString msg, Object
 	emit s_progressUpdated(progress, msg, obj_type, cmd, is_code_gen);
 }
 
-void ModelValidationHelper::setValidationParams(DatabaseModel *model, Connection *conn, const QString &pgsql_ver, bool use_tmp_names)
+void ModelValidationHelper::setValidationParams(DatabaseModel *model, Connection *conn, const QString &pgsql_ver, bool use_tmp_names, bool idx_analysis)
 {
 	if(!model)
 		throw Exception(ERR_ASG_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
@@ -243,6 +578,7 @@ void ModelValidationHelper::setValidationParams(DatabaseModel *model, Connection
 	this->conn=conn;
 	this->pgsql_ver=pgsql_ver;
 	this->use_tmp_names=use_tmp_names;
+	this->idx_analysis=idx_analysis;
 	export_helper.setExportToDBMSParams(this->db_model, conn, pgsql_ver, false, false, false, true, use_tmp_names);
 }
 
@@ -258,6 +594,8 @@ bool ModelValidationHelper::isInFixMode()
 
 void ModelValidationHelper::validateModel(void)
 {
+	TRACE_SCOPE("validation", "validateModel");
+
 	if(!db_model)
 		throw Exception(ERR_OPR_NOT_ALOC_OBJECT,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
@@ -307,13 +645,14 @@ void ModelValidationHelper::validateModel(void)
 				{
 					emit s_objectProcessed(signal_msg.arg(object->getName()).arg(object->getTypeName()), object->getObjectType());
 
-					/* Special validation case: For generalization and copy relationships validates the ids of participant tables.
+					/* Special validation case: For generalization, partitioning and copy relationships validates the ids of participant tables.
 		   * Reference table cannot own an id greater thant receiver table */
 					if(obj_type==OBJ_RELATIONSHIP)
 					{
 						rel=dynamic_cast<Relationship *>(object);
 						if(rel->getRelationshipType()==Relationship::RELATIONSHIP_GEN ||
-								rel->getRelationshipType()==Relationship::RELATIONSHIP_DEP)
+								rel->getRelationshipType()==Relationship::RELATIONSHIP_DEP ||
+								rel->getRelationshipType()==Relationship::RELATIONSHIP_PART)
 						{
 							recv_tab=rel->getReceiverTable();
 							ref_tab=rel->getReferenceTable();
@@ -561,6 +900,31 @@ void ModelValidationHelper::validateModel(void)
 			}
 		}
 
+		/* Step 5 (optional): Analyzing the index coverage of the tables. This step generates performance advices
+		(missing indexes on foreign keys and columns used in policies/rules, redundant indexes) and is executed only
+		when the model has no other pending validation infos since the fixes of the previous steps may change the tables.
+		The revalidations done while fixing conflicts skip it so no advice is applied without being listed to the user first */
+		if(idx_analysis && !fix_mode && val_infos.empty())
+		{
+			TRACE_SCOPE("validation", "analyzeIndexCoverage");
+
+			obj_list=db_model->getObjectList(OBJ_TABLE);
+			itr=obj_list->begin();
+			i=0;
+
+			while(itr!=obj_list->end() && !valid_canceled)
+			{
+				table=dynamic_cast<Table *>(*itr);
+				emit s_objectProcessed(signal_msg.arg(table->getName()).arg(table->getTypeName()), table->getObjectType());
+
+				if(!table->isSQLDisabled())
+					analyzeIndexCoverage(table);
+
+				progress=40 + ((i/static_cast<float>(obj_list->size()))*20);
+				itr++; i++;
+			}
+		}
+
 		if(!valid_canceled && !fix_mode)
 		{
 			//Step 3 (optional): Validating the SQL code onto a local DBMS.
@@ -598,10 +962,14 @@ void ModelValidationHelper::applyFixes(void)
 {
 	if(fix_mode)
 	{
-		bool validate_rels=false, found_broken_rels=false;
+		bool validate_rels=false, found_broken_rels=false, perf_advices=false;
 
 		while(!val_infos.empty() && !valid_canceled && !found_broken_rels)
 		{
+			/* The index coverage analysis runs only when no other validation info is pending, so performance advices are
+			never mixed with conflicts. Only the advices listed to the user are applied since the model isn't analyzed again */
+			perf_advices=val_infos.front().isPerformanceAdvice();
+
 			for(unsigned i=0; i < val_infos.size() && !valid_canceled; i++)
 			{
 				if(!validate_rels)
@@ -621,7 +989,9 @@ void ModelValidationHelper::applyFixes(void)
 
 			emit s_fixApplied();
 
-			if(!valid_canceled && !found_broken_rels)
+			if(perf_advices)
+				val_infos.clear();
+			else if(!valid_canceled && !found_broken_rels)
 				validateModel();
 		}
 
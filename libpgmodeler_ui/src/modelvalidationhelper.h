@@ -61,7 +61,10 @@ class ModelValidationHelper: public QObject {
 		//! \brief Indicates if the validation is on fix mode.
 		fix_mode,
 
-		use_tmp_names;
+		use_tmp_names,
+
+		//! \brief Indicates if the index coverage analysis (performance advices) must be executed
+		idx_analysis;
 
 		/*! \brief Stores the validation infos generated during validation steps.
 		This vector is read when applying fixes */
@@ -72,13 +75,34 @@ class ModelValidationHelper: public QObject {
 
 		void generateValidationInfo(unsigned val_type, BaseObject *object, vector<BaseObject *> refs);
 
+		/*! \brief Returns the key used to compare index elements (column or expression followed by operator class,
+		collation and sorting) when searching for redundant indexes */
+		static QString getElementKey(IndexElement &elem);
+
+		/*! \brief Returns the leading columns of each index, primary key and unique key of the table. The columns of an index are
+		listed until the first expression element. Partial indexes and objects with SQL disabled are ignored since they can't be used by all queries */
+		static vector<vector<Column *>> getIndexedColumns(Table *table);
+
+		//! \brief Returns if the provided columns (in any order) are the leading columns of one of the lists returned by getIndexedColumns()
+		static bool isColumnsIndexed(const vector<Column *> &cols, const vector<vector<Column *>> &idx_cols);
+
+		//! \brief Returns if the column name is used as an identifier in the expression
+		static bool isColumnReferenced(const QString &expr, Column *column);
+
+		/*! \brief Analyzes the indexes of the table generating advices for foreign keys without a supporting index, redundant
+		indexes and columns used in policies/rules expressions which are not indexed */
+		void analyzeIndexCoverage(Table *table);
+
+		//! \brief Creates a btree index on the specified columns of the table (used to fix index coverage advices)
+		void createCoveringIndex(Table *table, const vector<Column *> &cols, const QString &name);
+
 	public:
 		ModelValidationHelper(void);
 		~ModelValidationHelper(void);
 
 		/*! \brief Validates the specified model. If a connection is specifies executes the
 		SQL validation directly on DBMS */
-		void setValidationParams(DatabaseModel *model, Connection *conn=nullptr, const QString &pgsql_ver=QString(), bool use_tmp_names=false);
+		void setValidationParams(DatabaseModel *model, Connection *conn=nullptr, const QString &pgsql_ver=QString(), bool use_tmp_names=false, bool idx_analysis=false);
 
 		//! \brief Switch the validator to fix mode
 		void switchToFixMode(bool value);
@@ -92,6 +116,10 @@ class ModelValidationHelper: public QObject {
 		//! \brief Returns the warning count
 		unsigned getWarningCount(void);
 
+		/*! \brief Returns if there are validation infos that can be fixed. Used to enable the fixing of performance advices
+		since they don't invalidate the model */
+		bool hasPendingFixes(void);
+
 		//! \brief Try to resolve the conflict specified by validation info
 		void resolveConflict(ValidationInfo &info);
 
@@ -133,6 +161,9 @@ class ModelValidationHelper: public QObject {
 		//! \brief This signal is emitted when the validator changes some objects id by swapping or update operations
 		void s_objectIdChanged(BaseObject *object);
 
+		//! \brief This signal is emitted when the validator renames some object or adds a child object to a table
+		void s_objectRenamed(BaseObject *object);
+
 		/*! \brief This signal is emitted when the validator need the validation of relationship.
 		This process must be performed outside the current thread, this explains the usage of this signal */
 		void s_relsValidationRequested(void);
@@ -45,6 +45,9 @@ ModelValidationWidget::ModelValidationWidget(QWidget *parent): QWidget(parent)
 		use_unique_names_ht=new HintTextWidget(use_unique_names_hint, this);
 		use_unique_names_ht->setText(use_tmp_names_chk->statusTip());
 
+		index_analysis_ht=new HintTextWidget(index_analysis_hint, this);
+		index_analysis_ht->setText(index_analysis_chk->statusTip());
+
 		connect(hide_tb, SIGNAL(clicked(void)), this, SLOT(hide(void)));
 		connect(clear_btn, SIGNAL(clicked(void)), this, SLOT(clearOutput(void)));
 		connect(options_btn, SIGNAL(toggled(bool)), options_frm, SLOT(setVisible(bool)));
@@ -107,12 +110,17 @@ void ModelValidationWidget::createThread(void)
 			BaseGraphicObject *graph_obj=dynamic_cast<BaseGraphicObject *>(obj);
 			if(graph_obj) graph_objects.push_back(graph_obj);
 		});
+
+		connect(validation_helper, &ModelValidationHelper::s_objectRenamed,
+				[&](BaseObject *obj) { renamed_objs.push_back(obj); });
 	}
 }
 
 void ModelValidationWidget::destroyThread(bool force)
 {
-	if(validation_thread && (force || validation_helper->getErrorCount()==0))
+	//The helper is kept while there are fixes to be applied (errors or performance advices)
+	if(validation_thread &&
+		 (force || (validation_helper->getErrorCount()==0 && !validation_helper->hasPendingFixes())))
 	{
 		validation_thread->wait();
 		delete(validation_thread);
@@ -136,7 +144,7 @@ void ModelValidationWidget::reenableValidation(void)
 		model_wgt->setEnabled(true);
 		validate_btn->setEnabled(true);
 		cancel_btn->setEnabled(false);
-		fix_btn->setEnabled(model_wgt->getDatabaseModel()->isInvalidated());
+		fix_btn->setEnabled(model_wgt->getDatabaseModel()->isInvalidated() || validation_helper->hasPendingFixes());
 		clear_btn->setEnabled(true);
 		options_btn->setEnabled(true);
 		options_frm->setEnabled(true);
@@ -276,6 +284,33 @@ void ModelValidationWidget::updateValidation(ValidationInfo val_info)
 									 .arg(BaseObject::getTypeName(OBJ_TABLE))
 									 .arg(~col->getType()));
 	}
+	else if(val_info.getValidationType()==ValidationInfo::MISSING_FK_INDEX)
+	{
+		tab_obj=dynamic_cast<TableObject *>(val_info.getObject());
+		label->setText(trUtf8("The foreign key <strong>%1</strong> on <strong>%2</strong> <em>(%3)</em> has no index with its columns as leading columns. Deletions and updates on the referenced table will cause sequential scans on this table.")
+									 .arg(tab_obj->getName())
+									 .arg(tab_obj->getParentTable()->getSignature(true))
+									 .arg(tab_obj->getParentTable()->getTypeName()));
+	}
+	else if(val_info.getValidationType()==ValidationInfo::REDUNDANT_INDEX)
+	{
+		tab_obj=dynamic_cast<TableObject *>(val_info.getObject());
+		label->setText(trUtf8("The index <strong>%1</strong> on <strong>%2</strong> <em>(%3)</em> is redundant since its elements are the leading elements of <strong>%4</strong> <em>(%5)</em>.")
+									 .arg(tab_obj->getName())
+									 .arg(tab_obj->getParentTable()->getSignature(true))
+									 .arg(tab_obj->getParentTable()->getTypeName())
+									 .arg(val_info.getReferences().front()->getName())
+									 .arg(val_info.getReferences().front()->getTypeName()));
+	}
+	else if(val_info.getValidationType()==ValidationInfo::UNINDEXED_EXPR_COLUMN)
+	{
+		tab_obj=dynamic_cast<TableObject *>(val_info.getObject());
+		label->setText(trUtf8("The column <strong>%1</strong> on <strong>%2</strong> <em>(%3)</em> is used in the expressions of <strong>%4</strong> policy(ies)/rule(s) but is not the leading column of any index.")
+									 .arg(tab_obj->getName())
+									 .arg(tab_obj->getParentTable()->getSignature(true))
+									 .arg(tab_obj->getParentTable()->getTypeName())
+									 .arg(val_info.getReferences().size()));
+	}
 	else
 		label->setText(val_info.getErrors().at(0));
 
@@ -305,7 +340,20 @@ void ModelValidationWidget::updateValidation(ValidationInfo val_info)
 	}
 	else
 	{
-		item->setIcon(0, QPixmap(PgModelerUiNS::getIconPath("msgbox_erro")));
+		//Performance advices are displayed as warnings since they don't invalidate the model
+		item->setIcon(0, QPixmap(PgModelerUiNS::getIconPath(val_info.isPerformanceAdvice() ? "msgbox_alerta" : "msgbox_erro")));
+
+		if(val_info.getValidationType()==ValidationInfo::MISSING_FK_INDEX ||
+			 val_info.getValidationType()==ValidationInfo::UNINDEXED_EXPR_COLUMN)
+		{
+			PgModelerUiNS::createOutputTreeItem(output_trw, trUtf8("<strong>HINT:</strong> Create an index for the column(s) in the model or let it be created by applying the needed fixes."),
+																					QPixmap(PgModelerUiNS::getIconPath("msgbox_info")), item);
+		}
+		else if(val_info.getValidationType()==ValidationInfo::REDUNDANT_INDEX)
+		{
+			PgModelerUiNS::createOutputTreeItem(output_trw, trUtf8("<strong>HINT:</strong> Remove the index from the model or let its SQL code be disabled by applying the needed fixes."),
+																					QPixmap(PgModelerUiNS::getIconPath("msgbox_info")), item);
+		}
 
 		if(val_info.getValidationType()==ValidationInfo::BROKEN_REL_CONFIG)
 		{
@@ -317,7 +365,7 @@ void ModelValidationWidget::updateValidation(ValidationInfo val_info)
 			PgModelerUiNS::createOutputTreeItem(output_trw, trUtf8("<strong>HINT:</strong> Create the extension in the model or let it be created by applying the needed fixes."),
 																					QPixmap(PgModelerUiNS::getIconPath("msgbox_alerta")), item);
 		}
-		else
+		else if(val_info.getValidationType()!=ValidationInfo::REDUNDANT_INDEX)
 		{
 			//Listing the referrer object on output pane
 			refs=val_info.getReferences();
@@ -495,7 +543,7 @@ void ModelValidationWidget::configureValidation(void)
 			ver=(version_cmb->currentIndex() > 0 ? version_cmb->currentText() : QString());
 		}
 
-		validation_helper->setValidationParams(model_wgt->getDatabaseModel(), conn, ver, use_tmp_names_chk->isChecked());
+		validation_helper->setValidationParams(model_wgt->getDatabaseModel(), conn, ver, use_tmp_names_chk->isChecked(), index_analysis_chk->isChecked());
 	}
 }
 
@@ -533,6 +581,17 @@ void ModelValidationWidget::validateRelationships(void)
 
 void ModelValidationWidget::updateGraphicalObjects(void)
 {
+	if(model_wgt)
+	{
+		while(!renamed_objs.empty())
+		{
+			model_wgt->getDatabaseModel()->notifyObjectRenamed(renamed_objs.back());
+			renamed_objs.pop_back();
+		}
+	}
+	else
+		renamed_objs.clear();
+
 	if(!graph_objects.empty())
 	{
 		vector<BaseGraphicObject *>::iterator end;
@@ -42,7 +42,7 @@ class ModelValidationWidget: public QWidget, public Ui::ModelValidationWidget {
 	private:
 		Q_OBJECT
 
-		HintTextWidget *sql_validation_ht, *use_unique_names_ht;
+		HintTextWidget *sql_validation_ht, *use_unique_names_ht, *index_analysis_ht;
 
 		//! \brief Custom delegate used to paint html texts in output tree
 		HtmlItemDelegate *htmlitem_del;
@@ -63,6 +63,10 @@ class ModelValidationWidget: public QWidget, public Ui::ModelValidationWidget {
 		the validation they can be updated to reflect the new id in the tooltips and forms */
 		vector<BaseGraphicObject *> graph_objects;
 
+		/*! \brief Stores the objects renamed by the fixes so that in the end of the validation
+		the model can notify them in the main thread (see DatabaseModel::notifyObjectRenamed()) */
+		vector<BaseObject *> renamed_objs;
+
 		void emitValidationInProgress(void);
 
 		//! \brief Creates a new validation thread
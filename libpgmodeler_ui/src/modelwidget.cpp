@@ -80,9 +80,9 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 	QGridLayout *grid=nullptr;
 	QAction *action=nullptr;
 	QString str_ico, str_txt;
-	QStringList rel_types_cod={QString("11"), QString("1n"), QString("nn"), QString("dep"), QString("gen") },
+	QStringList rel_types_cod={QString("11"), QString("1n"), QString("nn"), QString("dep"), QString("gen"), QString("part") },
 			rel_labels={ trUtf8("One to One (1-1)"), trUtf8("One to Many (1-n)"),
-						 trUtf8("Many to Many (n-n)"), trUtf8("Copy"), trUtf8("Inheritance") };
+						 trUtf8("Many to Many (n-n)"), trUtf8("Copy"), trUtf8("Inheritance"), trUtf8("Partitioning") };
 	ObjectType types[]={ OBJ_TABLE, OBJ_VIEW, OBJ_TEXTBOX, OBJ_RELATIONSHIP,
 						 OBJ_CAST, OBJ_CONVERSION, OBJ_DOMAIN,
 						 OBJ_FUNCTION, OBJ_AGGREGATE, OBJ_LANGUAGE,
@@ -94,7 +94,7 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 	unsigned i, obj_cnt=sizeof(types)/sizeof(ObjectType),
 			rel_types_id[]={ BaseRelationship::RELATIONSHIP_11, BaseRelationship::RELATIONSHIP_1N,
 							 BaseRelationship::RELATIONSHIP_NN, BaseRelationship::RELATIONSHIP_DEP,
-							 BaseRelationship::RELATIONSHIP_GEN };
+							 BaseRelationship::RELATIONSHIP_GEN, BaseRelationship::RELATIONSHIP_PART };
 
 	current_zoom=1;
 	modified=panning_mode=false;
@@ -157,6 +157,9 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 	//Force the scene to be drawn from the left to right and from top to bottom
 	viewport->setAlignment(Qt::AlignLeft | Qt::AlignTop);
 	viewport->setViewportUpdateMode(QGraphicsView::MinimalViewportUpdate);
+
+	//The background (grid and page delimiters) is cached since it changes only when the grid options are modified
+	viewport->setCacheMode(QGraphicsView::CacheBackground);
 	viewport->centerOn(0,0);
 	viewport->setMouseTracking(true);
 
@@ -739,6 +742,9 @@ void ModelWidget::applyZoom(double zoom)
 	viewport->scale(zoom, zoom);
 	this->current_zoom=zoom;
 
+	//Using the simplified tables representation (level of detail) when the zoom makes their contents illegible
+	scene->setSimplifiedView(zoom < ObjectsScene::getSimplifiedViewZoom());
+
 	zoom_info_lbl->setText(trUtf8("Zoom: %1%").arg(QString::number(this->current_zoom * 100, 'g' , 3)));
 	zoom_info_lbl->setVisible(true);
 	zoom_info_timer.start();
@@ -1381,7 +1387,7 @@ void ModelWidget::adjustSceneSize(void)
 	ObjectsScene::getGridOptions(show_grid, align_objs, show_delims);
 
 	scene_rect=scene->sceneRect();
-	objs_rect=scene->itemsBoundingRect();
+	objs_rect=scene->itemsBoundingRect(true);
 
 	if(scene_rect.width() < objs_rect.left() + objs_rect.width())
 		scene_rect.setWidth(objs_rect.left() + objs_rect.width());
@@ -1405,7 +1411,7 @@ void ModelWidget::printModel(QPrinter *printer, bool print_grid, bool print_page
 {
 	if(printer)
 	{
-		bool show_grid, align_objs, show_delims;
+		bool show_grid, align_objs, show_delims, simplified_view=scene->isSimplifiedView();
 		unsigned page_cnt, page, h_page_cnt, v_page_cnt, h_pg_id, v_pg_id;
 		vector<QRectF> pages;
 		QRectF margins, page_rect;
@@ -1424,6 +1430,10 @@ void ModelWidget::printModel(QPrinter *printer, bool print_grid, bool print_page
 		//Reconfigure the grid options based upon the passed settings
 		ObjectsScene::setGridOptions(print_grid, align_objs, false);
 
+		//Printing the objects in full detail and as vector graphics
+		scene->setSimplifiedView(false);
+		scene->setItemsCacheEnabled(false);
+
 		scene->update();
 		scene->clearSelection();
 
@@ -1540,6 +1550,8 @@ void ModelWidget::printModel(QPrinter *printer, bool print_grid, bool print_page
 
 		//Restore the grid option backup
 		ObjectsScene::setGridOptions(show_grid, align_objs, show_delims);
+		scene->setItemsCacheEnabled(true);
+		scene->setSimplifiedView(simplified_view);
 		scene->update();
 	}
 }
@@ -1901,6 +1913,7 @@ void ModelWidget::moveToSchema(void)
 				op_id=op_list->registerObject(obj, Operation::OBJECT_MODIFIED, -1);
 
 				obj->setSchema(schema);
+				db_model->notifyObjectRenamed(obj);
 				obj_graph=dynamic_cast<BaseGraphicObject *>(obj);
 
 				//If the object is a graphical one, move it to a position near to the new schema box
@@ -2526,6 +2539,9 @@ void ModelWidget::pasteObjects(void)
 
 	op_list->startOperationChain();
 
+	//Pasting the objects in a batch so the model is revalidated and redrawn only once
+	db_model->startBatch();
+
 	while(itr!=itr_end)
 	{
 		object = *itr;
@@ -2573,6 +2589,7 @@ void ModelWidget::pasteObjects(void)
 						db_model->updateTableFKRelationships(dynamic_cast<Table *>(tab_obj->getParentTable()));
 
 					op_list->registerObject(tab_obj, Operation::OBJECT_CREATED, -1, tab_obj->getParentTable());
+					db_model->notifyObjectRenamed(tab_obj);
 				}
 				else
 					op_list->registerObject(object, Operation::OBJECT_CREATED);
@@ -2587,6 +2604,7 @@ void ModelWidget::pasteObjects(void)
 
 	//Validates the relationships to reflect any modification on the tables structures and not propagated columns
 	db_model->validateRelationships();
+	db_model->finishBatch();
 
 	this->adjustSceneSize();
 	task_prog_wgt.close();
@@ -2655,6 +2673,7 @@ void ModelWidget::duplicateObject(void)
 			op_id=op_list->registerObject(dup_object, Operation::OBJECT_CREATED, -1, table);
 			table->addObject(dup_object);
 			table->setModified(true);
+			db_model->notifyObjectRenamed(table);
 
 			if(obj_type == OBJ_COLUMN)
 				db_model->validateRelationships();
@@ -2830,6 +2849,10 @@ void ModelWidget::removeObjects(bool cascade)
 				op_count=op_list->getCurrentSize();
 				op_list->startOperationChain();
 
+				/* Removing the objects in a batch so the relationships are revalidated
+				and the graphical objects are redrawn only once at the end of the process */
+				db_model->startBatch();
+
 				do
 				{
 					object=std::get<0>(ritr->second);
@@ -2888,6 +2911,7 @@ void ModelWidget::removeObjects(bool cascade)
 								//Register the removed object on the operation list
 								table->removeObject(obj_idx, obj_type);
 								op_list->registerObject(tab_obj, Operation::OBJECT_REMOVED, obj_idx, table);
+								db_model->notifyObjectRenamed(table);
 
 								db_model->removePermissions(tab_obj);
 
@@ -2957,6 +2981,18 @@ void ModelWidget::removeObjects(bool cascade)
 				}
 				while(ritr!=ritr_end);
 
+				try
+				{
+					db_model->finishBatch();
+				}
+				catch(Exception &e)
+				{
+					if(cascade && e.getErrorType()==ERR_INVALIDATED_OBJECTS)
+						errors.push_back(e);
+					else
+						throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+				}
+
 				op_list->finishOperationChain();
 				scene->clearSelection();
 				this->configurePopupMenu();
@@ -2975,6 +3011,18 @@ void ModelWidget::removeObjects(bool cascade)
 				//if(e.getErrorType()==ERR_INVALIDATED_OBJECTS)
 				//  op_list->removeOperations();
 
+				if(db_model->isBatchRunning())
+				{
+					try
+					{
+						db_model->finishBatch();
+					}
+					catch(Exception &)
+					{
+						//The error raised by the postponed validation is ignored in favor of the original one
+					}
+				}
+
 				if(op_list->isOperationChainStarted())
 					op_list->finishOperationChain();
 
@@ -3578,7 +3626,7 @@ void ModelWidget::configurePopupMenu(const vector<BaseObject *> &objects)
 			else
 				popup_menu.addAction(action_protect);
 
-			if(scene->items().count() > 1)
+			if(scene->getObjectViewsCount() > 0)
 				popup_menu.addAction(action_select_all);
 		}
 		else if(objects.size()==1)
@@ -4721,6 +4769,179 @@ void ModelWidget::rearrangeTablesInSchema(Schema *schema, QPointF start)
 	}
 }
 
+void ModelWidget::rearrangeTables(unsigned algorithm)
+{
+	vector<BaseObject *> tables, rels;
+	vector<Schema *> schemas;
+	vector<QRectF> rects;
+	vector<pair<unsigned, unsigned>> edges;
+	map<BaseObject *, unsigned> node_ids;
+	vector<QPointF> positions;
+	BaseTable *base_tab=nullptr, *src_tab=nullptr, *dst_tab=nullptr;
+	BaseTableView *tab_view=nullptr;
+	BaseRelationship *rel=nullptr;
+	Schema *schema=nullptr;
+	LayoutEngine layout_eng;
+	QThread layout_thread;
+	QEventLoop event_loop;
+	TaskProgressWidget task_prog_wgt(this);
+	bool undoable=false, discard_ops=false, is_protected=false;
+	unsigned op_count=0;
+
+	tables.assign(db_model->getObjectList(OBJ_TABLE)->begin(), db_model->getObjectList(OBJ_TABLE)->end());
+	tables.insert(tables.end(), db_model->getObjectList(OBJ_VIEW)->begin(), db_model->getObjectList(OBJ_VIEW)->end());
+
+	if(tables.empty())
+		return;
+
+	for(auto &tab : tables)
+	{
+		tab_view=dynamic_cast<BaseTableView *>(dynamic_cast<BaseTable *>(tab)->getReceiverObject());
+		node_ids[tab]=rects.size();
+		rects.push_back(QRectF(tab_view->pos(), tab_view->boundingRect().size()));
+	}
+
+	rels.assign(db_model->getObjectList(OBJ_RELATIONSHIP)->begin(), db_model->getObjectList(OBJ_RELATIONSHIP)->end());
+	rels.insert(rels.end(), db_model->getObjectList(BASE_RELATIONSHIP)->begin(), db_model->getObjectList(BASE_RELATIONSHIP)->end());
+
+	for(auto &obj : rels)
+	{
+		rel=dynamic_cast<BaseRelationship *>(obj);
+		src_tab=rel->getTable(BaseRelationship::SRC_TABLE);
+		dst_tab=rel->getTable(BaseRelationship::DST_TABLE);
+
+		if(node_ids.count(src_tab) && node_ids.count(dst_tab))
+			edges.push_back({ node_ids[src_tab], node_ids[dst_tab] });
+	}
+
+	//Only the schemas which rectangles are visible are changed (and registered) during the rearrangement
+	for(auto &tab : tables)
+	{
+		schema=dynamic_cast<Schema *>(dynamic_cast<BaseTable *>(tab)->getSchema());
+
+		if(schema->isRectVisible() && std::find(schemas.begin(), schemas.end(), schema)==schemas.end())
+			schemas.push_back(schema);
+	}
+
+	/* The new positions, the hidden schema rectangles and the reset relationship lines are registered as a single operation chain
+	if it fits in the operation list. When there's no room for the chain the registered operations must be discarded, so the user
+	is asked before any change is made to the model */
+	op_count=tables.size() + rels.size() + schemas.size();
+	undoable=op_count < op_list->getMaximumSize();
+	discard_ops=!undoable || (op_list->getCurrentSize() + op_count) >= op_list->getMaximumSize();
+
+	if(discard_ops && op_list->getCurrentSize() > 0)
+	{
+		Messagebox msgbox;
+
+		if(!undoable)
+			msgbox.show(trUtf8("The rearrangement changes <strong>%1</strong> objects but the operation history holds at most <strong>%2</strong> operations, so it can't be undone and the operations currently registered will be discarded. Do you want to proceed?")
+									.arg(op_count).arg(op_list->getMaximumSize()),
+									Messagebox::ALERT_ICON, Messagebox::YES_NO_BUTTONS);
+		else
+			msgbox.show(trUtf8("There's no room in the operation history to register the rearrangement, so the operations currently registered will be discarded. Do you want to proceed?"),
+									Messagebox::ALERT_ICON, Messagebox::YES_NO_BUTTONS);
+
+		if(msgbox.result()==QDialog::Rejected)
+			return;
+	}
+
+	try
+	{
+		layout_eng.setGraph(rects, edges);
+		layout_eng.setAlgorithm(algorithm);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	//The layout is computed in a separated thread so the progress dialog can be updated and the operation canceled
+	layout_eng.moveToThread(&layout_thread);
+	connect(&layout_thread, SIGNAL(started()), &layout_eng, SLOT(computeLayout()));
+	connect(&layout_eng, SIGNAL(s_layoutFinished()), &layout_thread, SLOT(quit()));
+	connect(&layout_eng, SIGNAL(s_layoutCanceled()), &layout_thread, SLOT(quit()));
+	connect(&layout_thread, SIGNAL(finished()), &event_loop, SLOT(quit()));
+	connect(&layout_eng, &LayoutEngine::s_progressUpdated, &task_prog_wgt, [&](int progress, QString msg){
+		task_prog_wgt.updateProgress(progress, msg, OBJ_TABLE);
+	});
+	connect(&task_prog_wgt, &TaskProgressWidget::rejected, [&](){ layout_eng.cancelLayout(); });
+
+	task_prog_wgt.setWindowTitle(trUtf8("Rearranging objects"));
+	task_prog_wgt.setModal(true);
+	task_prog_wgt.show();
+	layout_thread.start();
+	event_loop.exec();
+	layout_thread.wait();
+	task_prog_wgt.close();
+
+	if(layout_eng.isLayoutCanceled())
+		return;
+
+	positions=layout_eng.getPositions();
+	scene->clearSelection();
+
+	if(discard_ops)
+		op_list->removeOperations();
+
+	try
+	{
+		if(undoable)
+			op_list->startOperationChain();
+
+		for(auto &sch : schemas)
+		{
+			if(undoable)
+				op_list->registerObject(sch, Operation::OBJECT_MODIFIED);
+
+			sch->setRectVisible(false);
+		}
+
+		for(unsigned i=0; i < tables.size(); i++)
+		{
+			base_tab=dynamic_cast<BaseTable *>(tables[i]);
+			tab_view=dynamic_cast<BaseTableView *>(base_tab->getReceiverObject());
+
+			if(undoable)
+				op_list->registerObject(base_tab, Operation::OBJECT_MOVED);
+
+			//Temporarily unprotecting the table so it can be moved
+			is_protected=base_tab->isProtected();
+			base_tab->setProtected(false);
+			tab_view->setPos(positions[i]);
+			base_tab->setProtected(is_protected);
+		}
+
+		for(auto &obj : rels)
+		{
+			rel=dynamic_cast<BaseRelationship *>(obj);
+
+			if(undoable)
+				op_list->registerObject(rel, Operation::OBJECT_MODIFIED);
+
+			rel->setPoints({});
+			rel->resetLabelsDistance();
+		}
+
+		if(undoable)
+			op_list->finishOperationChain();
+	}
+	catch(Exception &e)
+	{
+		if(op_list->isOperationChainStarted())
+			op_list->finishOperationChain();
+
+		throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	}
+
+	db_model->setObjectsModified({ OBJ_TABLE, OBJ_VIEW, OBJ_SCHEMA, OBJ_RELATIONSHIP, BASE_RELATIONSHIP });
+	adjustSceneSize();
+	viewport->updateScene({ scene->sceneRect() });
+
+	this->modified=true;
+	emit s_objectsMoved();
+}
+
 void ModelWidget::rearrangeTablesInSchemas(void)
 {
 	BaseRelationship *base_rel = nullptr;
@@ -4843,7 +5064,18 @@ void ModelWidget::updateMagnifierArea(void)
 	p.setRenderHints(viewport->renderHints());
 
 	scene->blockSignals(true);
-	scene->render(&p, QRectF(QPointF(0,0), size), QRectF(scene_pos - QPointF(cx, cy), size));
+
+	//The magnified area is always drawn in full detail even if the tables are simplified in the current zoom
+	if(scene->isSimplifiedView())
+	{
+		QRectF area = QRectF(scene_pos - QPointF(cx, cy), size);
+
+		scene->setSimplifiedView(false, area);
+		scene->render(&p, QRectF(QPointF(0,0), size), area);
+		scene->setSimplifiedView(true, area);
+	}
+	else
+		scene->render(&p, QRectF(QPointF(0,0), size), QRectF(scene_pos - QPointF(cx, cy), size));
 
 	p.setPen(QColor(80,0,0));
 	p.drawLine(QPointF(cx, cy - 10), QPointF(cx, cy + 10));
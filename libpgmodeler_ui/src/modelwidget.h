@@ -31,6 +31,7 @@
 #include "messagebox.h"
 #include "objectsscene.h"
 #include "taskprogresswidget.h"
+#include "layoutengine.h"
 #include "newobjectoverlaywidget.h"
 
 class ModelWidget: public QWidget {
@@ -353,6 +354,11 @@ class ModelWidget: public QWidget {
 		//! \brief Arrange all tables it their schemas randomly (scattered)
 		void rearrangeTablesInSchemas(void);
 
+		/*! \brief Rearranges all tables/views using the layout engine (see LayoutEngine::Algorithm). The layout is computed in a
+		separated thread while a progress dialog is displayed (the computation is canceled by closing the dialog). The new positions are
+		registered as a single operation chain so the whole rearrangement can be undone */
+		void rearrangeTables(unsigned algorithm);
+
 		void emitSceneInteracted(void);
 
 	private slots:
@@ -35,6 +35,16 @@ ObjectFinderWidget::ObjectFinderWidget(QWidget *parent) : QWidget(parent)
 	fade_menu.addAction(trUtf8("Not listed"), this, SLOT(fadeObjects()));
 	fade_btn->setMenu(&fade_menu);
 
+	search_attrs_cmb->addItem(trUtf8("Name"), ParsersAttributes::NAME);
+	search_attrs_cmb->addItem(trUtf8("Signature"), ParsersAttributes::SIGNATURE);
+	search_attrs_cmb->addItem(trUtf8("Comment"), ParsersAttributes::COMMENT);
+
+	candidate_idx=0;
+	search_exact_match=false;
+	search_timer.setInterval(0);
+	typing_timer.setInterval(TYPING_INTERVAL);
+	typing_timer.setSingleShot(true);
+
 	connect(filter_btn, SIGNAL(toggled(bool)), filter_frm, SLOT(setVisible(bool)));
 	connect(filter_btn, &QToolButton::toggled, [&](){
 		splitter->setSizes({0, 1000});
@@ -48,6 +58,13 @@ ObjectFinderWidget::ObjectFinderWidget(QWidget *parent) : QWidget(parent)
 	connect(clear_res_btn, SIGNAL(clicked(void)), this, SLOT(clearResult(void)));
 	connect(select_all_btn, SIGNAL(clicked(void)), this, SLOT(setAllObjectsChecked(void)));
 	connect(clear_all_btn, SIGNAL(clicked(void)), this, SLOT(setAllObjectsChecked(void)));
+	connect(&search_timer, SIGNAL(timeout(void)), this, SLOT(searchNextObjects(void)));
+	connect(pattern_edt, SIGNAL(textEdited(QString)), &typing_timer, SLOT(start(void)));
+
+	connect(&typing_timer, &QTimer::timeout, [&](){
+		if(!pattern_edt->text().isEmpty())
+			findObjects();
+	});
 
 	this->setModel(nullptr);
 	pattern_edt->installEventFilter(this);
@@ -61,6 +78,7 @@ bool ObjectFinderWidget::eventFilter(QObject *object, QEvent *event)
 	if(event->type() == QEvent::KeyPress &&
 			(k_event->key()==Qt::Key_Return || k_event->key()==Qt::Key_Enter))
 	{
+		typing_timer.stop();
 		find_btn->click();
 		return(true);
 	}
@@ -188,6 +206,15 @@ void ObjectFinderWidget::setModel(ModelWidget *model_wgt)
 
 	clearResult();
 	this->model_wgt=model_wgt;
+	search_idx.setModel(enable ? model_wgt->getDatabaseModel() : nullptr);
+
+	if(enable)
+	{
+		connect(model_wgt->getDatabaseModel(), SIGNAL(s_objectAdded(BaseObject*)), this, SLOT(handleObjectAddition(BaseObject*)), Qt::UniqueConnection);
+		connect(model_wgt->getDatabaseModel(), SIGNAL(s_objectRemoved(BaseObject*)), this, SLOT(handleObjectRemoval(BaseObject*)), Qt::UniqueConnection);
+		connect(model_wgt->getDatabaseModel(), SIGNAL(s_objectRenamed(BaseObject*)), this, SLOT(handleObjectRenaming(BaseObject*)), Qt::UniqueConnection);
+	}
+
 	filter_btn->setEnabled(enable);
 	pattern_edt->setEnabled(enable);
 	filter_frm->setEnabled(enable);
@@ -198,6 +225,10 @@ void ObjectFinderWidget::setModel(ModelWidget *model_wgt)
 
 void ObjectFinderWidget::clearResult(void)
 {
+	search_timer.stop();
+	candidates.clear();
+	candidate_idx=0;
+
 	selected_obj=nullptr;
 	found_objs.clear();
 
@@ -225,29 +256,102 @@ void ObjectFinderWidget::findObjects(void)
 				types.push_back(static_cast<ObjectType>(obj_types_lst->item(i)->data(Qt::UserRole).toUInt()));
 		}
 
-		//Search the objects on model
-		found_objs=model_wgt->getDatabaseModel()->findObjects(pattern_edt->text(), types, true,
-														case_sensitive_chk->isChecked(), regexp_chk->isChecked(), exact_match_chk->isChecked());
+		search_pattern=pattern_edt->text();
+		search_attr=search_attrs_cmb->currentData().toString();
+		search_exact_match=exact_match_chk->isChecked();
+		search_regexp=ObjectSearchIndex::createSearchRegExp(search_pattern, case_sensitive_chk->isChecked(),
+																												regexp_chk->isChecked(), search_exact_match);
 
-		//Show the found objects on the result table
-		updateObjectTable(result_tbw, found_objs);
+		/* Retrieving the objects that may match the pattern from the index. The candidates are verified
+		in small chunks in the event loop so the results are shown incrementally without freezing the ui */
+		candidates=search_idx.getCandidates(search_pattern, types, search_attr, regexp_chk->isChecked(), search_exact_match);
+		candidate_idx=0;
+
+		result_tbw->setSortingEnabled(false);
+		found_lbl->setText(trUtf8("Searching objects..."));
 		found_lbl->setVisible(true);
+		search_timer.start();
+	}
+}
 
-		//Show a message indicating the number of found objects
-		if(!found_objs.empty())
-		{
-			found_lbl->setText(trUtf8("Found <strong>%1</strong> object(s).").arg(found_objs.size()));
-			result_tbw->resizeColumnsToContents();
-			result_tbw->horizontalHeader()->setStretchLastSection(true);
-		}
-		else
-			found_lbl->setText(trUtf8("No objects found."));
+void ObjectFinderWidget::searchNextObjects(void)
+{
+	vector<BaseObject *> objs;
+	unsigned count=std::min<unsigned>(candidate_idx + SEARCH_CHUNK_SIZE, candidates.size());
+
+	for(; candidate_idx < count; candidate_idx++)
+	{
+		if(ObjectSearchIndex::matchesObject(candidates[candidate_idx], search_pattern, search_regexp,
+																				search_attr, true, search_exact_match))
+			objs.push_back(candidates[candidate_idx]);
+	}
+
+	if(!objs.empty())
+	{
+		found_objs.insert(found_objs.end(), objs.begin(), objs.end());
+		updateObjectTable(result_tbw, objs, true);
+		found_lbl->setText(trUtf8("Searching objects... <strong>%1</strong> found so far.").arg(found_objs.size()));
+	}
+
+	if(candidate_idx >= candidates.size())
+		finishSearch();
+}
+
+void ObjectFinderWidget::finishSearch(void)
+{
+	search_timer.stop();
+	candidates.clear();
+	candidate_idx=0;
+	result_tbw->setSortingEnabled(true);
 
-		clear_res_btn->setEnabled(!found_objs.empty());
-		select_btn->setEnabled(!found_objs.empty());
-		fade_btn->setEnabled(!found_objs.empty());
-		fadeObjects();
+	//Show a message indicating the number of found objects
+	if(!found_objs.empty())
+	{
+		found_lbl->setText(trUtf8("Found <strong>%1</strong> object(s).").arg(found_objs.size()));
+		result_tbw->resizeColumnsToContents();
+		result_tbw->horizontalHeader()->setStretchLastSection(true);
 	}
+	else
+		found_lbl->setText(trUtf8("No objects found."));
+
+	clear_res_btn->setEnabled(!found_objs.empty());
+	select_btn->setEnabled(!found_objs.empty());
+	fade_btn->setEnabled(!found_objs.empty());
+	fadeObjects();
+}
+
+void ObjectFinderWidget::restartSearch(void)
+{
+	if(!search_timer.isActive())
+		return;
+
+	/* The running search is aborted since its candidates may have been destroyed.
+	A new search is scheduled to the next event loop iteration when the model is in a consistent state */
+	search_timer.stop();
+	candidates.clear();
+	candidate_idx=0;
+	QTimer::singleShot(0, this, SLOT(findObjects(void)));
+}
+
+void ObjectFinderWidget::handleObjectAddition(BaseObject *object)
+{
+	if(sender()==search_idx.getModel())
+		search_idx.addObject(object);
+}
+
+void ObjectFinderWidget::handleObjectRemoval(BaseObject *object)
+{
+	if(sender()!=search_idx.getModel())
+		return;
+
+	search_idx.removeObject(object);
+	restartSearch();
+}
+
+void ObjectFinderWidget::handleObjectRenaming(BaseObject *object)
+{
+	if(sender()==search_idx.getModel())
+		search_idx.updateObject(object);
 }
 
 void ObjectFinderWidget::selectObject(void)
@@ -314,7 +418,7 @@ void ObjectFinderWidget::setAllObjectsChecked(void)
 		obj_types_lst->item(i)->setCheckState((checked ? Qt::Checked : Qt::Unchecked));
 }
 
-void ObjectFinderWidget::updateObjectTable(QTableWidget *tab_wgt, vector<BaseObject *> &objs)
+void ObjectFinderWidget::updateObjectTable(QTableWidget *tab_wgt, vector<BaseObject *> &objs, bool append)
 {
 	if(tab_wgt && tab_wgt->columnCount()!=0)
 	{
@@ -328,7 +432,7 @@ void ObjectFinderWidget::updateObjectTable(QTableWidget *tab_wgt, vector<BaseObj
 		tab_wgt->setUpdatesEnabled(false);
 		tab_wgt->setSortingEnabled(false);
 
-		for(lin_idx=0, i=0; i < objs.size(); i++)
+		for(lin_idx=(append ? tab_wgt->rowCount() : 0), i=0; i < objs.size(); i++)
 		{
 			if(objs[i]->getObjectType()==BASE_RELATIONSHIP)
 				str_aux=QString("tv");
@@ -442,11 +546,11 @@ void ObjectFinderWidget::updateObjectTable(QTableWidget *tab_wgt, vector<BaseObj
 			lin_idx++;
 		}
 
-		if(static_cast<int>(objs.size()) != tab_wgt->rowCount())
+		if(!append && static_cast<int>(objs.size()) != tab_wgt->rowCount())
 		  tab_wgt->setRowCount(objs.size());
 
 		tab_wgt->setUpdatesEnabled(true);
-		tab_wgt->setSortingEnabled(true);
+		tab_wgt->setSortingEnabled(!append);
 	}
 }
 
@@ -28,14 +28,44 @@
 #include "ui_objectfinderwidget.h"
 #include "pgmodelerns.h"
 #include "modelwidget.h"
+#include "objectsearchindex.h"
 #include <QWidget>
+#include <QTimer>
 
 class ObjectFinderWidget : public QWidget, public Ui::ObjectFinderWidget {
 	private:
 		Q_OBJECT
 
+		//! \brief Amount of search candidates verified at each step of an incremental search
+		static const unsigned SEARCH_CHUNK_SIZE=500;
+
+		//! \brief Interval (in ms) after the last key press in the pattern field to trigger the search
+		static const int TYPING_INTERVAL=300;
+
 		vector<BaseObject *> found_objs;
 
+		//! \brief Index used to reduce the amount of objects matched against the search pattern
+		ObjectSearchIndex search_idx;
+
+		//! \brief Objects returned by the search index that are being verified by the current incremental search
+		vector<BaseObject *> candidates;
+
+		//! \brief Position of the next candidate to be verified
+		unsigned candidate_idx;
+
+		//! \brief Parameters of the current incremental search
+		QString search_pattern, search_attr;
+
+		QRegExp search_regexp;
+
+		bool search_exact_match;
+
+		//! \brief Timer that drives the incremental search in the event loop
+		QTimer search_timer;
+
+		//! \brief Timer that triggers the search while the user types the pattern
+		QTimer typing_timer;
+
 		QMenu select_menu, fade_menu;
 
 		//! \brief Reference model widget
@@ -51,6 +81,12 @@ class ObjectFinderWidget : public QWidget, public Ui::ObjectFinderWidget {
 
 		void resizeEvent(QResizeEvent *event);
 
+		//! \brief Stops the current incremental search and updates the result controls
+		void finishSearch(void);
+
+		//! \brief Aborts the running incremental search (if any) and schedules a new one
+		void restartSearch(void);
+
 	public:
 		ObjectFinderWidget(QWidget *parent = 0);
 
@@ -58,8 +94,10 @@ class ObjectFinderWidget : public QWidget, public Ui::ObjectFinderWidget {
 		static void updateObjectTypeList(QListWidget *list_wgt);
 
 		/*! \brief Lists the objects of a vector in a QTableWidget. Any row of table contains the
-		reference to the object on the first column */
-		static void updateObjectTable(QTableWidget *tab_wgt, vector<BaseObject *> &objects);
+		reference to the object on the first column. When append is true the objects are listed after
+		the current rows and the sorting of the table is left disabled, so the caller must reenable it
+		when no more objects will be appended */
+		static void updateObjectTable(QTableWidget *tab_wgt, vector<BaseObject *> &objects, bool append=false);
 		
 		//! \brief Sets the database model to work on
 		void setModel(ModelWidget *model_wgt);
@@ -73,6 +111,18 @@ class ObjectFinderWidget : public QWidget, public Ui::ObjectFinderWidget {
 		void findObjects(void);
 
 	private slots:
+		//! \brief Verifies the next chunk of candidates of the running search appending the matching objects to the result
+		void searchNextObjects(void);
+
+		//! \brief Updates the search index when an object is added to the model
+		void handleObjectAddition(BaseObject *object);
+
+		//! \brief Updates the search index when an object is removed from the model
+		void handleObjectRemoval(BaseObject *object);
+
+		//! \brief Updates the search index when an object of the model is renamed (or has its children changed)
+		void handleObjectRenaming(BaseObject *object);
+
 		//! \brief Opens the editing form of the selected object
 		void editObject(void);
 
@@ -129,6 +129,7 @@ void ObjectRenameWidget::applyRenaming(void)
 			}
 
 			object->setName(new_name_edt->text().toUtf8());
+			model->notifyObjectRenamed(object);
 
 			//If the renamed object is a graphical one, set as modified to force its redraw
 			if(obj_graph)
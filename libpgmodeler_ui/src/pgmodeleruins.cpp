@@ -285,6 +285,21 @@ namespace PgModelerUiNS {
 		return(getIconPath(BaseObject::getSchemaName(obj_type)));
 	}
 
+	QIcon getIcon(const QString &icon)
+	{
+		static QHash<QString, QIcon> icons;
+
+		if(!icons.contains(icon))
+			icons[icon]=QIcon(QPixmap(getIconPath(icon)));
+
+		return(icons[icon]);
+	}
+
+	QIcon getIcon(ObjectType obj_type)
+	{
+		return(getIcon(BaseObject::getSchemaName(obj_type)));
+	}
+
 	void resizeDialog(QDialog *widget)
 	{
 		QSize min_size=widget->minimumSize();
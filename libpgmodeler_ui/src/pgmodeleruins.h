@@ -29,6 +29,7 @@
 #include <QListWidget>
 #include <QTableWidget>
 #include <QPixmap>
+#include <QIcon>
 #include "baseobject.h"
 #include "numberedtexteditor.h"
 
@@ -76,6 +77,14 @@ namespace PgModelerUiNS {
 	//! \brief Returns the path, in the icon resource, to the icon of the provided object type
 	extern QString getIconPath(ObjectType obj_type);
 
+	/*! \brief Returns the icon, from the icon resource, with the provided name. The icons are loaded
+	only once and shared by the subsequent calls, this avoids decoding the same image several times when
+	filling views with a large amount of items. This function must be called only from the GUI thread */
+	extern QIcon getIcon(const QString &icon);
+
+	//! \brief Returns the shared icon of the provided object type (see getIcon(const QString &))
+	extern QIcon getIcon(ObjectType obj_type);
+
 	//! \brief Resizes the provided dialog considering font dpi changes as well screen size
 	extern void resizeDialog(QDialog *dialog);
 
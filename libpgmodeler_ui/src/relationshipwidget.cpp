@@ -58,6 +58,9 @@ RelationshipWidget::RelationshipWidget(QWidget *parent): BaseObjectWidget(parent
 		table2_hl=new SyntaxHighlighter(recv_table_txt, true);
 		table2_hl->loadConfiguration(GlobalAttributes::SQL_HIGHLIGHT_CONF_PATH);
 
+		part_bound_hl=new SyntaxHighlighter(part_bound_txt, false, true);
+		part_bound_hl->loadConfiguration(GlobalAttributes::SQL_HIGHLIGHT_CONF_PATH);
+
 		for(int i=0; i < pattern_fields.size(); i++)
 		{
 			patterns_hl[i]=new SyntaxHighlighter(qobject_cast<QPlainTextEdit *>(pattern_fields[i]), true);
@@ -190,6 +193,8 @@ RelationshipWidget::RelationshipWidget(QWidget *parent): BaseObjectWidget(parent
 		connect(all_chk, SIGNAL(toggled(bool)), this, SLOT(selectCopyOptions(void)));
 
 		connect(custom_color_chk, SIGNAL(toggled(bool)), color_picker, SLOT(setEnabled(bool)));
+		connect(default_part_chk, SIGNAL(toggled(bool)), part_bound_txt, SLOT(setDisabled(bool)));
+		connect(default_part_chk, SIGNAL(toggled(bool)), part_bound_lbl, SLOT(setDisabled(bool)));
 
 		connect(fk_gconf_chk, SIGNAL(toggled(bool)), this, SLOT(useFKGlobalSettings(bool)));
 		connect(patterns_gconf_chk, SIGNAL(toggled(bool)), this, SLOT(usePatternGlobalSettings(bool)));
@@ -251,6 +256,7 @@ void RelationshipWidget::setAttributes(DatabaseModel *model, OperationList *op_l
 		case BaseRelationship::RELATIONSHIP_GEN: rel_gen_rb->setChecked(true); break;
 		case BaseRelationship::RELATIONSHIP_FK:  rel_fk_rb->setChecked(true); break;
 		case BaseRelationship::RELATIONSHIP_DEP: rel_dep_rb->setChecked(true); break;
+		case BaseRelationship::RELATIONSHIP_PART: rel_part_rb->setChecked(true); break;
 	}
 
 	aux_rel=dynamic_cast<Relationship *>(base_rel);
@@ -338,6 +344,11 @@ void RelationshipWidget::setAttributes(DatabaseModel *model, OperationList *op_l
 				identity_chk->setChecked(!all_chk->isChecked() && copy_op.isOptionSet(CopyOptions::IDENTITY));
 				statistics_chk->setChecked(!all_chk->isChecked() && copy_op.isOptionSet(CopyOptions::STATISTICS));
 			}
+			else if(rel_type==BaseRelationship::RELATIONSHIP_PART)
+			{
+				part_bound_txt->setPlainText(aux_rel->getReceiverTable()->getPartitionBoundingExpr());
+				default_part_chk->setChecked(aux_rel->getReceiverTable()->isDefaultPartition());
+			}
 		}
 	}
 
@@ -348,6 +359,7 @@ void RelationshipWidget::setAttributes(DatabaseModel *model, OperationList *op_l
 
 	relgen_dep=(rel_type==BaseRelationship::RELATIONSHIP_DEP ||
 				rel_type==BaseRelationship::RELATIONSHIP_GEN ||
+				rel_type==BaseRelationship::RELATIONSHIP_PART ||
 				rel_type==BaseRelationship::RELATIONSHIP_FK);
 
 	use_name_patterns=(rel1n || relnn ||
@@ -402,6 +414,9 @@ void RelationshipWidget::setAttributes(DatabaseModel *model, OperationList *op_l
 	copy_options_grp->setVisible(base_rel->getObjectType()==OBJ_RELATIONSHIP &&
 								 base_rel->getRelationshipType()==BaseRelationship::RELATIONSHIP_DEP);
 
+	part_bound_grp->setVisible(base_rel->getObjectType()==OBJ_RELATIONSHIP &&
+							   base_rel->getRelationshipType()==BaseRelationship::RELATIONSHIP_PART);
+
 	custom_color_chk->setChecked(base_rel->getCustomColor()!=Qt::transparent);
 	color_picker->setColor(0, base_rel->getCustomColor());
 	listAdvancedObjects();
@@ -428,7 +443,7 @@ QSize RelationshipWidget::getIdealSize(void)
 	if(rel_fk_rb->isChecked() ||
 		 (rel_dep_rb->isChecked() &&	this->object && this->object->getObjectType()==BASE_RELATIONSHIP))
 		return(QSize(640, 320));
-	else if(rel_gen_rb->isChecked())
+	else if(rel_gen_rb->isChecked() || rel_part_rb->isChecked())
 		return(QSize(640, 520));
 	else
 		return(QSize(640, 680));
@@ -479,6 +494,10 @@ void RelationshipWidget::usePatternGlobalSettings(bool value)
 			map<QString, attribs_map> confs=RelationshipConfigWidget::getConfigurationParams();
 			QString rel_type=rel->getRelTypeAttribute();
 
+			//Partitioning relationships share the name patterns of generalizations
+			if(rel_type==ParsersAttributes::RELATIONSHIP_PART)
+				rel_type=ParsersAttributes::RELATIONSHIP_GEN;
+
 			//Using the global settings
 			pk_pattern_txt->setPlainText(confs[rel_type][ParsersAttributes::PK_PATTERN]);
 			src_fk_pattern_txt->setPlainText(confs[rel_type][ParsersAttributes::SRC_FK_PATTERN]);
@@ -998,9 +1017,29 @@ void RelationshipWidget::applyConfiguration(void)
 	{
 		Relationship *rel=nullptr;
 		BaseRelationship *base_rel=dynamic_cast<BaseRelationship *>(this->object);
+		Table *recv_tab=nullptr;
 		unsigned rel_type, count, i, copy_mode=0, copy_ops=0;
 		vector<unsigned> col_ids;
 
+		/* The partition bound is stored in the receiver table so it's validated and the table
+		modification is registered before disconnecting the relationships */
+		if(this->object->getObjectType()==OBJ_RELATIONSHIP &&
+			 base_rel->getRelationshipType()==BaseRelationship::RELATIONSHIP_PART)
+		{
+			rel=dynamic_cast<Relationship *>(base_rel);
+			recv_tab=rel->getReceiverTable();
+
+			if(!default_part_chk->isChecked() && part_bound_txt->toPlainText().trimmed().isEmpty())
+				throw Exception(Exception::getErrorMessage(ERR_PARTITION_NO_BOUND_EXPR)
+								.arg(recv_tab->getName(true))
+								.arg(rel->getReferenceTable()->getName(true)),
+								ERR_PARTITION_NO_BOUND_EXPR,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			op_list->registerObject(recv_tab, Operation::OBJECT_MODIFIED);
+			recv_tab->setDefaultPartition(default_part_chk->isChecked());
+			recv_tab->setPartitionBoundingExpr(default_part_chk->isChecked() ? QString() : part_bound_txt->toPlainText().trimmed());
+		}
+
 		/* Due to the complexity of the Relationship class and the strong link between all
 		 the relationships on the model is necessary to store the XML of the special objects
 		 and disconnect all relationships, edit the relationshi and revalidate all the relationships again */
@@ -1103,6 +1142,7 @@ void RelationshipWidget::applyConfiguration(void)
 				//Checking if there is relationship redundancy
 				if(rel_type==BaseRelationship::RELATIONSHIP_DEP ||
 						rel_type==BaseRelationship::RELATIONSHIP_GEN ||
+						rel_type==BaseRelationship::RELATIONSHIP_PART ||
 						rel->isIdentifier())
 					model->checkRelationshipRedundancy(rel);
 
@@ -17,6 +17,7 @@
 */
 
 #include "sqlexecutionhelper.h"
+#include "sqlstatementsplitter.h"
 
 SQLExecutionHelper::SQLExecutionHelper(void) : QObject(nullptr)
 {
@@ -70,8 +71,43 @@ void SQLExecutionHelper::executeCommand(void)
 			connection.setSQLExecutionTimout(3600);
 		}
 
-		connection.executeDMLCommand(command, res);
-		notices = connection.getNotices();
+		/* Executing the statements one by one so the script can be cancelled between them and
+		commands that can't run inside a multi-statement string (e.g. VACUUM) are accepted.
+		As in a single multi-statement execution only the result of the last statement is kept */
+		SQLStatementSplitter splitter(command);
+		SQLStatementSplitter::Statement stmt;
+		vector<SQLStatementSplitter::Statement> stmts;
+		bool use_tx=false;
+
+		while(splitter.next(stmt))
+			stmts.push_back(stmt);
+
+		/* A multi-statement string runs in a single implicit transaction, so the same is done here with an
+		explicit one. Scripts that control the transactions by themselves or that contain commands which can't
+		run inside a transaction block are executed as they are, each statement being committed on its own.
+		The same happens when the user has a transaction opened in the connection so it is not committed here */
+		use_tx=(stmts.size() > 1 && !connection.isInTransaction());
+
+		for(auto itr=stmts.begin(); itr!=stmts.end() && use_tx; itr++)
+			use_tx=!(itr->tx_control || itr->no_tx_block);
+
+		notices.clear();
+
+		if(use_tx)
+			connection.executeDDLCommand(QString("START TRANSACTION"));
+
+		for(auto itr=stmts.begin(); itr!=stmts.end() && !cancelled; itr++)
+		{
+			connection.executeDMLCommand(splitter.getStatement(*itr), res);
+			notices.append(connection.getNotices());
+		}
+
+		//A script cancelled between two statements has its changes undone as a failed multi-statement string would
+		if(use_tx)
+		{
+			connection.executeDDLCommand(cancelled ? QString("ROLLBACK") : QString("COMMIT"));
+			notices.append(connection.getNotices());
+		}
 
 		if(!res.isEmpty())
 			result_model = new ResultSetModel(res, catalog);
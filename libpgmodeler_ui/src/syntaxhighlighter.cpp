@@ -20,6 +20,8 @@
 #include "numberedtexteditor.h"
 
 QFont SyntaxHighlighter::default_font=QFont(QString("Source Code Pro"), 10);
+map<QString, SyntaxHighlighter::RegistryEntry> SyntaxHighlighter::conf_registry;
+set<SyntaxHighlighter *> SyntaxHighlighter::instances;
 
 SyntaxHighlighter::SyntaxHighlighter(QPlainTextEdit *parent, bool single_line_mode, bool use_custom_tab_width) : QSyntaxHighlighter(parent)
 {
@@ -30,6 +32,7 @@ SyntaxHighlighter::SyntaxHighlighter(QPlainTextEdit *parent, bool single_line_mo
 	this->single_line_mode=single_line_mode;
 	configureAttributes();
 	parent->installEventFilter(this);
+	instances.insert(this);
 
 	if(use_custom_tab_width)
 		parent->setTabStopWidth(NumberedTextEditor::getTabWidth());
@@ -46,6 +49,11 @@ SyntaxHighlighter::SyntaxHighlighter(QPlainTextEdit *parent, bool single_line_mo
 	}
 }
 
+SyntaxHighlighter::~SyntaxHighlighter(void)
+{
+	instances.erase(this);
+}
+
 bool SyntaxHighlighter::eventFilter(QObject *object, QEvent *event)
 {
 	//Filters the ENTER/RETURN avoiding line breaks
@@ -77,11 +85,13 @@ bool SyntaxHighlighter::eventFilter(QObject *object, QEvent *event)
 
 bool SyntaxHighlighter::hasInitialAndFinalExprs(const QString &group)
 {
-	return(initial_exprs.count(group) && final_exprs.count(group));
+	return(conf->initial_exprs.count(group) && conf->final_exprs.count(group));
 }
 
 void SyntaxHighlighter::configureAttributes(void)
 {
+	conf=make_shared<const Configuration>();
+	conf_file.clear();
 	conf_loaded=false;
 }
 
@@ -116,6 +126,9 @@ void SyntaxHighlighter::highlightBlock(const QString &txt)
 
 	if(!txt.isEmpty())
 	{
+		const QString &word_separators=conf->word_separators,
+				&word_delimiters=conf->word_delimiters,
+				&ignored_chars=conf->ignored_chars;
 		QString text=txt + QChar('\n'), word, group;
 		unsigned i=0, len, idx=0, i1;
 		int match_idx, match_len, aux_len, start_col;
@@ -183,9 +196,10 @@ void SyntaxHighlighter::highlightBlock(const QString &txt)
 					this because the final expression of the group contains the word delimiter '. In order to force the highlight stop
 					in the last ' we include it in the current evaluated word and increment the position in the text so the next
 					word starts without the word delimiter. */
-					if(word_delimiters.contains(text[i]) && prev_info && !prev_info->group.isEmpty() && prev_info->has_exprs)
+					if(word_delimiters.contains(text[i]) && prev_info && !prev_info->group.isEmpty() && prev_info->has_exprs &&
+						 conf->final_exprs.count(prev_info->group))
 					{
-						for(auto exp : final_exprs[prev_info->group])
+						for(auto &exp : conf->final_exprs.at(prev_info->group))
 						{
 							if(exp.pattern().contains(text[i]))
 							{
@@ -268,7 +282,7 @@ QString SyntaxHighlighter::identifyWordGroup(const QString &word, const QChar &l
 	}
 	else
 	{
-		for(auto &itr_group : groups_order)
+		for(auto &itr_group : conf->groups_order)
 		{
 			group=itr_group;
 			if(isWordMatchGroup(word, group, false, lookahead_chr, match_idx, match_len))
@@ -295,19 +309,23 @@ QString SyntaxHighlighter::identifyWordGroup(const QString &word, const QChar &l
 
 bool SyntaxHighlighter::isWordMatchGroup(const QString &word, const QString &group, bool use_final_expr, const QChar &lookahead_chr, int &match_idx, int &match_len)
 {
-	vector<QRegExp> *vet_expr=nullptr;
-	bool match=false, part_match=partial_match[group];
+	const vector<QRegExp> *vet_expr=nullptr;
+	bool match=false, part_match=(conf->partial_match.count(group) && conf->partial_match.at(group));
 
-	if(use_final_expr && final_exprs.count(group))
-		vet_expr=&final_exprs[group];
+	if(use_final_expr && conf->final_exprs.count(group))
+		vet_expr=&conf->final_exprs.at(group);
+	else if(conf->initial_exprs.count(group))
+		vet_expr=&conf->initial_exprs.at(group);
 	else
-		vet_expr=&initial_exprs[group];
+		return(false);
 
+	/* The expressions are shared by all highlighters using the same configuration, since they are used only
+	in the main thread the match state stored by the (const) QRegExp methods is read right after the matching */
 	for(auto &expr : *vet_expr)
 	{
 		if(part_match)
 		{
-			match_idx=word.indexOf(expr);
+			match_idx=expr.indexIn(word);
 			match_len=expr.matchedLength();
 			match=(match_idx >= 0);
 		}
@@ -325,7 +343,7 @@ bool SyntaxHighlighter::isWordMatchGroup(const QString &word, const QString &gro
 			}
 		}
 
-		if(match && lookahead_char.count(group) > 0 && lookahead_chr!=lookahead_char.at(group))
+		if(match && conf->lookahead_char.count(group) > 0 && lookahead_chr!=conf->lookahead_char.at(group))
 			match=false;
 
 		if(match) break;
@@ -341,16 +359,6 @@ bool SyntaxHighlighter::isConfigurationLoaded(void)
 
 void SyntaxHighlighter::clearConfiguration(void)
 {
-	initial_exprs.clear();
-	final_exprs.clear();
-	formats.clear();
-	partial_match.clear();
-	groups_order.clear();
-	word_separators.clear();
-	word_delimiters.clear();
-	ignored_chars.clear();
-	lookahead_char.clear();
-
 	configureAttributes();
 }
 
@@ -358,233 +366,281 @@ void SyntaxHighlighter::loadConfiguration(const QString &filename)
 {
 	if(!filename.isEmpty())
 	{
-		attribs_map attribs;
-		QString elem, expr_type, group;
-		bool groups_decl=false, chr_sensitive=false,
-				bold=false, italic=false,
-				underline=false, partial_match=false;
-		QTextCharFormat format;
-		QRegExp regexp;
-		QColor bg_color, fg_color;
-		vector<QString>::iterator itr, itr_end;
-
 		try
 		{
 			clearConfiguration();
-			xmlparser.restartParser();
-			xmlparser.setDTDFile(GlobalAttributes::TMPL_CONFIGURATIONS_DIR +
-								 GlobalAttributes::DIR_SEPARATOR +
-								 GlobalAttributes::OBJECT_DTD_DIR +
-								 GlobalAttributes::DIR_SEPARATOR +
-								 GlobalAttributes::CODE_HIGHLIGHT_CONF +
-								 GlobalAttributes::OBJECT_DTD_EXT,
-								 GlobalAttributes::CODE_HIGHLIGHT_CONF);
-
-			xmlparser.loadXMLFile(filename);
-
-			if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
+			conf=getConfiguration(filename);
+			conf_file=filename;
+			conf_loaded=true;
+		}
+		catch(Exception &e)
+		{
+			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		}
+	}
+}
+
+shared_ptr<const SyntaxHighlighter::Configuration> SyntaxHighlighter::getConfiguration(const QString &filename)
+{
+	QFileInfo fi(filename);
+	QString key=fi.absoluteFilePath();
+
+	try
+	{
+		if(conf_registry.count(key))
+		{
+			RegistryEntry &entry=conf_registry[key];
+
+			if(entry.last_modified==fi.lastModified() && entry.file_size==fi.size())
+				return(entry.conf);
+		}
+
+		RegistryEntry entry;
+
+		entry.conf=parseConfiguration(filename);
+		entry.last_modified=fi.lastModified();
+		entry.file_size=fi.size();
+		conf_registry[key]=entry;
+
+		return(entry.conf);
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+shared_ptr<const SyntaxHighlighter::Configuration> SyntaxHighlighter::parseConfiguration(const QString &filename)
+{
+	shared_ptr<Configuration> conf=make_shared<Configuration>();
+	map<QString, vector<QRegExp> > &initial_exprs=conf->initial_exprs,
+			&final_exprs=conf->final_exprs;
+	vector<QString> &groups_order=conf->groups_order;
+	XMLParser xmlparser;
+	attribs_map attribs;
+	QString elem, expr_type, group;
+	bool groups_decl=false, chr_sensitive=false,
+			bold=false, italic=false,
+			underline=false, partial_match=false;
+	QTextCharFormat format;
+	QRegExp regexp;
+	QColor bg_color, fg_color;
+	vector<QString>::iterator itr, itr_end;
+
+	try
+	{
+		xmlparser.setDTDFile(GlobalAttributes::TMPL_CONFIGURATIONS_DIR +
+							 GlobalAttributes::DIR_SEPARATOR +
+							 GlobalAttributes::OBJECT_DTD_DIR +
+							 GlobalAttributes::DIR_SEPARATOR +
+							 GlobalAttributes::CODE_HIGHLIGHT_CONF +
+							 GlobalAttributes::OBJECT_DTD_EXT,
+							 GlobalAttributes::CODE_HIGHLIGHT_CONF);
+
+		xmlparser.loadXMLFile(filename);
+
+		if(xmlparser.accessElement(XMLParser::CHILD_ELEMENT))
+		{
+			do
 			{
-				do
+				if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 				{
-					if(xmlparser.getElementType()==XML_ELEMENT_NODE)
+					elem=xmlparser.getElementName();
+
+					if(elem==ParsersAttributes::WORD_SEPARATORS)
 					{
-						elem=xmlparser.getElementName();
+						xmlparser.getElementAttributes(attribs);
+						conf->word_separators=attribs[ParsersAttributes::VALUE];
+					}
+					else if(elem==ParsersAttributes::WORD_DELIMITERS)
+					{
+						xmlparser.getElementAttributes(attribs);
+						conf->word_delimiters=attribs[ParsersAttributes::VALUE];
+					}
+					else if(elem==ParsersAttributes::IGNORED_CHARS)
+					{
+						xmlparser.getElementAttributes(attribs);
+						conf->ignored_chars=attribs[ParsersAttributes::VALUE];
+					}
+					else if(elem==ParsersAttributes::COMPLETION_TRIGGER)
+					{
+						xmlparser.getElementAttributes(attribs);
 
-						if(elem==ParsersAttributes::WORD_SEPARATORS)
-						{
-							xmlparser.getElementAttributes(attribs);
-							word_separators=attribs[ParsersAttributes::VALUE];
-						}
-						else if(elem==ParsersAttributes::WORD_DELIMITERS)
-						{
-							xmlparser.getElementAttributes(attribs);
-							word_delimiters=attribs[ParsersAttributes::VALUE];
-						}
-						else if(elem==ParsersAttributes::IGNORED_CHARS)
-						{
-							xmlparser.getElementAttributes(attribs);
-							ignored_chars=attribs[ParsersAttributes::VALUE];
-						}
-						else if(elem==ParsersAttributes::COMPLETION_TRIGGER)
-						{
-							xmlparser.getElementAttributes(attribs);
+						if(attribs[ParsersAttributes::VALUE].size() >= 1)
+							conf->completion_trigger=attribs[ParsersAttributes::VALUE].at(0);
+					}
 
-							if(attribs[ParsersAttributes::VALUE].size() >= 1)
-								completion_trigger=attribs[ParsersAttributes::VALUE].at(0);
-						}
+					/*	If the element is what defines the order of application of the groups
+							highlight in the (highlight-order). Is in this block that are declared
+							the groups used to highlight the source code. ALL groups
+							in this block must be declared before they are built
+							otherwise an error will be triggered. */
+					else if(elem==ParsersAttributes::HIGHLIGHT_ORDER)
+					{
+						//Marks a flag indication that groups are being declared
+						groups_decl=true;
+						xmlparser.savePosition();
+						xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+						elem=xmlparser.getElementName();
+					}
 
-						/*	If the element is what defines the order of application of the groups
-								highlight in the (highlight-order). Is in this block that are declared
-								the groups used to highlight the source code. ALL groups
-								in this block must be declared before they are built
-								otherwise an error will be triggered. */
-						else if(elem==ParsersAttributes::HIGHLIGHT_ORDER)
-						{
-							//Marks a flag indication that groups are being declared
-							groups_decl=true;
-							xmlparser.savePosition();
-							xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
-							elem=xmlparser.getElementName();
-						}
+					if(elem==ParsersAttributes::GROUP)
+					{
+						xmlparser.getElementAttributes(attribs);
+						group=attribs[ParsersAttributes::NAME];
 
-						if(elem==ParsersAttributes::GROUP)
+						/* If the parser is on the group declaration block and not in the build block
+							 some validations are made. */
+						if(groups_decl)
 						{
-							xmlparser.getElementAttributes(attribs);
-							group=attribs[ParsersAttributes::NAME];
-
-							/* If the parser is on the group declaration block and not in the build block
-								 some validations are made. */
-							if(groups_decl)
+							//Raises an error if the group was declared before
+							if(find(groups_order.begin(), groups_order.end(), group)!=groups_order.end())
 							{
-								//Raises an error if the group was declared before
-								if(find(groups_order.begin(), groups_order.end(), group)!=groups_order.end())
-								{
-									throw Exception(Exception::getErrorMessage(ERR_REDECL_HL_GROUP).arg(group),
-													ERR_REDECL_HL_GROUP,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-								}
-								//Raises an error if the group is being declared and build at the declaration statment (not permitted)
-								else if(attribs.size() > 1 || xmlparser.hasElement(XMLParser::CHILD_ELEMENT))
-								{
-									throw Exception(Exception::getErrorMessage(ERR_DEF_INV_GROUP_DECL)
-													.arg(group).arg(ParsersAttributes::HIGHLIGHT_ORDER),
-													ERR_REDECL_HL_GROUP,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-								}
+								throw Exception(Exception::getErrorMessage(ERR_REDECL_HL_GROUP).arg(group),
+												ERR_REDECL_HL_GROUP,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							}
+							//Raises an error if the group is being declared and build at the declaration statment (not permitted)
+							else if(attribs.size() > 1 || xmlparser.hasElement(XMLParser::CHILD_ELEMENT))
+							{
+								throw Exception(Exception::getErrorMessage(ERR_DEF_INV_GROUP_DECL)
+												.arg(group).arg(ParsersAttributes::HIGHLIGHT_ORDER),
+												ERR_REDECL_HL_GROUP,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							}
 
-								groups_order.push_back(group);
+							groups_order.push_back(group);
+						}
+						//Case the parser is on the contruction block and not in declaration of groups
+						else
+						{
+							//Raises an error if the group is being constructed by a second time
+							if(initial_exprs.count(group)!=0)
+							{
+								throw Exception(Exception::getErrorMessage(ERR_DEF_DUPLIC_GROUP).arg(group),
+												ERR_DEF_DUPLIC_GROUP,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 							}
-							//Case the parser is on the contruction block and not in declaration of groups
-							else
+							//Raises an error if the group is being constructed without being declared
+							else if(find(groups_order.begin(), groups_order.end(), group)==groups_order.end())
 							{
-								//Raises an error if the group is being constructed by a second time
-								if(initial_exprs.count(group)!=0)
-								{
-									throw Exception(Exception::getErrorMessage(ERR_DEF_DUPLIC_GROUP).arg(group),
-													ERR_DEF_DUPLIC_GROUP,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-								}
-								//Raises an error if the group is being constructed without being declared
-								else if(find(groups_order.begin(), groups_order.end(), group)==groups_order.end())
-								{
-									throw Exception(Exception::getErrorMessage(ERR_DEF_NOT_DECL_GROUP)
-													.arg(group).arg(ParsersAttributes::HIGHLIGHT_ORDER),
-													ERR_DEF_NOT_DECL_GROUP,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-								}
-								//Raises an error if the group does not have children element
-								else if(!xmlparser.hasElement(XMLParser::CHILD_ELEMENT))
-								{
-									throw Exception(Exception::getErrorMessage(ERR_DEF_EMPTY_GROUP).arg(group),
-													ERR_DEF_EMPTY_GROUP,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-								}
+								throw Exception(Exception::getErrorMessage(ERR_DEF_NOT_DECL_GROUP)
+												.arg(group).arg(ParsersAttributes::HIGHLIGHT_ORDER),
+												ERR_DEF_NOT_DECL_GROUP,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							}
+							//Raises an error if the group does not have children element
+							else if(!xmlparser.hasElement(XMLParser::CHILD_ELEMENT))
+							{
+								throw Exception(Exception::getErrorMessage(ERR_DEF_EMPTY_GROUP).arg(group),
+												ERR_DEF_EMPTY_GROUP,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+							}
 
-								chr_sensitive=(attribs[ParsersAttributes::CASE_SENSITIVE]==ParsersAttributes::_TRUE_);
-								italic=(attribs[ParsersAttributes::ITALIC]==ParsersAttributes::_TRUE_);
-								bold=(attribs[ParsersAttributes::BOLD]==ParsersAttributes::_TRUE_);
-								underline=(attribs[ParsersAttributes::UNDERLINE]==ParsersAttributes::_TRUE_);
-								partial_match=(attribs[ParsersAttributes::PARTIAL_MATCH]==ParsersAttributes::_TRUE_);
-								fg_color.setNamedColor(attribs[ParsersAttributes::FOREGROUND_COLOR]);
+							chr_sensitive=(attribs[ParsersAttributes::CASE_SENSITIVE]==ParsersAttributes::_TRUE_);
+							italic=(attribs[ParsersAttributes::ITALIC]==ParsersAttributes::_TRUE_);
+							bold=(attribs[ParsersAttributes::BOLD]==ParsersAttributes::_TRUE_);
+							underline=(attribs[ParsersAttributes::UNDERLINE]==ParsersAttributes::_TRUE_);
+							partial_match=(attribs[ParsersAttributes::PARTIAL_MATCH]==ParsersAttributes::_TRUE_);
+							fg_color.setNamedColor(attribs[ParsersAttributes::FOREGROUND_COLOR]);
 
-								//If the attribute isn't defined the bg color will be transparent
-								if(attribs[ParsersAttributes::BACKGROUND_COLOR].isEmpty())
-									bg_color.setRgb(0,0,0,0);
-								else
-									bg_color.setNamedColor(attribs[ParsersAttributes::BACKGROUND_COLOR]);
+							//If the attribute isn't defined the bg color will be transparent
+							if(attribs[ParsersAttributes::BACKGROUND_COLOR].isEmpty())
+								bg_color.setRgb(0,0,0,0);
+							else
+								bg_color.setNamedColor(attribs[ParsersAttributes::BACKGROUND_COLOR]);
 
-								if(!attribs[ParsersAttributes::LOOKAHEAD_CHAR].isEmpty())
-									lookahead_char[group]=attribs[ParsersAttributes::LOOKAHEAD_CHAR][0];
+							if(!attribs[ParsersAttributes::LOOKAHEAD_CHAR].isEmpty())
+								conf->lookahead_char[group]=attribs[ParsersAttributes::LOOKAHEAD_CHAR][0];
 
-								format.setFontFamily(default_font.family());
-								format.setFontPointSize(default_font.pointSizeF());
-								format.setFontItalic(italic);
-								format.setFontUnderline(underline);
+							format.setFontFamily(default_font.family());
+							format.setFontPointSize(default_font.pointSizeF());
+							format.setFontItalic(italic);
+							format.setFontUnderline(underline);
 
-								if(bold)
-									format.setFontWeight(QFont::Bold);
-								else
-									format.setFontWeight(QFont::Normal);
+							if(bold)
+								format.setFontWeight(QFont::Bold);
+							else
+								format.setFontWeight(QFont::Normal);
 
-								format.setForeground(fg_color);
-								format.setBackground(bg_color);
-								formats[group]=format;
+							format.setForeground(fg_color);
+							format.setBackground(bg_color);
+							conf->formats[group]=format;
 
 
-								xmlparser.savePosition();
-								xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
+							xmlparser.savePosition();
+							xmlparser.accessElement(XMLParser::CHILD_ELEMENT);
 
-								if(chr_sensitive)
-									regexp.setCaseSensitivity(Qt::CaseSensitive);
-								else
-									regexp.setCaseSensitivity(Qt::CaseInsensitive);
+							if(chr_sensitive)
+								regexp.setCaseSensitivity(Qt::CaseSensitive);
+							else
+								regexp.setCaseSensitivity(Qt::CaseInsensitive);
 
-								this->partial_match[group]=partial_match;
+							conf->partial_match[group]=partial_match;
 
-								do
+							do
+							{
+								if(xmlparser.getElementType()==XML_ELEMENT_NODE)
 								{
-									if(xmlparser.getElementType()==XML_ELEMENT_NODE)
-									{
-										xmlparser.getElementAttributes(attribs);
-										expr_type=attribs[ParsersAttributes::TYPE];
-										regexp.setPattern(attribs[ParsersAttributes::VALUE]);
-
-										if(attribs[ParsersAttributes::REGULAR_EXP]==ParsersAttributes::_TRUE_)
-											regexp.setPatternSyntax(QRegExp::RegExp2);
-										else if(attribs[ParsersAttributes::WILDCARD]==ParsersAttributes::_TRUE_)
-											regexp.setPatternSyntax(QRegExp::Wildcard);
-										else
-											regexp.setPatternSyntax(QRegExp::FixedString);
-
-										if(expr_type.isEmpty() ||
-												expr_type==ParsersAttributes::SIMPLE_EXP ||
-												expr_type==ParsersAttributes::INITIAL_EXP)
-											initial_exprs[group].push_back(regexp);
-										else
-											final_exprs[group].push_back(regexp);
-									}
+									xmlparser.getElementAttributes(attribs);
+									expr_type=attribs[ParsersAttributes::TYPE];
+									regexp.setPattern(attribs[ParsersAttributes::VALUE]);
+
+									if(attribs[ParsersAttributes::REGULAR_EXP]==ParsersAttributes::_TRUE_)
+										regexp.setPatternSyntax(QRegExp::RegExp2);
+									else if(attribs[ParsersAttributes::WILDCARD]==ParsersAttributes::_TRUE_)
+										regexp.setPatternSyntax(QRegExp::Wildcard);
+									else
+										regexp.setPatternSyntax(QRegExp::FixedString);
+
+									if(expr_type.isEmpty() ||
+											expr_type==ParsersAttributes::SIMPLE_EXP ||
+											expr_type==ParsersAttributes::INITIAL_EXP)
+										initial_exprs[group].push_back(regexp);
+									else
+										final_exprs[group].push_back(regexp);
 								}
-								while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
-								xmlparser.restorePosition();
 							}
+							while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
+							xmlparser.restorePosition();
 						}
 					}
-
-					/* Check if there are some other groups to be declared, if not,
-							continues to reading to the other part of configuration */
-					if(groups_decl && !xmlparser.hasElement(XMLParser::NEXT_ELEMENT))
-					{
-						groups_decl=false;
-						xmlparser.restorePosition();
-					}
-
 				}
-				while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
-			}
-
-			itr=groups_order.begin();
-			itr_end=groups_order.end();
-
-			while(itr!=itr_end)
-			{
-				group=(*itr);
-				itr++;
 
-				if(initial_exprs[group].size()==0)
+				/* Check if there are some other groups to be declared, if not,
+						continues to reading to the other part of configuration */
+				if(groups_decl && !xmlparser.hasElement(XMLParser::NEXT_ELEMENT))
 				{
-					//Raises an error if the group was declared but not constructed
-					throw Exception(Exception::getErrorMessage(ERR_GROUP_DECL_NOT_DEFINED).arg(group),
-									ERR_GROUP_DECL_NOT_DEFINED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+					groups_decl=false;
+					xmlparser.restorePosition();
 				}
-			}
 
-			conf_loaded=true;
+			}
+			while(xmlparser.accessElement(XMLParser::NEXT_ELEMENT));
 		}
-		catch(Exception &e)
+
+		itr=groups_order.begin();
+		itr_end=groups_order.end();
+
+		while(itr!=itr_end)
 		{
-			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+			group=(*itr);
+			itr++;
+
+			if(initial_exprs[group].size()==0)
+			{
+				//Raises an error if the group was declared but not constructed
+				throw Exception(Exception::getErrorMessage(ERR_GROUP_DECL_NOT_DEFINED).arg(group),
+								ERR_GROUP_DECL_NOT_DEFINED,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			}
 		}
 	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+
+	return(conf);
 }
 
 vector<QRegExp> SyntaxHighlighter::getExpressions(const QString &group_name, bool final_expr)
 {
-	map<QString, vector<QRegExp> > *expr_map=(!final_expr ? &initial_exprs : &final_exprs);
+	const map<QString, vector<QRegExp> > *expr_map=(!final_expr ? &conf->initial_exprs : &conf->final_exprs);
 
 	if(expr_map->count(group_name) > 0)
 		return(expr_map->at(group_name));
@@ -594,12 +650,12 @@ vector<QRegExp> SyntaxHighlighter::getExpressions(const QString &group_name, boo
 
 QChar SyntaxHighlighter::getCompletionTrigger(void)
 {
-	return(completion_trigger);
+	return(conf->completion_trigger);
 }
 
 void SyntaxHighlighter::setFormat(int start, int count, const QString &group)
 {
-	QTextCharFormat format=formats[group];
+	QTextCharFormat format=(conf->formats.count(group) ? conf->formats.at(group) : QTextCharFormat());
 	format.setFontFamily(default_font.family());
 	format.setFontPointSize(default_font.pointSizeF());
 	QSyntaxHighlighter::setFormat(start, count, format);
@@ -609,3 +665,25 @@ void SyntaxHighlighter::setDefaultFont(const QFont &fnt)
 {
 	SyntaxHighlighter::default_font=fnt;
 }
+
+void SyntaxHighlighter::reloadConfigurations(void)
+{
+	try
+	{
+		//Discarding the parsed files so each one in use is parsed again (only once) in getConfiguration()
+		conf_registry.clear();
+
+		for(auto &hl : instances)
+		{
+			if(hl->conf_file.isEmpty())
+				continue;
+
+			hl->conf=getConfiguration(hl->conf_file);
+			hl->rehighlight();
+		}
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
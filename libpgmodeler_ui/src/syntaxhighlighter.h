@@ -20,6 +20,9 @@
 \ingroup libpgmodeler_ui
 \class SyntaxHighlighter
 \brief Implements a syntax hightlighter with user-defined markup patterns (xml configuration).
+\note Each configuration file is parsed only once per process and the resulting (immutable) configuration is shared by all
+highlighters that load the same file. The file is parsed again only if it was modified since the last load or when
+reloadConfigurations() is called, in which case all the instances are updated at once.
 */
 
 #ifndef SYNTAX_HIGHLIGHTER_H
@@ -33,6 +36,8 @@
 #include "globalattributes.h"
 #include "parsersattributes.h"
 #include <algorithm>
+#include <memory>
+#include <set>
 
 class SyntaxHighlighter: public QSyntaxHighlighter {
 	private:
@@ -57,8 +62,60 @@ class SyntaxHighlighter: public QSyntaxHighlighter {
 				}
 		};
 
-		//! \brief XML parser used to parse configuration files
-		XMLParser xmlparser;
+		//! \brief Stores the parsed contents of a configuration file
+		struct Configuration {
+			/*! \brief Stores the regexp used to identify keywords, identifiers, strings, numbers.
+			Also stores initial regexps used to identify a multiline group */
+			map<QString, vector<QRegExp> > initial_exprs;
+
+			/*! \brief Stores the regexps that indicates the end of a group. This regexps are
+			used mainly to identify the end of multiline comments */
+			map<QString, vector<QRegExp> > final_exprs;
+
+			//! \brief Stores the text formatting to each group
+			map<QString, QTextCharFormat> formats;
+
+			//! \brief Stores the groups related to partial matching
+			map<QString, bool> partial_match;
+
+			//! \brief Stores the char used to break the highlight for a group. This char is not highlighted itself.
+			map<QString, QChar> lookahead_char;
+
+			//! \brief Stores the order in which the groups must be applied
+			vector<QString> groups_order;
+
+			//! \brief Stores the chars that indicates word separators
+			QString word_separators,
+
+			//! \brief Stores the chars that indicates word delimiters
+			word_delimiters,
+
+			//! \brief Stores the chars ignored by the highlighter during the word reading
+			ignored_chars;
+
+			//! \brief Stores the char that triggers the code completion
+			QChar	completion_trigger;
+		};
+
+		//! \brief Stores a parsed configuration and the state of the file at the moment it was parsed
+		struct RegistryEntry {
+			QDateTime last_modified;
+			qint64 file_size;
+			shared_ptr<const Configuration> conf;
+		};
+
+		/*! \brief Parsed configurations indexed by file name. Highlighters are created only in the main thread
+		so the registry isn't guarded against concurrent access */
+		static map<QString, RegistryEntry> conf_registry;
+
+		//! \brief All the highlighters alive, used to update them when the configurations are reloaded
+		static set<SyntaxHighlighter *> instances;
+
+		//! \brief Configuration in use by the highlighter (an empty one when no file is loaded)
+		shared_ptr<const Configuration> conf;
+
+		//! \brief File name of the loaded configuration
+		QString conf_file;
 
 		//! \brief Default font configuratoin for all instances os syntax highlighter
 		static QFont default_font;
@@ -71,26 +128,6 @@ class SyntaxHighlighter: public QSyntaxHighlighter {
 		configuration as the current one */
 		OPEN_EXPR_BLOCK=0;
 
-		/*! \brief Stores the regexp used to identify keywords, identifiers, strings, numbers.
-		Also stores initial regexps used to identify a multiline group */
-		map<QString, vector<QRegExp> > initial_exprs;
-
-		/*! \brief Stores the regexps that indicates the end of a group. This regexps are
-		used mainly to identify the end of multiline comments */
-		map<QString, vector<QRegExp> > final_exprs;
-
-		//! \brief Stores the text formatting to each group
-		map<QString, QTextCharFormat> formats;
-
-		//! \brief Stores the groups related to partial matching
-		map<QString, bool> partial_match;
-
-		//! \brief Stores the char used to break the highlight for a group. This char is not highlighted itself.
-		map<QString, QChar> lookahead_char;
-
-		//! \brief Stores the order in which the groups must be applied
-		vector<QString> groups_order;
-
 		//! \brief Indicates if the configuration is loaded or not
 		bool conf_loaded,
 
@@ -98,18 +135,6 @@ class SyntaxHighlighter: public QSyntaxHighlighter {
 							the text to be in a single line. */
 		single_line_mode;
 
-		//! \brief Stores the chars that indicates word separators
-		QString word_separators,
-
-		//! \brief Stores the chars that indicates word delimiters
-		word_delimiters,
-
-		//! \brief Stores the chars ignored by the highlighter during the word reading
-		ignored_chars;
-
-		//! \brief Stores the char that triggers the code completion
-		QChar	completion_trigger;
-
 		//! \brief Configures the initial attributes of the highlighter
 		void configureAttributes(void);
 
@@ -133,12 +158,21 @@ class SyntaxHighlighter: public QSyntaxHighlighter {
 		the expression could match. Additionally this method returns a boolean indicating the if the match was successful */
 		bool isWordMatchGroup(const QString &word, const QString &group, bool use_final_expr, const QChar &lookahead_chr, int &match_idx, int &match_len);
 
+		//! \brief Parses the configuration file raising errors when the file contents are invalid
+		static shared_ptr<const Configuration> parseConfiguration(const QString &filename);
+
+		/*! \brief Returns the configuration stored in the registry for the file. The file is parsed only if it isn't
+		in the registry yet or if it was modified (date or size) since it was last parsed */
+		static shared_ptr<const Configuration> getConfiguration(const QString &filename);
+
 	public:
 		/*! \brief Install the syntax highlighter in a QPlainTextEdit. If single_line_mode is true
 		the highlighter prevents the parent text field to process line breaks. If use_custom_tab_width is true
 		the highlighter will use the same tab size as NumberedTextEdit class */
 		SyntaxHighlighter(QPlainTextEdit *parent, bool single_line_mode=false, bool use_custom_tab_width=false);
 
+		~SyntaxHighlighter(void);
+
 		//! \brief Loads a highlight configuration from a XML file
 		void loadConfiguration(const QString &filename);
 
@@ -155,6 +189,10 @@ class SyntaxHighlighter: public QSyntaxHighlighter {
 		//! \brief Sets the default font for all instances of this class
 		static void setDefaultFont(const QFont &fnt);
 
+		/*! \brief Parses again (once per file) the configurations in use and updates all the instances of this class,
+		rehighlighting their documents. Must be called after the configuration files are changed or the default font is modified */
+		static void reloadConfigurations(void);
+
 	private slots:
 		//! \brief Highlight a line of the text
 		void highlightBlock(const QString &txt);
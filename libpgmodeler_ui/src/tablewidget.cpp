@@ -35,6 +35,7 @@ TableWidget::TableWidget(QWidget *parent): BaseObjectWidget(parent, OBJ_TABLE)
 	map<QString, vector<QWidget *> > fields_map;
 	QFrame *frame=nullptr;
 	QPushButton *edt_data_tb=nullptr;
+	QStringList part_types;
 
 	Ui_TableWidget::setupUi(this);
 
@@ -52,10 +53,28 @@ TableWidget::TableWidget(QWidget *parent): BaseObjectWidget(parent, OBJ_TABLE)
 	fields_map[generateVersionsInterval(AFTER_VERSION, PgSQLVersions::PGSQL_VERSION_91)].push_back(unlogged_chk);
 	fields_map[generateVersionsInterval(AFTER_VERSION, PgSQLVersions::PGSQL_VERSION_95)].push_back(enable_rls_chk);
 	fields_map[generateVersionsInterval(AFTER_VERSION, PgSQLVersions::PGSQL_VERSION_95)].push_back(force_rls_chk);
+	fields_map[generateVersionsInterval(AFTER_VERSION, PgSQLVersions::PGSQL_VERSION_100)].push_back(partitioning_type_lbl);
 	frame=generateVersionWarningFrame(fields_map);
 	table_grid->addWidget(frame, table_grid->count()+1, 0, 1, 2);
 	frame->setParent(this);
 
+	PartitioningType::getTypes(part_types);
+	part_types.push_front(trUtf8("None"));
+	partitioning_type_cmb->addItems(part_types);
+
+	part_keys_wgt=new ElementsWidget(this);
+	partitioning_grid->addWidget(part_keys_wgt, 1, 0, 1, 2);
+
+	connect(partitioning_type_cmb, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), [&](int idx){
+		part_keys_wgt->setEnabled(idx > 0);
+	});
+
+	//Updating the columns available to the partition keys since they can be changed in the columns tab
+	connect(attributes_tbw, &QTabWidget::currentChanged, [&](int idx){
+		if(attributes_tbw->widget(idx)==partitioning_grid->parentWidget() && this->object)
+			part_keys_wgt->updateColumnsCombo();
+	});
+
 	parent_tables = new ObjectsTableWidget(ObjectsTableWidget::NO_BUTTONS, true, this);
 	parent_tables->setColumnCount(3);
 	parent_tables->setHeaderLabel(trUtf8("Name"), 0);
@@ -212,6 +231,7 @@ void TableWidget::setAttributes(DatabaseModel *model, OperationList *op_list, Sc
 		unsigned i, count;
 		Table *aux_tab=nullptr;
 		ObjectType types[]={ OBJ_COLUMN, OBJ_CONSTRAINT, OBJ_TRIGGER, OBJ_RULE, OBJ_INDEX, OBJ_POLICY };
+		vector<PartitionKey> part_keys;
 
 		if(!table)
 		{
@@ -268,6 +288,16 @@ void TableWidget::setAttributes(DatabaseModel *model, OperationList *op_list, Sc
 
 		tag_sel->setModel(this->model);
 		tag_sel->setSelectedObject(table->getTag());
+
+		part_keys=table->getPartitionKeys();
+		part_keys_wgt->setAttributes(model, table, part_keys);
+
+		if(table->isPartitioned())
+			partitioning_type_cmb->setCurrentText(~table->getPartitioningType());
+		else
+			partitioning_type_cmb->setCurrentIndex(0);
+
+		part_keys_wgt->setEnabled(table->isPartitioned());
 	}
 	catch(Exception &e)
 	{
@@ -739,6 +769,7 @@ void TableWidget::applyConfiguration(void)
 		Constraint *pk = nullptr;
 		vector<BaseRelationship *> rels;
 		vector<Column *> pk_cols;
+		vector<PartitionKey> part_keys;
 		ObjectsTableWidget *col_tab = objects_tab_map[OBJ_COLUMN];
 
 		if(!this->new_object)
@@ -754,6 +785,19 @@ void TableWidget::applyConfiguration(void)
 		table->setUnlogged(unlogged_chk->isChecked());
 		table->setTag(dynamic_cast<Tag *>(tag_sel->getSelectedObject()));
 
+		/* The current keys are removed before changing the partitioning type since the new type
+		could not accept them (e.g. LIST accepts only one key) */
+		table->removePartitionKeys();
+
+		if(partitioning_type_cmb->currentIndex() > 0)
+		{
+			part_keys_wgt->getElements(part_keys);
+			table->setPartitioningType(PartitioningType(partitioning_type_cmb->currentText()));
+			table->addPartitionKeys(part_keys);
+		}
+		else
+			table->setPartitioningType(BaseType::null);
+
 		BaseObjectWidget::applyConfiguration();
 
 		//Retrieving all columns marked as primary key
@@ -28,6 +28,7 @@
 #include "baseobjectwidget.h"
 #include "ui_tablewidget.h"
 #include "objectstablewidget.h"
+#include "elementswidget.h"
 #include "tableview.h"
 
 class TableWidget: public BaseObjectWidget, public Ui::TableWidget {
@@ -38,6 +39,9 @@ class TableWidget: public BaseObjectWidget, public Ui::TableWidget {
 
 		ObjectSelectorWidget *tag_sel;
 
+		//! \brief Widget used to handle the partition keys of the table
+		ElementsWidget *part_keys_wgt;
+
 		//! \brief Stores the objects tables used to handle columns, constraints, indexes, rules and triggers
 		map<ObjectType, ObjectsTableWidget *> objects_tab_map;
 
@@ -79,6 +79,11 @@ QStringList ValidationInfo::getErrors(void)
 	return(errors);
 }
 
+bool ValidationInfo::isPerformanceAdvice(void)
+{
+	return(val_type==MISSING_FK_INDEX || val_type==REDUNDANT_INDEX || val_type==UNINDEXED_EXPR_COLUMN);
+}
+
 bool ValidationInfo::isValid(void)
 {
 	return(((val_type==NO_UNIQUE_NAME || val_type==BROKEN_REFERENCE) && object) ||
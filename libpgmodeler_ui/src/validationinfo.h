@@ -51,8 +51,11 @@ class ValidationInfo {
 		SP_OBJ_BROKEN_REFERENCE=2,
 		BROKEN_REL_CONFIG=3,
 		MISSING_EXTENSION=4,
-		SQL_VALIDATION_ERR=5,
-		VALIDATION_ABORTED=6;
+		MISSING_FK_INDEX=5,
+		REDUNDANT_INDEX=6,
+		UNINDEXED_EXPR_COLUMN=7,
+		SQL_VALIDATION_ERR=8,
+		VALIDATION_ABORTED=9;
 
 		ValidationInfo(void);
 		ValidationInfo(unsigned val_type, BaseObject *object, vector<BaseObject *> references);
@@ -71,6 +74,10 @@ class ValidationInfo {
 		//! \brief Returns the SQL errors generated during the SQL validation
 		QStringList getErrors(void);
 
+		/*! \brief Returns if the info is a performance advice generated by the index coverage analysis
+		(MISSING_FK_INDEX, REDUNDANT_INDEX, UNINDEXED_EXPR_COLUMN). Advices don't invalidate the model */
+		bool isPerformanceAdvice(void);
+
 		/*! \brief Returns if the content of validation info is valid. To be valid
 		the info must have the object not null when it is NO_UNIQUE_NAME or BROKEN_REFERENCE,
 		and when its SQL_VALIDATION_ERR the sql error message must be set */
@@ -15,11 +15,13 @@ windows: DESTDIR = $$PWD
 
 HEADERS += src/exception.h \
            src/globalattributes.h \
-           src/pgsqlversions.h
+           src/pgsqlversions.h \
+           src/tracer.h
 
 SOURCES += src/exception.cpp \
            src/globalattributes.cpp \
-           src/pgsqlversions.cpp
+           src/pgsqlversions.cpp \
+           src/tracer.cpp
 
 # Deployment settings
 target.path = $$PRIVATELIBDIR
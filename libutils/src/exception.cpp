@@ -18,8 +18,8 @@
 #include "exception.h"
 #include <QApplication>
 
-QString Exception::messages[ERROR_COUNT][2]={
-	{"ERR_CUSTOM", QString(" ")},
+const char *Exception::messages[ERROR_COUNT][2]={
+	{"ERR_CUSTOM", " "},
 	{"ERR_ASG_PSDTYPE_COLUMN", QT_TR_NOOP("Assignment of a pseudo-type to the type of the column!")},
 	{"ERR_ASG_INV_PRECISION", QT_TR_NOOP("Assignment of a precision greater than the length of the type!")},
 	{"ERR_ASG_INV_PREC_TIMESTAMP", QT_TR_NOOP("Assignment of an invalid precision to type time, timestamp or interval. The precision in this case must be equal to or less than 6!")},
@@ -251,96 +251,111 @@ QString Exception::messages[ERROR_COUNT][2]={
 	{"ERR_NULL_PK_COLUMN", QT_TR_NOOP("The column `%1' must be `NOT NULL' because it composes the primary key of the table `%2'. You need to remove the column from the mentioned contraint in order to disable the `NOT NULL' on it!")},
 	{"ERR_ASG_INV_IDENTITY_COLUMN", QT_TR_NOOP("The identity column `%1' has an invalid data type! The data type must be `smallint', `integer' or `bigint'.")},
 	{"ERR_REF_INV_AFFECTED_CMD", QT_TR_NOOP("Reference to an invalid affected command in policy `%1'!")},
-	{"ERR_REF_INV_SPECIAL_ROLE", QT_TR_NOOP("Reference to an invalid special role in policy `%1'!")}
+	{"ERR_REF_INV_SPECIAL_ROLE", QT_TR_NOOP("Reference to an invalid special role in policy `%1'!")},
+	{"ERR_ASYNC_QUERY_RUNNING", QT_TR_NOOP("The operation can't be performed while the asynchronous command is running! Wait for its completion or cancel it first.")},
+	{"ERR_CONN_POOL_WAIT_TIMEOUT", QT_TR_NOOP("Timeout while waiting for a free connection to `%1'! The limit of `%2' simultaneous connections to this server and database was reached.")},
+	{"ERR_INV_PARTITION_KEY_COUNT", QT_TR_NOOP("The table `%1' is partitioned by `LIST' so it accepts only one partition key!")},
+	{"ERR_ASG_INV_COLUMN_PARTITION_KEY", QT_TR_NOOP("The partition key of the table `%1' references the column `%2' which doesn't belong to that table or was added by a relationship!")},
+	{"ERR_PARTITIONING_REL_NO_PART_TABLE", QT_TR_NOOP("Partitioning relationship between tables `%1' and `%2' cannot be done because the latter is not a partitioned table! Define the partitioning type and the partition keys of that table first.")},
+	{"ERR_PARTITION_TAB_DEFINED", QT_TR_NOOP("Partitioning relationship between tables `%1' and `%2' cannot be done because the first one is already a partition of `%3'! Tables can be a partition of only one partitioned table!")},
+	{"ERR_REM_PARTITION_KEY_COLUMN", QT_TR_NOOP("The column `%1' can't be removed from the table `%2' because it is referenced by the partition keys of the table!")},
+	{"ERR_PARTITIONED_TAB_NO_KEYS", QT_TR_NOOP("The table `%1' is configured as partitioned but has no partition keys!")},
+	{"ERR_ASG_INV_STORAGE_PARAM", QT_TR_NOOP("The storage parameter `%1' is not supported by objects of the type `%2'!")},
+	{"ERR_ASG_INV_STORAGE_PARAM_VALUE", QT_TR_NOOP("Assignment of an invalid value `%1' to the storage parameter `%2'! The value must be a number, a boolean or a single word.")},
+	{"ERR_ASG_INV_STATISTICS_TARGET", QT_TR_NOOP("Assignment of an invalid statistics target `%1' to the column `%2'! The value must be -1 (system default) or between 0 and 10000.")},
+	{"ERR_PARTITION_NO_BOUND_EXPR", QT_TR_NOOP("The table `%1' is a partition of `%2' but has no partition bound! Define the values accepted by the partition or configure it as the default partition.")}
 };
 
 Exception::Exception(void)
 {
-	configureException(QString(),ERR_CUSTOM,QString(),QString(),-1,QString());
+	configureException(QString(),ERR_CUSTOM,"","",-1,QString());
 }
 
-Exception::Exception(const QString &msg, const QString &method, const QString &file, int line, Exception *exception, const QString &extra_info)
+Exception::Exception(const QString &msg, const char *method, const char *file, int line, Exception *exception, const QString &extra_info)
 {
 	configureException(msg,ERR_CUSTOM, method, file, line, extra_info);
 	if(exception) addException(*exception);
 }
 
-Exception::Exception(ErrorType error_type, const QString &method, const QString &file, int line, Exception *exception, const QString &extra_info)
+Exception::Exception(ErrorType error_type, const char *method, const char *file, int line, Exception *exception, const QString &extra_info)
 {
-	/* Because the Exception class is not derived from QObject the function tr() is inefficient to translate messages
-		so the translation method is called  directly from the application specifying the
-		context (Exception) in the ts file and the text to be translated */
-	configureException(QApplication::translate("Exception",messages[error_type][ERROR_MESSAGE].toStdString().c_str(),"", -1),
-					   error_type, method, file, line, extra_info);
+	configureException(QString(), error_type, method, file, line, extra_info);
+	lazy_msg=true;
+	if(exception) addException(*exception);
+}
 
+Exception::Exception(ErrorType error_type, const QStringList &msg_args, const char *method, const char *file, int line, Exception *exception, const QString &extra_info)
+{
+	configureException(QString(), error_type, method, file, line, extra_info);
+	this->msg_args=msg_args;
+	lazy_msg=true;
 	if(exception) addException(*exception);
 }
 
-Exception::Exception(const QString &msg, ErrorType error_type, const QString &method, const QString &file, int line, Exception *exception, const QString &extra_info)
+Exception::Exception(const Exception &exception, const char *method, const char *file, int line, const QString &extra_info)
+{
+	configureException(exception.error_msg, exception.error_type, method, file, line, extra_info);
+	this->msg_args=exception.msg_args;
+	lazy_msg=exception.lazy_msg;
+	addException(exception);
+}
+
+Exception::Exception(const QString &msg, ErrorType error_type, const char *method, const char *file, int line, Exception *exception, const QString &extra_info)
 {
 	configureException(msg,error_type, method, file, line, extra_info);
 	if(exception) addException(*exception);
 }
 
-Exception::Exception(ErrorType error_type, const QString &method, const QString &file, int line, vector<Exception> &exceptions, const QString &extra_info)
+Exception::Exception(ErrorType error_type, const char *method, const char *file, int line, const vector<Exception> &exceptions, const QString &extra_info)
 {
-	vector<Exception>::iterator itr, itr_end;
+	configureException(QString(), error_type, method, file, line, extra_info);
+	lazy_msg=true;
 
-	/* Because the Exception class is not derived from QObject the function tr() is inefficient to translate messages
-		so the translation method is called  directly from the application specifying the
-		context (Exception) in the ts file and the text to be translated */
-	configureException(QApplication::translate("Exception",messages[error_type][ERROR_MESSAGE].toStdString().c_str(),"",-1),
-					   error_type, method, file, line, extra_info);
-
-	itr=exceptions.begin();
-	itr_end=exceptions.end();
-	while(itr!=itr_end)
-	{
-		addException((*itr));
-		itr++;
-	}
+	for(auto &exception : exceptions)
+		addException(exception);
 }
 
-Exception::Exception(const QString &msg, const QString &method, const QString &file, int line, vector<Exception> &exceptions, const QString &extra_info)
+Exception::Exception(const QString &msg, const char *method, const char *file, int line, const vector<Exception> &exceptions, const QString &extra_info)
 {
-	vector<Exception>::iterator itr, itr_end;
-
 	configureException(msg,ERR_CUSTOM, method, file, line, extra_info);
 
-	itr=exceptions.begin();
-	itr_end=exceptions.end();
-	while(itr!=itr_end)
-	{
-		addException((*itr));
-		itr++;
-	}
+	for(auto &exception : exceptions)
+		addException(exception);
 }
 
-Exception::Exception(const QString &msg, ErrorType error_type, const QString &method, const QString &file, int line, vector<Exception> &exceptions, const QString &extra_info)
+Exception::Exception(const QString &msg, ErrorType error_type, const char *method, const char *file, int line, const vector<Exception> &exceptions, const QString &extra_info)
 {
-	vector<Exception>::iterator itr=exceptions.begin();
-
 	configureException(msg,error_type, method, file, line, extra_info);
 
-	while(itr!=exceptions.end())
-	{
-		addException((*itr));
-		itr++;
-	}
+	for(auto &exception : exceptions)
+		addException(exception);
 }
 
-void Exception::configureException(const QString &msg, ErrorType error_type, const QString &method, const QString &file, int line, const QString &extra_info)
+void Exception::configureException(const QString &msg, ErrorType error_type, const char *method, const char *file, int line, const QString &extra_info)
 {
 	this->error_type=error_type;
 	this->error_msg=msg;
-	this->method=method;
-	this->file=file;
+	this->method=(method ? method : "");
+	this->file=(file ? file : "");
 	this->line=line;
-	this->extra_info=QString(extra_info);
+	this->extra_info=extra_info;
+	this->lazy_msg=false;
 }
 
 QString Exception::getErrorMessage(void)
 {
+	//The message of the error type is translated and formatted only when it is requested for the first time
+	if(lazy_msg)
+	{
+		error_msg=getErrorMessage(error_type);
+
+		for(auto &arg : msg_args)
+			error_msg=error_msg.arg(arg);
+
+		msg_args.clear();
+		lazy_msg=false;
+	}
+
 	return(error_msg);
 }
 
@@ -350,7 +365,7 @@ QString Exception::getErrorMessage(ErrorType error_type)
 		/* Because the Exception class is not derived from QObject the function tr() is inefficient to translate messages
 		 so the translation method is called  directly from the application specifying the
 		 context (Exception) in the ts file and the text to be translated */
-		return(QApplication::translate("Exception",messages[error_type][ERROR_MESSAGE].toStdString().c_str(),"", -1));
+		return(QApplication::translate("Exception",messages[error_type][ERROR_MESSAGE],"", -1));
 	else
 		return(QString());
 }
@@ -358,19 +373,19 @@ QString Exception::getErrorMessage(ErrorType error_type)
 QString Exception::getErrorCode(ErrorType error_type)
 {
 	if(error_type < ERROR_COUNT)
-		return(messages[error_type][ERROR_CODE]);
+		return(QString(messages[error_type][ERROR_CODE]));
 	else
 		return(QString());
 }
 
 QString Exception::getMethod(void)
 {
-	return(method);
+	return(QString(method));
 }
 
 QString Exception::getFile(void)
 {
-	return(file);
+	return(QString(file));
 }
 
 QString Exception::getLine(void)
@@ -388,29 +403,26 @@ QString Exception::getExtraInfo(void)
 	return(extra_info);
 }
 
-void Exception::addException(Exception &exception)
+void Exception::addException(const Exception &exception)
 {
-	vector<Exception>::iterator itr, itr_end;
+	/* The exception is copied only once (its nested exceptions are shared by the copy)
+	so the cost of rethrowing doesn't depend on the size of the chain */
+	this->exceptions.push_back(make_shared<const Exception>(exception));
+}
 
-	itr=exception.exceptions.begin();
-	itr_end=exception.exceptions.end();
+void Exception::appendToList(vector<Exception> &list) const
+{
+	for(auto &exception : exceptions)
+		exception->appendToList(list);
 
-	while(itr!=itr_end)
-	{
-		this->exceptions.push_back(Exception(itr->error_msg,itr->error_type,
-											 itr->method,itr->file,itr->line,nullptr,itr->extra_info));
-		itr++;
-	}
-	exception.exceptions.clear();
-	this->exceptions.push_back(Exception(exception.error_msg,exception.error_type,
-										 exception.method,exception.file,exception.line,nullptr,exception.extra_info));
+	list.push_back(*this);
+	list.back().exceptions.clear();
 }
 
 void Exception::getExceptionsList(vector<Exception> &list)
 {
-	list.assign(this->exceptions.begin(), this->exceptions.end());
-	list.push_back(Exception(this->error_msg,this->error_type,
-							 this->method,this->file,this->line,nullptr,this->extra_info));
+	list.clear();
+	appendToList(list);
 }
 
 QString Exception::getExceptionsText(void)
@@ -443,4 +455,3 @@ QString Exception::getExceptionsText(void)
 
 	return(exceptions_txt);
 }
-
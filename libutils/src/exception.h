@@ -27,10 +27,12 @@
 #define EXCEPTION_H
 
 #include <QObject>
+#include <QStringList>
 #include <exception>
 #include <signal.h>
 #include <vector>
 #include <deque>
+#include <memory>
 
 using namespace std;
 
@@ -279,19 +281,33 @@ enum ErrorType {
 	ERR_NULL_PK_COLUMN,
 	ERR_INV_IDENTITY_COLUMN,
 	ERR_REF_INV_AFFECTED_CMD,
-	ERR_REF_INV_SPECIAL_ROLE
+	ERR_REF_INV_SPECIAL_ROLE,
+	ERR_ASYNC_QUERY_RUNNING,
+	ERR_CONN_POOL_WAIT_TIMEOUT,
+	ERR_INV_PARTITION_KEY_COUNT,
+	ERR_ASG_INV_COLUMN_PARTITION_KEY,
+	ERR_PARTITIONING_REL_NO_PART_TABLE,
+	ERR_PARTITION_TAB_DEFINED,
+	ERR_REM_PARTITION_KEY_COLUMN,
+	ERR_PARTITIONED_TAB_NO_KEYS,
+	ERR_ASG_INV_STORAGE_PARAM,
+	ERR_ASG_INV_STORAGE_PARAM_VALUE,
+	ERR_ASG_INV_STATISTICS_TARGET,
+	ERR_PARTITION_NO_BOUND_EXPR
 };
 
 class Exception {
 	private:
-		static const int ERROR_COUNT=233;
+		static const int ERROR_COUNT=245;
 
 		/*! \brief Stores other exceptions before raise the 'this' exception.
-		 This structure can be used to simulate a stack trace to improve the debug */
-		vector<Exception> exceptions;
+		 This structure can be used to simulate a stack trace to improve the debug.
+		 The nested exceptions are immutable and shared among the copies of an exception, this way,
+		 rethrowing an exception doesn't copy the whole chain (see addException()) */
+		vector<shared_ptr<const Exception>> exceptions;
 
 		//! \brief Stores the error messages and codes (names of errors) in string format
-		static QString messages[ERROR_COUNT][2];
+		static const char *messages[ERROR_COUNT][2];
 
 		//! \brief Constants used to access the error details
 		static const unsigned ERROR_CODE=0,
@@ -300,38 +316,58 @@ class Exception {
 		//! \brief Error type related to the exception
 		ErrorType error_type;
 
+		/*! \brief Indicates that the error message must be generated (translated and formatted using msg_args)
+		from the error type in the first call to getErrorMessage() */
+		bool lazy_msg;
+
 		//! \brief Formated error message
 		QString error_msg,
+
+		/*! \brief Additional information (optional) may store any other
+						type of information that is interesting on attempt to resolve the error */
+		extra_info;
+
+		//! \brief Arguments used to format the message of the error type when lazy_msg is set
+		QStringList msg_args;
+
 		/*! \brief Holds the class name and method which was
 						triggered the exception. For this to be possible, at the time
 						instantiation of this class the  G++ macro __ PRETTY_FUNCTION__
-						must be passed. This macro contains the format [RETURN][CLASS]::[METHOD][PARAMS] */
-		method,
+						must be passed. This macro contains the format [RETURN][CLASS]::[METHOD][PARAMS].
+						Since the macros expand to string literals only their addresses are stored */
+		const char *method,
 
 		//! \brief File where the exception was generated (Macro __ FILE__)
-		file,
-
-		/*! \brief Additional information (optional) may store any other
-						type of information that is interesting on attempt to resolve the error */
-		extra_info;
+		*file;
 
 		//! \brief Line of file where the exception were generated (Macro __LINE__)
 		int line;
 
 		//! \brief Configures the basic attributes of exception
-		void configureException(const QString &msg, ErrorType error_type, const QString &method, const QString &file, int line, const QString &extra_info);
+		void configureException(const QString &msg, ErrorType error_type, const char *method, const char *file, int line, const QString &extra_info);
 
 		//! \brief Adds a exception to the list of exceptions
-		void addException(Exception &exception);
+		void addException(const Exception &exception);
+
+		//! \brief Appends to the list the nested exceptions (recursively) followed by the 'this' exception without its chain
+		void appendToList(vector<Exception> &list) const;
 
 	public:
 		Exception(void);
-		Exception(const QString &msg, const QString &method, const QString &file, int line, Exception *exception=nullptr, const QString &extra_info=QString());
-		Exception(const QString &msg, const QString &method, const QString &file, int line, vector<Exception> &exceptions, const QString &extra_info=QString());
-		Exception(const QString &msg, ErrorType error_type, const QString &method, const QString &file, int line, Exception *exception=nullptr, const QString &extra_info=QString());
-		Exception(const QString &msg, ErrorType error_type, const QString &method, const QString &file, int line, vector<Exception> &exceptions, const QString &extra_info=QString());
-		Exception(ErrorType error_type, const QString &method, const QString &file, int line, Exception *exception=nullptr, const QString &extra_info=QString());
-		Exception(ErrorType error_type, const QString &method, const QString &file, int line, vector<Exception> &exceptions, const QString &extra_info=QString());
+		Exception(const QString &msg, const char *method, const char *file, int line, Exception *exception=nullptr, const QString &extra_info=QString());
+		Exception(const QString &msg, const char *method, const char *file, int line, const vector<Exception> &exceptions, const QString &extra_info=QString());
+		Exception(const QString &msg, ErrorType error_type, const char *method, const char *file, int line, Exception *exception=nullptr, const QString &extra_info=QString());
+		Exception(const QString &msg, ErrorType error_type, const char *method, const char *file, int line, const vector<Exception> &exceptions, const QString &extra_info=QString());
+		Exception(ErrorType error_type, const char *method, const char *file, int line, Exception *exception=nullptr, const QString &extra_info=QString());
+		Exception(ErrorType error_type, const char *method, const char *file, int line, const vector<Exception> &exceptions, const QString &extra_info=QString());
+
+		/*! \brief Creates an exception which message is the one of the error type formatted with the provided arguments
+		(replacing %1, %2, ...). The message is translated and formatted only when getErrorMessage() is called */
+		Exception(ErrorType error_type, const QStringList &msg_args, const char *method, const char *file, int line, Exception *exception=nullptr, const QString &extra_info=QString());
+
+		/*! \brief Creates an exception that rethrows the provided one keeping its error type and its (possibly
+		not yet formatted) message. The provided exception is added to the chain of the new one */
+		Exception(const Exception &exception, const char *method, const char *file, int line, const QString &extra_info=QString());
 
 		~Exception(void){}
 		QString getErrorMessage(void);
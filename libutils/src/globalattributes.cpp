@@ -37,6 +37,8 @@ namespace GlobalAttributes {
 	BUG_REPORT_EMAIL=QString("bug@pgmodeler.io"),
 	BUG_REPORT_FILE=QString("pgmodeler%1.bug"),
 	STACKTRACE_FILE=QString(".stacktrace"),
+	STARTUP_PROFILE_FILE=QString("startup-profile.json"),
+	TRACE_FILE=QString("pgmodeler-trace.json"),
 
 	DIR_SEPARATOR=QString("/"),
 	DEFAULT_CONFS_DIR=QString("defaults"),
@@ -52,6 +52,8 @@ namespace GlobalAttributes {
 	BUG_REPORT_EMAIL,
 	BUG_REPORT_FILE,
 	STACKTRACE_FILE,
+	STARTUP_PROFILE_FILE, //! \brief File (in the temporary dir) where the trace is written when profiling the startup (see Tracer::STARTUP_PROFILE_OPT)
+	TRACE_FILE, //! \brief File (in the temporary dir) where the trace is written when tracing is enabled in the settings (see Tracer)
 
 	DIR_SEPARATOR,
 	DEFAULT_CONFS_DIR,  //! \brief Directory name which holds the default pgModeler configuration
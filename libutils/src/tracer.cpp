@@ -0,0 +1,275 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "tracer.h"
+#include "exception.h"
+#include <QThread>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QCoreApplication>
+#include <cmath>
+
+const QString Tracer::TRACE_FILE_OPT=QString("--trace-file");
+const QString Tracer::STARTUP_PROFILE_OPT=QString("--startup-profile");
+
+atomic<bool> Tracer::enabled(false);
+QMutex Tracer::mutex;
+QElapsedTimer Tracer::timer;
+vector<Tracer::TraceEvent> Tracer::events;
+map<QString, qint64> Tracer::counters;
+map<QString, Tracer::Histogram> Tracer::histograms;
+unsigned Tracer::dropped_events=0;
+map<QString, qint64> Tracer::phase_marks;
+
+Tracer::ScopedTimer::ScopedTimer(const char *category, const char *name, bool sampled)
+{
+	active=Tracer::isEnabled();
+
+	if(active)
+	{
+		this->category=category;
+		this->literal_name=name;
+		this->sampled=sampled;
+		start_time=Tracer::getTimestamp();
+	}
+}
+
+Tracer::ScopedTimer::ScopedTimer(const char *category, const QString &name, bool sampled)
+{
+	active=Tracer::isEnabled();
+
+	if(active)
+	{
+		this->category=category;
+		this->literal_name=nullptr;
+		this->name=name;
+		this->sampled=sampled;
+		start_time=Tracer::getTimestamp();
+	}
+}
+
+Tracer::ScopedTimer::~ScopedTimer(void)
+{
+	qint64 duration=0;
+	QString evnt_name;
+
+	//Events of tracers stopped while the scope was running are discarded
+	if(!active || !Tracer::isEnabled())
+		return;
+
+	duration=Tracer::getTimestamp() - start_time;
+	evnt_name=(literal_name ? QString(literal_name) : name);
+	Tracer::addEvent(category, evnt_name, start_time, duration);
+
+	if(sampled)
+		Tracer::addSample(QString("%1.%2").arg(category).arg(evnt_name), duration / 1000.0);
+}
+
+void Tracer::start(void)
+{
+	QMutexLocker locker(&mutex);
+
+	if(!timer.isValid())
+		timer.start();
+
+	events.clear();
+	counters.clear();
+	histograms.clear();
+	phase_marks.clear();
+	dropped_events=0;
+	enabled=true;
+}
+
+void Tracer::stop(void)
+{
+	enabled=false;
+}
+
+qint64 Tracer::getTimestamp(void)
+{
+	return(timer.isValid() ? timer.nsecsElapsed() / 1000 : 0);
+}
+
+void Tracer::addEvent(const char *category, const QString &name, qint64 start_time, qint64 duration)
+{
+	QMutexLocker locker(&mutex);
+	TraceEvent event;
+
+	if(events.size() >= MAX_EVENTS)
+	{
+		dropped_events++;
+		return;
+	}
+
+	event.name=name;
+	event.category=category;
+	event.phase='X';
+	event.timestamp=start_time;
+	event.duration=duration;
+	event.value=0;
+	event.thread_id=QThread::currentThreadId();
+	events.push_back(event);
+}
+
+void Tracer::markPhase(const char *category, const QString &name)
+{
+	qint64 end_time=getTimestamp(), start_time=0;
+
+	{
+		QMutexLocker locker(&mutex);
+		QString key=QString(category);
+
+		if(phase_marks.count(key))
+			start_time=phase_marks[key];
+
+		phase_marks[key]=end_time;
+	}
+
+	addEvent(category, name, start_time, end_time - start_time);
+}
+
+void Tracer::incrementCounter(const char *category, const QString &name, qint64 value)
+{
+	QMutexLocker locker(&mutex);
+	TraceEvent event;
+	QString key=QString("%1.%2").arg(category).arg(name);
+
+	counters[key]+=value;
+
+	if(events.size() >= MAX_EVENTS)
+	{
+		dropped_events++;
+		return;
+	}
+
+	event.name=key;
+	event.category=category;
+	event.phase='C';
+	event.timestamp=getTimestamp();
+	event.duration=0;
+	event.value=counters[key];
+	event.thread_id=QThread::currentThreadId();
+	events.push_back(event);
+}
+
+void Tracer::addSample(const QString &name, double value)
+{
+	QMutexLocker locker(&mutex);
+	Histogram &hist=histograms[name];
+	unsigned bucket=0;
+
+	//The bucket N stores the samples in the interval [2^(N-1), 2^N), the first one stores the samples below 1
+	if(value >= 1)
+		bucket=static_cast<unsigned>(std::floor(std::log2(value))) + 1;
+
+	if(hist.buckets.size() <= bucket)
+		hist.buckets.resize(bucket + 1, 0);
+
+	hist.buckets[bucket]++;
+	hist.min=(hist.count==0 ? value : qMin(hist.min, value));
+	hist.max=(hist.count==0 ? value : qMax(hist.max, value));
+	hist.sum+=value;
+	hist.count++;
+}
+
+void Tracer::saveTrace(const QString &filename)
+{
+	QMutexLocker locker(&mutex);
+	QJsonArray trace_events, buckets;
+	QJsonObject trace, event, args, other_data, counters_obj, histograms_obj, hist_obj;
+	map<Qt::HANDLE, int> thread_ids;
+	QFile output;
+
+	for(auto &evnt : events)
+	{
+		//Replacing the thread handles by sequential numbers (the first thread seen is usually the main one)
+		if(thread_ids.count(evnt.thread_id)==0)
+		{
+			int tid=static_cast<int>(thread_ids.size()) + 1;
+
+			thread_ids[evnt.thread_id]=tid;
+			args=QJsonObject();
+			args[QString("name")]=(tid==1 ? QString("main") : QString("worker %1").arg(tid - 1));
+			event=QJsonObject();
+			event[QString("name")]=QString("thread_name");
+			event[QString("ph")]=QString("M");
+			event[QString("pid")]=static_cast<double>(QCoreApplication::applicationPid());
+			event[QString("tid")]=tid;
+			event[QString("args")]=args;
+			trace_events.append(event);
+		}
+
+		event=QJsonObject();
+		event[QString("name")]=evnt.name;
+		event[QString("cat")]=QString(evnt.category);
+		event[QString("ph")]=QString(QChar(evnt.phase));
+		event[QString("ts")]=static_cast<double>(evnt.timestamp);
+		event[QString("pid")]=static_cast<double>(QCoreApplication::applicationPid());
+		event[QString("tid")]=thread_ids[evnt.thread_id];
+
+		if(evnt.phase=='X')
+			event[QString("dur")]=static_cast<double>(evnt.duration);
+		else
+		{
+			args=QJsonObject();
+			args[QString("value")]=static_cast<double>(evnt.value);
+			event[QString("args")]=args;
+		}
+
+		trace_events.append(event);
+	}
+
+	for(auto &itr : counters)
+		counters_obj[itr.first]=static_cast<double>(itr.second);
+
+	for(auto &itr : histograms)
+	{
+		buckets=QJsonArray();
+
+		for(auto &count : itr.second.buckets)
+			buckets.append(static_cast<int>(count));
+
+		hist_obj=QJsonObject();
+		hist_obj[QString("count")]=static_cast<int>(itr.second.count);
+		hist_obj[QString("min")]=itr.second.min;
+		hist_obj[QString("max")]=itr.second.max;
+		hist_obj[QString("avg")]=(itr.second.count > 0 ? itr.second.sum / itr.second.count : 0);
+		hist_obj[QString("log2_buckets")]=buckets;
+		histograms_obj[itr.first]=hist_obj;
+	}
+
+	other_data[QString("counters")]=counters_obj;
+	other_data[QString("histograms")]=histograms_obj;
+	other_data[QString("dropped_events")]=static_cast<int>(dropped_events);
+
+	trace[QString("traceEvents")]=trace_events;
+	trace[QString("displayTimeUnit")]=QString("ms");
+	trace[QString("otherData")]=other_data;
+
+	output.setFileName(filename);
+	output.open(QFile::WriteOnly | QFile::Truncate);
+
+	if(!output.isOpen())
+		throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(filename),
+										ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	output.write(QJsonDocument(trace).toJson(QJsonDocument::Compact));
+	output.close();
+}
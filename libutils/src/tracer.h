@@ -0,0 +1,175 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libutils
+\class Tracer
+\brief Collects timing events, counters and histograms of the main operations (model loading/saving, code generation,
+catalog queries, export, import and diff) and writes them in the Chrome trace event format (JSON) so they can be inspected
+in chrome://tracing or similar tools. The tracer is enabled through the --trace-file command line option (GUI and CLI),
+the --startup-profile option (GUI) or the general settings and the trace is written when the tracer is stopped.
+\note The instrumentation is done through the TRACE_* macros declared below which cost a single flag check when the
+tracer is disabled. Building with NO_TRACING defined (running qmake with NO_TRACING=true) removes the macros completely.
+All methods are thread safe.
+*/
+
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <QString>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <atomic>
+#include <vector>
+#include <map>
+
+using namespace std;
+
+class Tracer {
+	public:
+		/*! \brief Registers a complete event with the time elapsed between its creation and destruction. When sampled is true
+		the duration (in miliseconds) is also added to the histogram named category.name */
+		class ScopedTimer {
+			private:
+				const char *category,
+
+				//! \brief Name given as a literal, only converted to QString when the event is registered
+				*literal_name;
+
+				QString name;
+				qint64 start_time;
+				bool active, sampled;
+
+			public:
+				ScopedTimer(const char *category, const char *name, bool sampled=false);
+				ScopedTimer(const char *category, const QString &name, bool sampled=false);
+				~ScopedTimer(void);
+		};
+
+	private:
+		//! \brief Stores a single event. The phase follows the trace format: X (complete event) or C (counter)
+		struct TraceEvent {
+			QString name;
+			const char *category;
+			char phase;
+			qint64 timestamp, duration, value;
+			Qt::HANDLE thread_id;
+		};
+
+		//! \brief Stores the statistics of a histogram and the amount of samples in each power of two bucket
+		struct Histogram {
+			unsigned count;
+			double min, max, sum;
+			vector<unsigned> buckets;
+
+			Histogram(void)
+			{
+				count=0;
+				min=max=sum=0;
+			}
+		};
+
+		static atomic<bool> enabled;
+
+		static QMutex mutex;
+
+		//! \brief Reference clock of all events, started when the tracer is started for the first time
+		static QElapsedTimer timer;
+
+		static vector<TraceEvent> events;
+
+		//! \brief Current value of the counters (the keys are in the form category.name)
+		static map<QString, qint64> counters;
+
+		static map<QString, Histogram> histograms;
+
+		//! \brief Amount of events discarded after reaching MAX_EVENTS
+		static unsigned dropped_events;
+
+		//! \brief Time (in microseconds) of the last phase registered in each category (see markPhase())
+		static map<QString, qint64> phase_marks;
+
+	public:
+		//! \brief Command line option that enables the tracer. The option requires the output file
+		static const QString TRACE_FILE_OPT;
+
+		/*! \brief Command line option that enables the tracer in order to profile the startup (GUI only). Unless TRACE_FILE_OPT
+		is also used the trace is written to the file GlobalAttributes::STARTUP_PROFILE_FILE in the temporary directory */
+		static const QString STARTUP_PROFILE_OPT;
+
+		/*! \brief Maximum amount of events stored. Counters and histograms are still updated
+		after reaching this limit but no new event is recorded */
+		static const unsigned MAX_EVENTS=2000000;
+
+		//! \brief Discards all the data collected so far and enables the tracer
+		static void start(void);
+
+		//! \brief Disables the tracer keeping the collected data so it can be saved
+		static void stop(void);
+
+		static bool isEnabled(void)
+		{
+			return(enabled.load(std::memory_order_relaxed));
+		}
+
+		//! \brief Returns the current time of the reference clock in microseconds
+		static qint64 getTimestamp(void);
+
+		//! \brief Registers a complete event (times in microseconds). Usually called by ScopedTimer
+		static void addEvent(const char *category, const QString &name, qint64 start_time, qint64 duration);
+
+		/*! \brief Registers a complete event spanning from the previous phase of the same category (or from the first start
+		of the tracer) until now. Used to time sequential phases that don't fit in a single scope, like the startup ones */
+		static void markPhase(const char *category, const QString &name);
+
+		//! \brief Increments the counter registering its new value in the trace
+		static void incrementCounter(const char *category, const QString &name, qint64 value=1);
+
+		//! \brief Adds a sample to the histogram with the specified name
+		static void addSample(const QString &name, double value);
+
+		/*! \brief Writes the collected data to the file. The events are written in the traceEvents array while
+		the final value of counters and the histograms are written in the otherData object */
+		static void saveTrace(const QString &filename);
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+
+#ifndef NO_TRACING
+	//! \brief Measures the time spent from this point until the end of the current scope
+	#define TRACE_SCOPE(category, name) Tracer::ScopedTimer TRACE_CONCAT(trace_scope_, __LINE__)(category, name)
+
+	//! \brief Same as TRACE_SCOPE but also adds the duration to the histogram category.name
+	#define TRACE_SCOPE_SAMPLED(category, name) Tracer::ScopedTimer TRACE_CONCAT(trace_scope_, __LINE__)(category, name, true)
+
+	#define TRACE_COUNTER(category, name, value) do { if(Tracer::isEnabled()) Tracer::incrementCounter(category, name, value); } while(0)
+
+	#define TRACE_SAMPLE(name, value) do { if(Tracer::isEnabled()) Tracer::addSample(name, value); } while(0)
+
+	//! \brief Registers the time spent since the previous phase of the category (see Tracer::markPhase())
+	#define TRACE_PHASE(category, name) do { if(Tracer::isEnabled()) Tracer::markPhase(category, name); } while(0)
+#else
+	#define TRACE_SCOPE(category, name)
+	#define TRACE_SCOPE_SAMPLED(category, name)
+	#define TRACE_COUNTER(category, name, value) do { } while(0)
+	#define TRACE_SAMPLE(name, value) do { } while(0)
+	#define TRACE_PHASE(category, name) do { } while(0)
+#endif
+
+#endif
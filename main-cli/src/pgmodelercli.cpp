@@ -75,6 +75,10 @@ const QString PgModelerCLI::NO_SEQUENCE_REUSE=QString("--no-sequence-reuse");
 const QString PgModelerCLI::NO_CASCADE_DROP_TRUNC=QString("--no-cascade");
 const QString PgModelerCLI::NO_FORCE_OBJ_RECREATION=QString("--no-force-recreation");
 const QString PgModelerCLI::NO_UNMOD_OBJ_RECREATION=QString("--no-unmod-recreation");
+const QString PgModelerCLI::LOW_LOCK_MODE=QString("--low-lock");
+const QString PgModelerCLI::LOCK_TIMEOUT=QString("--lock-timeout");
+const QString PgModelerCLI::STMT_TIMEOUT=QString("--stmt-timeout");
+const QString PgModelerCLI::TRACE_FILE=QString("--trace-file");
 
 const QString PgModelerCLI::TAG_EXPR=QString("<%1");
 const QString PgModelerCLI::END_TAG_EXPR=QString("</%1");
@@ -150,7 +154,7 @@ PgModelerCLI::PgModelerCLI(int argc, char **argv) :  QApplication(argc, argv)
 				connect(model, SIGNAL(s_objectAdded(BaseObject*)), this, SLOT(handleObjectAddition(BaseObject *)));
 				connect(model, SIGNAL(s_objectRemoved(BaseObject*)), this, SLOT(handleObjectRemoval(BaseObject *)));
 
-				//Creates a scene to
+				//Creates a scene to (the objects style is loaded by the scene itself)
 				scene=new ObjectsScene;
 				scene->setParent(this);
 				scene->setSceneRect(QRectF(0,0,2000,2000));
@@ -158,9 +162,6 @@ PgModelerCLI::PgModelerCLI(int argc, char **argv) :  QApplication(argc, argv)
 				//Load the general configuration including grid and delimiter options
 				GeneralConfigWidget conf_wgt;
 				conf_wgt.loadConfiguration();
-
-				//Load the objects styles
-				BaseObjectView::loadObjectsStyle();
 			}
 
 			if(parsed_opts.count(EXPORT_TO_DBMS) || parsed_opts.count(IMPORT_DB) || parsed_opts.count(DIFF))
@@ -284,6 +285,10 @@ void PgModelerCLI::initializeOptions(void)
 	long_opts[NO_CASCADE_DROP_TRUNC]=false;
 	long_opts[NO_FORCE_OBJ_RECREATION]=false;
 	long_opts[NO_UNMOD_OBJ_RECREATION]=false;
+	long_opts[LOW_LOCK_MODE]=false;
+	long_opts[LOCK_TIMEOUT]=true;
+	long_opts[STMT_TIMEOUT]=true;
+	long_opts[TRACE_FILE]=true;
 
 	short_opts[INPUT]=QString("-if");
 	short_opts[OUTPUT]=QString("-of");
@@ -335,6 +340,10 @@ void PgModelerCLI::initializeOptions(void)
 	short_opts[NO_CASCADE_DROP_TRUNC]=QString("-nd");
 	short_opts[NO_FORCE_OBJ_RECREATION]=QString("-nf");
 	short_opts[NO_UNMOD_OBJ_RECREATION]=QString("-nu");
+	short_opts[LOW_LOCK_MODE]=QString("-ll");
+	short_opts[LOCK_TIMEOUT]=QString("-lt");
+	short_opts[STMT_TIMEOUT]=QString("-st");
+	short_opts[TRACE_FILE]=QString("-tf");
 }
 
 bool PgModelerCLI::isOptionRecognized(QString &op, bool &accepts_val)
@@ -387,6 +396,7 @@ void PgModelerCLI::showMenu(void)
 	out << trUtf8("  %1, %2\t\t\t    Compares a model and a database or two databases generating the SQL script to synch the latter in relation to the first.").arg(short_opts[DIFF]).arg(DIFF) << endl;
 	out << trUtf8("  %1, %2\t\t    Force the PostgreSQL version of generated SQL code.").arg(short_opts[PGSQL_VER]).arg(PGSQL_VER) << endl;
 	out << trUtf8("  %1, %2\t\t\t    Silent execution. Only critical messages and errors are shown during process.").arg(short_opts[SILENT]).arg(SILENT) << endl;
+	out << trUtf8("  %1, %2 [FILE]\t    Records the time spent in each step of the operation and writes it to a Chrome trace (JSON) file.").arg(short_opts[TRACE_FILE]).arg(TRACE_FILE) << endl;
 	out << trUtf8("  %1, %2\t\t\t    Show this help menu.").arg(short_opts[HELP]).arg(HELP) << endl;
 	out << endl;
 	out << trUtf8("Connection options: ") << endl;
@@ -433,6 +443,9 @@ void PgModelerCLI::showMenu(void)
 	out << trUtf8("  %1, %2\t    Don't reuse sequences on serial columns. Drop the old sequence assigned to a serial column and creates a new one.").arg(short_opts[NO_SEQUENCE_REUSE]).arg(NO_SEQUENCE_REUSE) << endl;
 	out << trUtf8("  %1, %2\t    Don't force the recreation of objects. Avoids the usage of a DROP and CREATE commands to create a new version of the objects.").arg(short_opts[NO_FORCE_OBJ_RECREATION]).arg(NO_FORCE_OBJ_RECREATION) << endl;
 	out << trUtf8("  %1, %2\t    Don't recreate the unmodifiable objects. These objects are the ones which can't be changed via ALTER command.").arg(short_opts[NO_UNMOD_OBJ_RECREATION]).arg(NO_UNMOD_OBJ_RECREATION) << endl;
+	out << trUtf8("  %1, %2\t\t    Generate low-lock commands: indexes created/dropped concurrently outside the transaction block, constraints created as NOT VALID and validated later.").arg(short_opts[LOW_LOCK_MODE]).arg(LOW_LOCK_MODE) << endl;
+	out << trUtf8("  %1, %2 [MSECS]\t    The lock_timeout applied to the commands in low-lock mode (default: %3). Zero disables the timeout.").arg(short_opts[LOCK_TIMEOUT]).arg(LOCK_TIMEOUT).arg(ModelsDiffHelper::DEFAULT_LOCK_TIMEOUT) << endl;
+	out << trUtf8("  %1, %2 [MSECS]\t    The statement_timeout applied to the transaction block in low-lock mode (default: %3). Zero disables the timeout.").arg(short_opts[STMT_TIMEOUT]).arg(STMT_TIMEOUT).arg(ModelsDiffHelper::DEFAULT_STMT_TIMEOUT) << endl;
 	out << endl;
 
 #ifndef Q_OS_MAC
@@ -579,6 +592,9 @@ int PgModelerCLI::exec(void)
 		{
 			printMessage(QString("\npgModeler %1 %2").arg(GlobalAttributes::PGMODELER_VERSION).arg(trUtf8(" command line interface.")));
 
+			if(parsed_opts.count(TRACE_FILE))
+				Tracer::start();
+
 			if(parsed_opts.count(FIX_MODEL))
 				fixModel();
 			else if(parsed_opts.count(DBM_MIME_TYPE))
@@ -589,16 +605,35 @@ int PgModelerCLI::exec(void)
 				diffModelDatabase();
 			else
 				exportModel();
+
+			saveTrace();
 		}
 
 		return(0);
 	}
 	catch(Exception &e)
 	{
+		//The trace is also written on failures so the time spent until the error can be inspected
+		try
+		{
+			saveTrace();
+		}
+		catch(Exception &){}
+
 		throw e;
 	}
 }
 
+void PgModelerCLI::saveTrace(void)
+{
+	if(!Tracer::isEnabled())
+		return;
+
+	Tracer::stop();
+	Tracer::saveTrace(parsed_opts[TRACE_FILE]);
+	printMessage(trUtf8("Trace written to `%1'.").arg(parsed_opts[TRACE_FILE]));
+}
+
 void PgModelerCLI::updateProgress(int progress, QString msg, ObjectType)
 {
 	if(progress > 0)
@@ -1306,6 +1341,8 @@ void PgModelerCLI::diffModelDatabase(void)
 {
 	DatabaseModel *model_aux = new DatabaseModel();
 	QString dbname;
+	unsigned lock_timeout=ModelsDiffHelper::DEFAULT_LOCK_TIMEOUT,
+			stmt_timeout=ModelsDiffHelper::DEFAULT_STMT_TIMEOUT;
 
 	printMessage(trUtf8("Starting diff process..."));
 
@@ -1343,6 +1380,15 @@ void PgModelerCLI::diffModelDatabase(void)
 	diff_hlp.setDiffOption(ModelsDiffHelper::OPT_PRESERVE_DB_NAME, !parsed_opts.count(RENAME_DB));
 	diff_hlp.setDiffOption(ModelsDiffHelper::OPT_DONT_DROP_MISSING_OBJS, !parsed_opts.count(DROP_MISSING_OBJS));
 	diff_hlp.setDiffOption(ModelsDiffHelper::OPT_DROP_MISSING_COLS_CONSTR, !parsed_opts.count(FORCE_DROP_COLS_CONSTRS));
+	diff_hlp.setDiffOption(ModelsDiffHelper::OPT_LOW_LOCK_MODE, parsed_opts.count(LOW_LOCK_MODE));
+
+	if(parsed_opts.count(LOCK_TIMEOUT))
+		lock_timeout=parsed_opts[LOCK_TIMEOUT].toUInt();
+
+	if(parsed_opts.count(STMT_TIMEOUT))
+		stmt_timeout=parsed_opts[STMT_TIMEOUT].toUInt();
+
+	diff_hlp.setLowLockTimeouts(lock_timeout, stmt_timeout);
 
 	if(!parsed_opts[PGSQL_VER].isEmpty())
 		diff_hlp.setPgSQLVersion(parsed_opts[PGSQL_VER]);
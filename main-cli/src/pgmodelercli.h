@@ -38,6 +38,7 @@
 #include "generalconfigwidget.h"
 #include "databaseimporthelper.h"
 #include "modelsdiffhelper.h"
+#include "tracer.h"
 
 class PgModelerCLI: public QApplication {
 	private:
@@ -157,6 +158,10 @@ class PgModelerCLI: public QApplication {
 		NO_CASCADE_DROP_TRUNC,
 		NO_FORCE_OBJ_RECREATION,
 		NO_UNMOD_OBJ_RECREATION,
+		LOW_LOCK_MODE,
+		LOCK_TIMEOUT,
+		STMT_TIMEOUT,
+		TRACE_FILE,
 
 		TAG_EXPR,
 		END_TAG_EXPR,
@@ -211,6 +216,9 @@ class PgModelerCLI: public QApplication {
 
 		void printMessage(const QString &msg);
 
+		//! \brief Stops the tracing (if enabled via --trace-file) and writes the collected data to the specified file
+		void saveTrace(void);
+
 	public:
 		PgModelerCLI(int argc, char **argv);
 		~PgModelerCLI(void);
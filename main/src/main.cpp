@@ -18,6 +18,7 @@
 
 #include "application.h"
 #include "mainwindow.h"
+#include "tracer.h"
 
 #ifndef Q_OS_WIN
 #include "execinfo.h"
@@ -85,8 +86,23 @@ void startCrashHandler(int signal)
 
 int main(int argc, char **argv)
 {
+	QString trace_file;
+	bool profile_startup=false;
+
 	try
 	{
+		//The tracing is started before anything else so the startup phases are also registered in the trace
+		for(int i=0; i < argc; i++)
+		{
+			if(QString(argv[i])==Tracer::TRACE_FILE_OPT && i < argc - 1 && trace_file.isEmpty())
+				trace_file=QString(argv[i + 1]);
+			else if(QString(argv[i])==Tracer::STARTUP_PROFILE_OPT)
+				profile_startup=true;
+		}
+
+		if(!trace_file.isEmpty() || profile_startup)
+			Tracer::start();
+
 		/* Registering the below classes as metatypes in order to make
 	them liable to be sent through signal parameters. */
 		qRegisterMetaType<ObjectType>("ObjectType");
@@ -118,6 +134,8 @@ int main(int argc, char **argv)
 		if(!using_style)
 			app.setStyle(GlobalAttributes::DEFAULT_QT_STYLE);
 
+		TRACE_PHASE("startup", QString("application setup (translations, ui style)"));
+
 		//Loading the application splash screen
 		QSplashScreen splash;
 		QPixmap pix(QPixmap(QString(":imagens/imagens/pgmodeler_splash.png")));
@@ -125,6 +143,7 @@ int main(int argc, char **argv)
 		splash.setMask(pix.mask());
 		splash.show();
 		app.processEvents();
+		TRACE_PHASE("startup", QString("splash screen"));
 
 		//Creates the main form
 		MainWindow fmain;
@@ -133,10 +152,19 @@ int main(int argc, char **argv)
 #ifndef Q_OS_MAC
 		QStringList params=app.arguments();
 		params.pop_front();
+		params.removeAll(Tracer::STARTUP_PROFILE_OPT);
+
+		if(!trace_file.isEmpty())
+		{
+			params.removeAt(params.indexOf(Tracer::TRACE_FILE_OPT) + 1);
+			params.removeAll(Tracer::TRACE_FILE_OPT);
+		}
 
 		//If the user specifies a list of files to be loaded
 		if(!params.isEmpty())
 			fmain.loadModels(params);
+
+		TRACE_PHASE("startup", QString("command line models"));
 #endif
 
 		fmain.show();
@@ -144,6 +172,17 @@ int main(int argc, char **argv)
 		res=app.exec();
 		app.closeAllWindows();
 
+		//Writing the trace of the session (tracing is enabled via command line or in the general settings)
+		if(Tracer::isEnabled())
+		{
+			if(trace_file.isEmpty())
+				trace_file=GlobalAttributes::TEMPORARY_DIR + GlobalAttributes::DIR_SEPARATOR +
+									 (profile_startup ? GlobalAttributes::STARTUP_PROFILE_FILE : GlobalAttributes::TRACE_FILE);
+
+			Tracer::stop();
+			Tracer::saveTrace(trace_file);
+		}
+
 		return(res);
 	}
 	catch(Exception &e)
@@ -23,6 +23,9 @@ defined(DEMO_VERSION, var): DEFINES+=DEMO_VERSION
 # Setting up the flag passed to compiler to disable all code related to update checking
 defined(NO_UPDATE_CHECK, var): DEFINES+=NO_UPDATE_CHECK
 
+# Setting up the flag passed to compiler to remove all the instrumentation code (see Tracer)
+defined(NO_TRACING, var): DEFINES+=NO_TRACING
+
 # Properly defining build number constant
 unix {
  BUILDNUM=$$system("date '+%Y%m%d'")
@@ -0,0 +1,206 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "databasemodel.h"
+#include "flatattribsmap.h"
+
+/* Compares the lookups on attribs_map against FlatAttribsMap and measures the full model
+SQL generation (which uses FlatAttribsMap inside SchemaParser). To compare the code generation
+before and after the flat container run generateModelSQL() against the previous revision too. */
+class AttribsMapBenchmark: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Returns a set of attributes similar to the ones used to generate the code of a table
+		attribs_map getSampleAttributes(void);
+
+		//! \brief Returns the keys looked up by the benchmarks (including some unknown ones)
+		QStringList getLookupKeys(void);
+
+	private slots:
+		void flatMapMatchesStdMap(void);
+		void stdMapLookup(void);
+		void flatMapLookup(void);
+		void flatMapInternedLookup(void);
+		void stdMapCopy(void);
+		void flatMapCopy(void);
+		void generateModelSQL(void);
+};
+
+attribs_map AttribsMapBenchmark::getSampleAttributes(void)
+{
+	attribs_map attribs;
+	QString keys[]={ ParsersAttributes::NAME, ParsersAttributes::SCHEMA, ParsersAttributes::OWNER,
+									 ParsersAttributes::TABLESPACE, ParsersAttributes::COMMENT, ParsersAttributes::COLUMNS,
+									 ParsersAttributes::CONSTRAINTS, ParsersAttributes::OIDS, ParsersAttributes::UNLOGGED,
+									 ParsersAttributes::RLS_ENABLED, ParsersAttributes::RLS_FORCED, ParsersAttributes::ANCESTOR_TABLE,
+									 ParsersAttributes::COPY_TABLE, ParsersAttributes::TAG, ParsersAttributes::PROTECTED,
+									 ParsersAttributes::SQL_DISABLED, ParsersAttributes::APPENDED_SQL, ParsersAttributes::PREPENDED_SQL,
+									 ParsersAttributes::SIGNATURE, ParsersAttributes::SQL_OBJECT, ParsersAttributes::DROP,
+									 ParsersAttributes::DECL_IN_TABLE, ParsersAttributes::REDUCED_FORM, ParsersAttributes::POSITION,
+									 ParsersAttributes::INITIAL_DATA, ParsersAttributes::GEN_ALTER_CMDS, ParsersAttributes::FADED_OUT,
+									 ParsersAttributes::HIDE_EXT_ATTRIBS, ParsersAttributes::PERMISSION, ParsersAttributes::ALIAS };
+
+	for(auto &key : keys)
+		attribs[key]=QString("value_of_%1").arg(key);
+
+	return(attribs);
+}
+
+QStringList AttribsMapBenchmark::getLookupKeys(void)
+{
+	QStringList keys;
+
+	for(auto &attr : getSampleAttributes())
+		keys.push_back(attr.first);
+
+	keys.push_back(QString("unknown-attribute-a"));
+	keys.push_back(QString("unknown-attribute-b"));
+	return(keys);
+}
+
+void AttribsMapBenchmark::flatMapMatchesStdMap(void)
+{
+	attribs_map attribs=getSampleAttributes();
+	FlatAttribsMap flat_attribs(attribs);
+
+	QCOMPARE(flat_attribs.size(), static_cast<unsigned>(attribs.size()));
+	QCOMPARE(flat_attribs.toAttribsMap() == attribs, true);
+
+	flat_attribs.erase(ParsersAttributes::NAME);
+	attribs.erase(ParsersAttributes::NAME);
+	QCOMPARE(flat_attribs.count(ParsersAttributes::NAME), 0u);
+	QCOMPARE(flat_attribs.toAttribsMap() == attribs, true);
+
+	flat_attribs[ParsersAttributes::NAME]=QString("foo");
+	QCOMPARE(flat_attribs.value(ParsersAttributes::NAME), QString("foo"));
+
+	flat_attribs.clear();
+	QCOMPARE(flat_attribs.empty(), true);
+	QCOMPARE(flat_attribs.count(ParsersAttributes::SCHEMA), 0u);
+}
+
+void AttribsMapBenchmark::stdMapLookup(void)
+{
+	attribs_map attribs=getSampleAttributes();
+	QStringList keys=getLookupKeys();
+	unsigned found=0;
+
+	QBENCHMARK
+	{
+		for(auto &key : keys)
+		{
+			if(attribs.count(key) && !attribs[key].isEmpty())
+				found++;
+		}
+	}
+
+	QVERIFY(found > 0);
+}
+
+void AttribsMapBenchmark::flatMapLookup(void)
+{
+	FlatAttribsMap attribs(getSampleAttributes());
+	QStringList keys=getLookupKeys();
+	unsigned found=0;
+
+	QBENCHMARK
+	{
+		for(auto &key : keys)
+		{
+			if(attribs.count(key) && !attribs[key].isEmpty())
+				found++;
+		}
+	}
+
+	QVERIFY(found > 0);
+}
+
+void AttribsMapBenchmark::flatMapInternedLookup(void)
+{
+	FlatAttribsMap attribs(getSampleAttributes());
+	vector<AttributeKey> keys;
+	unsigned found=0;
+
+	//Interning the names once, as SchemaParser does for each attribute extracted from the schema file
+	for(auto &key : getLookupKeys())
+		keys.push_back(AttributeKey(key));
+
+	QBENCHMARK
+	{
+		for(auto &key : keys)
+		{
+			if(attribs.count(key) && !attribs[key].isEmpty())
+				found++;
+		}
+	}
+
+	QVERIFY(found > 0);
+}
+
+void AttribsMapBenchmark::stdMapCopy(void)
+{
+	attribs_map attribs=getSampleAttributes(), copy;
+
+	QBENCHMARK
+	{
+		copy=attribs;
+	}
+
+	QCOMPARE(copy.size(), attribs.size());
+}
+
+void AttribsMapBenchmark::flatMapCopy(void)
+{
+	attribs_map attribs=getSampleAttributes();
+	FlatAttribsMap copy;
+
+	QBENCHMARK
+	{
+		copy=attribs;
+	}
+
+	QCOMPARE(copy.size(), static_cast<unsigned>(attribs.size()));
+}
+
+void AttribsMapBenchmark::generateModelSQL(void)
+{
+	DatabaseModel dbmodel;
+	QString input=SAMPLESDIR + GlobalAttributes::DIR_SEPARATOR + QString("pagila.dbm"), sql;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+		dbmodel.loadModel(input);
+
+		QBENCHMARK
+		{
+			sql=dbmodel.getCodeDefinition(SchemaParser::SQL_DEFINITION);
+		}
+
+		QCOMPARE(sql.isEmpty(), false);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(AttribsMapBenchmark)
+#include "attribsmapbenchmark.moc"
@@ -18,6 +18,8 @@
 
 #include <QtTest/QtTest>
 #include "databasemodel.h"
+#include "operationlist.h"
+#include "objectsearchindex.h"
 
 class DatabaseModelTest: public QObject {
 	private:
@@ -26,6 +28,10 @@ class DatabaseModelTest: public QObject {
 	private slots:
 		void saveObjectsMetadata(void);
 		void loadObjectsMetadata(void);
+		void saveAndLoadStorageParameters(void);
+		void findColumnAfterUndoRename(void);
+		void createObjectsFromRecords(void);
+		void searchIndexFollowsChanges(void);
 };
 
 void DatabaseModelTest::saveObjectsMetadata(void)
@@ -74,5 +80,253 @@ void DatabaseModelTest::loadObjectsMetadata(void)
 	}
 }
 
+void DatabaseModelTest::saveAndLoadStorageParameters(void)
+{
+	DatabaseModel dbmodel, loaded_model;
+	QTextStream out(stdout);
+	QString output=QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DIR_SEPARATOR + QString("storage_params.dbm");
+	Table *table=nullptr;
+	Column *column=nullptr;
+	Index *index=nullptr;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+
+		table=new Table;
+		table->setName(QString("tab_storage"));
+		table->setSchema(dbmodel.getSchema(QString("public")));
+		table->setStorageParameters(QString("fillfactor=70,autovacuum_enabled=false"));
+
+		column=new Column;
+		column->setName(QString("col_storage"));
+		column->setType(PgSQLType(QString("text")));
+		column->setStatisticsTarget(500);
+		column->setStorageType(StorageType(QString("external")));
+		column->setStorageParameter(QString("n_distinct"), QString("100"));
+		table->addObject(column);
+
+		index=new Index;
+		index->setName(QString("idx_storage"));
+		index->addIndexElement(column, nullptr, nullptr, false, false, false);
+		index->setIndexingType(IndexingType(QString("gin")));
+		index->setFillFactor(80);
+		index->setStorageParameter(QString("gin_pending_list_limit"), QString("512"));
+		table->addObject(index);
+
+		dbmodel.addTable(table);
+		dbmodel.saveModel(output, SchemaParser::XML_DEFINITION);
+
+		loaded_model.createSystemObjects(false);
+		loaded_model.loadModel(output);
+
+		table=loaded_model.getTable(QString("public.tab_storage"));
+		QVERIFY(table!=nullptr);
+		QCOMPARE(table->getStorageParameter(QString("fillfactor")), QString("70"));
+		QCOMPARE(table->getStorageParameter(QString("autovacuum_enabled")), QString("false"));
+
+		column=table->getColumn(QString("col_storage"));
+		QVERIFY(column!=nullptr);
+		QCOMPARE(column->getStatisticsTarget(), 500);
+		QCOMPARE(~column->getStorageType(), QString("external"));
+		QCOMPARE(column->getStorageParameter(QString("n_distinct")), QString("100"));
+
+		index=table->getIndex(QString("idx_storage"));
+		QVERIFY(index!=nullptr);
+		QCOMPARE(index->getFillFactor(), 80u);
+		QCOMPARE(index->getStorageParameter(QString("gin_pending_list_limit")), QString("512"));
+	}
+	catch (Exception &e)
+	{
+		out << e.getExceptionsText() << endl;
+		QCOMPARE(false, true);
+	}
+}
+
+void DatabaseModelTest::findColumnAfterUndoRename(void)
+{
+	DatabaseModel dbmodel;
+	OperationList op_list(&dbmodel);
+	QTextStream out(stdout);
+	Table *table=nullptr;
+	Column *column=nullptr;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+
+		table=new Table;
+		table->setName(QString("tab_rename"));
+		table->setSchema(dbmodel.getSchema(QString("public")));
+
+		column=new Column;
+		column->setName(QString("col_a"));
+		column->setType(PgSQLType(QString("integer")));
+		table->addObject(column);
+		dbmodel.addTable(table);
+
+		//Creating the name index of the columns before the modification
+		QCOMPARE(table->getColumn(QString("col_a")), column);
+
+		op_list.registerObject(column, Operation::OBJECT_MODIFIED, -1, table);
+		column->setName(QString("col_b"));
+		QCOMPARE(table->getColumn(QString("col_b")), column);
+		QVERIFY(table->getColumn(QString("col_a"))==nullptr);
+
+		//Undoing the rename restores the name through the assignment operator and not through setName()
+		op_list.undoOperation();
+		QCOMPARE(column->getName(), QString("col_a"));
+		QCOMPARE(table->getColumn(QString("col_a")), column);
+		QVERIFY(table->getColumn(QString("col_b"))==nullptr);
+
+		op_list.redoOperation();
+		QCOMPARE(table->getColumn(QString("col_b")), column);
+		QVERIFY(table->getColumn(QString("col_a"))==nullptr);
+	}
+	catch (Exception &e)
+	{
+		out << e.getExceptionsText() << endl;
+		QCOMPARE(false, true);
+	}
+}
+
+void DatabaseModelTest::createObjectsFromRecords(void)
+{
+	DatabaseModel dbmodel;
+	QTextStream out(stdout);
+	Table *table=nullptr;
+	Column *column=nullptr;
+	Index *index=nullptr;
+	Constraint *constr=nullptr;
+	View *view=nullptr;
+	Type *type=nullptr;
+	attribs_map attribs;
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+
+		attribs={{ ParsersAttributes::NAME, QString("tab_record") }, { ParsersAttributes::SCHEMA, QString("public") }};
+		table=dbmodel.createTable(attribs);
+		dbmodel.addTable(table);
+
+		attribs={{ ParsersAttributes::NAME, QString("id") }, { ParsersAttributes::TYPE, QString("integer") }};
+		column=dbmodel.createColumn(attribs);
+		table->addObject(column);
+
+		attribs={{ ParsersAttributes::NAME, QString("tab_record_pk") }, { ParsersAttributes::TYPE, ParsersAttributes::PK_CONSTR },
+						 { ParsersAttributes::TABLE, QString("public.tab_record") }, { ParsersAttributes::COMMENT, QString("primary key") }};
+		constr=dbmodel.createConstraint(attribs, nullptr);
+		QCOMPARE(constr->getParentTable(), dynamic_cast<BaseTable *>(table));
+		QCOMPARE(constr->getComment(), QString("primary key"));
+		QVERIFY(constr->getConstraintType()==ConstraintType::primary_key);
+		constr->addColumn(column, Constraint::SOURCE_COLS);
+		table->addConstraint(constr);
+
+		attribs={{ ParsersAttributes::NAME, QString("idx_record") }, { ParsersAttributes::TABLE, QString("public.tab_record") },
+						 { ParsersAttributes::UNIQUE, ParsersAttributes::_TRUE_ }, { ParsersAttributes::INDEX_TYPE, QString("btree") },
+						 { ParsersAttributes::FACTOR, QString("80") }, { ParsersAttributes::PREDICATE, QString("id > 0") }};
+		index=dbmodel.createIndex(attribs);
+		QVERIFY(table->getIndex(QString("idx_record"))==nullptr);
+		QVERIFY(index->getIndexAttribute(Index::UNIQUE));
+		QCOMPARE(index->getFillFactor(), 80u);
+		QCOMPARE(index->getPredicate(), QString("id > 0"));
+		index->addIndexElement(column, nullptr, nullptr, false, false, false);
+		table->addObject(index);
+
+		attribs={{ ParsersAttributes::NAME, QString("view_record") }, { ParsersAttributes::SCHEMA, QString("public") },
+						 { ParsersAttributes::MATERIALIZED, ParsersAttributes::_TRUE_ }};
+		view=dbmodel.createView(attribs);
+		QVERIFY(view->isMaterialized());
+		QVERIFY(!view->isRecursive());
+		delete(view);
+
+		attribs={{ ParsersAttributes::NAME, QString("type_record") }, { ParsersAttributes::SCHEMA, QString("public") },
+						 { ParsersAttributes::CONFIGURATION, ParsersAttributes::ENUM_TYPE }, { ParsersAttributes::ENUMERATIONS, QString("a,b,c") }};
+		type=dbmodel.createType(attribs);
+		QVERIFY(type->getConfiguration()==Type::ENUMERATION_TYPE);
+		QCOMPARE(type->getEnumerationCount(), 3u);
+		delete(type);
+
+		//References to objects that doesn't exist in the model are rejected
+		attribs={{ ParsersAttributes::NAME, QString("idx_invalid") }, { ParsersAttributes::TABLE, QString("public.tab_invalid") }};
+		QVERIFY_EXCEPTION_THROWN(dbmodel.createIndex(attribs), Exception);
+	}
+	catch (Exception &e)
+	{
+		out << e.getExceptionsText() << endl;
+		QCOMPARE(false, true);
+	}
+}
+
+void DatabaseModelTest::searchIndexFollowsChanges(void)
+{
+	DatabaseModel dbmodel;
+	ObjectSearchIndex search_idx;
+	QTextStream out(stdout);
+	Table *table=nullptr, *other_tab=nullptr;
+	Column *column=nullptr;
+	vector<BaseObject *> objs;
+
+	auto find_objs=[&](const QString &pattern, ObjectType obj_type) -> vector<BaseObject *> {
+		return(search_idx.getCandidates(pattern, { obj_type }, ParsersAttributes::NAME, false, false));
+	};
+
+	try
+	{
+		dbmodel.createSystemObjects(false);
+		search_idx.setModel(&dbmodel);
+		connect(&dbmodel, &DatabaseModel::s_objectAdded, [&](BaseObject *obj){ search_idx.addObject(obj); });
+		connect(&dbmodel, &DatabaseModel::s_objectRemoved, [&](BaseObject *obj){ search_idx.removeObject(obj); });
+		connect(&dbmodel, &DatabaseModel::s_objectRenamed, [&](BaseObject *obj){ search_idx.updateObject(obj); });
+
+		table=new Table;
+		table->setName(QString("tab_search"));
+		table->setSchema(dbmodel.getSchema(QString("public")));
+		column=new Column;
+		column->setName(QString("col_search"));
+		column->setType(PgSQLType(QString("integer")));
+		table->addObject(column);
+		dbmodel.addTable(table);
+
+		//The first query synchronizes the whole index, the next ones only apply the notified changes
+		objs=find_objs(QString("tab_search"), OBJ_TABLE);
+		QCOMPARE(objs.size(), static_cast<size_t>(1));
+		QCOMPARE(objs[0], dynamic_cast<BaseObject *>(table));
+
+		other_tab=new Table;
+		other_tab->setName(QString("tab_other"));
+		other_tab->setSchema(dbmodel.getSchema(QString("public")));
+		dbmodel.addTable(other_tab);
+		QCOMPARE(find_objs(QString("tab_other"), OBJ_TABLE).size(), static_cast<size_t>(1));
+
+		//The operations that rename objects notify the model which forwards the notification to the index
+		table->setName(QString("renamed_tab"));
+		dbmodel.notifyObjectRenamed(table);
+		QCOMPARE(find_objs(QString("tab_search"), OBJ_TABLE).empty(), true);
+		QCOMPARE(find_objs(QString("renamed_tab"), OBJ_TABLE).size(), static_cast<size_t>(1));
+
+		column->setName(QString("renamed_col"));
+		dbmodel.notifyObjectRenamed(column);
+		QCOMPARE(find_objs(QString("col_search"), OBJ_COLUMN).empty(), true);
+		QCOMPARE(find_objs(QString("renamed_col"), OBJ_COLUMN).size(), static_cast<size_t>(1));
+
+		//Children and objects removed are dropped from the index without being dereferenced
+		table->removeObject(column);
+		dbmodel.notifyObjectRenamed(table);
+		delete(column);
+		QCOMPARE(find_objs(QString("renamed_col"), OBJ_COLUMN).empty(), true);
+
+		dbmodel.removeTable(other_tab);
+		delete(other_tab);
+		QCOMPARE(find_objs(QString("tab_other"), OBJ_TABLE).empty(), true);
+	}
+	catch (Exception &e)
+	{
+		out << e.getExceptionsText() << endl;
+		QCOMPARE(false, true);
+	}
+}
+
 QTEST_MAIN(DatabaseModelTest)
 #include "databasemodeltest.moc"
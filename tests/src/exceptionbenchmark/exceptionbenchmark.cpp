@@ -0,0 +1,203 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "exception.h"
+
+/* Reproduces the error handling of a database import running with --ignore-errors: each object
+fails deep in the model (createObject -> create[Type] -> XML parsing), every level rethrows the
+error using the usual catch/rethrow pattern and the import stores the final chain to write the log
+at the end. A real import can't be used here since it depends on a running server. */
+class ExceptionBenchmark: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Amount of failing objects simulated by the import benchmarks
+		static const unsigned ERROR_COUNT=10000;
+
+		//! \brief Amount of methods that rethrow the error until it reaches the import helper
+		static const unsigned RETHROW_LEVELS=5;
+
+		//! \brief Throws an error at the deepest level and rethrows it in the levels above
+		void raiseError(unsigned level, unsigned obj_id, bool lazy_msg);
+
+		//! \brief Simulates the import of the failing objects storing the errors
+		vector<Exception> importObjects(bool lazy_msg);
+
+	private slots:
+		void chainIsPreserved(void);
+		void lazyMessageIsFormatted(void);
+		void rethrowKeepsMessage(void);
+		void importIgnoringErrors(void);
+		void importIgnoringErrorsLazyMessages(void);
+		void writeImportLog(void);
+};
+
+void ExceptionBenchmark::raiseError(unsigned level, unsigned obj_id, bool lazy_msg)
+{
+	try
+	{
+		if(level==0)
+		{
+			if(lazy_msg)
+				throw Exception(ERR_REF_OBJ_INEXISTS_MODEL,
+												{ QString("table_%1").arg(obj_id), QString("table"), QString("public.type_%1").arg(obj_id), QString("type") },
+												__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			else
+				throw Exception(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL)
+												.arg(QString("table_%1").arg(obj_id)).arg(QString("table"))
+												.arg(QString("public.type_%1").arg(obj_id)).arg(QString("type")),
+												ERR_REF_OBJ_INEXISTS_MODEL,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		}
+
+		raiseError(level - 1, obj_id, lazy_msg);
+	}
+	catch(Exception &e)
+	{
+		if(lazy_msg)
+			throw Exception(e,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		else
+			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+vector<Exception> ExceptionBenchmark::importObjects(bool lazy_msg)
+{
+	vector<Exception> errors;
+
+	for(unsigned obj_id=0; obj_id < ERROR_COUNT; obj_id++)
+	{
+		try
+		{
+			raiseError(RETHROW_LEVELS, obj_id, lazy_msg);
+		}
+		catch(Exception &e)
+		{
+			if(lazy_msg)
+				errors.push_back(Exception(e, __PRETTY_FUNCTION__,__FILE__,__LINE__, QString("oid: %1").arg(obj_id)));
+			else
+				errors.push_back(Exception(e.getErrorMessage(), e.getErrorType(), __PRETTY_FUNCTION__,__FILE__,__LINE__, &e, QString("oid: %1").arg(obj_id)));
+		}
+	}
+
+	return(errors);
+}
+
+void ExceptionBenchmark::chainIsPreserved(void)
+{
+	vector<Exception> list, errors;
+	Exception first(QString("first"), __PRETTY_FUNCTION__, __FILE__, __LINE__),
+			second(QString("second"), ERR_CUSTOM, __PRETTY_FUNCTION__, __FILE__, __LINE__, &first),
+			third(QString("third"), __PRETTY_FUNCTION__, __FILE__, __LINE__, &second);
+
+	third.getExceptionsList(list);
+	QCOMPARE(list.size(), static_cast<size_t>(3));
+	QCOMPARE(list[0].getErrorMessage(), QString("first"));
+	QCOMPARE(list[1].getErrorMessage(), QString("second"));
+	QCOMPARE(list[2].getErrorMessage(), QString("third"));
+
+	//The nested chain is kept intact in the exceptions used to build other ones
+	second.getExceptionsList(list);
+	QCOMPARE(list.size(), static_cast<size_t>(2));
+
+	//Exceptions created from a list keep the chains in the same order they appear in the list
+	errors.push_back(second);
+	errors.push_back(first);
+	Exception grouped(ERR_INVALIDATED_OBJECTS, __PRETTY_FUNCTION__, __FILE__, __LINE__, errors);
+
+	grouped.getExceptionsList(list);
+	QCOMPARE(list.size(), static_cast<size_t>(4));
+	QCOMPARE(list[0].getErrorMessage(), QString("first"));
+	QCOMPARE(list[1].getErrorMessage(), QString("second"));
+	QCOMPARE(list[2].getErrorMessage(), QString("first"));
+	QCOMPARE(list[3].getErrorType(), ERR_INVALIDATED_OBJECTS);
+	QCOMPARE(list[3].getMethod().isEmpty(), false);
+}
+
+void ExceptionBenchmark::lazyMessageIsFormatted(void)
+{
+	Exception lazy(ERR_REF_OBJ_INEXISTS_MODEL, { QString("a"), QString("b"), QString("c"), QString("d") }, __PRETTY_FUNCTION__, __FILE__, __LINE__),
+			eager(Exception::getErrorMessage(ERR_REF_OBJ_INEXISTS_MODEL).arg(QString("a")).arg(QString("b")).arg(QString("c")).arg(QString("d")),
+						ERR_REF_OBJ_INEXISTS_MODEL, __PRETTY_FUNCTION__, __FILE__, __LINE__),
+			no_args(ERR_INVALIDATED_OBJECTS, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	QCOMPARE(lazy.getErrorMessage(), eager.getErrorMessage());
+	QCOMPARE(no_args.getErrorMessage(), Exception::getErrorMessage(ERR_INVALIDATED_OBJECTS));
+}
+
+void ExceptionBenchmark::rethrowKeepsMessage(void)
+{
+	vector<Exception> list;
+	Exception lazy(ERR_REF_OBJ_INEXISTS_MODEL, { QString("a"), QString("b"), QString("c"), QString("d") }, __PRETTY_FUNCTION__, __FILE__, __LINE__),
+			custom(QString("custom"), __PRETTY_FUNCTION__, __FILE__, __LINE__),
+			rethrown(lazy, __PRETTY_FUNCTION__, __FILE__, __LINE__, QString("extra")),
+			rethrown_custom(custom, __PRETTY_FUNCTION__, __FILE__, __LINE__);
+
+	//The rethrown exception formats the same message of the original one and keeps it in the chain
+	QCOMPARE(rethrown.getErrorType(), ERR_REF_OBJ_INEXISTS_MODEL);
+	QCOMPARE(rethrown.getErrorMessage(), lazy.getErrorMessage());
+	QCOMPARE(rethrown.getExtraInfo(), QString("extra"));
+	QCOMPARE(rethrown_custom.getErrorMessage(), QString("custom"));
+
+	rethrown.getExceptionsList(list);
+	QCOMPARE(list.size(), static_cast<size_t>(2));
+	QCOMPARE(list[0].getErrorMessage(), list[1].getErrorMessage());
+}
+
+void ExceptionBenchmark::importIgnoringErrors(void)
+{
+	vector<Exception> errors;
+
+	QBENCHMARK
+	{
+		errors=importObjects(false);
+	}
+
+	QCOMPARE(errors.size(), static_cast<size_t>(ERROR_COUNT));
+}
+
+void ExceptionBenchmark::importIgnoringErrorsLazyMessages(void)
+{
+	vector<Exception> errors;
+
+	QBENCHMARK
+	{
+		errors=importObjects(true);
+	}
+
+	QCOMPARE(errors.size(), static_cast<size_t>(ERROR_COUNT));
+}
+
+void ExceptionBenchmark::writeImportLog(void)
+{
+	vector<Exception> errors=importObjects(true);
+	QString log;
+
+	QBENCHMARK
+	{
+		log.clear();
+
+		for(auto &error : errors)
+			log+=error.getExceptionsText();
+	}
+
+	QCOMPARE(log.isEmpty(), false);
+}
+
+QTEST_MAIN(ExceptionBenchmark)
+#include "exceptionbenchmark.moc"
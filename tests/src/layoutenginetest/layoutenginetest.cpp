@@ -0,0 +1,210 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+#include <QtTest/QtTest>
+#include "layoutengine.h"
+
+class LayoutEngineTest: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Creates a graph with a chain of tables, a small cycle and a few isolated tables
+		void createGraph(vector<QRectF> &rects, vector<pair<unsigned, unsigned>> &edges);
+
+		//! \brief Computes the layout synchronously and returns the positioned rectangles
+		vector<QRectF> computeLayout(unsigned algorithm, const vector<QRectF> &rects, const vector<pair<unsigned, unsigned>> &edges);
+
+		//! \brief Returns true when at least two of the provided rectangles overlap
+		bool hasOverlaps(const vector<QRectF> &rects);
+
+	private slots:
+		void layeredLayoutPlacesAllNodes(void);
+		void layeredLayoutHasNoOverlaps(void);
+		void layeredLayoutPlacesSourcesAbove(void);
+		void forceDirectedLayoutPlacesAllNodes(void);
+		void forceDirectedLayoutHasNoOverlaps(void);
+		void isolatedNodesArePlacedBelow(void);
+		void invalidEdgeRaisesError(void);
+};
+
+void LayoutEngineTest::createGraph(vector<QRectF> &rects, vector<pair<unsigned, unsigned>> &edges)
+{
+	rects.clear();
+	edges.clear();
+
+	//All the rectangles start at the same position so the engine must spread them
+	for(unsigned i=0; i < 20; i++)
+		rects.push_back(QRectF(0, 0, 120 + (i % 4) * 30, 80 + (i % 3) * 40));
+
+	//Chain 0 -> 1 -> ... -> 9
+	for(unsigned i=0; i < 9; i++)
+		edges.push_back({ i, i + 1 });
+
+	//Branches and a cycle 10 -> 11 -> 12 -> 10 attached to the chain
+	edges.push_back({ 2, 10 });
+	edges.push_back({ 10, 11 });
+	edges.push_back({ 11, 12 });
+	edges.push_back({ 12, 10 });
+	edges.push_back({ 5, 13 });
+	edges.push_back({ 13, 14 });
+
+	//Duplicated and self edges must be ignored
+	edges.push_back({ 0, 1 });
+	edges.push_back({ 14, 14 });
+
+	//Nodes 15 to 19 are isolated
+}
+
+vector<QRectF> LayoutEngineTest::computeLayout(unsigned algorithm, const vector<QRectF> &rects, const vector<pair<unsigned, unsigned>> &edges)
+{
+	LayoutEngine layout_eng;
+	vector<QPointF> positions;
+	vector<QRectF> result;
+
+	layout_eng.setGraph(rects, edges);
+	layout_eng.setAlgorithm(algorithm);
+	layout_eng.computeLayout();
+	positions=layout_eng.getPositions();
+
+	for(unsigned i=0; i < positions.size() && i < rects.size(); i++)
+		result.push_back(QRectF(positions[i], rects[i].size()));
+
+	return(result);
+}
+
+bool LayoutEngineTest::hasOverlaps(const vector<QRectF> &rects)
+{
+	for(unsigned i=0; i < rects.size(); i++)
+	{
+		for(unsigned j=i + 1; j < rects.size(); j++)
+		{
+			if(rects[i].intersects(rects[j]))
+				return(true);
+		}
+	}
+
+	return(false);
+}
+
+void LayoutEngineTest::layeredLayoutPlacesAllNodes(void)
+{
+	vector<QRectF> rects, result;
+	vector<pair<unsigned, unsigned>> edges;
+
+	createGraph(rects, edges);
+	result=computeLayout(LayoutEngine::LAYERED_LAYOUT, rects, edges);
+
+	QCOMPARE(result.size(), rects.size());
+
+	for(auto &rect : result)
+		QVERIFY(rect.left() >= 0 && rect.top() >= 0);
+}
+
+void LayoutEngineTest::layeredLayoutHasNoOverlaps(void)
+{
+	vector<QRectF> rects, result;
+	vector<pair<unsigned, unsigned>> edges;
+
+	createGraph(rects, edges);
+	result=computeLayout(LayoutEngine::LAYERED_LAYOUT, rects, edges);
+
+	QCOMPARE(hasOverlaps(result), false);
+}
+
+void LayoutEngineTest::layeredLayoutPlacesSourcesAbove(void)
+{
+	vector<QRectF> rects, result;
+	vector<pair<unsigned, unsigned>> edges;
+
+	createGraph(rects, edges);
+	result=computeLayout(LayoutEngine::LAYERED_LAYOUT, rects, edges);
+
+	//Edges outside the cycle keep their direction, so the source is always in an upper layer
+	for(unsigned i=0; i < 9; i++)
+		QVERIFY(result[i].bottom() < result[i + 1].top());
+
+	QVERIFY(result[2].bottom() < result[10].top());
+	QVERIFY(result[5].bottom() < result[13].top());
+	QVERIFY(result[13].bottom() < result[14].top());
+}
+
+void LayoutEngineTest::forceDirectedLayoutPlacesAllNodes(void)
+{
+	vector<QRectF> rects, result;
+	vector<pair<unsigned, unsigned>> edges;
+
+	createGraph(rects, edges);
+	result=computeLayout(LayoutEngine::FORCE_DIRECTED_LAYOUT, rects, edges);
+
+	QCOMPARE(result.size(), rects.size());
+
+	for(auto &rect : result)
+		QVERIFY(rect.left() >= 0 && rect.top() >= 0);
+}
+
+void LayoutEngineTest::forceDirectedLayoutHasNoOverlaps(void)
+{
+	vector<QRectF> rects, result;
+	vector<pair<unsigned, unsigned>> edges;
+
+	createGraph(rects, edges);
+	result=computeLayout(LayoutEngine::FORCE_DIRECTED_LAYOUT, rects, edges);
+
+	QCOMPARE(hasOverlaps(result), false);
+}
+
+void LayoutEngineTest::isolatedNodesArePlacedBelow(void)
+{
+	vector<QRectF> rects, result;
+	vector<pair<unsigned, unsigned>> edges;
+	QRectF connected_rect;
+
+	createGraph(rects, edges);
+
+	for(unsigned alg : { LayoutEngine::LAYERED_LAYOUT, LayoutEngine::FORCE_DIRECTED_LAYOUT })
+	{
+		result=computeLayout(alg, rects, edges);
+		connected_rect=QRectF();
+
+		for(unsigned i=0; i < 15; i++)
+			connected_rect=connected_rect.united(result[i]);
+
+		for(unsigned i=15; i < result.size(); i++)
+			QVERIFY(result[i].top() > connected_rect.bottom());
+	}
+}
+
+void LayoutEngineTest::invalidEdgeRaisesError(void)
+{
+	LayoutEngine layout_eng;
+	vector<QRectF> rects={ QRectF(0, 0, 100, 100), QRectF(0, 0, 100, 100) };
+	bool error=false;
+
+	try
+	{
+		layout_eng.setGraph(rects, { { 0, 2 } });
+	}
+	catch(Exception &)
+	{
+		error=true;
+	}
+
+	QCOMPARE(error, true);
+}
+
+QTEST_MAIN(LayoutEngineTest)
+#include "layoutenginetest.moc"
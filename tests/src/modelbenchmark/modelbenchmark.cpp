@@ -0,0 +1,460 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include "databasemodel.h"
+#include "modelsdiffhelper.h"
+#include "syntheticmodelgenerator.h"
+
+/* Measures the core model operations against synthetic models of different sizes (see SyntheticModelGenerator).
+Besides the usual QtTest output, the average/minimum time of each benchmark and dataset is written as JSON
+to the file in the PGMODELER_BENCHMARK_OUTPUT environment variable (defaults to modelbenchmark.json in the
+binaries directory) so the results of different revisions can be compared over time. */
+class ModelBenchmark: public QObject {
+	private:
+		Q_OBJECT
+
+		//! \brief Accumulates the time spent in each iteration of a QBENCHMARK block
+		struct Measurement {
+			qint64 total_ns, min_ns;
+			unsigned iterations;
+
+			Measurement(void)
+			{
+				total_ns=min_ns=0;
+				iterations=0;
+			}
+
+			void add(qint64 elapsed_ns)
+			{
+				total_ns+=elapsed_ns;
+				min_ns=(iterations==0 ? elapsed_ns : qMin(min_ns, elapsed_ns));
+				iterations++;
+			}
+		};
+
+		//! \brief Directory where the synthetic models and the saved models are written
+		QTemporaryDir tmp_dir;
+
+		//! \brief Parameters of each dataset, the variant (changed) model of each dataset is used by the diff benchmark
+		map<QString, SyntheticModelGenerator::Parameters> datasets;
+
+		//! \brief Models loaded by the benchmarks that don't change the model structure (created on demand)
+		map<QString, DatabaseModel *> loaded_models;
+
+		QJsonArray results;
+
+		QString getModelFile(const QString &dataset, bool variant=false);
+
+		//! \brief Returns the already loaded model of the dataset loading it if needed
+		DatabaseModel *getLoadedModel(const QString &dataset, bool variant=false);
+
+		//! \brief Adds the datasets as test data (used by all the *_data methods)
+		void addDatasets(void);
+
+		//! \brief Stores the measurement of the current test function and dataset in the JSON results
+		void recordResult(const Measurement &measure);
+
+	private slots:
+		void initTestCase(void);
+		void cleanupTestCase(void);
+
+		void loadModel_data(void);
+		void loadModel(void);
+
+		void saveModel_data(void);
+		void saveModel(void);
+
+		void generateSQL_data(void);
+		void generateSQL(void);
+
+		void validateRelationships_data(void);
+		void validateRelationships(void);
+
+		void getCreationOrder_data(void);
+		void getCreationOrder(void);
+
+		void diffModels_data(void);
+		void diffModels(void);
+
+		void findObjects_data(void);
+		void findObjects(void);
+};
+
+QString ModelBenchmark::getModelFile(const QString &dataset, bool variant)
+{
+	return(tmp_dir.path() + GlobalAttributes::DIR_SEPARATOR + dataset + (variant ? QString("_changed.dbm") : QString(".dbm")));
+}
+
+DatabaseModel *ModelBenchmark::getLoadedModel(const QString &dataset, bool variant)
+{
+	QString filename=getModelFile(dataset, variant);
+
+	if(loaded_models.count(filename)==0)
+	{
+		DatabaseModel *model=new DatabaseModel;
+
+		try
+		{
+			model->createSystemObjects(false);
+			model->loadModel(filename);
+			loaded_models[filename]=model;
+		}
+		catch(Exception &e)
+		{
+			delete(model);
+			throw Exception(e.getErrorMessage(),e.getErrorType(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+		}
+	}
+
+	return(loaded_models[filename]);
+}
+
+void ModelBenchmark::addDatasets(void)
+{
+	QTest::addColumn<QString>("dataset");
+
+	for(auto &itr : datasets)
+		QTest::newRow(itr.first.toStdString().c_str()) << itr.first;
+}
+
+void ModelBenchmark::recordResult(const Measurement &measure)
+{
+	QJsonObject result;
+	QString dataset=QTest::currentDataTag();
+	SyntheticModelGenerator::Parameters &params=datasets[dataset];
+
+	result[QString("benchmark")]=QString(QTest::currentTestFunction());
+	result[QString("dataset")]=dataset;
+	result[QString("tables")]=static_cast<int>(params.tables);
+	result[QString("columns")]=static_cast<int>(params.columns);
+	result[QString("foreign_keys")]=static_cast<int>(params.foreign_keys);
+	result[QString("inheritance_depth")]=static_cast<int>(params.inheritance_depth);
+	result[QString("functions")]=static_cast<int>(params.functions);
+	result[QString("views")]=static_cast<int>(params.views);
+	result[QString("iterations")]=static_cast<int>(measure.iterations);
+	result[QString("avg_msecs")]=(measure.iterations > 0 ? (measure.total_ns / static_cast<double>(measure.iterations)) / 1e6 : 0);
+	result[QString("min_msecs")]=measure.min_ns / 1e6;
+	results.append(result);
+}
+
+void ModelBenchmark::initTestCase(void)
+{
+	SyntheticModelGenerator::Parameters params, variant;
+	unsigned tables[]={ 50, 200, 500 };
+	QString names[]={ QString("small"), QString("medium"), QString("large") };
+
+	QVERIFY(tmp_dir.isValid());
+
+	try
+	{
+		for(unsigned i=0; i < 3; i++)
+		{
+			params.tables=tables[i];
+			params.functions=tables[i] / 2;
+			params.views=tables[i] / 5;
+			datasets[names[i]]=params;
+			SyntheticModelGenerator(params).saveModel(getModelFile(names[i]));
+
+			/* The variant has one extra column per table and some functions less, so the diff
+			generates ALTER TABLE for all tables and DROP for the missing functions */
+			variant=params;
+			variant.columns++;
+			variant.functions-=params.functions / 10;
+			SyntheticModelGenerator(variant).saveModel(getModelFile(names[i], true));
+		}
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::cleanupTestCase(void)
+{
+	QJsonObject report;
+	QString filename=qgetenv("PGMODELER_BENCHMARK_OUTPUT");
+	QFile output;
+
+	for(auto &itr : loaded_models)
+		delete(itr.second);
+
+	loaded_models.clear();
+
+	if(filename.isEmpty())
+		filename=QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DIR_SEPARATOR + QString("modelbenchmark.json");
+
+	report[QString("suite")]=QString("ModelBenchmark");
+	report[QString("pgmodeler_version")]=GlobalAttributes::PGMODELER_VERSION;
+	report[QString("timestamp")]=QDateTime::currentDateTimeUtc().toString(Qt::ISODate);
+	report[QString("results")]=results;
+
+	output.setFileName(filename);
+	output.open(QFile::WriteOnly | QFile::Truncate);
+	QVERIFY2(output.isOpen(), filename.toStdString().c_str());
+	output.write(QJsonDocument(report).toJson());
+	output.close();
+}
+
+void ModelBenchmark::loadModel_data(void)
+{
+	addDatasets();
+}
+
+void ModelBenchmark::loadModel(void)
+{
+	QFETCH(QString, dataset);
+	QString filename=getModelFile(dataset);
+	DatabaseModel *model=nullptr;
+	QElapsedTimer timer;
+	Measurement measure;
+	unsigned tab_count=0;
+
+	try
+	{
+		QBENCHMARK
+		{
+			model=new DatabaseModel;
+			timer.start();
+			model->createSystemObjects(false);
+			model->loadModel(filename);
+			measure.add(timer.nsecsElapsed());
+			tab_count=model->getObjectCount(OBJ_TABLE);
+			delete(model);
+			model=nullptr;
+		}
+
+		QCOMPARE(tab_count, datasets[dataset].tables);
+		recordResult(measure);
+	}
+	catch(Exception &e)
+	{
+		if(model) delete(model);
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::saveModel_data(void)
+{
+	addDatasets();
+}
+
+void ModelBenchmark::saveModel(void)
+{
+	QFETCH(QString, dataset);
+	QString output=tmp_dir.path() + GlobalAttributes::DIR_SEPARATOR + dataset + QString("_saved.dbm");
+	QElapsedTimer timer;
+	Measurement measure;
+
+	try
+	{
+		DatabaseModel *model=getLoadedModel(dataset);
+
+		QBENCHMARK
+		{
+			timer.start();
+			model->saveModel(output, SchemaParser::XML_DEFINITION);
+			measure.add(timer.nsecsElapsed());
+		}
+
+		QCOMPARE(QFileInfo(output).size() > 0, true);
+		recordResult(measure);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::generateSQL_data(void)
+{
+	addDatasets();
+}
+
+void ModelBenchmark::generateSQL(void)
+{
+	QFETCH(QString, dataset);
+	QElapsedTimer timer;
+	Measurement measure;
+	QString sql;
+
+	try
+	{
+		DatabaseModel *model=getLoadedModel(dataset);
+
+		QBENCHMARK
+		{
+			timer.start();
+			sql=model->getCodeDefinition(SchemaParser::SQL_DEFINITION);
+			measure.add(timer.nsecsElapsed());
+		}
+
+		QCOMPARE(sql.isEmpty(), false);
+		recordResult(measure);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::validateRelationships_data(void)
+{
+	addDatasets();
+}
+
+void ModelBenchmark::validateRelationships(void)
+{
+	QFETCH(QString, dataset);
+	QElapsedTimer timer;
+	Measurement measure;
+
+	try
+	{
+		DatabaseModel *model=getLoadedModel(dataset);
+
+		QBENCHMARK
+		{
+			timer.start();
+			model->validateRelationships();
+			measure.add(timer.nsecsElapsed());
+		}
+
+		//The revalidation must not create or lose any relationship
+		QCOMPARE(model->getObjectCount(OBJ_TABLE), datasets[dataset].tables);
+		recordResult(measure);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::getCreationOrder_data(void)
+{
+	addDatasets();
+}
+
+void ModelBenchmark::getCreationOrder(void)
+{
+	QFETCH(QString, dataset);
+	QElapsedTimer timer;
+	Measurement measure;
+	map<unsigned, BaseObject *> objects;
+
+	try
+	{
+		DatabaseModel *model=getLoadedModel(dataset);
+
+		QBENCHMARK
+		{
+			timer.start();
+			objects=model->getCreationOrder(SchemaParser::SQL_DEFINITION);
+			measure.add(timer.nsecsElapsed());
+		}
+
+		QCOMPARE(objects.empty(), false);
+		recordResult(measure);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::diffModels_data(void)
+{
+	addDatasets();
+}
+
+void ModelBenchmark::diffModels(void)
+{
+	QFETCH(QString, dataset);
+	QElapsedTimer timer;
+	Measurement measure;
+	QString diff_def, error;
+
+	try
+	{
+		DatabaseModel *src_model=getLoadedModel(dataset, true),
+				*imp_model=getLoadedModel(dataset);
+
+		QBENCHMARK
+		{
+			ModelsDiffHelper diff_helper;
+
+			connect(&diff_helper, &ModelsDiffHelper::s_diffAborted, [&error](Exception e){
+				error=e.getExceptionsText();
+			});
+
+			diff_helper.setModels(src_model, imp_model);
+
+			timer.start();
+			diff_helper.diffModels();
+			diff_def=diff_helper.getDiffDefinition();
+			measure.add(timer.nsecsElapsed());
+		}
+
+		QVERIFY2(error.isEmpty(), error.toStdString().c_str());
+		QCOMPARE(diff_def.isEmpty(), false);
+		recordResult(measure);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void ModelBenchmark::findObjects_data(void)
+{
+	addDatasets();
+}
+
+void ModelBenchmark::findObjects(void)
+{
+	QFETCH(QString, dataset);
+	QElapsedTimer timer;
+	Measurement measure;
+	vector<BaseObject *> objects;
+
+	try
+	{
+		DatabaseModel *model=getLoadedModel(dataset);
+
+		QBENCHMARK
+		{
+			timer.start();
+			objects=model->findObjects(QString("col_1"), { OBJ_TABLE, OBJ_COLUMN, OBJ_CONSTRAINT, OBJ_VIEW, OBJ_FUNCTION },
+																 false, false, false, false);
+			measure.add(timer.nsecsElapsed());
+		}
+
+		QCOMPARE(objects.empty(), false);
+		recordResult(measure);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(ModelBenchmark)
+#include "modelbenchmark.moc"
@@ -0,0 +1,4 @@
+include(../../tests.pri)
+HEADERS += syntheticmodelgenerator.h
+SOURCES += modelbenchmark.cpp \
+           syntheticmodelgenerator.cpp
@@ -0,0 +1,191 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "syntheticmodelgenerator.h"
+#include "exception.h"
+#include "globalattributes.h"
+#include <QFile>
+
+SyntheticModelGenerator::SyntheticModelGenerator(const Parameters &params)
+{
+	this->params=params;
+}
+
+QString SyntheticModelGenerator::getTableName(unsigned tab_idx)
+{
+	return(QString("table_%1").arg(tab_idx));
+}
+
+QString SyntheticModelGenerator::getColumnType(unsigned col_idx)
+{
+	static const QString types[]={ QString("<type name=\"integer\" length=\"0\"/>"),
+																 QString("<type name=\"varchar\" length=\"64\"/>"),
+																 QString("<type name=\"timestamp\" length=\"0\"/>"),
+																 QString("<type name=\"numeric\" length=\"12\" precision=\"2\"/>"),
+																 QString("<type name=\"text\" length=\"0\"/>") };
+
+	return(types[col_idx % 5]);
+}
+
+unsigned SyntheticModelGenerator::getReferencedTable(unsigned tab_idx, unsigned fk_idx)
+{
+	//Spreads the references over the tables created before the current one (deterministically)
+	return(((tab_idx * 31) + (fk_idx * 17)) % tab_idx);
+}
+
+bool SyntheticModelGenerator::hasAncestor(unsigned tab_idx)
+{
+	return(params.inheritance_depth > 0 && (tab_idx % (params.inheritance_depth + 1)) != 0);
+}
+
+QString SyntheticModelGenerator::generateTable(unsigned tab_idx)
+{
+	QString code, tab_name=getTableName(tab_idx);
+	unsigned col;
+
+	code+=QString("<table name=\"%1\">\n").arg(tab_name);
+	code+=QString("\t<schema name=\"public\"/>\n");
+	code+=QString("\t<position x=\"%1\" y=\"%2\"/>\n").arg((tab_idx % 20) * 300).arg((tab_idx / 20) * 400);
+
+	/* The columns are prefixed with the table index so the columns inherited from
+	ancestor tables never conflict with the ones of the descendant tables */
+	code+=QString("\t<column name=\"id_%1\" not-null=\"true\">\n\t\t<type name=\"integer\" length=\"0\"/>\n\t</column>\n").arg(tab_idx);
+
+	for(col=0; col < params.columns; col++)
+		code+=QString("\t<column name=\"t%1_col_%2\">\n\t\t%3\n\t</column>\n").arg(tab_idx).arg(col).arg(getColumnType(col));
+
+	for(col=0; tab_idx > 0 && col < params.foreign_keys; col++)
+		code+=QString("\t<column name=\"t%1_ref_%2\">\n\t\t<type name=\"integer\" length=\"0\"/>\n\t</column>\n").arg(tab_idx).arg(col);
+
+	code+=QString("\t<constraint name=\"%1_pk\" type=\"pk-constr\" table=\"public.%1\">\n").arg(tab_name);
+	code+=QString("\t\t<columns names=\"id_%1\" ref-type=\"src-columns\"/>\n\t</constraint>\n").arg(tab_idx);
+	code+=QString("</table>\n\n");
+
+	return(code);
+}
+
+QString SyntheticModelGenerator::generateInheritance(unsigned tab_idx)
+{
+	QString tab_name=getTableName(tab_idx), parent_name=getTableName(tab_idx - 1);
+
+	return(QString("<relationship name=\"%1_inherits_%2\" type=\"relgen\"\n"
+								 "\t pk-pattern=\"{dt}_pk\"\n"
+								 "\t src-table=\"public.%1\"\n"
+								 "\t dst-table=\"public.%2\"/>\n\n").arg(tab_name).arg(parent_name));
+}
+
+QString SyntheticModelGenerator::generateForeignKeys(unsigned tab_idx)
+{
+	QString code, tab_name=getTableName(tab_idx);
+	unsigned ref_idx;
+
+	for(unsigned fk=0; tab_idx > 0 && fk < params.foreign_keys; fk++)
+	{
+		ref_idx=getReferencedTable(tab_idx, fk);
+		code+=QString("<constraint name=\"%1_fk_%2\" type=\"fk-constr\" comparison-type=\"MATCH SIMPLE\"\n"
+									"\t upd-action=\"NO ACTION\" del-action=\"NO ACTION\" ref-table=\"public.%3\" table=\"public.%1\">\n"
+									"\t<columns names=\"t%4_ref_%2\" ref-type=\"src-columns\"/>\n"
+									"\t<columns names=\"id_%5\" ref-type=\"dst-columns\"/>\n"
+									"</constraint>\n\n")
+					.arg(tab_name).arg(fk).arg(getTableName(ref_idx)).arg(tab_idx).arg(ref_idx);
+	}
+
+	return(code);
+}
+
+QString SyntheticModelGenerator::generateFunction(unsigned func_idx)
+{
+	return(QString("<function name=\"func_%1\"\n"
+								 "\t\twindow-func=\"false\"\n"
+								 "\t\treturns-setof=\"false\"\n"
+								 "\t\tbehavior-type=\"CALLED ON NULL INPUT\"\n"
+								 "\t\tfunction-type=\"IMMUTABLE\"\n"
+								 "\t\tsecurity-type=\"SECURITY INVOKER\"\n"
+								 "\t\texecution-cost=\"100\"\n"
+								 "\t\trow-amount=\"0\">\n"
+								 "\t<schema name=\"public\"/>\n"
+								 "\t<language name=\"sql\" sql-disabled=\"true\"/>\n"
+								 "\t<return-type>\n\t<type name=\"integer\" length=\"0\"/>\n\t</return-type>\n"
+								 "\t<parameter name=\"value\">\n\t\t<type name=\"integer\" length=\"0\"/>\n\t</parameter>\n"
+								 "\t<definition><![CDATA[SELECT $1 + %1;]]></definition>\n"
+								 "</function>\n\n").arg(func_idx));
+}
+
+QString SyntheticModelGenerator::generateView(unsigned view_idx)
+{
+	unsigned tab_idx=(view_idx * 7) % params.tables;
+
+	return(QString("<view name=\"view_%1\">\n"
+								 "\t<schema name=\"public\"/>\n"
+								 "\t<position x=\"%2\" y=\"-400\"/>\n"
+								 "\t<reference table=\"public.%3\" alias=\"t\"/>\n"
+								 "\t<expression type=\"select-exp\">0</expression>\n"
+								 "\t<expression type=\"from-exp\">0</expression>\n"
+								 "</view>\n\n"
+								 "<relationship name=\"rel_view_%1_%3\" type=\"reltv\"\n"
+								 "\t src-table=\"public.view_%1\"\n"
+								 "\t dst-table=\"public.%3\"\n"
+								 "\t src-required=\"false\" dst-required=\"false\"/>\n\n")
+				 .arg(view_idx).arg(view_idx * 300).arg(getTableName(tab_idx)));
+}
+
+QString SyntheticModelGenerator::generateModel(const QString &db_name)
+{
+	QString code;
+	unsigned idx;
+
+	code+=QString("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+	code+=QString("<dbmodel pgmodeler-ver=\"%1\">\n").arg(GlobalAttributes::PGMODELER_VERSION);
+	code+=QString("<database name=\"%1\" encoding=\"UTF8\">\n</database>\n\n").arg(db_name);
+	code+=QString("<schema name=\"public\" protected=\"true\" fill-color=\"#e1e1e1\" sql-disabled=\"true\">\n</schema>\n\n");
+
+	for(idx=0; idx < params.tables; idx++)
+		code+=generateTable(idx);
+
+	for(idx=0; idx < params.functions; idx++)
+		code+=generateFunction(idx);
+
+	for(idx=0; params.tables > 0 && idx < params.views; idx++)
+		code+=generateView(idx);
+
+	for(idx=0; idx < params.tables; idx++)
+	{
+		if(hasAncestor(idx))
+			code+=generateInheritance(idx);
+	}
+
+	for(idx=0; idx < params.tables; idx++)
+		code+=generateForeignKeys(idx);
+
+	code+=QString("</dbmodel>\n");
+	return(code);
+}
+
+void SyntheticModelGenerator::saveModel(const QString &filename, const QString &db_name)
+{
+	QFile output(filename);
+
+	output.open(QFile::WriteOnly | QFile::Truncate);
+
+	if(!output.isOpen())
+		throw Exception(Exception::getErrorMessage(ERR_FILE_DIR_NOT_WRITTEN).arg(filename),
+										ERR_FILE_DIR_NOT_WRITTEN,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	output.write(generateModel(db_name).toUtf8());
+	output.close();
+}
@@ -0,0 +1,83 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\class SyntheticModelGenerator
+\brief Generates the XML code of database models with a configurable amount of tables, columns, foreign keys,
+inheritance levels, functions and views so the model operations can be measured against models of different
+sizes without depending on large sample files. The output is deterministic for the same parameters.
+*/
+
+#ifndef SYNTHETIC_MODEL_GENERATOR_H
+#define SYNTHETIC_MODEL_GENERATOR_H
+
+#include <QString>
+
+class SyntheticModelGenerator {
+	public:
+		//! \brief Configures the amount of objects created in the generated model
+		struct Parameters {
+			//! \brief Amount of tables and the amount of columns created in each table (apart from the primary key column)
+			unsigned tables, columns,
+
+			//! \brief Amount of foreign keys in each table. Each foreign key references one of the tables created before
+			foreign_keys,
+
+			/*! \brief Length of the inheritance chains. Zero disables inheritance, otherwise each group of (depth + 1)
+			tables forms a chain where each table inherits the previous one */
+			inheritance_depth,
+
+			//! \brief Amount of SQL functions and views (each view references one table)
+			functions, views;
+
+			Parameters(void)
+			{
+				tables=50;
+				columns=10;
+				foreign_keys=2;
+				inheritance_depth=2;
+				functions=20;
+				views=10;
+			}
+		};
+
+	private:
+		Parameters params;
+
+		QString getTableName(unsigned tab_idx);
+		QString getColumnType(unsigned col_idx);
+		unsigned getReferencedTable(unsigned tab_idx, unsigned fk_idx);
+		bool hasAncestor(unsigned tab_idx);
+
+		QString generateTable(unsigned tab_idx);
+		QString generateInheritance(unsigned tab_idx);
+		QString generateForeignKeys(unsigned tab_idx);
+		QString generateFunction(unsigned func_idx);
+		QString generateView(unsigned view_idx);
+
+	public:
+		SyntheticModelGenerator(const Parameters &params);
+
+		//! \brief Returns the XML code of the model (the same format of .dbm files)
+		QString generateModel(const QString &db_name=QString("synthetic_db"));
+
+		//! \brief Writes the XML code of the model to the file raising an error if the file can't be written
+		void saveModel(const QString &filename, const QString &db_name=QString("synthetic_db"));
+};
+
+#endif
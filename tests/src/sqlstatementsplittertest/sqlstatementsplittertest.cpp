@@ -0,0 +1,185 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2018 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "sqlstatementsplitter.h"
+
+class SQLStatementSplitterTest: public QObject {
+	private:
+		Q_OBJECT
+
+	private slots:
+		void ignoresTerminatorsInQuotesAndComments(void);
+		void handlesDollarQuotedBodies(void);
+		void handlesCopyDataBlocks(void);
+		void classifiesStatements(void);
+		void extractsCommentedDrops(void);
+		void detectsTransactionCommands(void);
+};
+
+void SQLStatementSplitterTest::ignoresTerminatorsInQuotesAndComments(void)
+{
+	QString buffer=QString("-- header; comment\n"
+												 "INSERT INTO t VALUES ('a;b', E'c\\';d', \"e;f\");\n"
+												 "/* block /* nested; */ comment; */\n"
+												 "CREATE RULE r AS ON INSERT TO t DO ALSO (DELETE FROM a; DELETE FROM b);\n"
+												 ";;\n"
+												 "SELECT 1");
+	SQLStatementSplitter splitter(buffer);
+	vector<SQLStatementSplitter::Statement> stmts=SQLStatementSplitter::split(buffer);
+
+	QCOMPARE(stmts.size(), static_cast<size_t>(3));
+	QCOMPARE(splitter.getStatement(stmts[0]), QString("INSERT INTO t VALUES ('a;b', E'c\\';d', \"e;f\");"));
+	QCOMPARE(splitter.getStatement(stmts[1]), QString("CREATE RULE r AS ON INSERT TO t DO ALSO (DELETE FROM a; DELETE FROM b);"));
+	QCOMPARE(splitter.getStatement(stmts[2]), QString("SELECT 1"));
+}
+
+void SQLStatementSplitterTest::handlesDollarQuotedBodies(void)
+{
+	QString buffer=QString("CREATE FUNCTION public.f(a integer) RETURNS integer AS $body$\n"
+												 "BEGIN RETURN $1; END; $$ still inside $$;\n"
+												 "$body$ LANGUAGE plpgsql;\n"
+												 "SELECT $$a;b$$;");
+	SQLStatementSplitter splitter(buffer);
+	vector<SQLStatementSplitter::Statement> stmts=SQLStatementSplitter::split(buffer);
+
+	QCOMPARE(stmts.size(), static_cast<size_t>(2));
+	QCOMPARE(splitter.getStatement(stmts[0]).endsWith(QString("LANGUAGE plpgsql;")), true);
+	QCOMPARE(stmts[0].obj_type, OBJ_FUNCTION);
+	QCOMPARE(stmts[0].obj_name, QString("public.f(a integer)"));
+	QCOMPARE(splitter.getStatement(stmts[1]), QString("SELECT $$a;b$$;"));
+}
+
+void SQLStatementSplitterTest::handlesCopyDataBlocks(void)
+{
+	QString buffer=QString("COPY t (a, b) FROM stdin;\n"
+												 "1\tx;y\n"
+												 "2\tz\n"
+												 "\\.\n"
+												 "SELECT 1;");
+	vector<SQLStatementSplitter::Statement> stmts=SQLStatementSplitter::split(buffer);
+
+	QCOMPARE(stmts.size(), static_cast<size_t>(2));
+	QCOMPARE(stmts[0].has_copy_data, true);
+	QCOMPARE(buffer.mid(stmts[0].start, stmts[0].length).endsWith(QString("\\.\n")), true);
+	QCOMPARE(buffer.mid(stmts[1].start, stmts[1].length), QString("SELECT 1;"));
+}
+
+void SQLStatementSplitterTest::classifiesStatements(void)
+{
+	QString buffer=QString("CREATE UNLOGGED TABLE IF NOT EXISTS \"MySchema\".\"Table\" (id integer);\n"
+												 "CREATE OPERATOR CLASS public.opc FOR TYPE integer USING btree AS OPERATOR 1 <;\n"
+												 "ALTER TABLE public.t ADD CONSTRAINT t_pk PRIMARY KEY (id);\n"
+												 "DROP MATERIALIZED VIEW IF EXISTS public.v CASCADE;\n"
+												 "CREATE CAST (integer AS text) WITH INOUT;\n"
+												 "ALTER DATABASE db OWNER TO postgres;\n"
+												 "GRANT ALL ON TABLE public.t TO postgres;");
+	vector<SQLStatementSplitter::Statement> stmts=SQLStatementSplitter::split(buffer);
+
+	QCOMPARE(stmts.size(), static_cast<size_t>(7));
+
+	QCOMPARE(stmts[0].cmd_type == SQLStatementSplitter::CMD_CREATE, true);
+	QCOMPARE(stmts[0].obj_type, OBJ_TABLE);
+	QCOMPARE(stmts[0].obj_name, QString("MySchema.Table"));
+
+	QCOMPARE(stmts[1].obj_type, OBJ_OPCLASS);
+	QCOMPARE(stmts[1].obj_name, QString("public.opc"));
+
+	QCOMPARE(stmts[2].cmd_type == SQLStatementSplitter::CMD_CREATE, true);
+	QCOMPARE(stmts[2].obj_type, OBJ_CONSTRAINT);
+	QCOMPARE(stmts[2].obj_name, QString("public.t.t_pk"));
+
+	QCOMPARE(stmts[3].cmd_type == SQLStatementSplitter::CMD_DROP, true);
+	QCOMPARE(stmts[3].obj_type, OBJ_VIEW);
+	QCOMPARE(stmts[3].obj_name, QString("public.v"));
+
+	QCOMPARE(stmts[4].obj_type, OBJ_CAST);
+	QCOMPARE(stmts[4].obj_name, QString("cast(integer,text)"));
+
+	QCOMPARE(stmts[5].cmd_type == SQLStatementSplitter::CMD_ALTER, true);
+	QCOMPARE(stmts[5].obj_type, OBJ_DATABASE);
+
+	QCOMPARE(stmts[6].cmd_type == SQLStatementSplitter::CMD_OTHER, true);
+	QCOMPARE(stmts[6].obj_type, BASE_OBJECT);
+}
+
+void SQLStatementSplitterTest::extractsCommentedDrops(void)
+{
+	QString buffer=QString("-- DROP TABLE IF EXISTS public.a CASCADE;\n"
+												 "CREATE TABLE public.a (id integer);\n"
+												 "-- ddl-end --\n"
+												 "-- -- DROP TABLE IF EXISTS public.b CASCADE;\n"
+												 "-- ALTER TABLE public.a DROP CONSTRAINT IF EXISTS a_pk CASCADE;\n");
+	vector<SQLStatementSplitter::Statement> stmts;
+
+	QCOMPARE(SQLStatementSplitter::split(buffer).size(), static_cast<size_t>(1));
+
+	stmts=SQLStatementSplitter::split(buffer, true);
+	QCOMPARE(stmts.size(), static_cast<size_t>(3));
+
+	QCOMPARE(stmts[0].commented, true);
+	QCOMPARE(stmts[0].cmd_type == SQLStatementSplitter::CMD_DROP, true);
+	QCOMPARE(buffer.mid(stmts[0].start, stmts[0].length), QString("DROP TABLE IF EXISTS public.a CASCADE;"));
+
+	QCOMPARE(stmts[1].commented, false);
+	QCOMPARE(stmts[1].obj_type, OBJ_TABLE);
+
+	QCOMPARE(stmts[2].commented, true);
+	QCOMPARE(stmts[2].cmd_type == SQLStatementSplitter::CMD_DROP, true);
+	QCOMPARE(stmts[2].obj_type, OBJ_CONSTRAINT);
+	QCOMPARE(stmts[2].obj_name, QString("public.a.a_pk"));
+}
+
+void SQLStatementSplitterTest::detectsTransactionCommands(void)
+{
+	QString buffer=QString("BEGIN;\n"
+												 "START TRANSACTION;\n"
+												 "SAVEPOINT sp;\n"
+												 "PREPARE TRANSACTION 'tx';\n"
+												 "VACUUM ANALYZE public.t;\n"
+												 "CREATE INDEX CONCURRENTLY idx ON public.t (id);\n"
+												 "DROP DATABASE IF EXISTS db;\n"
+												 "ALTER SYSTEM SET work_mem = '8MB';\n"
+												 "ALTER DATABASE db OWNER TO postgres;\n"
+												 "CREATE INDEX idx2 ON public.t (id);\n"
+												 "PREPARE stmt AS SELECT 1;");
+	vector<SQLStatementSplitter::Statement> stmts=SQLStatementSplitter::split(buffer);
+
+	QCOMPARE(stmts.size(), static_cast<size_t>(11));
+
+	for(unsigned i=0; i < 4; i++)
+	{
+		QCOMPARE(stmts[i].tx_control, true);
+		QCOMPARE(stmts[i].no_tx_block, false);
+	}
+
+	for(unsigned i=4; i < 8; i++)
+	{
+		QCOMPARE(stmts[i].tx_control, false);
+		QCOMPARE(stmts[i].no_tx_block, true);
+	}
+
+	for(unsigned i=8; i < 11; i++)
+	{
+		QCOMPARE(stmts[i].tx_control, false);
+		QCOMPARE(stmts[i].no_tx_block, false);
+	}
+}
+
+QTEST_MAIN(SQLStatementSplitterTest)
+#include "sqlstatementsplittertest.moc"
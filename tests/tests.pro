@@ -14,4 +14,9 @@ src/syntaxhighlightertest \
 src/databasemodeltest \
 src/schemaparsertest \
 src/linenumberstest \
+src/attribsmapbenchmark \
+src/sqlstatementsplittertest \
+src/exceptionbenchmark \
+src/modelbenchmark \
+src/layoutenginetest \
 